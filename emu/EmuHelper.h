@@ -2,6 +2,8 @@
 #define __EMUHELPER_H__
 
 #include <stddef.h>	// for NULL
+#include <stdlib.h>	// for malloc/realloc/free
+#include <string.h>	// for memcpy
 #include "../stdtype.h"
 #include "../common_def.h"	// for INLINE
 #include "EmuStructs.h"
@@ -85,4 +87,47 @@ INLINE UINT32 pow2_mask(UINT32 v)
 	return v;
 }
 
+
+// sample ROM helpers for devices that support DEVRW_ATTACH
+// romOwned: 1 = ROM was allocated by the device, 0 = ROM is attached and owned by the caller
+INLINE void* rom_attach(void* rom, UINT8* romOwned, const UINT8* data)
+{
+	if (*romOwned)
+		free(rom);
+	*romOwned = 0;
+	return (void*)data;
+}
+
+INLINE void* rom_realloc(void* rom, UINT8* romOwned, UINT32 size)
+{
+	if (! *romOwned)
+		rom = NULL;	// never resize attached data
+	*romOwned = 1;
+	return realloc(rom, size);
+}
+
+// make a private copy of attached ROM data before writing to it
+// returns NULL (and leaves the attached data untouched) when the copy can't be allocated
+INLINE void* rom_unshare(void* rom, UINT8* romOwned, UINT32 size)
+{
+	void* copy;
+	
+	if (*romOwned)
+		return rom;
+	copy = malloc(size);
+	if (copy == NULL)
+		return NULL;
+	if (size)
+		memcpy(copy, rom, size);
+	*romOwned = 1;
+	return copy;
+}
+
+INLINE void rom_free(void* rom, UINT8 romOwned)
+{
+	if (romOwned)
+		free(rom);
+	return;
+}
+
 #endif	// __EMUHELPER_H__
@@ -54,6 +54,7 @@ typedef void (*DEVFUNC_WRITE_A16D8)(void* info, UINT16 addr, UINT8 data);
 typedef void (*DEVFUNC_WRITE_A16D16)(void* info, UINT16 addr, UINT16 data);
 typedef void (*DEVFUNC_WRITE_MEMSIZE)(void* info, UINT32 memsize);
 typedef void (*DEVFUNC_WRITE_BLOCK)(void* info, UINT32 offset, UINT32 length, const UINT8* data);
+typedef void (*DEVFUNC_ATTACH_BLOCK)(void* info, UINT32 length, const UINT8* data);
 typedef void (*DEVFUNC_WRITE_CLOCK)(void* info, UINT32 clock);
 typedef void (*DEVFUNC_WRITE_VOLUME)(void* info, INT32 volume);	// 16.16 fixed point
 typedef void (*DEVFUNC_WRITE_VOL_LR)(void* info, INT32 volL, INT32 volR);
@@ -79,6 +80,10 @@ typedef void (*DEVFUNC_WRITE_VOL_LR)(void* info, INT32 volL, INT32 volR);
 #define DEVRW_A16D16	0x22	// 16-bit address, 16-bit data
 #define DEVRW_BLOCK		0x80	// write sample ROM/RAM
 #define DEVRW_MEMSIZE	0x81	// set ROM/RAM size
+#define DEVRW_ATTACH	0x82	// attach sample ROM without copying it (see note below)
+// Note: DEVRW_ATTACH makes the device reference the caller's data directly. (data == NULL detaches it)
+//       The data must stay valid and unchanged until the device is stopped or another ROM is attached.
+//       DEVRW_MEMSIZE/DEVRW_BLOCK calls afterwards make the device use its own copy again.
 // chip setting DEVRW constants
 #define DEVRW_VALUE		0x00
 #define DEVRW_ALL		0x01
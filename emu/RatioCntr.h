@@ -41,6 +41,25 @@ INLINE void RC_STEPS(RATIO_CNTR* rc, UINT32 step)
 	rc->val += rc->inc * step;
 }
 
+// number of steps that can be done while the integer part stays below 'val', limited to 'maxSteps'
+INLINE UINT32 RC_STEPS_BELOW(const RATIO_CNTR* rc, UINT32 val, UINT32 maxSteps)
+{
+	UINT64 limit;
+	UINT64 steps;
+
+#if LOW_PRECISION_RATIOCNTR
+	if (val >= (1U << (32 - RC_SHIFT)))
+		val = (1U << (32 - RC_SHIFT)) - 1;	// keep the integer part within the counter's range
+#endif
+	limit = (UINT64)val << RC_SHIFT;
+	if (limit <= rc->val)
+		return 0;
+	if (! rc->inc)
+		return maxSteps;
+	steps = (limit - rc->val - 1) / rc->inc;
+	return (steps < maxSteps) ? (UINT32)steps : maxSteps;
+}
+
 INLINE UINT32 RC_GET_VAL(const RATIO_CNTR* rc)
 {
 	return (UINT32)(rc->val >> RC_SHIFT);
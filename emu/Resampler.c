@@ -6,6 +6,7 @@
 
 #include "../stdtype.h"
 #include "EmuStructs.h"
+#include "SoundEmu.h"
 #include "Resampler.h"
 
 static void Resmpl_Exec_Old(RESMPL_STATE* CAA, UINT32 length, WAVE_32BS* retSample);
@@ -32,7 +33,12 @@ static void Resmpl_EnsureBuffers(RESMPL_STATE* CAA, UINT32 length)
 
 void Resmpl_DevConnect(RESMPL_STATE* CAA, const DEV_INFO* devInf)
 {
+	DEVFUNC_READ_SRATE readSRate;
+	
 	CAA->smpRateSrc = devInf->sampleRate;
+	// option bits may have changed the sample rate since the device was started
+	if (! SndEmu_GetDeviceFunc(devInf->devDef, RWF_SRATE | RWF_READ, DEVRW_VALUE, 0, (void**)&readSRate))
+		CAA->smpRateSrc = readSRate(devInf->dataPtr);
 	CAA->StreamUpdate = devInf->devDef->Update;
 	CAA->su_DataPtr = devInf->dataPtr;
 	if (devInf->devDef->SetSRateChgCB != NULL)
@@ -0,0 +1,59 @@
+/*
+	blep.c - band-limited step synthesis buffer
+	Level changes are stored as windowed-sinc impulses with sub-sample precision.
+	Integrating the buffer turns them into band-limited steps.
+*/
+
+#include <string.h>	// for memset()/memmove()
+
+#include "../stdtype.h"
+#include "snddef.h"
+#include "blep.h"
+
+#include "blep_tables.h"
+
+
+void Blep_Init(BLEP_BUF* bb)
+{
+	Blep_Reset(bb);
+
+	return;
+}
+
+void Blep_Reset(BLEP_BUF* bb)
+{
+	bb->level[0] = bb->level[1] = 0;
+	bb->integ[0] = bb->integ[1] = 0;
+	memset(bb->buf, 0x00, sizeof(bb->buf));
+
+	return;
+}
+
+void Blep_Render(BLEP_BUF* bb, UINT32 samples, DEV_SMPL* outL, DEV_SMPL* outR)
+{
+	DEV_SMPL* outputs[2];
+	UINT8 curChn;
+	UINT32 curSmpl;
+
+	outputs[0] = outL;
+	outputs[1] = outR;
+	for (curChn = 0; curChn < 2; curChn ++)
+	{
+		INT32* buf = bb->buf[curChn];
+		DEV_SMPL* out = outputs[curChn];
+		INT32 integ = bb->integ[curChn];
+
+		for (curSmpl = 0; curSmpl < samples; curSmpl ++)
+		{
+			integ += buf[curSmpl];
+			out[curSmpl] = integ >> BLEP_KERNEL_BITS;
+		}
+		bb->integ[curChn] = integ;
+
+		// move the impulse tails to the beginning of the buffer
+		memmove(&buf[0], &buf[samples], BLEP_TAPS * sizeof(INT32));
+		memset(&buf[BLEP_TAPS], 0x00, samples * sizeof(INT32));
+	}
+
+	return;
+}
@@ -0,0 +1,91 @@
+#ifndef __EMU_BLEP_H__
+#define __EMU_BLEP_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "../stdtype.h"
+#include "../common_def.h"	// for INLINE
+#include "snddef.h"
+#include "RatioCntr.h"
+
+// Band-limited step synthesis
+// Sound cores record level changes of their output together with a sub-sample timestamp.
+// Each change is added as a windowed-sinc impulse and the buffer is integrated when
+// reading it out. This renders square-wave chips directly at the output sample rate.
+// The cost depends on the number of transitions instead of the chip clock.
+
+#define BLEP_PHASE_BITS		5	// sub-sample resolution of the timestamps
+#define BLEP_PHASES			(1 << BLEP_PHASE_BITS)
+#define BLEP_TAPS			16	// impulse width in samples (output is delayed by BLEP_TAPS/2 - 1 samples)
+#define BLEP_KERNEL_BITS	15	// kernel precision (see Blep_AddDelta for the resulting level limits)
+#define BLEP_BLOCK			256	// maximum number of samples rendered at once
+
+typedef struct _blep_buffer
+{
+	INT32 level[2];	// current output level (left/right)
+	INT32 integ[2];	// integrator state (left/right)
+	INT32 buf[2][BLEP_BLOCK + BLEP_TAPS];
+} BLEP_BUF;
+
+// windowed-sinc impulses, one per sub-sample phase, each phase sums up to (1 << BLEP_KERNEL_BITS)
+extern const INT16 blep_kernel[BLEP_PHASES][BLEP_TAPS];
+
+void Blep_Init(BLEP_BUF* bb);
+void Blep_Reset(BLEP_BUF* bb);
+// integrate and output the first 'samples' samples (max. BLEP_BLOCK) of the buffer
+// Timestamps of following calls to Blep_SetLevel are relative to the sample after the last one rendered.
+void Blep_Render(BLEP_BUF* bb, UINT32 samples, DEV_SMPL* outL, DEV_SMPL* outR);
+
+// The buffer and the integrator use INT32, which limits the levels:
+//	- The integrator holds (level << BLEP_KERNEL_BITS), so output levels must stay within +-0xFFFF.
+//	- The largest kernel tap is 26214 (0.8 << BLEP_KERNEL_BITS), so the level changes that are added
+//	  to one sample must stay within +-0x13FFF in total.
+// The SN76496 and AY8910 cores output at most +-0x8000.
+INLINE void Blep_AddDelta(INT32* buf, RC_TYPE time, INT32 delta)
+{
+	UINT32 pos = (UINT32)(time >> RC_SHIFT);
+	const INT16* kern = blep_kernel[(time >> (RC_SHIFT - BLEP_PHASE_BITS)) & (BLEP_PHASES - 1)];
+	UINT32 curTap;
+
+	buf += pos;
+	for (curTap = 0; curTap < BLEP_TAPS; curTap ++)
+		buf[curTap] += kern[curTap] * delta;
+	return;
+}
+
+// number of chip ticks before the end of a block of 'samples' samples
+// tick: time of the next chip tick (RC_SHIFT fixed point, in samples) and time per tick
+INLINE UINT32 Blep_GetTicks(const RATIO_CNTR* tick, UINT32 samples)
+{
+	RC_TYPE blkEnd = (RC_TYPE)samples << RC_SHIFT;
+
+	if (tick->val >= blkEnd)
+		return 0;
+	return (UINT32)((blkEnd - tick->val + tick->inc - 1) / tick->inc);
+}
+
+// set output level at a certain time
+// time: sample position (RC_SHIFT fixed point), must be smaller than the sample count of the next Blep_Render call
+INLINE void Blep_SetLevel(BLEP_BUF* bb, RC_TYPE time, INT32 left, INT32 right)
+{
+	if (left != bb->level[0])
+	{
+		Blep_AddDelta(bb->buf[0], time, left - bb->level[0]);
+		bb->level[0] = left;
+	}
+	if (right != bb->level[1])
+	{
+		Blep_AddDelta(bb->buf[1], time, right - bb->level[1]);
+		bb->level[1] = right;
+	}
+	return;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// __EMU_BLEP_H__
@@ -0,0 +1,134 @@
+// Lookup tables for blep.c
+// generated by tables_gen.c - do not edit
+
+const INT16 blep_kernel[BLEP_PHASES][BLEP_TAPS] =
+{
+	{
+		1, -56, 268, -634, 800, 113, -3743, 19182,
+		19941, -3448, -116, 912, -667, 269, -53, -1
+	},
+	{
+		2, -59, 265, -598, 688, 332, -3999, 18396,
+		20666, -3114, -354, 1022, -697, 268, -48, -2
+	},
+	{
+		3, -62, 260, -560, 577, 539, -4217, 17585,
+		21358, -2740, -601, 1131, -724, 266, -43, -4
+	},
+	{
+		4, -63, 253, -520, 466, 735, -4397, 16752,
+		22013, -2328, -855, 1236, -746, 261, -37, -6
+	},
+	{
+		4, -64, 245, -479, 357, 917, -4541, 15900,
+		22631, -1877, -1114, 1338, -765, 254, -30, -8
+	},
+	{
+		5, -64, 236, -436, 251, 1085, -4648, 15032,
+		23203, -1387, -1377, 1436, -780, 245, -22, -11
+	},
+	{
+		5, -64, 226, -393, 148, 1240, -4721, 14153,
+		23733, -860, -1643, 1527, -789, 233, -14, -13
+	},
+	{
+		6, -64, 215, -349, 48, 1379, -4760, 13264,
+		24216, -296, -1909, 1613, -793, 219, -5, -16
+	},
+	{
+		6, -62, 203, -305, -47, 1504, -4767, 12369,
+		24651, 305, -2175, 1691, -793, 202, 5, -19
+	},
+	{
+		6, -61, 190, -261, -138, 1614, -4743, 11472,
+		25036, 939, -2438, 1761, -786, 183, 16, -22
+	},
+	{
+		6, -59, 177, -218, -224, 1709, -4690, 10576,
+		25368, 1608, -2697, 1823, -774, 161, 27, -25
+	},
+	{
+		5, -56, 163, -176, -305, 1789, -4609, 9683,
+		25649, 2307, -2949, 1874, -755, 137, 39, -28
+	},
+	{
+		5, -54, 149, -134, -380, 1854, -4502, 8798,
+		25871, 3037, -3193, 1916, -730, 111, 52, -32
+	},
+	{
+		5, -51, 135, -94, -449, 1904, -4372, 7923,
+		26042, 3795, -3427, 1945, -700, 82, 65, -35
+	},
+	{
+		4, -48, 120, -55, -512, 1940, -4219, 7060,
+		26156, 4578, -3648, 1963, -662, 51, 78, -38
+	},
+	{
+		4, -45, 106, -18, -568, 1961, -4047, 6214,
+		26214, 5385, -3856, 1969, -618, 17, 92, -42
+	},
+	{
+		4, -42, 92, 17, -618, 1969, -3856, 5386,
+		26213, 6214, -4047, 1961, -568, -18, 106, -45
+	},
+	{
+		3, -38, 78, 51, -662, 1964, -3649, 4579,
+		26157, 7060, -4220, 1940, -512, -55, 120, -48
+	},
+	{
+		3, -35, 65, 82, -700, 1946, -3427, 3795,
+		26043, 7923, -4372, 1904, -449, -94, 135, -51
+	},
+	{
+		2, -32, 52, 111, -731, 1916, -3193, 3037,
+		25875, 8799, -4503, 1854, -380, -134, 149, -54
+	},
+	{
+		2, -28, 39, 137, -755, 1875, -2949, 2308,
+		25650, 9684, -4609, 1789, -305, -176, 163, -57
+	},
+	{
+		2, -25, 27, 161, -774, 1823, -2697, 1608,
+		25370, 10577, -4690, 1710, -224, -218, 177, -59
+	},
+	{
+		1, -22, 16, 183, -786, 1762, -2438, 940,
+		25037, 11474, -4743, 1615, -138, -262, 190, -61
+	},
+	{
+		1, -19, 5, 202, -793, 1691, -2175, 305,
+		24653, 12371, -4767, 1505, -47, -305, 203, -62
+	},
+	{
+		1, -16, -5, 219, -794, 1613, -1910, -296,
+		24220, 13266, -4760, 1380, 48, -349, 215, -64
+	},
+	{
+		1, -13, -14, 233, -789, 1528, -1643, -860,
+		23734, 14155, -4721, 1240, 148, -393, 226, -64
+	},
+	{
+		0, -11, -22, 245, -780, 1436, -1377, -1388,
+		23209, 15034, -4649, 1085, 251, -437, 236, -64
+	},
+	{
+		0, -8, -30, 254, -765, 1338, -1114, -1877,
+		22631, 15902, -4541, 917, 358, -479, 246, -64
+	},
+	{
+		0, -6, -37, 261, -747, 1237, -855, -2328,
+		22016, 16754, -4398, 735, 466, -520, 253, -63
+	},
+	{
+		0, -4, -43, 266, -724, 1131, -601, -2741,
+		21360, 17587, -4217, 539, 577, -560, 260, -62
+	},
+	{
+		0, -2, -48, 268, -697, 1022, -354, -3114,
+		20667, 18397, -3999, 332, 688, -598, 265, -59
+	},
+	{
+		0, -1, -53, 269, -667, 912, -116, -3448,
+		19942, 19182, -3743, 113, 800, -634, 268, -56
+	}
+};
@@ -542,6 +542,8 @@ YM2203 Japanese datasheet contents, translated: http://www.larwe.com/technical/c
 #include "../EmuCores.h"
 #include "../EmuHelper.h"
 #include "../logging.h"
+#include "../RatioCntr.h"
+#include "../blep.h"
 #include "ayintf.h"
 #include "ay8910.h"
 
@@ -566,7 +568,7 @@ DEV_DEF devDef_AY8910_MAME =
 	ay8910_reset,
 	ay8910_update_one,
 	
-	NULL,	// SetOptionBits
+	ay8910_set_options,	// SetOptionBits
 	ay8910_set_mute_mask,
 	NULL,	// SetPanning
 	ay8910_set_srchg_cb,	// SetSampleRateChangeCallback
@@ -698,6 +700,10 @@ struct _ay8910_context
 	
 	DEVCB_SRATE_CHG SmpRateFunc;
 	void* SmpRateData;
+	
+	UINT32 smpl_rate;       /* output sample rate of the band-limited step mode (see OPT_AY8910_BLEP) */
+	BLEP_BUF* blep;         /* band-limited step buffer (NULL = render at native rate) */
+	RATIO_CNTR blep_tick;   /* time of the next chip tick, in output samples */
 };
 
 
@@ -1111,6 +1117,212 @@ void ay8910_write_reg(ay8910_context *psg, UINT8 r, UINT8 v)
 	}
 }
 
+/*************************************
+ *
+ * Band-limited step synthesis
+ *
+ * The generators are advanced from one output transition to the next
+ * and only the transitions are rendered, directly at the output sample rate.
+ * Used when a custom sample rate is requested.
+ *
+ *************************************/
+
+/* number of ticks until a counter reaches its period */
+INLINE UINT32 counter_next(INT32 count, UINT32 period)
+{
+	return ((UINT32)count + 1 >= period) ? 1 : (period - (UINT32)count);
+}
+
+/* advance a counter by a number of ticks, returns how often it reached its period */
+INLINE UINT32 counter_advance(INT32 *count, UINT32 period, UINT32 ticks)
+{
+	UINT32 next = counter_next(*count, period);
+
+	if (ticks < next)
+	{
+		*count += ticks;
+		return 0;
+	}
+	ticks -= next;
+	if (period < 1)
+		period = 1;
+	*count = ticks % period;
+	return 1 + ticks / period;
+}
+
+/* advance the envelope by a number of steps */
+static void envelope_steps(ay8910_context *psg, UINT32 steps)
+{
+	INT32 pos = psg->env_step - (INT32)steps;
+
+	if (pos >= 0)
+	{
+		psg->env_step = pos;
+	}
+	else if (psg->hold)
+	{
+		if (psg->alternate)
+			psg->attack ^= psg->env_step_mask;
+		psg->holding = 1;
+		psg->env_step = 0;
+		psg->count_env = 0;
+	}
+	else
+	{
+		/* invert the output if the envelope looped an odd number of times */
+		UINT32 loops = ((UINT32)-pos + psg->env_step_mask) / (psg->env_step_mask + 1);
+		if (psg->alternate && (loops & 1))
+			psg->attack ^= psg->env_step_mask;
+		psg->env_step = pos & psg->env_step_mask;
+	}
+}
+
+/* advance all generators by a number of ticks, same as running ay8910_update_one for that many samples */
+static void ay8910_advance(ay8910_context *psg, UINT32 ticks)
+{
+	int chan;
+	UINT32 count;
+
+	for (chan = 0; chan < NUM_CHANNELS; chan++)
+	{
+		count = counter_advance(&psg->count[chan], TONE_PERIOD(psg, chan), ticks);
+		psg->output[chan] ^= (count & 1);
+	}
+
+	count = counter_advance(&psg->count_noise, NOISE_PERIOD(psg), ticks);
+	for (; count > 0; count --)
+	{
+		psg->prescale_noise ^= 1;
+		if (psg->prescale_noise)
+		{
+			psg->rng ^= (((psg->rng & 1) ^ ((psg->rng >> 3) & 1)) << 17);
+			psg->rng >>= 1;
+		}
+	}
+
+	if (psg->holding == 0)
+	{
+		count = counter_advance(&psg->count_env, ENVELOPE_PERIOD(psg) * psg->step, ticks);
+		if (count > 0)
+			envelope_steps(psg, count);
+	}
+	psg->env_volume = (psg->env_step ^ psg->attack);
+}
+
+/* number of ticks until the next one that may change the output, limited to 'ticks' */
+static UINT32 ay8910_next_event(const ay8910_context *psg, UINT32 ticks)
+{
+	int chan;
+	UINT32 next;
+	UINT8 use_noise = 0;
+	UINT8 use_env = 0;
+
+	for (chan = 0; chan < NUM_CHANNELS; chan++)
+	{
+		if (! psg->MuteMsk[chan])
+			continue;
+		if (! TONE_ENABLEQ(psg, chan))
+		{
+			next = counter_next(psg->count[chan], TONE_PERIOD(psg, chan));
+			if (ticks > next)
+				ticks = next;
+		}
+		if (! NOISE_ENABLEQ(psg, chan))
+			use_noise = 1;
+		if (TONE_ENVELOPE(psg, chan) != 0)
+			use_env = 1;
+	}
+	if (use_noise)
+	{
+		next = counter_next(psg->count_noise, NOISE_PERIOD(psg));
+		if (ticks > next)
+			ticks = next;
+	}
+	if (use_env && psg->holding == 0)
+	{
+		next = counter_next(psg->count_env, ENVELOPE_PERIOD(psg) * psg->step);
+		if (ticks > next)
+			ticks = next;
+	}
+	return ticks;
+}
+
+/* same mixing as ay8910_update_one, returns the current output level */
+static void ay8910_blep_mix(ay8910_context *psg, INT32 *outL, INT32 *outR)
+{
+	int chan;
+	INT32 chnout;
+
+	*outL = 0;
+	*outR = 0;
+	for (chan = 0; chan < NUM_CHANNELS; chan++)
+		psg->vol_enabled[chan] = (psg->output[chan] | TONE_ENABLEQ(psg, chan)) & (NOISE_OUTPUT(psg) | NOISE_ENABLEQ(psg, chan));
+
+#if ENABLE_CUSTOM_OUTPUTS
+	if (psg->streams != 3)
+	{
+		*outL = *outR = mix_3D(psg);
+		return;
+	}
+#endif
+	for (chan = 0; chan < NUM_CHANNELS; chan++)
+	{
+		if (! psg->MuteMsk[chan])
+			continue;
+		if (TONE_ENVELOPE(psg, chan) != 0)
+		{
+			if (psg->chip_type == AYTYPE_AY8914) // AY8914 Has a two bit tone_envelope field
+				chnout = psg->env_table[chan][psg->vol_enabled[chan] ? psg->env_volume >> (3-TONE_ENVELOPE(psg,chan)) : 0];
+			else
+				chnout = psg->env_table[chan][psg->vol_enabled[chan] ? psg->env_volume : 0];
+		}
+		else
+		{
+			chnout = psg->vol_table[chan][psg->vol_enabled[chan] ? TONE_VOLUME(psg, chan) : 0];
+		}
+		if (psg->StereoMask[chan] & 0x01)
+			*outL += chnout;
+		if (psg->StereoMask[chan] & 0x02)
+			*outR += chnout;
+	}
+}
+
+static void ay8910_update_blep(ay8910_context *psg, UINT32 samples, DEV_SMPL **outputs)
+{
+	UINT32 smpl_pos;
+	UINT32 blk_len;
+	UINT32 ticks;
+	UINT32 step;
+	INT32 outL, outR;
+
+	for (smpl_pos = 0; smpl_pos < samples; smpl_pos += blk_len)
+	{
+		blk_len = samples - smpl_pos;
+		if (blk_len > BLEP_BLOCK)
+			blk_len = BLEP_BLOCK;
+
+		/* pick up register changes */
+		ay8910_blep_mix(psg, &outL, &outR);
+		Blep_SetLevel(psg->blep, 0, outL, outR);
+
+		ticks = Blep_GetTicks(&psg->blep_tick, blk_len);
+		while (ticks > 0)
+		{
+			step = ay8910_next_event(psg, ticks);
+			ay8910_advance(psg, step);
+
+			RC_STEPS(&psg->blep_tick, step - 1);
+			ay8910_blep_mix(psg, &outL, &outR);
+			Blep_SetLevel(psg->blep, psg->blep_tick.val, outL, outR);
+			RC_STEP(&psg->blep_tick);
+			ticks -= step;
+		}
+
+		Blep_Render(psg->blep, blk_len, &outputs[0][smpl_pos], &outputs[1][smpl_pos]);
+		RC_VAL_SUB(&psg->blep_tick, blk_len);
+	}
+}
+
 void ay8910_update_one(void *param, UINT32 samples, DEV_SMPL **outputs)
 {
 	ay8910_context *psg = (ay8910_context *)param;
@@ -1120,6 +1332,12 @@ void ay8910_update_one(void *param, UINT32 samples, DEV_SMPL **outputs)
 	DEV_SMPL *bufR = outputs[1];
 	DEV_SMPL chnout;
 	
+	if (psg->blep != NULL)
+	{
+		ay8910_update_blep(psg, samples, outputs);
+		return;
+	}
+	
 	memset(outputs[0], 0x00, samples * sizeof(DEV_SMPL));
 	memset(outputs[1], 0x00, samples * sizeof(DEV_SMPL));
 	
@@ -1366,15 +1584,29 @@ static void ay8910_set_type(ay8910_context *info, UINT8 chip_type)
 	return;
 }
 
+static void ay8910_blep_set_ratio(ay8910_context *psg)
+{
+	UINT32 clock_div = 8;
+
+	if (psg->type == PSG_TYPE_YM && (psg->chip_flags & YM2149_PIN26_LOW))
+		clock_div *= 2;
+	RC_SET_RATIO(&psg->blep_tick, psg->smpl_rate * clock_div, psg->clock);
+}
+
 UINT8 device_start_ay8910_mame(const AY8910_CFG* cfg, DEV_INFO* retDevInf)
 {
 	void* chip;
+	ay8910_context* psg;
 	DEV_DATA* devData;
 	UINT32 rate;
 	
 	rate = ay8910_start(&chip, cfg->_genCfg.clock, cfg->chipType, cfg->chipFlags);
 	if (chip == NULL)
 		return 0xFF;
+	psg = (ay8910_context*)chip;
+	/* sample rate for the band-limited step mode (see OPT_AY8910_BLEP) */
+	psg->smpl_rate = rate;
+	SRATE_CUSTOM_HIGHEST(cfg->_genCfg.srMode, psg->smpl_rate, cfg->_genCfg.smplRate);
 	
 	devData = (DEV_DATA*)chip;
 	devData->chipInf = chip;
@@ -1422,7 +1654,10 @@ UINT32 ay8910_start(void **chip, UINT32 clock, UINT8 ay_type, UINT8 ay_flags)
 
 void ay8910_stop(void *chip)
 {
-	free(chip);
+	ay8910_context *psg = (ay8910_context *)chip;
+
+	free(psg->blep);
+	free(psg);
 }
 
 void ay8910_reset(void *chip)
@@ -1445,6 +1680,11 @@ void ay8910_reset(void *chip)
 	psg->last_enable = 0xC0;    /* force a write */
 	for (i = 0;i < AY_PORTA;i++)
 		ay8910_write_reg(psg,i,0);
+	if (psg->blep != NULL)
+	{
+		Blep_Reset(psg->blep);
+		RC_RESET(&psg->blep_tick);
+	}
 	//psg->ready = 1;
 #if ENABLE_REGISTER_TEST
 	ay8910_write_reg(psg, AY_AFINE, 0);
@@ -1469,15 +1709,20 @@ void ay8910_set_clock(void *chip, UINT32 clock)
 	ay8910_context *psg = (ay8910_context *)chip;
 	
 	psg->clock = clock;
+	if (psg->blep != NULL)
+	{
+		// the output sample rate stays the same
+		ay8910_blep_set_ratio(psg);
+		return;
+	}
 	if (psg->SmpRateFunc != NULL)
 		psg->SmpRateFunc(psg->SmpRateData, ay8910_get_sample_rate(psg));
 	
 	return;
 }
 
-UINT32 ay8910_get_sample_rate(void *chip)
+static UINT32 ay8910_get_native_rate(ay8910_context *psg)
 {
-	ay8910_context *psg = (ay8910_context *)chip;
 	UINT32 master_clock = psg->clock;
 	
 	if (psg->type == PSG_TYPE_YM)
@@ -1491,6 +1736,15 @@ UINT32 ay8910_get_sample_rate(void *chip)
 	return master_clock / 8;
 }
 
+UINT32 ay8910_get_sample_rate(void *chip)
+{
+	ay8910_context *psg = (ay8910_context *)chip;
+	
+	if (psg->blep != NULL)
+		return psg->smpl_rate;
+	return ay8910_get_native_rate(psg);
+}
+
 void ay8910_write(void *chip, UINT8 addr, UINT8 data)
 {
 	ay8910_context *psg = (ay8910_context *)chip;
@@ -1605,6 +1859,37 @@ void ay8910_set_stereo_mask(void *chip, UINT32 StereoMask)
 }
 
 
+void ay8910_set_options(void *chip, UINT32 options)
+{
+	ay8910_context *psg = (ay8910_context *)chip;
+	UINT8 use_blep;
+	
+	use_blep = (options & OPT_AY8910_BLEP) ? 1 : 0;
+	if (psg->smpl_rate == ay8910_get_native_rate(psg))
+		use_blep = 0;	/* the native rate was requested */
+	if (use_blep == (psg->blep != NULL))
+		return;
+	
+	if (use_blep)
+	{
+		psg->blep = (BLEP_BUF*)malloc(sizeof(BLEP_BUF));
+		if (psg->blep == NULL)
+			return;
+		Blep_Init(psg->blep);
+		ay8910_blep_set_ratio(psg);
+		RC_RESET(&psg->blep_tick);
+	}
+	else
+	{
+		free(psg->blep);
+		psg->blep = NULL;
+	}
+	if (psg->SmpRateFunc != NULL)
+		psg->SmpRateFunc(psg->SmpRateData, ay8910_get_sample_rate(psg));
+	
+	return;
+}
+
 void ay8910_set_srchg_cb(void *chip, DEVCB_SRATE_CHG CallbackFunc, void* DataPtr)
 {
 	ay8910_context *info = (ay8910_context *)chip;
@@ -89,6 +89,7 @@ void ay8910_write_reg(ay8910_context *psg, UINT8 r, UINT8 v);
 
 void ay8910_update_one(void *param, UINT32 samples, DEV_SMPL **outputs);
 
+void ay8910_set_options(void *chip, UINT32 options);
 void ay8910_set_mute_mask(void *chip, UINT32 MuteMask);
 void ay8910_set_stereo_mask(void *chip, UINT32 StereoMask);
 void ay8910_set_srchg_cb(void *chip, DEVCB_SRATE_CHG CallbackFunc, void* DataPtr);
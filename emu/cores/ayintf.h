@@ -43,6 +43,7 @@ typedef struct ay8910_config
 
 
 #define OPT_AY8910_PCM3CH_DETECT	0x01	// enable 3-channel PCM detection and disable per-channel panning in that case
+#define OPT_AY8910_BLEP				0x02	// [MAME core] render at the CUSTOM/HIGHEST sample rate using band-limited steps (default: disabled)
 
 
 extern const DEV_DECL sndDev_AY8910;
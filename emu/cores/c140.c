@@ -42,6 +42,7 @@ static void c140_w(void *chip, UINT16 offset, UINT8 data);
 
 static void c140_alloc_rom(void* chip, UINT32 memsize);
 static void c140_write_rom(void *chip, UINT32 offset, UINT32 length, const UINT8* data);
+static void c140_attach_rom(void *chip, UINT32 length, const UINT8* data);
 
 static void c140_set_mute_mask(void *chip, UINT32 MuteMask);
 
@@ -52,6 +53,7 @@ static DEVDEF_RWFUNC devFunc[] =
 	{RWF_REGISTER | RWF_READ, DEVRW_A16D8, 0, c140_r},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, c140_write_rom},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, c140_alloc_rom},
+	{RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, c140_attach_rom},
 	{RWF_CHN_MUTE | RWF_WRITE, DEVRW_ALL, 0, c140_set_mute_mask},
 	{0x00, 0x00, 0, NULL}
 };
@@ -163,6 +165,7 @@ struct _c140_state
 	UINT32 romSize;
 	UINT32 romMask;
 	UINT8 *pRom;
+	UINT8 romOwned;
 	UINT8 REG[0x200];
 
 	INT16 mulaw_table[256];
@@ -419,7 +422,7 @@ static void device_stop_c140(void *chip)
 {
 	c140_state *info = (c140_state *)chip;
 	
-	free(info->pRom);
+	rom_free(info->pRom, info->romOwned);
 	free(info);
 	
 	return;
@@ -447,7 +450,7 @@ static void c140_alloc_rom(void* chip, UINT32 memsize)
 	if (info->romSize == memsize)
 		return;
 	
-	info->pRom = (UINT8*)realloc(info->pRom, memsize);
+	info->pRom = (UINT8*)rom_realloc(info->pRom, &info->romOwned, memsize);
 	info->romSize = memsize;
 	info->romMask = pow2_mask(memsize);
 	memset(info->pRom, 0xFF, memsize);
@@ -458,17 +461,33 @@ static void c140_alloc_rom(void* chip, UINT32 memsize)
 static void c140_write_rom(void *chip, UINT32 offset, UINT32 length, const UINT8* data)
 {
 	c140_state *info = (c140_state *)chip;
+	UINT8* rom;
 	
 	if (offset > info->romSize)
 		return;
 	if (offset + length > info->romSize)
 		length = info->romSize - offset;
 	
+	rom = (UINT8*)rom_unshare(info->pRom, &info->romOwned, info->romSize);
+	if (rom == NULL)
+		return;
+	info->pRom = rom;
 	memcpy(info->pRom + offset, data, length);
 	
 	return;
 }
 
+static void c140_attach_rom(void *chip, UINT32 length, const UINT8* data)
+{
+	c140_state *info = (c140_state *)chip;
+	
+	info->pRom = (UINT8*)rom_attach(info->pRom, &info->romOwned, data);
+	info->romSize = (data != NULL) ? length : 0x00;
+	info->romMask = pow2_mask(info->romSize);
+	
+	return;
+}
+
 
 static void c140_set_mute_mask(void *chip, UINT32 MuteMask)
 {
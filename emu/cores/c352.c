@@ -27,6 +27,7 @@
 #include "../EmuCores.h"
 #include "../snddef.h"
 #include "../EmuHelper.h"
+#include "../pcmmix.h"
 #include "c352.h"
 
 static void c352_update(void *chip, UINT32 samples, DEV_SMPL **outputs);
@@ -39,6 +40,7 @@ static void c352_w(void *chip, UINT16 offset, UINT16 data);
 
 static void c352_alloc_rom(void* chip, UINT32 memsize);
 static void c352_write_rom(void *chip, UINT32 offset, UINT32 length, const UINT8* data);
+static void c352_attach_rom(void *chip, UINT32 length, const UINT8* data);
 
 static void c352_set_mute_mask(void *chip, UINT32 MuteMask);
 static UINT32 c352_get_mute_mask(void *chip);
@@ -51,6 +53,7 @@ static DEVDEF_RWFUNC devFunc[] =
 	{RWF_REGISTER | RWF_READ, DEVRW_A16D16, 0, c352_r},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, c352_write_rom},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, c352_alloc_rom},
+	{RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, c352_attach_rom},
 	{RWF_CHN_MUTE | RWF_WRITE, DEVRW_ALL, 0, c352_set_mute_mask},
 	{0x00, 0x00, 0, NULL}
 };
@@ -156,6 +159,7 @@ typedef struct {
 	DEV_DATA _devData;
 
 	UINT32 sample_rate_base;
+	UINT8 sub_ticks;    // voice updates per output sample
 
 	C352_Voice v[C352_VOICES];
 
@@ -163,6 +167,7 @@ typedef struct {
 	UINT16 control; // control flags, purpose unknown.
 
 	UINT8* wave;
+	UINT8 wave_owned;
 	UINT32 wavesize;
 	UINT32 wave_mask;
 
@@ -241,84 +246,187 @@ static void c352_ramp_volume(C352_Voice* v,int ch,UINT8 val)
 		v->curr_vol[ch] += (vol_delta>0) ? -1 : 1;
 }
 
+// advance the voice by one update tick (clock / 288)
+static void c352_step_voice(C352 *c, C352_Voice *v)
+{
+	INT32 next_counter = v->counter+v->freq;
+
+	if(next_counter & 0x10000)
+	{
+		C352_fetch_sample(c,v);
+	}
+
+	if((next_counter^v->counter) & 0x18000)
+	{
+		c352_ramp_volume(v,0,v->vol_f>>8);
+		c352_ramp_volume(v,1,v->vol_f&0xff);
+		c352_ramp_volume(v,2,v->vol_r>>8);
+		c352_ramp_volume(v,3,v->vol_r&0xff);
+	}
+
+	v->counter = next_counter&0xffff;
+}
+
+// mix the current output of a voice into a single sample
+static void c352_mix_sample(C352 *c, C352_Voice *v, DEV_SMPL *outL, DEV_SMPL *outR)
+{
+	INT32 s;
+
+	// Interpolate samples
+	if((v->flags & C352_FLG_FILTER) == 0)
+		s = v->last_sample + (INT32)((INT64)v->counter*(v->sample-v->last_sample)>>16);
+	else
+		s = v->sample;
+
+	// Left
+	*outL += (((v->flags & C352_FLG_PHASEFL) ? -s : s) * v->curr_vol[0])>>8;
+	// Right
+	*outR += (((v->flags & C352_FLG_PHASEFR) ? -s : s) * v->curr_vol[1])>>8;
+	if (!c->muteRear && !c->optMuteRear)
+	{
+		*outL += (((v->flags & C352_FLG_PHASERL) ? -s : s) * v->curr_vol[2])>>8;
+		*outR += (((v->flags & C352_FLG_PHASEFR) ? -s : s) * v->curr_vol[3])>>8;
+	}
+}
+
+// render up to PCMMIX_BLOCK samples of a busy voice and add them to the output
+static void c352_render_voice(C352 *c, C352_Voice *v, UINT32 samples, DEV_SMPL *outL, DEV_SMPL *outR)
+{
+	INT32 base[PCMMIX_BLOCK];
+	INT32 delta[PCMMIX_BLOCK];
+	UINT32 frac[PCMMIX_BLOCK];
+	INT32 smpl[PCMMIX_BLOCK];
+	UINT8 vol[4][PCMMIX_BLOCK];
+	UINT8 ramping;
+	UINT8 rear;
+	INT32 gain[4];
+	UINT32 i, t;
+
+	ramping = (v->curr_vol[0] != (v->vol_f>>8) || v->curr_vol[1] != (v->vol_f&0xff) ||
+		v->curr_vol[2] != (v->vol_r>>8) || v->curr_vol[3] != (v->vol_r&0xff));
+
+	// step the voice and collect the interpolation points
+	for(i=0;i<samples;i++)
+	{
+		for(t=0;t<c->sub_ticks;t++)
+		{
+			if(!(v->flags & C352_FLG_BUSY))
+				break;
+			c352_step_voice(c,v);
+		}
+		if(t < c->sub_ticks)
+			break;	// the voice ended, the remaining samples are silent
+
+		base[i] = v->last_sample;
+		delta[i] = v->sample - v->last_sample;
+		frac[i] = (v->flags & C352_FLG_FILTER) ? 0x10000 : v->counter;
+		if(ramping)
+		{
+			vol[0][i] = v->curr_vol[0];
+			vol[1][i] = v->curr_vol[1];
+			vol[2][i] = v->curr_vol[2];
+			vol[3][i] = v->curr_vol[3];
+		}
+	}
+	samples = i;
+	if(v->mute || !samples)
+		return;
+
+	// Interpolate samples
+	for(i=0;i<samples;i++)
+		smpl[i] = base[i] + (INT32)((INT64)frac[i]*delta[i]>>16);
+
+	rear = (!c->muteRear && !c->optMuteRear);
+	if(!ramping)
+	{
+		gain[0] = (v->flags & C352_FLG_PHASEFL) ? -v->curr_vol[0] : v->curr_vol[0];
+		gain[1] = (v->flags & C352_FLG_PHASEFR) ? -v->curr_vol[1] : v->curr_vol[1];
+		gain[2] = (v->flags & C352_FLG_PHASERL) ? -v->curr_vol[2] : v->curr_vol[2];
+		gain[3] = (v->flags & C352_FLG_PHASEFR) ? -v->curr_vol[3] : v->curr_vol[3];
+		PcmMix_AddStereo(smpl, samples, gain[0], gain[1], 8, outL, outR);
+		if(rear)
+			PcmMix_AddStereo(smpl, samples, gain[2], gain[3], 8, outL, outR);
+		return;
+	}
+
+	// volume ramp in progress
+	gain[0] = (v->flags & C352_FLG_PHASEFL) ? -1 : 1;
+	gain[1] = (v->flags & C352_FLG_PHASEFR) ? -1 : 1;
+	gain[2] = (v->flags & C352_FLG_PHASERL) ? -1 : 1;
+	gain[3] = (v->flags & C352_FLG_PHASEFR) ? -1 : 1;
+	for(i=0;i<samples;i++)
+	{
+		outL[i] += (smpl[i] * gain[0] * vol[0][i])>>8;
+		outR[i] += (smpl[i] * gain[1] * vol[1][i])>>8;
+		if(rear)
+		{
+			outL[i] += (smpl[i] * gain[2] * vol[2][i])>>8;
+			outR[i] += (smpl[i] * gain[3] * vol[3][i])>>8;
+		}
+	}
+}
+
 static void c352_update(void *chip, UINT32 samples, DEV_SMPL **outputs)
 {
 	C352 *c = (C352 *)chip;
-	UINT32 i, j;
-	INT32 s;
-	INT32 next_counter;
+	UINT32 i, j, t;
+	UINT32 blk_len;
+	UINT32 noise_mask;
 	C352_Voice* v;
 
-	DEV_SMPL out[4];
-
 	memset(outputs[0], 0, samples * sizeof(DEV_SMPL));
 	memset(outputs[1], 0, samples * sizeof(DEV_SMPL));
 	if (c->wave == NULL)
 		return;
 
-	for(i=0;i<samples;i++)
+	// Voices are rendered one after another in blocks.
+	// Noise voices share the random number generator, so they are stepped together
+	// in order to keep the sequence of random numbers.
+	noise_mask = 0;
+	for(j=0;j<C352_VOICES;j++)
 	{
-		out[0]=out[1]=out[2]=out[3]=0;
-
-		for(j=0;j<C352_VOICES;j++)
+		v = &c->v[j];
+		if(!(v->flags & C352_FLG_BUSY))
+			continue;
+		if(v->flags & C352_FLG_NOISE)
 		{
+			noise_mask |= (1U << j);
+			continue;
+		}
 
-			v = &c->v[j];
-			s = 0;
+		for(i=0;i<samples && (v->flags & C352_FLG_BUSY);i+=blk_len)
+		{
+			blk_len = samples - i;
+			if(blk_len > PCMMIX_BLOCK)
+				blk_len = PCMMIX_BLOCK;
+			c352_render_voice(c,v,blk_len,&outputs[0][i],&outputs[1][i]);
+		}
+	}
 
-			if(v->flags & C352_FLG_BUSY)
+	if(noise_mask)
+	{
+		for(i=0;i<samples;i++)
+		{
+			for(t=0;t<c->sub_ticks;t++)
 			{
-				next_counter = v->counter+v->freq;
-
-				if(next_counter & 0x10000)
-				{
-					C352_fetch_sample(c,v);
-				}
-
-				if((next_counter^v->counter) & 0x18000)
+				for(j=0;j<C352_VOICES;j++)
 				{
-					c352_ramp_volume(v,0,v->vol_f>>8);
-					c352_ramp_volume(v,1,v->vol_f&0xff);
-					c352_ramp_volume(v,2,v->vol_r>>8);
-					c352_ramp_volume(v,3,v->vol_r&0xff);
+					if(noise_mask & (1U << j))
+						c352_step_voice(c,&c->v[j]);
 				}
-
-				v->counter = next_counter&0xffff;
-
-				// Interpolate samples
-				if((v->flags & C352_FLG_FILTER) == 0)
-					s = v->last_sample + (INT32)((INT64)v->counter*(v->sample-v->last_sample)>>16);
-				else
-					s = v->sample;
 			}
-
-			if(!c->v[j].mute)
+			for(j=0;j<C352_VOICES;j++)
 			{
-				// Left
-				out[0] += (((v->flags & C352_FLG_PHASEFL) ? -s : s) * v->curr_vol[0])>>8;
-				out[2] += (((v->flags & C352_FLG_PHASERL) ? -s : s) * v->curr_vol[2])>>8;
-
-				// Right
-				out[1] += (((v->flags & C352_FLG_PHASEFR) ? -s : s) * v->curr_vol[1])>>8;
-				out[3] += (((v->flags & C352_FLG_PHASEFR) ? -s : s) * v->curr_vol[3])>>8;
+				if((noise_mask & (1U << j)) && !c->v[j].mute)
+					c352_mix_sample(c,&c->v[j],&outputs[0][i],&outputs[1][i]);
 			}
 		}
-
-		outputs[0][i] += out[0];
-		outputs[1][i] += out[1];
-		if (!c->muteRear && !c->optMuteRear)
-		{
-			outputs[0][i] += out[2];
-			outputs[1][i] += out[3];
-		}
 	}
 }
 
 static UINT8 device_start_c352(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf)
 {
 	C352 *c;
-	int i;
-	INT16 j;
 
 	c = (C352 *)calloc(1, sizeof(C352));
 	if (c == NULL)
@@ -327,31 +435,21 @@ static UINT8 device_start_c352(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf)
 	c->wave = NULL;
 	c->wavesize = 0x00;
 
-	//c->sample_rate_base = cfg->clock / 576;	// sample rate according to superctr
-	c->sample_rate_base = cfg->clock / 288;	// TODO: output at 43 KHz and fix sample reading/interpolation code
+	// The chip outputs at clock / 576, voices are updated twice per sample.
+	c->sample_rate_base = cfg->clock / 576;
+	c->sub_ticks = 2;
+	if (cfg->srMode != DEVRI_SRMODE_NATIVE && cfg->smplRate > c->sample_rate_base)
+	{
+		// output every voice update for high output sample rates
+		c->sample_rate_base = cfg->clock / 288;
+		c->sub_ticks = 1;
+	}
 	c->muteRear = cfg->flags;
 
 	//device_reset_c352(c);
 
 	c352_set_mute_mask(c, 0x00000000);
-	
-	j=0;
-	for(i=0;i<128;i++)
-	{
-		c->mulaw_table[i] = j<<5;
-		if(i < 16)
-			j += 1;
-		else if(i < 24)
-			j += 2;
-		else if(i < 48)
-			j += 4;
-		else if(i < 100)
-			j += 8;
-		else
-			j += 16;
-	}
-	for(i=128;i<256;i++)
-		c->mulaw_table[i] = (~c->mulaw_table[i-128])&~0x1f;
+	PcmMix_GenerateMuLaw(c->mulaw_table);
 
 	c->_devData.chipInf = c;
 	INIT_DEVINF(retDevInf, &c->_devData, c->sample_rate_base, &devDef);
@@ -362,7 +460,7 @@ static void device_stop_c352(void *chip)
 {
 	C352 *c = (C352 *)chip;
 	
-	free(c->wave);
+	rom_free(c->wave, c->wave_owned);
 	free(c);
 	
 	return;
@@ -460,7 +558,7 @@ static void c352_alloc_rom(void* chip, UINT32 memsize)
 	if (c->wavesize == memsize)
 		return;
 	
-	c->wave = (UINT8*)realloc(c->wave, memsize);
+	c->wave = (UINT8*)rom_realloc(c->wave, &c->wave_owned, memsize);
 	c->wavesize = memsize;
 	memset(c->wave, 0xFF, memsize);
 	c->wave_mask = pow2_mask(memsize);
@@ -471,17 +569,33 @@ static void c352_alloc_rom(void* chip, UINT32 memsize)
 static void c352_write_rom(void *chip, UINT32 offset, UINT32 length, const UINT8* data)
 {
 	C352 *c = (C352 *)chip;
+	UINT8* rom;
 	
 	if (offset > c->wavesize)
 		return;
 	if (offset + length > c->wavesize)
 		length = c->wavesize - offset;
 	
+	rom = (UINT8*)rom_unshare(c->wave, &c->wave_owned, c->wavesize);
+	if (rom == NULL)
+		return;
+	c->wave = rom;
 	memcpy(c->wave + offset, data, length);
 	
 	return;
 }
 
+static void c352_attach_rom(void *chip, UINT32 length, const UINT8* data)
+{
+	C352 *c = (C352 *)chip;
+	
+	c->wave = (UINT8*)rom_attach(c->wave, &c->wave_owned, data);
+	c->wavesize = (data != NULL) ? length : 0x00;
+	c->wave_mask = pow2_mask(c->wavesize);
+	
+	return;
+}
+
 static void c352_set_mute_mask(void *chip, UINT32 MuteMask)
 {
 	C352 *c = (C352 *)chip;
@@ -168,28 +168,11 @@ static uint16_t exp_table[256] = {
 854,  859,  864,  869,  874,  880,  885,  890,  895,  900,  906,  911,  916,  921,  927,  932,
 937,  942,  948,  953,  959,  964,  969,  975,  980,  986,  991,  996, 1002, 1007, 1013, 1018
 };
-/* fullsin_table[x] = round(-log2(sin((x + 0.5) * PI / (PG_WIDTH / 4) / 2)) * 256) */
-static uint16_t fullsin_table[PG_WIDTH] = {
-2137, 1731, 1543, 1419, 1326, 1252, 1190, 1137, 1091, 1050, 1013, 979,  949,  920,  894,  869, 
-846,  825,  804,  785,  767,  749,  732,  717,  701,  687,  672,  659,  646,  633,  621,  609, 
-598,  587,  576,  566,  556,  546,  536,  527,  518,  509,  501,  492,  484,  476,  468,  461,
-453,  446,  439,  432,  425,  418,  411,  405,  399,  392,  386,  380,  375,  369,  363,  358,  
-352,  347,  341,  336,  331,  326,  321,  316,  311,  307,  302,  297,  293,  289,  284,  280,
-276,  271,  267,  263,  259,  255,  251,  248,  244,  240,  236,  233,  229,  226,  222,  219, 
-215,  212,  209,  205,  202,  199,  196,  193,  190,  187,  184,  181,  178,  175,  172,  169, 
-167,  164,  161,  159,  156,  153,  151,  148,  146,  143,  141,  138,  136,  134,  131,  129,  
-127,  125,  122,  120,  118,  116,  114,  112,  110,  108,  106,  104,  102,  100,  98,   96,   
-94,   92,   91,   89,   87,   85,   83,   82,   80,   78,   77,   75,   74,   72,   70,   69,
-67,   66,   64,   63,   62,   60,   59,   57,   56,   55,   53,   52,   51,   49,   48,   47,  
-46,   45,   43,   42,   41,   40,   39,   38,   37,   36,   35,   34,   33,   32,   31,   30,  
-29,   28,   27,   26,   25,   24,   23,   23,   22,   21,   20,   20,   19,   18,   17,   17,   
-16,   15,   15,   14,   13,   13,   12,   12,   11,   10,   10,   9,    9,    8,    8,    7,    
-7,    7,    6,    6,    5,    5,    5,    4,    4,    4,    3,    3,    3,    2,    2,    2,
-2,    1,    1,    1,    1,    1,    1,    1,    0,    0,    0,    0,    0,    0,    0,    0,
-};
 /* clang-format on */
 
-static uint16_t halfsin_table[PG_WIDTH];
+/* sine tables and preset tones, shared by all chips */
+#include "emu2413_tables.h"
+
 static const uint16_t *wave_table_map[2] = {fullsin_table, halfsin_table};
 
 /* pitch modulator */
@@ -239,15 +222,11 @@ static uint32_t ml_table[16] = {1,     1 * 2, 2 * 2,  3 * 2,  4 * 2,  5 * 2,  6
                                 8 * 2, 9 * 2, 10 * 2, 10 * 2, 12 * 2, 12 * 2, 15 * 2, 15 * 2};
 
 #define dB2(x) ((x)*2)
-static double kl_table[16] = {dB2(0.000),  dB2(9.000),  dB2(12.000), dB2(13.875), dB2(15.000), dB2(16.125),
-                              dB2(16.875), dB2(17.625), dB2(18.000), dB2(18.750), dB2(19.125), dB2(19.500),
-                              dB2(19.875), dB2(20.250), dB2(20.625), dB2(21.000)};
-
-static uint32_t tll_table[8 * 16][1 << TL_BITS][4];
-static int32_t rks_table[8 * 2][2];
+static const double kl_table[16] = {dB2(0.000),  dB2(9.000),  dB2(12.000), dB2(13.875), dB2(15.000), dB2(16.125),
+                                    dB2(16.875), dB2(17.625), dB2(18.000), dB2(18.750), dB2(19.125), dB2(19.500),
+                                    dB2(19.875), dB2(20.250), dB2(20.625), dB2(21.000)};
 
 static const EOPLL_PATCH null_patch = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-static EOPLL_PATCH default_patch[EOPLL_TONE_NUM][(16 + 3) * 2];
 
 /* don't forget min/max is defined as a macro in stdlib.h of Visual C. */
 #ifndef min
@@ -363,80 +342,6 @@ void EOPLL_RateConv_delete(EOPLL_RateConv *conv) {
   free(conv);
 }
 
-/***************************************************
-
-                  Create tables
-
-****************************************************/
-
-static void makeSinTable(void) {
-  int x;
-
-  for (x = 0; x < PG_WIDTH / 4; x++) {
-    fullsin_table[PG_WIDTH / 4 + x] = fullsin_table[PG_WIDTH / 4 - x - 1];
-  }
-
-  for (x = 0; x < PG_WIDTH / 2; x++) {
-    fullsin_table[PG_WIDTH / 2 + x] = 0x8000 | fullsin_table[x];
-  }
-
-  for (x = 0; x < PG_WIDTH / 2; x++)
-    halfsin_table[x] = fullsin_table[x];
-
-  for (x = PG_WIDTH / 2; x < PG_WIDTH; x++)
-    halfsin_table[x] = 0xfff;
-}
-
-static void makeTllTable(void) {
-
-  int32_t tmp;
-  int32_t fnum, block, TL, KL;
-
-  for (fnum = 0; fnum < 16; fnum++) {
-    for (block = 0; block < 8; block++) {
-      for (TL = 0; TL < 64; TL++) {
-        for (KL = 0; KL < 4; KL++) {
-          if (KL == 0) {
-            tll_table[(block << 4) | fnum][TL][KL] = TL2EG(TL);
-          } else {
-            tmp = (int32_t)(kl_table[fnum] - dB2(3.000) * (7 - block));
-            if (tmp <= 0)
-              tll_table[(block << 4) | fnum][TL][KL] = TL2EG(TL);
-            else
-              tll_table[(block << 4) | fnum][TL][KL] = (uint32_t)((tmp >> (3 - KL)) / EG_STEP) + TL2EG(TL);
-          }
-        }
-      }
-    }
-  }
-}
-
-static void makeRksTable(void) {
-  int fnum8, block;
-  for (fnum8 = 0; fnum8 < 2; fnum8++)
-    for (block = 0; block < 8; block++) {
-      rks_table[(block << 1) | fnum8][1] = (block << 1) + fnum8;
-      rks_table[(block << 1) | fnum8][0] = block >> 1;
-    }
-}
-
-static void makeDefaultPatch(void) {
-  int i, j;
-  for (i = 0; i < EOPLL_TONE_NUM; i++)
-    for (j = 0; j < 19; j++)
-      EOPLL_getDefaultPatch(i, j, &default_patch[i][j * 2]);
-}
-
-static uint8_t table_initialized = 0;
-
-static void initializeTables(void) {
-  makeTllTable();
-  makeRksTable();
-  makeSinTable();
-  makeDefaultPatch();
-  table_initialized = 1;
-}
-
 /*********************************************************
 
                       Synthesizing
@@ -527,6 +432,20 @@ enum SLOT_UPDATE_FLAG {
 
 static INLINE void request_update(EOPLL_SLOT *slot, int flag) { slot->update_requests |= flag; }
 
+/* total level + key scale level, as envelope attenuation */
+static uint16_t calc_tll(uint16_t blk_fnum, uint32_t TL, uint32_t KL) {
+  const int32_t fnum = (blk_fnum >> 5) & 15;
+  const int32_t block = (blk_fnum >> 9) & 7;
+  int32_t tmp;
+
+  if (KL == 0)
+    return TL2EG(TL);
+  tmp = (int32_t)(kl_table[fnum] - dB2(3.000) * (7 - block));
+  if (tmp <= 0)
+    return TL2EG(TL);
+  return (uint32_t)((tmp >> (3 - KL)) / EG_STEP) + TL2EG(TL);
+}
+
 static void commit_slot_update(EOPLL_SLOT *slot) {
 
 #if EOPLL_DEBUG
@@ -542,14 +461,15 @@ static void commit_slot_update(EOPLL_SLOT *slot) {
 
   if (slot->update_requests & UPDATE_TLL) {
     if ((slot->type & 1) == 0) {
-      slot->tll = tll_table[slot->blk_fnum >> 5][slot->patch->TL][slot->patch->KL];
+      slot->tll = calc_tll(slot->blk_fnum, slot->patch->TL, slot->patch->KL);
     } else {
-      slot->tll = tll_table[slot->blk_fnum >> 5][slot->volume][slot->patch->KL];
+      slot->tll = calc_tll(slot->blk_fnum, slot->volume, slot->patch->KL);
     }
   }
 
   if (slot->update_requests & UPDATE_RKS) {
-    slot->rks = rks_table[slot->blk_fnum >> 8][slot->patch->KR];
+    /* KR=1: (block << 1) | fnum8, KR=0: block >> 1 */
+    slot->rks = slot->patch->KR ? (slot->blk_fnum >> 8) : (slot->blk_fnum >> 10);
   }
 
   if (slot->update_requests & (UPDATE_RKS | UPDATE_EG)) {
@@ -559,18 +479,19 @@ static void commit_slot_update(EOPLL_SLOT *slot) {
       slot->eg_shift = 0;
       slot->eg_rate_h = 0;
       slot->eg_rate_l = 0;
-      return;
-    }
-
-    slot->eg_rate_h = min(15, p_rate + (slot->rks >> 2));
-    slot->eg_rate_l = slot->rks & 3;
-    if (slot->eg_state == ATTACK) {
-      slot->eg_shift = (0 < slot->eg_rate_h && slot->eg_rate_h < 12) ? (13 - slot->eg_rate_h) : 0;
     } else {
-      slot->eg_shift = (slot->eg_rate_h < 13) ? (13 - slot->eg_rate_h) : 0;
+      slot->eg_rate_h = min(15, p_rate + (slot->rks >> 2));
+      slot->eg_rate_l = slot->rks & 3;
+      if (slot->eg_state == ATTACK) {
+        slot->eg_shift = (0 < slot->eg_rate_h && slot->eg_rate_h < 12) ? (13 - slot->eg_rate_h) : 0;
+      } else {
+        slot->eg_shift = (slot->eg_rate_h < 13) ? (13 - slot->eg_rate_h) : 0;
+      }
     }
   }
 
+  /* Clear the requests in all cases. Slots with a zero rate would otherwise keep them pending
+   * and be recalculated on every sample. */
   slot->update_requests = 0;
 }
 
@@ -658,10 +579,15 @@ static INLINE void update_key_status(EOPLL *opll) {
   opll->slot_key_status = new_slot_key_status;
 }
 
+static INLINE const EOPLL_PATCH *get_patch(EOPLL *opll, int32_t num) {
+  return (num == 0) ? opll->patch : &opll->rom_patch[num * 2];
+}
+
 static INLINE void set_patch(EOPLL *opll, int32_t ch, int32_t num) {
+  const EOPLL_PATCH *patch = get_patch(opll, num);
   opll->patch_number[ch] = num;
-  MOD(opll, ch)->patch = &opll->patch[num * 2 + 0];
-  CAR(opll, ch)->patch = &opll->patch[num * 2 + 1];
+  MOD(opll, ch)->patch = &patch[0];
+  CAR(opll, ch)->patch = &patch[1];
   request_update(MOD(opll, ch), UPDATE_ALL);
   request_update(CAR(opll, ch), UPDATE_ALL);
 }
@@ -1110,16 +1036,14 @@ EOPLL *EOPLL_new(uint32_t clk, uint32_t rate) {
   EOPLL *opll;
   int i;
 
-  if (!table_initialized) {
-    initializeTables();
-  }
-
   opll = (EOPLL *)calloc(1, sizeof(EOPLL));
   if (opll == NULL)
     return NULL;
 
-  for (i = 0; i < 19 * 2; i++)
+  for (i = 0; i < 2; i++)
     memcpy(&opll->patch[i], &null_patch, sizeof(EOPLL_PATCH));
+  opll->rom_patch = default_patch[0];
+  opll->custom_patch = NULL;
 
   opll->clk = clk;
   opll->rate = rate;
@@ -1146,6 +1070,7 @@ void EOPLL_delete(EOPLL *opll) {
     EOPLL_RateConv_delete(opll->conv);
     opll->conv = NULL;
   }
+  free(opll->custom_patch);
   free(opll);
 }
 
@@ -1472,13 +1397,38 @@ void EOPLL_getDefaultPatch(int32_t type, int32_t num, EOPLL_PATCH *patch) {
   EOPLL_dumpToPatch(default_inst[type] + num * 8, patch);
 }
 
+/* point the slots to the current patch data, without requesting updates */
+static void refresh_patch_pointers(EOPLL *opll) {
+  int ch;
+  for (ch = 0; ch < 9; ch++) {
+    const EOPLL_PATCH *patch = get_patch(opll, opll->patch_number[ch]);
+    MOD(opll, ch)->patch = &patch[0];
+    CAR(opll, ch)->patch = &patch[1];
+  }
+}
+
+/* The preset tones are shared by all chips of the same type.
+ * A chip gets a private copy only when its presets are overwritten. */
+static EOPLL_PATCH *get_custom_patch(EOPLL *opll) {
+  if (opll->custom_patch == NULL) {
+    opll->custom_patch = (EOPLL_PATCH *)malloc(sizeof(EOPLL_PATCH) * 19 * 2);
+    if (opll->custom_patch == NULL)
+      return NULL;
+    memcpy(opll->custom_patch, opll->rom_patch, sizeof(EOPLL_PATCH) * 19 * 2);
+    opll->rom_patch = opll->custom_patch;
+    refresh_patch_pointers(opll);
+  }
+  return opll->custom_patch;
+}
+
 void EOPLL_setPatch(EOPLL *opll, const uint8_t *dump) {
   EOPLL_PATCH patch[2];
   int i;
-  for (i = 0; i < 19; i++) {
+  EOPLL_dumpToPatch(dump, opll->patch);
+  for (i = 1; i < 19; i++) {
     EOPLL_dumpToPatch(dump + i * 8, patch);
-    memcpy(&opll->patch[i * 2 + 0], &patch[0], sizeof(EOPLL_PATCH));
-    memcpy(&opll->patch[i * 2 + 1], &patch[1], sizeof(EOPLL_PATCH));
+    EOPLL_copyPatch(opll, i * 2 + 0, &patch[0]);
+    EOPLL_copyPatch(opll, i * 2 + 1, &patch[1]);
   }
 }
 
@@ -1494,13 +1444,25 @@ void EOPLL_patchToDump(const EOPLL_PATCH *patch, uint8_t *dump) {
 }
 
 void EOPLL_copyPatch(EOPLL *opll, int32_t num, EOPLL_PATCH *patch) {
-  memcpy(&opll->patch[num], patch, sizeof(EOPLL_PATCH));
+  EOPLL_PATCH *dest;
+  if (num < 2) {
+    dest = &opll->patch[num];
+  } else {
+    dest = get_custom_patch(opll);
+    if (dest == NULL)
+      return;
+    dest += num;
+  }
+  memcpy(dest, patch, sizeof(EOPLL_PATCH));
 }
 
 void EOPLL_resetPatch(EOPLL *opll, uint8_t type) {
-  int i;
-  for (i = 0; i < 19 * 2; i++)
-    EOPLL_copyPatch(opll, i, &default_patch[type % EOPLL_TONE_NUM][i]);
+  const EOPLL_PATCH *tone = default_patch[type % EOPLL_TONE_NUM];
+  memcpy(&opll->patch[0], &tone[0], sizeof(EOPLL_PATCH) * 2);
+  opll->rom_patch = tone;
+  free(opll->custom_patch);
+  opll->custom_patch = NULL;
+  refresh_patch_pointers(opll);
 }
 
 int32_t EOPLL_calc(EOPLL *opll) {
@@ -115,7 +115,9 @@ typedef struct __EOPLL {
 
   int32_t patch_number[9];
   EOPLL_SLOT slot[18];
-  EOPLL_PATCH patch[19 * 2];
+  EOPLL_PATCH patch[2];               /* user tone (modulator, carrier) */
+  const EOPLL_PATCH *rom_patch;       /* preset tones [19 * 2], shared or custom_patch */
+  EOPLL_PATCH *custom_patch;          /* private copy of the presets, NULL if unused */
 
   uint8_t pan[16];
   int32_t pan_fine[16][2];  /* [VB mod] changed from float to 16.16 fixed-point int32_t */
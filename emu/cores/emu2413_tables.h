@@ -0,0 +1,262 @@
+// Lookup tables for emu2413.c
+// generated by tables_gen.c - do not edit
+
+static const uint16_t fullsin_table[PG_WIDTH] =
+{
+	2137, 1731, 1543, 1419, 1326, 1252, 1190, 1137, 1091, 1050, 1013, 979, 949, 920, 894, 869,
+	846, 825, 804, 785, 767, 749, 732, 717, 701, 687, 672, 659, 646, 633, 621, 609,
+	598, 587, 576, 566, 556, 546, 536, 527, 518, 509, 501, 492, 484, 476, 468, 461,
+	453, 446, 439, 432, 425, 418, 411, 405, 399, 392, 386, 380, 375, 369, 363, 358,
+	352, 347, 341, 336, 331, 326, 321, 316, 311, 307, 302, 297, 293, 289, 284, 280,
+	276, 271, 267, 263, 259, 255, 251, 248, 244, 240, 236, 233, 229, 226, 222, 219,
+	215, 212, 209, 205, 202, 199, 196, 193, 190, 187, 184, 181, 178, 175, 172, 169,
+	167, 164, 161, 159, 156, 153, 151, 148, 146, 143, 141, 138, 136, 134, 131, 129,
+	127, 125, 122, 120, 118, 116, 114, 112, 110, 108, 106, 104, 102, 100, 98, 96,
+	94, 92, 91, 89, 87, 85, 83, 82, 80, 78, 77, 75, 74, 72, 70, 69,
+	67, 66, 64, 63, 62, 60, 59, 57, 56, 55, 53, 52, 51, 49, 48, 47,
+	46, 45, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30,
+	29, 28, 27, 26, 25, 24, 23, 23, 22, 21, 20, 20, 19, 18, 17, 17,
+	16, 15, 15, 14, 13, 13, 12, 12, 11, 10, 10, 9, 9, 8, 8, 7,
+	7, 7, 6, 6, 5, 5, 5, 4, 4, 4, 3, 3, 3, 2, 2, 2,
+	2, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2,
+	2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 7, 7,
+	7, 8, 8, 9, 9, 10, 10, 11, 12, 12, 13, 13, 14, 15, 15, 16,
+	17, 17, 18, 19, 20, 20, 21, 22, 23, 23, 24, 25, 26, 27, 28, 29,
+	30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 45, 46,
+	47, 48, 49, 51, 52, 53, 55, 56, 57, 59, 60, 62, 63, 64, 66, 67,
+	69, 70, 72, 74, 75, 77, 78, 80, 82, 83, 85, 87, 89, 91, 92, 94,
+	96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 125, 127,
+	129, 131, 134, 136, 138, 141, 143, 146, 148, 151, 153, 156, 159, 161, 164, 167,
+	169, 172, 175, 178, 181, 184, 187, 190, 193, 196, 199, 202, 205, 209, 212, 215,
+	219, 222, 226, 229, 233, 236, 240, 244, 248, 251, 255, 259, 263, 267, 271, 276,
+	280, 284, 289, 293, 297, 302, 307, 311, 316, 321, 326, 331, 336, 341, 347, 352,
+	358, 363, 369, 375, 380, 386, 392, 399, 405, 411, 418, 425, 432, 439, 446, 453,
+	461, 468, 476, 484, 492, 501, 509, 518, 527, 536, 546, 556, 566, 576, 587, 598,
+	609, 621, 633, 646, 659, 672, 687, 701, 717, 732, 749, 767, 785, 804, 825, 846,
+	869, 894, 920, 949, 979, 1013, 1050, 1091, 1137, 1190, 1252, 1326, 1419, 1543, 1731, 2137,
+	34905, 34499, 34311, 34187, 34094, 34020, 33958, 33905, 33859, 33818, 33781, 33747, 33717, 33688, 33662, 33637,
+	33614, 33593, 33572, 33553, 33535, 33517, 33500, 33485, 33469, 33455, 33440, 33427, 33414, 33401, 33389, 33377,
+	33366, 33355, 33344, 33334, 33324, 33314, 33304, 33295, 33286, 33277, 33269, 33260, 33252, 33244, 33236, 33229,
+	33221, 33214, 33207, 33200, 33193, 33186, 33179, 33173, 33167, 33160, 33154, 33148, 33143, 33137, 33131, 33126,
+	33120, 33115, 33109, 33104, 33099, 33094, 33089, 33084, 33079, 33075, 33070, 33065, 33061, 33057, 33052, 33048,
+	33044, 33039, 33035, 33031, 33027, 33023, 33019, 33016, 33012, 33008, 33004, 33001, 32997, 32994, 32990, 32987,
+	32983, 32980, 32977, 32973, 32970, 32967, 32964, 32961, 32958, 32955, 32952, 32949, 32946, 32943, 32940, 32937,
+	32935, 32932, 32929, 32927, 32924, 32921, 32919, 32916, 32914, 32911, 32909, 32906, 32904, 32902, 32899, 32897,
+	32895, 32893, 32890, 32888, 32886, 32884, 32882, 32880, 32878, 32876, 32874, 32872, 32870, 32868, 32866, 32864,
+	32862, 32860, 32859, 32857, 32855, 32853, 32851, 32850, 32848, 32846, 32845, 32843, 32842, 32840, 32838, 32837,
+	32835, 32834, 32832, 32831, 32830, 32828, 32827, 32825, 32824, 32823, 32821, 32820, 32819, 32817, 32816, 32815,
+	32814, 32813, 32811, 32810, 32809, 32808, 32807, 32806, 32805, 32804, 32803, 32802, 32801, 32800, 32799, 32798,
+	32797, 32796, 32795, 32794, 32793, 32792, 32791, 32791, 32790, 32789, 32788, 32788, 32787, 32786, 32785, 32785,
+	32784, 32783, 32783, 32782, 32781, 32781, 32780, 32780, 32779, 32778, 32778, 32777, 32777, 32776, 32776, 32775,
+	32775, 32775, 32774, 32774, 32773, 32773, 32773, 32772, 32772, 32772, 32771, 32771, 32771, 32770, 32770, 32770,
+	32770, 32769, 32769, 32769, 32769, 32769, 32769, 32769, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+	32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768, 32769, 32769, 32769, 32769, 32769, 32769, 32769, 32770,
+	32770, 32770, 32770, 32771, 32771, 32771, 32772, 32772, 32772, 32773, 32773, 32773, 32774, 32774, 32775, 32775,
+	32775, 32776, 32776, 32777, 32777, 32778, 32778, 32779, 32780, 32780, 32781, 32781, 32782, 32783, 32783, 32784,
+	32785, 32785, 32786, 32787, 32788, 32788, 32789, 32790, 32791, 32791, 32792, 32793, 32794, 32795, 32796, 32797,
+	32798, 32799, 32800, 32801, 32802, 32803, 32804, 32805, 32806, 32807, 32808, 32809, 32810, 32811, 32813, 32814,
+	32815, 32816, 32817, 32819, 32820, 32821, 32823, 32824, 32825, 32827, 32828, 32830, 32831, 32832, 32834, 32835,
+	32837, 32838, 32840, 32842, 32843, 32845, 32846, 32848, 32850, 32851, 32853, 32855, 32857, 32859, 32860, 32862,
+	32864, 32866, 32868, 32870, 32872, 32874, 32876, 32878, 32880, 32882, 32884, 32886, 32888, 32890, 32893, 32895,
+	32897, 32899, 32902, 32904, 32906, 32909, 32911, 32914, 32916, 32919, 32921, 32924, 32927, 32929, 32932, 32935,
+	32937, 32940, 32943, 32946, 32949, 32952, 32955, 32958, 32961, 32964, 32967, 32970, 32973, 32977, 32980, 32983,
+	32987, 32990, 32994, 32997, 33001, 33004, 33008, 33012, 33016, 33019, 33023, 33027, 33031, 33035, 33039, 33044,
+	33048, 33052, 33057, 33061, 33065, 33070, 33075, 33079, 33084, 33089, 33094, 33099, 33104, 33109, 33115, 33120,
+	33126, 33131, 33137, 33143, 33148, 33154, 33160, 33167, 33173, 33179, 33186, 33193, 33200, 33207, 33214, 33221,
+	33229, 33236, 33244, 33252, 33260, 33269, 33277, 33286, 33295, 33304, 33314, 33324, 33334, 33344, 33355, 33366,
+	33377, 33389, 33401, 33414, 33427, 33440, 33455, 33469, 33485, 33500, 33517, 33535, 33553, 33572, 33593, 33614,
+	33637, 33662, 33688, 33717, 33747, 33781, 33818, 33859, 33905, 33958, 34020, 34094, 34187, 34311, 34499, 34905
+};
+
+static const uint16_t halfsin_table[PG_WIDTH] =
+{
+	2137, 1731, 1543, 1419, 1326, 1252, 1190, 1137, 1091, 1050, 1013, 979, 949, 920, 894, 869,
+	846, 825, 804, 785, 767, 749, 732, 717, 701, 687, 672, 659, 646, 633, 621, 609,
+	598, 587, 576, 566, 556, 546, 536, 527, 518, 509, 501, 492, 484, 476, 468, 461,
+	453, 446, 439, 432, 425, 418, 411, 405, 399, 392, 386, 380, 375, 369, 363, 358,
+	352, 347, 341, 336, 331, 326, 321, 316, 311, 307, 302, 297, 293, 289, 284, 280,
+	276, 271, 267, 263, 259, 255, 251, 248, 244, 240, 236, 233, 229, 226, 222, 219,
+	215, 212, 209, 205, 202, 199, 196, 193, 190, 187, 184, 181, 178, 175, 172, 169,
+	167, 164, 161, 159, 156, 153, 151, 148, 146, 143, 141, 138, 136, 134, 131, 129,
+	127, 125, 122, 120, 118, 116, 114, 112, 110, 108, 106, 104, 102, 100, 98, 96,
+	94, 92, 91, 89, 87, 85, 83, 82, 80, 78, 77, 75, 74, 72, 70, 69,
+	67, 66, 64, 63, 62, 60, 59, 57, 56, 55, 53, 52, 51, 49, 48, 47,
+	46, 45, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30,
+	29, 28, 27, 26, 25, 24, 23, 23, 22, 21, 20, 20, 19, 18, 17, 17,
+	16, 15, 15, 14, 13, 13, 12, 12, 11, 10, 10, 9, 9, 8, 8, 7,
+	7, 7, 6, 6, 5, 5, 5, 4, 4, 4, 3, 3, 3, 2, 2, 2,
+	2, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 2,
+	2, 2, 2, 3, 3, 3, 4, 4, 4, 5, 5, 5, 6, 6, 7, 7,
+	7, 8, 8, 9, 9, 10, 10, 11, 12, 12, 13, 13, 14, 15, 15, 16,
+	17, 17, 18, 19, 20, 20, 21, 22, 23, 23, 24, 25, 26, 27, 28, 29,
+	30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 45, 46,
+	47, 48, 49, 51, 52, 53, 55, 56, 57, 59, 60, 62, 63, 64, 66, 67,
+	69, 70, 72, 74, 75, 77, 78, 80, 82, 83, 85, 87, 89, 91, 92, 94,
+	96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 125, 127,
+	129, 131, 134, 136, 138, 141, 143, 146, 148, 151, 153, 156, 159, 161, 164, 167,
+	169, 172, 175, 178, 181, 184, 187, 190, 193, 196, 199, 202, 205, 209, 212, 215,
+	219, 222, 226, 229, 233, 236, 240, 244, 248, 251, 255, 259, 263, 267, 271, 276,
+	280, 284, 289, 293, 297, 302, 307, 311, 316, 321, 326, 331, 336, 341, 347, 352,
+	358, 363, 369, 375, 380, 386, 392, 399, 405, 411, 418, 425, 432, 439, 446, 453,
+	461, 468, 476, 484, 492, 501, 509, 518, 527, 536, 546, 556, 566, 576, 587, 598,
+	609, 621, 633, 646, 659, 672, 687, 701, 717, 732, 749, 767, 785, 804, 825, 846,
+	869, 894, 920, 949, 979, 1013, 1050, 1091, 1137, 1190, 1252, 1326, 1419, 1543, 1731, 2137,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095,
+	4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095, 4095
+};
+
+static const EOPLL_PATCH default_patch[EOPLL_TONE_NUM][(16 + 3) * 2] =
+{
+	{
+		{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+		{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+		{30, 7, 1, 1, 13, 0, 0, 0, 1, 0, 0, 1, 0},
+		{0, 0, 1, 1, 7, 8, 1, 7, 0, 0, 0, 1, 1},
+		{26, 5, 0, 3, 13, 8, 2, 3, 1, 0, 0, 0, 1},
+		{0, 0, 0, 1, 15, 7, 1, 3, 0, 0, 0, 1, 0},
+		{25, 0, 0, 3, 15, 2, 2, 1, 1, 2, 0, 0, 0},
+		{0, 0, 0, 1, 12, 4, 2, 3, 0, 0, 0, 0, 0},
+		{14, 7, 0, 1, 8, 13, 7, 0, 1, 0, 0, 0, 0},
+		{0, 0, 1, 1, 6, 4, 2, 7, 0, 0, 0, 1, 0},
+		{30, 6, 1, 2, 14, 1, 0, 1, 1, 0, 0, 0, 0},
+		{0, 0, 1, 1, 7, 6, 2, 8, 0, 0, 0, 0, 0},
+		{22, 5, 1, 1, 14, 0, 0, 0, 1, 0, 0, 0, 0},
+		{0, 0, 1, 2, 7, 1, 1, 8, 0, 0, 0, 0, 0},
+		{29, 7, 1, 1, 8, 2, 1, 1, 0, 0, 0, 0, 0},
+		{0, 0, 1, 1, 8, 1, 0, 7, 0, 0, 0, 1, 0},
+		{45, 3, 1, 3, 11, 0, 0, 0, 1, 0, 0, 0, 0},
+		{0, 0, 1, 1, 7, 0, 0, 7, 0, 0, 0, 0, 1},
+		{27, 6, 1, 1, 6, 4, 1, 0, 0, 0, 0, 1, 0},
+		{0, 0, 1, 1, 6, 5, 1, 7, 0, 0, 0, 1, 0},
+		{11, 0, 0, 1, 8, 5, 8, 1, 0, 0, 0, 1, 1},
+		{0, 0, 1, 1, 15, 0, 0, 7, 0, 0, 0, 1, 1},
+		{3, 1, 1, 3, 14, 10, 1, 0, 1, 2, 0, 0, 0},
+		{0, 0, 0, 1, 14, 15, 0, 4, 0, 0, 0, 0, 1},
+		{36, 7, 0, 7, 15, 8, 2, 2, 1, 0, 0, 0, 0},
+		{0, 0, 0, 1, 15, 8, 1, 2, 0, 0, 1, 1, 0},
+		{12, 5, 1, 1, 13, 2, 4, 0, 0, 0, 0, 1, 0},
+		{0, 0, 0, 0, 15, 5, 4, 2, 1, 0, 0, 1, 0},
+		{21, 3, 0, 1, 14, 9, 0, 3, 0, 1, 0, 0, 0},
+		{0, 0, 0, 1, 9, 0, 0, 2, 0, 0, 0, 0, 0},
+		{9, 3, 0, 1, 15, 1, 12, 0, 0, 2, 0, 1, 0},
+		{0, 0, 0, 1, 14, 4, 1, 3, 0, 0, 0, 1, 0},
+		{24, 7, 0, 1, 13, 15, 6, 10, 0, 0, 0, 0, 1},
+		{0, 0, 0, 1, 15, 8, 6, 13, 0, 0, 0, 0, 0},
+		{0, 0, 0, 1, 12, 8, 10, 7, 0, 0, 0, 0, 0},
+		{0, 0, 0, 1, 13, 8, 6, 8, 0, 0, 0, 0, 0},
+		{0, 0, 0, 5, 15, 8, 5, 9, 0, 0, 0, 0, 0},
+		{0, 0, 0, 1, 10, 10, 5, 5, 0, 0, 0, 0, 0}
+	},
+	{
+		{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+		{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+		{5, 6, 0, 3, 14, 8, 4, 2, 0, 0, 0, 0, 0},
+		{0, 0, 1, 1, 8, 1, 2, 7, 0, 0, 0, 0, 0},
+		{20, 5, 0, 3, 13, 8, 2, 3, 1, 0, 0, 0, 1},
+		{0, 0, 0, 1, 15, 6, 1, 2, 0, 0, 0, 1, 0},
+		{8, 0, 0, 1, 15, 10, 2, 0, 1, 0, 0, 0, 1},
+		{0, 0, 0, 1, 11, 2, 1, 2, 1, 0, 0, 0, 0},
+		{12, 7, 1, 1, 10, 8, 6, 1, 1, 0, 0, 0, 0},
+		{0, 0, 1, 1, 6, 4, 2, 7, 0, 0, 0, 1, 0},
+		{30, 6, 1, 2, 14, 1, 0, 1, 1, 0, 0, 0, 0},
+		{0, 0, 1, 1, 7, 6, 2, 8, 0, 0, 0, 0, 0},
+		{6, 0, 0, 2, 10, 3, 15, 4, 0, 0, 0, 0, 0},
+		{0, 0, 0, 1, 14, 2, 15, 4, 0, 0, 0, 0, 0},
+		{29, 7, 1, 1, 8, 2, 1, 1, 0, 0, 0, 0, 0},
+		{0, 0, 1, 1, 8, 1, 0, 7, 0, 0, 0, 1, 0},
+		{34, 7, 1, 3, 10, 2, 0, 1, 0, 0, 0, 0, 0},
+		{0, 0, 1, 1, 7, 2, 1, 7, 0, 0, 0, 0, 1},
+		{37, 0, 1, 5, 4, 0, 7, 2, 1, 0, 0, 0, 0},
+		{0, 0, 0, 1, 7, 3, 0, 1, 1, 0, 0, 0, 0},
+		{15, 7, 1, 5, 10, 8, 5, 1, 1, 0, 1, 0, 1},
+		{0, 0, 0, 1, 10, 5, 0, 2, 0, 0, 0, 0, 0},
+		{36, 7, 0, 7, 15, 8, 2, 2, 1, 0, 0, 0, 0},
+		{0, 0, 0, 1, 15, 8, 1, 2, 0, 0, 1, 1, 0},
+		{17, 6, 1, 1, 6, 5, 1, 8, 1, 0, 0, 1, 0},
+		{0, 0, 1, 3, 7, 4, 1, 6, 0, 0, 0, 0, 0},
+		{19, 5, 0, 1, 12, 9, 0, 3, 0, 3, 0, 0, 0},
+		{0, 0, 0, 2, 9, 5, 0, 2, 0, 0, 0, 0, 0},
+		{12, 0, 1, 1, 9, 4, 3, 3, 0, 0, 0, 1, 0},
+		{0, 0, 1, 3, 12, 0, 15, 6, 0, 0, 0, 1, 0},
+		{13, 0, 1, 1, 12, 1, 5, 6, 0, 0, 0, 0, 0},
+		{0, 0, 1, 2, 13, 5, 0, 6, 1, 0, 0, 1, 0},
+		{24, 7, 0, 1, 13, 15, 6, 10, 0, 0, 0, 0, 1},
+		{0, 0, 0, 1, 15, 8, 6, 13, 0, 0, 0, 0, 0},
+		{0, 0, 0, 1, 12, 8, 10, 7, 0, 0, 0, 0, 0},
+		{0, 0, 0, 1, 13, 8, 6, 8, 0, 0, 0, 0, 0},
+		{0, 0, 0, 5, 15, 8, 5, 9, 0, 0, 0, 0, 0},
+		{0, 0, 0, 1, 10, 10, 5, 5, 0, 0, 0, 0, 0}
+	},
+	{
+		{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+		{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+		{26, 7, 1, 2, 15, 0, 0, 0, 0, 0, 0, 1, 0},
+		{0, 0, 1, 1, 6, 15, 1, 6, 0, 0, 0, 0, 0},
+		{5, 0, 0, 0, 15, 6, 7, 3, 0, 1, 0, 1, 0},
+		{0, 0, 0, 0, 8, 3, 6, 3, 1, 0, 0, 0, 0},
+		{25, 0, 0, 3, 15, 2, 2, 1, 1, 2, 0, 0, 0},
+		{0, 0, 0, 1, 12, 3, 2, 3, 0, 0, 0, 0, 0},
+		{11, 7, 0, 1, 15, 9, 7, 0, 0, 0, 0, 0, 1},
+		{0, 0, 1, 1, 6, 4, 1, 7, 0, 0, 0, 1, 0},
+		{30, 6, 1, 2, 14, 1, 0, 1, 1, 0, 0, 0, 0},
+		{0, 0, 1, 1, 7, 6, 2, 8, 0, 0, 0, 0, 0},
+		{2, 6, 1, 0, 15, 9, 2, 0, 0, 2, 0, 1, 1},
+		{0, 0, 0, 1, 6, 1, 2, 7, 0, 0, 0, 0, 0},
+		{28, 7, 1, 1, 8, 4, 1, 1, 0, 0, 0, 0, 0},
+		{0, 0, 1, 1, 8, 1, 0, 7, 0, 0, 0, 1, 0},
+		{9, 1, 1, 7, 6, 6, 4, 0, 1, 3, 0, 0, 0},
+		{0, 0, 1, 2, 6, 4, 2, 8, 1, 0, 0, 0, 0},
+		{7, 3, 0, 1, 10, 5, 5, 1, 0, 0, 0, 0, 0},
+		{0, 0, 1, 1, 7, 1, 0, 7, 0, 0, 0, 0, 0},
+		{30, 7, 0, 6, 15, 3, 15, 6, 0, 1, 0, 0, 0},
+		{0, 0, 0, 1, 15, 3, 1, 3, 0, 0, 0, 0, 0},
+		{24, 6, 0, 0, 15, 5, 2, 0, 0, 0, 0, 0, 0},
+		{0, 0, 0, 0, 15, 3, 2, 3, 0, 0, 0, 0, 0},
+		{36, 7, 0, 7, 15, 8, 2, 2, 1, 0, 0, 0, 0},
+		{0, 0, 0, 1, 15, 8, 1, 2, 0, 0, 1, 1, 0},
+		{0, 0, 1, 5, 15, 15, 7, 7, 1, 0, 0, 0, 0},
+		{0, 0, 1, 4, 15, 3, 15, 5, 0, 0, 0, 1, 0},
+		{0, 7, 0, 1, 13, 13, 15, 15, 1, 0, 0, 0, 0},
+		{0, 0, 1, 1, 15, 3, 15, 11, 1, 0, 0, 0, 0},
+		{0, 7, 1, 10, 8, 0, 0, 15, 1, 0, 0, 0, 0},
+		{0, 0, 1, 1, 8, 4, 15, 5, 0, 0, 0, 0, 0},
+		{24, 7, 0, 1, 13, 15, 6, 10, 0, 0, 0, 0, 1},
+		{0, 0, 0, 1, 15, 8, 6, 13, 0, 0, 0, 0, 0},
+		{0, 0, 0, 1, 12, 8, 10, 7, 0, 0, 0, 0, 0},
+		{0, 0, 0, 1, 13, 8, 6, 8, 0, 0, 0, 0, 0},
+		{0, 0, 0, 5, 15, 8, 5, 9, 0, 0, 0, 0, 0},
+		{0, 0, 0, 1, 10, 10, 5, 5, 0, 0, 0, 0, 0}
+	}
+};
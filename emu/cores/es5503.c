@@ -48,6 +48,7 @@
 #include "../EmuCores.h"
 #include "../snddef.h"
 #include "../EmuHelper.h"
+#include "../pcmmix.h"
 #include "es5503.h"
 
 
@@ -258,103 +259,256 @@ static void es5503_halt_osc(ES5503Chip *chip, int onum, int type, UINT32 *accumu
 	}
 }
 
-static void es5503_pcm_update(void *param, UINT32 samples, DEV_SMPL **outputs)
+// render a single sample of an oscillator the slow way, including halts, swaps and IRQs
+static void es5503_render_osc_sample(ES5503Chip *chip, UINT8 osc, UINT32 snum, DEV_SMPL **outputs)
 {
-	UINT8 osc;
-	UINT32 snum;
+	ES5503Osc *pOsc = &chip->oscillators[osc];
+	UINT32 wtptr = pOsc->wavetblpointer & wavemasks[pOsc->wavetblsize];
+	UINT32 altram;
+	UINT16 wtsize = pOsc->wtsize - 1;
+	UINT8 chnMask = (pOsc->control >> 4) & 0x0F;
+	int resshift = resshifts[pOsc->resolution] - pOsc->wavetblsize;
+	UINT32 sizemask = accmasks[pOsc->wavetblsize];
+	const int mode = (pOsc->control>>1) & 3;
 	UINT32 ramptr;
-	ES5503Chip *chip = (ES5503Chip *)param;
-	UINT8 chnsStereo, chan;
+	UINT8 chnsStereo = chip->output_channels & ~1;
+	UINT8 chan;
 
-	memset(outputs[0], 0, samples * sizeof(DEV_SMPL));
-	memset(outputs[1], 0, samples * sizeof(DEV_SMPL));
-	if (chip->docram == NULL)
+	chnMask &= chip->outchn_mask;
+	altram = pOsc->accumulator >> resshift;
+	ramptr = altram & sizemask;
+
+	pOsc->accumulator += pOsc->freq;
+
+	// channel strobe is always valid when reading; this allows potentially banking per voice
+	chip->channel_strobe = (pOsc->control>>4) & 0xf;
+	pOsc->data = chip->docram[ramptr + wtptr];
+
+	if (pOsc->data == 0x00)
+	{
+		es5503_halt_osc(chip, osc, 1, &pOsc->accumulator, resshift);
+	}
+	else
+	{
+		INT32 outData;
+		if (mode != MODE_SYNCAM)
+		{
+			outData = (pOsc->data - 0x80) * (INT16)pOsc->vol;
+		}
+		else
+		{
+			// if we're odd, we play nothing ourselves
+			if (osc & 1)
+			{
+				if (osc < 31)
+				{
+					// if the next oscillator up is playing, it's volume becomes our control
+					if (!(chip->oscillators[osc + 1].control & 1))
+					{
+						chip->oscillators[osc + 1].vol = pOsc->data;
+					}
+				}
+				outData = 0;
+			}
+			else    // hard sync, both oscillators play?
+			{
+				outData = (pOsc->data - 0x80) * (INT16)pOsc->vol;
+			}
+		}
+
+		// send groups of 2 channels to L or R
+		for (chan = 0; chan < chnsStereo; chan ++)
+		{
+			if (chan == chnMask)
+				outputs[chan & 1][snum] += outData;
+		}
+		outData = (outData * 181) >> 8;	// outData *= sqrt(2)
+		// send remaining channels to L+R
+		for (; chan < chip->output_channels; chan ++)
+		{
+			if (chan == chnMask)
+			{
+				outputs[0][snum] += outData;
+				outputs[1][snum] += outData;
+			}
+		}
+
+		if (altram >= wtsize)
+		{
+			es5503_halt_osc(chip, osc, 0, &pOsc->accumulator, resshift);
+		}
+	}
+}
+
+// fetch the samples an oscillator plays before it either reaches the end of its
+// wavetable or reads a 0x00 stop byte, up to maxSmpls
+// returns the number of samples fetched, the oscillator state isn't changed
+static UINT32 es5503_fetch_run(ES5503Chip *chip, const ES5503Osc *pOsc, UINT32 maxSmpls, INT32 *smplBuf)
+{
+	const UINT8 *wavetbl = &chip->docram[pOsc->wavetblpointer & wavemasks[pOsc->wavetblsize]];
+	int resshift = resshifts[pOsc->resolution] - pOsc->wavetblsize;
+	UINT32 sizemask = accmasks[pOsc->wavetblsize];
+	UINT32 endacc = (UINT32)(UINT16)(pOsc->wtsize - 1) << resshift;
+	UINT32 acc = pOsc->accumulator;
+	UINT32 smpls;
+	UINT32 curSmpl;
+
+	smpls = PcmMix_StepsUntil(acc, pOsc->freq, endacc);
+	if (smpls > maxSmpls)
+		smpls = maxSmpls;
+	for (curSmpl = 0; curSmpl < smpls; curSmpl ++)
+	{
+		UINT8 data = wavetbl[(acc >> resshift) & sizemask];
+		if (data == 0x00)
+			break;
+		smplBuf[curSmpl] = PcmMix_DecodeU8(data);
+		acc += pOsc->freq;
+	}
+	return curSmpl;
+}
+
+// play a run of fetched samples that doesn't contain any halt, loop or swap events
+// amVol passes the per-sample volume from the odd to the even oscillator of a sync/AM pair
+static void es5503_render_run(ES5503Chip *chip, UINT8 osc, UINT32 smpls, INT32 *smplBuf, DEV_SMPL **outputs, UINT8 *amVol)
+{
+	ES5503Osc *pOsc = &chip->oscillators[osc];
+	UINT8 chnMask = (pOsc->control >> 4) & 0x0F;
+	const int mode = (pOsc->control>>1) & 3;
+	INT32 vol;
+	UINT32 curSmpl;
+
+	chnMask &= chip->outchn_mask;
+	chip->channel_strobe = (pOsc->control>>4) & 0xf;
+	pOsc->accumulator += pOsc->freq * smpls;
+	pOsc->data = (UINT8)(smplBuf[smpls - 1] + 0x80);
+
+	if (mode == MODE_SYNCAM && (osc & 1))
+	{
+		// if we're odd, we play nothing ourselves, but control the volume of the next oscillator up
+		if (osc < 31 && !(chip->oscillators[osc + 1].control & 1))
+		{
+			for (curSmpl = 0; curSmpl < smpls; curSmpl ++)
+				amVol[curSmpl] = (UINT8)(smplBuf[curSmpl] + 0x80);
+			chip->oscillators[osc + 1].vol = pOsc->data;
+		}
 		return;
+	}
 
-	chnsStereo = chip->output_channels & ~1;
-	for (snum = 0; snum < samples; snum++)
+	vol = (INT16)pOsc->vol;
+	if (osc > 0 && !(osc & 1))
 	{
-		for (osc = 0; osc < chip->oscsenabled; osc++)
+		const ES5503Osc *pMod = &chip->oscillators[osc - 1];
+		if (((pMod->control>>1) & 3) == MODE_SYNCAM && !(pMod->control & 1) && ! pMod->Muted)
 		{
-			ES5503Osc *pOsc = &chip->oscillators[osc];
+			for (curSmpl = 0; curSmpl < smpls; curSmpl ++)
+				smplBuf[curSmpl] *= amVol[curSmpl];
+			vol = 1;
+		}
+	}
+
+	// send groups of 2 channels to L or R, remaining channels to L+R (multiplied by sqrt(2))
+	if (chnMask < (chip->output_channels & ~1))
+		PcmMix_AddMono(smplBuf, smpls, vol, 0, outputs[chnMask & 1]);
+	else if (chnMask < chip->output_channels)
+		PcmMix_AddStereo(smplBuf, smpls, vol * 181, vol * 181, 8, outputs[0], outputs[1]);
 
+	return;
+}
+
+// Oscillators in swap mode start their partner when they halt, the even oscillator of a
+// sync/AM pair resyncs the odd oscillator below it and the odd one controls the volume of
+// the one above. Returns whether oscillator 'osc' is tied to 'osc+1' this way.
+static UINT8 es5503_osc_linked_to_next(ES5503Chip *chip, UINT8 osc)
+{
+	const int mode = (chip->oscillators[osc].control>>1) & 3;
+	const int nextMode = (chip->oscillators[osc + 1].control>>1) & 3;
+
+	if (!(osc & 1))
+		return (mode == MODE_SWAP || nextMode == MODE_SWAP);
+	else
+		return (mode == MODE_SYNCAM || nextMode == MODE_SYNCAM);
+}
+
+// render a group of linked oscillators
+// Runs are rendered up to the next sample where one of them halts, loops or swaps.
+// That sample is then processed for the whole group in oscillator order.
+static void es5503_render_group(ES5503Chip *chip, UINT8 first, UINT8 last, UINT32 samples, DEV_SMPL **outputs)
+{
+	INT32 smplBuf[PCMMIX_BLOCK];
+	UINT8 amVol[PCMMIX_BLOCK];
+	DEV_SMPL *blkOuts[2];
+	UINT32 snum;
+	UINT32 smpls;
+	UINT8 playing;
+	UINT8 osc;
+
+	snum = 0;
+	while (snum < samples)
+	{
+		smpls = samples - snum;
+		if (smpls > PCMMIX_BLOCK)
+			smpls = PCMMIX_BLOCK;
+		playing = 0;
+		for (osc = first; osc <= last && smpls > 0; osc++)
+		{
+			ES5503Osc *pOsc = &chip->oscillators[osc];
 			if (!(pOsc->control & 1) && ! pOsc->Muted)
 			{
-				UINT32 wtptr = pOsc->wavetblpointer & wavemasks[pOsc->wavetblsize];
-				UINT32 altram;
-				UINT16 wtsize = pOsc->wtsize - 1;
-				UINT8 chnMask = (pOsc->control >> 4) & 0x0F;
-				int resshift = resshifts[pOsc->resolution] - pOsc->wavetblsize;
-				UINT32 sizemask = accmasks[pOsc->wavetblsize];
-				const int mode = (pOsc->control>>1) & 3;
+				smpls = es5503_fetch_run(chip, pOsc, smpls, smplBuf);
+				playing = 1;
+			}
+		}
+		if (! playing)
+			break;	// the oscillators can only be started by each other
 
-				chnMask &= chip->outchn_mask;
-				altram = pOsc->accumulator >> resshift;
-				ramptr = altram & sizemask;
+		if (! smpls)
+		{
+			for (osc = first; osc <= last; osc++)
+			{
+				ES5503Osc *pOsc = &chip->oscillators[osc];
+				if (!(pOsc->control & 1) && ! pOsc->Muted)
+					es5503_render_osc_sample(chip, osc, snum, outputs);
+			}
+			snum ++;
+			continue;
+		}
 
-				pOsc->accumulator += pOsc->freq;
+		blkOuts[0] = &outputs[0][snum];
+		blkOuts[1] = &outputs[1][snum];
+		for (osc = first; osc <= last; osc++)
+		{
+			ES5503Osc *pOsc = &chip->oscillators[osc];
+			if (!(pOsc->control & 1) && ! pOsc->Muted)
+			{
+				if (first < last)	// the buffer holds the data of the last oscillator checked
+					es5503_fetch_run(chip, pOsc, smpls, smplBuf);
+				es5503_render_run(chip, osc, smpls, smplBuf, blkOuts, amVol);
+			}
+		}
+		snum += smpls;
+	}
 
-				// channel strobe is always valid when reading; this allows potentially banking per voice
-				chip->channel_strobe = (pOsc->control>>4) & 0xf;
-				pOsc->data = chip->docram[ramptr + wtptr];
+	return;
+}
 
-				if (pOsc->data == 0x00)
-				{
-					es5503_halt_osc(chip, osc, 1, &pOsc->accumulator, resshift);
-				}
-				else
-				{
-					INT32 outData;
-					if (mode != MODE_SYNCAM)
-					{
-						outData = (pOsc->data - 0x80) * (INT16)pOsc->vol;
-					}
-					else
-					{
-						// if we're odd, we play nothing ourselves
-						if (osc & 1)
-						{
-							if (osc < 31)
-							{
-								// if the next oscillator up is playing, it's volume becomes our control
-								if (!(chip->oscillators[osc + 1].control & 1))
-								{
-									chip->oscillators[osc + 1].vol = pOsc->data;
-								}
-							}
-							outData = 0;
-						}
-						else    // hard sync, both oscillators play?
-						{
-							outData = (pOsc->data - 0x80) * (INT16)pOsc->vol;
-						}
-					}
+static void es5503_pcm_update(void *param, UINT32 samples, DEV_SMPL **outputs)
+{
+	ES5503Chip *chip = (ES5503Chip *)param;
+	UINT8 first, last;
 
-					// send groups of 2 channels to L or R
-					for (chan = 0; chan < chnsStereo; chan ++)
-					{
-						if (chan == chnMask)
-							outputs[chan & 1][snum] += outData;
-					}
-					outData = (outData * 181) >> 8;	// outData *= sqrt(2)
-					// send remaining channels to L+R
-					for (; chan < chip->output_channels; chan ++)
-					{
-						if (chan == chnMask)
-						{
-							outputs[0][snum] += outData;
-							outputs[1][snum] += outData;
-						}
-					}
+	memset(outputs[0], 0, samples * sizeof(DEV_SMPL));
+	memset(outputs[1], 0, samples * sizeof(DEV_SMPL));
+	if (chip->docram == NULL)
+		return;
 
-					if (altram >= wtsize)
-					{
-						es5503_halt_osc(chip, osc, 0, &pOsc->accumulator, resshift);
-					}
-				}
-			}	// end if (oscillators[osc] playing)
-		}	// end for (osc)
-	}	// end for (snum)
+	// Oscillators that don't affect each other are rendered separately.
+	for (first = 0; first < chip->oscsenabled; first = last + 1)
+	{
+		last = first;
+		while (last + 1 < chip->oscsenabled && es5503_osc_linked_to_next(chip, last))
+			last ++;
+		es5503_render_group(chip, first, last, samples, outputs);
+	}
 }
 
 
@@ -5,6 +5,10 @@
 #include "../SoundDevs.h"
 #include "es5506.h"
 
+// Note: The ES5505/ES5506 sound core is not included in this source tree.
+// Only the device declaration is provided, so that the device ID is known,
+// but the device has no emulation cores and can not be started.
+
 static const char* DeviceName(const DEV_GEN_CFG* devCfg)
 {
 	return NULL;
@@ -236,12 +236,13 @@
 *   TL_RES_LEN - sinus resolution (X axis)
 */
 #define TL_TAB_LEN (13*2*TL_RES_LEN)
-static signed int tl_tab[TL_TAB_LEN];
 
 #define ENV_QUIET       (TL_TAB_LEN>>3)
 
-/* sin waveform table in 'decibel' scale */
-static unsigned int sin_tab[SIN_LEN];
+/* tl_tab:  Linear Power Table
+   sin_tab: sin waveform table in 'decibel' scale
+   lfo_pm_table: all 128 LFO PM waveforms */
+#include "fmopn_tables.h"
 
 /* sustain level table (3dB per step) */
 /* bit0, bit1, bit2, bit3, bit4, bit5, bit6 */
@@ -445,11 +446,11 @@ static const UINT8 lfo_ams_depth_shift[4] = {8, 3, 1, 0};
   Modulation level at each depth depends on F-NUMBER bits: 4,5,6,7,8,9,10
   (bits 8,9,10 = FNUM MSB from OCT/FNUM register)
 
-  Here we store only first quarter (positive one) of full waveform.
-  Full table (lfo_pm_table) containing all 128 waveforms is build
-  at run (init) time.
+  Only the first quarter (positive one) of each waveform is defined
+  by the chip, the full table (lfo_pm_table) containing all 128 waveforms
+  is generated by tables_gen.c.
 
-  One value in table below represents 4 (four) basic LFO steps
+  One value in the table represents 4 (four) basic LFO steps
   (1 PM step = 4 AM steps).
 
   For example:
@@ -457,84 +458,8 @@ static const UINT8 lfo_ams_depth_shift[4] = {8, 3, 1, 0};
    one value from "lfo_pm_output" table lasts for 432 consecutive
    samples (4*108=432) and one full LFO waveform cycle lasts for 13824
    samples (32*432=13824; 32 because we store only a quarter of whole
-            waveform in the table below)
+            waveform in the table)
 */
-static const UINT8 lfo_pm_output[7*8][8]={
-/* 7 bits meaningful (of F-NUMBER), 8 LFO output levels per one depth (out of 32), 8 LFO depths */
-/* FNUM BIT 4: 000 0001xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 5 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 6 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 7 */ {0,   0,   0,   0,   1,   1,   1,   1},
-
-/* FNUM BIT 5: 000 0010xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 5 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 6 */ {0,   0,   0,   0,   1,   1,   1,   1},
-/* DEPTH 7 */ {0,   0,   1,   1,   2,   2,   2,   3},
-
-/* FNUM BIT 6: 000 0100xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   1},
-/* DEPTH 5 */ {0,   0,   0,   0,   1,   1,   1,   1},
-/* DEPTH 6 */ {0,   0,   1,   1,   2,   2,   2,   3},
-/* DEPTH 7 */ {0,   0,   2,   3,   4,   4,   5,   6},
-
-/* FNUM BIT 7: 000 1000xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   1,   1},
-/* DEPTH 3 */ {0,   0,   0,   0,   1,   1,   1,   1},
-/* DEPTH 4 */ {0,   0,   0,   1,   1,   1,   1,   2},
-/* DEPTH 5 */ {0,   0,   1,   1,   2,   2,   2,   3},
-/* DEPTH 6 */ {0,   0,   2,   3,   4,   4,   5,   6},
-/* DEPTH 7 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
-
-/* FNUM BIT 8: 001 0000xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   1,   1,   1,   1},
-/* DEPTH 2 */ {0,   0,   0,   1,   1,   1,   2,   2},
-/* DEPTH 3 */ {0,   0,   1,   1,   2,   2,   3,   3},
-/* DEPTH 4 */ {0,   0,   1,   2,   2,   2,   3,   4},
-/* DEPTH 5 */ {0,   0,   2,   3,   4,   4,   5,   6},
-/* DEPTH 6 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
-/* DEPTH 7 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
-
-/* FNUM BIT 9: 010 0000xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   2,   2,   2,   2},
-/* DEPTH 2 */ {0,   0,   0,   2,   2,   2,   4,   4},
-/* DEPTH 3 */ {0,   0,   2,   2,   4,   4,   6,   6},
-/* DEPTH 4 */ {0,   0,   2,   4,   4,   4,   6,   8},
-/* DEPTH 5 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
-/* DEPTH 6 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
-/* DEPTH 7 */ {0,   0,0x10,0x18,0x20,0x20,0x28,0x30},
-
-/* FNUM BIT10: 100 0000xxxx */
-/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
-/* DEPTH 1 */ {0,   0,   0,   0,   4,   4,   4,   4},
-/* DEPTH 2 */ {0,   0,   0,   4,   4,   4,   8,   8},
-/* DEPTH 3 */ {0,   0,   4,   4,   8,   8, 0xc, 0xc},
-/* DEPTH 4 */ {0,   0,   4,   8,   8,   8, 0xc,0x10},
-/* DEPTH 5 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
-/* DEPTH 6 */ {0,   0,0x10,0x18,0x20,0x20,0x28,0x30},
-/* DEPTH 7 */ {0,   0,0x20,0x30,0x40,0x40,0x50,0x60},
-
-};
-
-/* all 128 LFO PM waveforms */
-static INT32 lfo_pm_table[128*8*32]; /* 128 combinations of 7 bits meaningful (of F-NUMBER), 8 LFO depths, 32 LFO output levels per one depth */
 
 /* register number to channel number , slot offset */
 #define OPN_CHAN(N) (N&3)
@@ -551,6 +476,9 @@ static INT32 lfo_pm_table[128*8*32]; /* 128 combinations of 7 bits meaningful (o
 #define OUTD_LEFT   2
 #define OUTD_CENTER 3
 
+/* maximum number of samples a channel is rendered ahead by chan_calc_block() */
+#define FM_BLOCK_LEN    256
+
 
 /* struct describing a single operator (SLOT) */
 typedef struct
@@ -602,12 +530,8 @@ typedef struct
 	UINT8   FB;         /* feedback shift */
 	INT32   op1_out[2]; /* op1 output for feedback */
 
-	INT32   *connect1;  /* SLOT1 output pointer */
-	INT32   *connect3;  /* SLOT3 output pointer */
-	INT32   *connect2;  /* SLOT2 output pointer */
-	INT32   *connect4;  /* SLOT4 output pointer */
+	INT32   *connect4;  /* channel output pointer (carrier accumulator) */
 
-	INT32   *mem_connect;/* where to put the delayed sample (MEM) */
 	INT32   mem_value;  /* delayed sample (MEM) value */
 
 	INT32   pms;        /* channel PMS */
@@ -696,11 +620,11 @@ typedef struct
 	UINT32  LFO_AM;             /* current LFO AM step */
 	UINT32  LFO_PM;             /* current LFO PM step */
 
-	INT32   m2,c1,c2;       /* Phase Modulation input for operators 2,3,4 */
-	INT32   mem;            /* one sample delay memory */
-
 	INT32   out_fm[6];      /* outputs of working channels */
 
+	UINT8   eg_ticks[FM_BLOCK_LEN];         /* EG counter steps after each sample of the current block */
+	INT32   blk_out[6][FM_BLOCK_LEN];       /* channel outputs rendered by OPNCalcBlock() */
+
 #if (BUILD_YM2608||BUILD_YM2610||BUILD_YM2610B)
 	INT32   out_adpcm[4];   /* channel output NONE,LEFT,RIGHT or CENTER for YM2608/YM2610 ADPCM */
 	INT32   out_delta[4];   /* channel output NONE,LEFT,RIGHT or CENTER for YM2608/YM2610 DELTAT*/
@@ -730,8 +654,6 @@ typedef struct
 }
 
 
-static UINT8 tablesInit = 0;
-
 /* status set and IRQ handling */
 INLINE void FM_STATUS_SET(FM_ST *ST,int flag)
 {
@@ -1066,89 +988,9 @@ INLINE void FM_BUSY_SET(FM_ST *ST,int busyclock )
 /* set algorithm connection */
 INLINE void setup_connection( FM_OPN *OPN, FM_CH *CH, int ch )
 {
-	INT32 *carrier = &OPN->out_fm[ch];
-
-	INT32 **om1 = &CH->connect1;
-	INT32 **om2 = &CH->connect3;
-	INT32 **oc1 = &CH->connect2;
-
-	INT32 **memc = &CH->mem_connect;
-
-	switch( CH->ALGO )
-	{
-	case 0:
-		/* M1---C1---MEM---M2---C2---OUT */
-		*om1 = &OPN->c1;
-		*oc1 = &OPN->mem;
-		*om2 = &OPN->c2;
-		*memc= &OPN->m2;
-		break;
-	case 1:
-		/* M1------+-MEM---M2---C2---OUT */
-		/*      C1-+                     */
-		*om1 = &OPN->mem;
-		*oc1 = &OPN->mem;
-		*om2 = &OPN->c2;
-		*memc= &OPN->m2;
-		break;
-	case 2:
-		/* M1-----------------+-C2---OUT */
-		/*      C1---MEM---M2-+          */
-		*om1 = &OPN->c2;
-		*oc1 = &OPN->mem;
-		*om2 = &OPN->c2;
-		*memc= &OPN->m2;
-		break;
-	case 3:
-		/* M1---C1---MEM------+-C2---OUT */
-		/*                 M2-+          */
-		*om1 = &OPN->c1;
-		*oc1 = &OPN->mem;
-		*om2 = &OPN->c2;
-		*memc= &OPN->c2;
-		break;
-	case 4:
-		/* M1---C1-+-OUT */
-		/* M2---C2-+     */
-		/* MEM: not used */
-		*om1 = &OPN->c1;
-		*oc1 = carrier;
-		*om2 = &OPN->c2;
-		*memc= &OPN->mem;   /* store it anywhere where it will not be used */
-		break;
-	case 5:
-		/*    +----C1----+     */
-		/* M1-+-MEM---M2-+-OUT */
-		/*    +----C2----+     */
-		*om1 = NULL;    /* special mark */
-		*oc1 = carrier;
-		*om2 = carrier;
-		*memc= &OPN->m2;
-		break;
-	case 6:
-		/* M1---C1-+     */
-		/*      M2-+-OUT */
-		/*      C2-+     */
-		/* MEM: not used */
-		*om1 = &OPN->c1;
-		*oc1 = carrier;
-		*om2 = carrier;
-		*memc= &OPN->mem;   /* store it anywhere where it will not be used */
-		break;
-	case 7:
-		/* M1-+     */
-		/* C1-+-OUT */
-		/* M2-+     */
-		/* C2-+     */
-		/* MEM: not used*/
-		*om1 = carrier;
-		*oc1 = carrier;
-		*om2 = carrier;
-		*memc= &OPN->mem;   /* store it anywhere where it will not be used */
-		break;
-	}
-
-	CH->connect4 = carrier;
+	/* The operator routing of each algorithm is hardcoded in the chan_calc_algo*() kernels.
+	   Only the output accumulator needs to be bound here. */
+	CH->connect4 = &OPN->out_fm[ch];
 }
 
 /* set detune & multiple */
@@ -1263,7 +1105,7 @@ INLINE void advance_lfo(FM_OPN *OPN)
 	}
 }
 
-INLINE void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
+INLINE void advance_eg_channel(UINT32 eg_cnt, FM_SLOT *SLOT)
 {
 	//unsigned int out;
 	unsigned int i = 4; /* four operators per channel */
@@ -1274,10 +1116,10 @@ INLINE void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 		{
 		case EG_ATT:    /* attack phase */
 		{
-			if (!(OPN->eg_cnt & ((1<<SLOT->eg_sh_ar)-1)))
+			if (!(eg_cnt & ((1<<SLOT->eg_sh_ar)-1)))
 			{
 					/* update attenuation level */
-					SLOT->volume += (~SLOT->volume * (eg_inc[SLOT->eg_sel_ar + ((OPN->eg_cnt>>SLOT->eg_sh_ar)&7)]))>>4;
+					SLOT->volume += (~SLOT->volume * (eg_inc[SLOT->eg_sel_ar + ((eg_cnt>>SLOT->eg_sh_ar)&7)]))>>4;
 
 					/* check phase transition*/
 					if (SLOT->volume <= MIN_ATT_INDEX)
@@ -1297,7 +1139,7 @@ INLINE void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 
 		case EG_DEC:    /* decay phase */
 		{
-			if (!(OPN->eg_cnt & ((1<<SLOT->eg_sh_d1r)-1)))
+			if (!(eg_cnt & ((1<<SLOT->eg_sh_d1r)-1)))
 			{
 					/* SSG EG type */
 					if (SLOT->ssg&0x08)
@@ -1305,7 +1147,7 @@ INLINE void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 						/* update attenuation level */
 						if (SLOT->volume < 0x200)
 					{
-						SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d1r + ((OPN->eg_cnt>>SLOT->eg_sh_d1r)&7)];
+						SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d1r + ((eg_cnt>>SLOT->eg_sh_d1r)&7)];
 
 						/* recalculate EG output */
 						if (SLOT->ssgn ^ (SLOT->ssg&0x04))   /* SSG-EG Output Inversion */
@@ -1317,7 +1159,7 @@ INLINE void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 					else
 					{
 					/* update attenuation level */
-					SLOT->volume += eg_inc[SLOT->eg_sel_d1r + ((OPN->eg_cnt>>SLOT->eg_sh_d1r)&7)];
+					SLOT->volume += eg_inc[SLOT->eg_sel_d1r + ((eg_cnt>>SLOT->eg_sh_d1r)&7)];
 
 					/* recalculate EG output */
 					SLOT->vol_out = (UINT32)SLOT->volume + SLOT->tl;
@@ -1332,7 +1174,7 @@ INLINE void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 
 		case EG_SUS:    /* sustain phase */
 		{
-			if (!(OPN->eg_cnt & ((1<<SLOT->eg_sh_d2r)-1)))
+			if (!(eg_cnt & ((1<<SLOT->eg_sh_d2r)-1)))
 			{
 					/* SSG EG type */
 					if (SLOT->ssg&0x08)
@@ -1340,7 +1182,7 @@ INLINE void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 					/* update attenuation level */
 					if (SLOT->volume < 0x200)
 					{
-						SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d2r + ((OPN->eg_cnt>>SLOT->eg_sh_d2r)&7)];
+						SLOT->volume += 4 * eg_inc[SLOT->eg_sel_d2r + ((eg_cnt>>SLOT->eg_sh_d2r)&7)];
 
 						/* recalculate EG output */
 						if (SLOT->ssgn ^ (SLOT->ssg&0x04))   /* SSG-EG Output Inversion */
@@ -1352,7 +1194,7 @@ INLINE void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 					else
 					{
 						/* update attenuation level */
-						SLOT->volume += eg_inc[SLOT->eg_sel_d2r + ((OPN->eg_cnt>>SLOT->eg_sh_d2r)&7)];
+						SLOT->volume += eg_inc[SLOT->eg_sel_d2r + ((eg_cnt>>SLOT->eg_sh_d2r)&7)];
 
 						/* check phase transition*/
 						if ( SLOT->volume >= MAX_ATT_INDEX )
@@ -1368,14 +1210,14 @@ INLINE void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 
 		case EG_REL:    /* release phase */
 		{
-			if (!(OPN->eg_cnt & ((1<<SLOT->eg_sh_rr)-1)))
+			if (!(eg_cnt & ((1<<SLOT->eg_sh_rr)-1)))
 			{
 					/* SSG EG type */
 					if (SLOT->ssg&0x08)
 					{
 						/* update attenuation level */
 						if (SLOT->volume < 0x200)
-							SLOT->volume += 4 * eg_inc[SLOT->eg_sel_rr + ((OPN->eg_cnt>>SLOT->eg_sh_rr)&7)];
+							SLOT->volume += 4 * eg_inc[SLOT->eg_sel_rr + ((eg_cnt>>SLOT->eg_sh_rr)&7)];
 					/* check phase transition */
 					if (SLOT->volume >= 0x200)
 					{
@@ -1386,7 +1228,7 @@ INLINE void advance_eg_channel(FM_OPN *OPN, FM_SLOT *SLOT)
 					else
 					{
 						/* update attenuation level */
-						SLOT->volume += eg_inc[SLOT->eg_sel_rr + ((OPN->eg_cnt>>SLOT->eg_sh_rr)&7)];
+						SLOT->volume += eg_inc[SLOT->eg_sel_rr + ((eg_cnt>>SLOT->eg_sh_rr)&7)];
 
 						/* check phase transition*/
 						if (SLOT->volume >= MAX_ATT_INDEX)
@@ -1626,21 +1468,13 @@ INLINE signed int op_calc1(UINT32 phase, unsigned int env, signed int pm)
 	return tl_tab[p];
 }
 
-INLINE void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
+/* SLOT1 with self-feedback, common to all algorithms */
+INLINE INT32 chan_calc_op1(FM_CH *CH, UINT32 AM)
 {
 	INT32 out = 0;
-	UINT32 AM = OPN->LFO_AM >> CH->ams;
-	unsigned int eg_out;
-
-	if (CH->Muted)
-		return;
+	unsigned int eg_out = volume_calc(&CH->SLOT[SLOT1]);
 
-	OPN->m2 = OPN->c1 = OPN->c2 = OPN->mem = 0;
-
-	*CH->mem_connect = CH->mem_value;  /* restore delayed sample (MEM) value to m2 or c2 */
-
-	eg_out = volume_calc(&CH->SLOT[SLOT1]);
-	if( eg_out < ENV_QUIET )  /* SLOT 1 */
+	if( eg_out < ENV_QUIET )
 	{
 		if (CH->FB < SIN_BITS)
 			out = (CH->op1_out[0] + CH->op1_out[1]) << (FREQ_SH - CH->FB);
@@ -1650,55 +1484,226 @@ INLINE void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 
 	CH->op1_out[0] = CH->op1_out[1];
 	CH->op1_out[1] = out;
+	return out;
+}
+
+/* SLOT2/3/4 with phase modulation input 'pm' */
+INLINE INT32 chan_calc_op(const FM_SLOT *SLOT, UINT32 AM, INT32 pm)
+{
+	unsigned int eg_out = volume_calc(SLOT);
+
+	if( eg_out < ENV_QUIET )
+		return op_calc(SLOT->phase, eg_out, pm);
+	return 0;
+}
+
+/* Algorithm kernels
+   The operator connections are resolved at compile time instead of routing each
+   operator output through a pointer to a shared accumulator.
+   SLOT1 = M1, SLOT2 = C1, SLOT3 = M2, SLOT4 = C2 */
+
+/* M1---C1---MEM---M2---C2---OUT */
+INLINE INT32 chan_calc_algo0(FM_CH *CH, UINT32 AM)
+{
+	INT32 m1 = chan_calc_op1(CH, AM);
+	INT32 m2 = chan_calc_op(&CH->SLOT[SLOT3], AM, CH->mem_value);
+	CH->mem_value = chan_calc_op(&CH->SLOT[SLOT2], AM, m1);
+	return chan_calc_op(&CH->SLOT[SLOT4], AM, m2);
+}
+
+/* M1------+-MEM---M2---C2---OUT */
+/*      C1-+                     */
+INLINE INT32 chan_calc_algo1(FM_CH *CH, UINT32 AM)
+{
+	INT32 m1 = chan_calc_op1(CH, AM);
+	INT32 m2 = chan_calc_op(&CH->SLOT[SLOT3], AM, CH->mem_value);
+	CH->mem_value = m1 + chan_calc_op(&CH->SLOT[SLOT2], AM, 0);
+	return chan_calc_op(&CH->SLOT[SLOT4], AM, m2);
+}
+
+/* M1-----------------+-C2---OUT */
+/*      C1---MEM---M2-+          */
+INLINE INT32 chan_calc_algo2(FM_CH *CH, UINT32 AM)
+{
+	INT32 m1 = chan_calc_op1(CH, AM);
+	INT32 m2 = chan_calc_op(&CH->SLOT[SLOT3], AM, CH->mem_value);
+	CH->mem_value = chan_calc_op(&CH->SLOT[SLOT2], AM, 0);
+	return chan_calc_op(&CH->SLOT[SLOT4], AM, m1 + m2);
+}
+
+/* M1---C1---MEM------+-C2---OUT */
+/*                 M2-+          */
+INLINE INT32 chan_calc_algo3(FM_CH *CH, UINT32 AM)
+{
+	INT32 m1 = chan_calc_op1(CH, AM);
+	INT32 m2 = chan_calc_op(&CH->SLOT[SLOT3], AM, 0);
+	INT32 c2 = CH->mem_value + m2;
+	CH->mem_value = chan_calc_op(&CH->SLOT[SLOT2], AM, m1);
+	return chan_calc_op(&CH->SLOT[SLOT4], AM, c2);
+}
+
+/* M1---C1-+-OUT */
+/* M2---C2-+     */
+/* MEM: not used */
+INLINE INT32 chan_calc_algo4(FM_CH *CH, UINT32 AM)
+{
+	INT32 m1 = chan_calc_op1(CH, AM);
+	INT32 m2 = chan_calc_op(&CH->SLOT[SLOT3], AM, 0);
+	return chan_calc_op(&CH->SLOT[SLOT2], AM, m1)
+		 + chan_calc_op(&CH->SLOT[SLOT4], AM, m2);
+}
+
+/*    +----C1----+     */
+/* M1-+-MEM---M2-+-OUT */
+/*    +----C2----+     */
+INLINE INT32 chan_calc_algo5(FM_CH *CH, UINT32 AM)
+{
+	INT32 m1 = chan_calc_op1(CH, AM);
+	INT32 out = chan_calc_op(&CH->SLOT[SLOT3], AM, CH->mem_value)
+			  + chan_calc_op(&CH->SLOT[SLOT2], AM, m1)
+			  + chan_calc_op(&CH->SLOT[SLOT4], AM, m1);
+	CH->mem_value = m1;
+	return out;
+}
+
+/* M1---C1-+     */
+/*      M2-+-OUT */
+/*      C2-+     */
+/* MEM: not used */
+INLINE INT32 chan_calc_algo6(FM_CH *CH, UINT32 AM)
+{
+	INT32 m1 = chan_calc_op1(CH, AM);
+	return chan_calc_op(&CH->SLOT[SLOT3], AM, 0)
+		 + chan_calc_op(&CH->SLOT[SLOT2], AM, m1)
+		 + chan_calc_op(&CH->SLOT[SLOT4], AM, 0);
+}
 
-	if( !CH->connect1 ){
-		/* algorithm 5  */
-		OPN->mem = OPN->c1 = OPN->c2 = out;
-	}else{
-		/* other algorithms */
-		*CH->connect1 = out;
+/* M1-+     */
+/* C1-+-OUT */
+/* M2-+     */
+/* C2-+     */
+/* MEM: not used*/
+INLINE INT32 chan_calc_algo7(FM_CH *CH, UINT32 AM)
+{
+	INT32 m1 = chan_calc_op1(CH, AM);
+	return m1
+		 + chan_calc_op(&CH->SLOT[SLOT3], AM, 0)
+		 + chan_calc_op(&CH->SLOT[SLOT2], AM, 0)
+		 + chan_calc_op(&CH->SLOT[SLOT4], AM, 0);
+}
+
+/* phase counter update of a channel with LFO phase modulation */
+INLINE void chan_update_phase_lfo(FM_OPN *OPN, FM_CH *CH)
+{
+	/* 3-slot mode */
+	if ((OPN->ST.mode & 0xC0) && (CH == &OPN->P_CH[2]))
+	{
+		/* keyscale code is not modified by LFO */
+		UINT8 kc = CH->kcode;
+		UINT32 pm = CH->pms + OPN->LFO_PM;
+		update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], pm, kc, OPN->SL3.block_fnum[1]);
+		update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], pm, kc, OPN->SL3.block_fnum[2]);
+		update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], pm, kc, OPN->SL3.block_fnum[0]);
+		update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], pm, kc, CH->block_fnum);
+	}
+	else
+	{
+		update_phase_lfo_channel(OPN, CH);
+	}
+}
+
+/* update phase counters AFTER output calculations */
+#define chan_advance_phase(OPN, CH)                     \
+{                                                       \
+	if ((CH)->pms)                                      \
+		chan_update_phase_lfo(OPN, CH);                 \
+	else  /* no LFO phase modulation */                 \
+	{                                                   \
+		(CH)->SLOT[SLOT1].phase += (CH)->SLOT[SLOT1].Incr;  \
+		(CH)->SLOT[SLOT2].phase += (CH)->SLOT[SLOT2].Incr;  \
+		(CH)->SLOT[SLOT3].phase += (CH)->SLOT[SLOT3].Incr;  \
+		(CH)->SLOT[SLOT4].phase += (CH)->SLOT[SLOT4].Incr;  \
+	}                                                   \
+}
+
+INLINE void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
+{
+	UINT32 AM;
+	INT32 out = 0;
+
+	if (CH->Muted)
+		return;
+
+	AM = OPN->LFO_AM >> CH->ams;
+	switch( CH->ALGO )
+	{
+	case 0: out = chan_calc_algo0(CH, AM);  break;
+	case 1: out = chan_calc_algo1(CH, AM);  break;
+	case 2: out = chan_calc_algo2(CH, AM);  break;
+	case 3: out = chan_calc_algo3(CH, AM);  break;
+	case 4: out = chan_calc_algo4(CH, AM);  break;
+	case 5: out = chan_calc_algo5(CH, AM);  break;
+	case 6: out = chan_calc_algo6(CH, AM);  break;
+	case 7: out = chan_calc_algo7(CH, AM);  break;
 	}
+	*CH->connect4 += out;
 
-	eg_out = volume_calc(&CH->SLOT[SLOT3]);
-	if( eg_out < ENV_QUIET )    /* SLOT 3 */
-		*CH->connect3 += op_calc(CH->SLOT[SLOT3].phase, eg_out, OPN->m2);
+	chan_advance_phase(OPN, CH)
+}
 
-	eg_out = volume_calc(&CH->SLOT[SLOT2]);
-	if( eg_out < ENV_QUIET )    /* SLOT 2 */
-		*CH->connect2 += op_calc(CH->SLOT[SLOT2].phase, eg_out, OPN->c1);
+/* Block processing
+   Between two register writes, a channel without SSG-EG that is not under CSM key control
+   doesn't interact with the rest of the chip. With the LFO disabled its AM/PM inputs are
+   constant as well, so it can be rendered for a whole block with the algorithm dispatch
+   hoisted out of the sample loop. Its envelope generator is stepped using the EG counter
+   schedule precomputed by OPNCalcBlock(), so the result is identical to chan_calc(). */
+INLINE UINT8 chan_block_ok(FM_OPN *OPN, FM_CH *CH)
+{
+	if ((CH->SLOT[SLOT1].ssg | CH->SLOT[SLOT2].ssg | CH->SLOT[SLOT3].ssg | CH->SLOT[SLOT4].ssg) & 0x08)
+		return 0;   /* SSG-EG */
+	if (CH == &OPN->P_CH[2] && ((OPN->ST.mode & 0xC0) == 0x80 || OPN->SL3.key_csm))
+		return 0;   /* CSM mode */
+	return 1;
+}
 
-	eg_out = volume_calc(&CH->SLOT[SLOT4]);
-	if( eg_out < ENV_QUIET )    /* SLOT 4 */
-		*CH->connect4 += op_calc(CH->SLOT[SLOT4].phase, eg_out, OPN->c2);
+#define CHAN_CALC_BLOCK(algo_calc)                                  \
+	for (i = 0; i < length; i ++)                                   \
+	{                                                               \
+		out[i] = algo_calc(CH, AM);                                 \
+		chan_advance_phase(OPN, CH)                                 \
+		for (t = OPN->eg_ticks[i]; t; t --)                         \
+			advance_eg_channel(++eg_cnt, &CH->SLOT[SLOT1]);         \
+	}
 
-	/* store current MEM */
-	CH->mem_value = OPN->mem;
+INLINE void chan_calc_block(FM_OPN *OPN, FM_CH *CH, INT32 *out, UINT32 length)
+{
+	UINT32 AM = OPN->LFO_AM >> CH->ams;
+	UINT32 eg_cnt = OPN->eg_cnt;
+	UINT32 i;
+	UINT8 t;
 
-	/* update phase counters AFTER output calculations */
-	if (CH->pms)
+	if (CH->Muted)
 	{
-		/* 3-slot mode */
-		if ((OPN->ST.mode & 0xC0) && (CH == &OPN->P_CH[2]))
-		{
-			/* keyscale code is not modified by LFO */
-			UINT8 kc = CH->kcode;
-			UINT32 pm = CH->pms + OPN->LFO_PM;
-			update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], pm, kc, OPN->SL3.block_fnum[1]);
-			update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], pm, kc, OPN->SL3.block_fnum[2]);
-			update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], pm, kc, OPN->SL3.block_fnum[0]);
-			update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], pm, kc, CH->block_fnum);
-		}
-		else
+		/* no output and no phase update, but the envelopes keep running */
+		for (i = 0; i < length; i ++)
 		{
-			update_phase_lfo_channel(OPN, CH);
+			out[i] = 0;
+			for (t = OPN->eg_ticks[i]; t; t --)
+				advance_eg_channel(++eg_cnt, &CH->SLOT[SLOT1]);
 		}
+		return;
 	}
-	else  /* no LFO phase modulation */
+
+	switch( CH->ALGO )
 	{
-		CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
-		CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
-		CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
-		CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+	case 0: CHAN_CALC_BLOCK(chan_calc_algo0);  break;
+	case 1: CHAN_CALC_BLOCK(chan_calc_algo1);  break;
+	case 2: CHAN_CALC_BLOCK(chan_calc_algo2);  break;
+	case 3: CHAN_CALC_BLOCK(chan_calc_algo3);  break;
+	case 4: CHAN_CALC_BLOCK(chan_calc_algo4);  break;
+	case 5: CHAN_CALC_BLOCK(chan_calc_algo5);  break;
+	case 6: CHAN_CALC_BLOCK(chan_calc_algo6);  break;
+	case 7: CHAN_CALC_BLOCK(chan_calc_algo7);  break;
 	}
 }
 
@@ -1716,6 +1721,48 @@ INLINE void CSMKeyControl(FM_OPN *OPN, FM_CH *CH)
 
 #if BUILD_OPN
 
+/* Render the next 'length' (up to FM_BLOCK_LEN) samples of the channels in 'mask' that
+   qualify for block processing into OPN->blk_out[].
+   Returns the mask of the rendered channels. The sample loop has to skip them. */
+static UINT8 OPNCalcBlock(FM_OPN *OPN, FM_CH **cch, UINT8 mask, UINT32 length)
+{
+	UINT32 eg_timer;
+	UINT32 i;
+	UINT8 c;
+
+	if (OPN->lfo_timer_overflow)    /* LFO enabled */
+		return 0x00;
+	for (c = 0; c < 6; c ++)
+	{
+		if ((mask & (1 << c)) && ! chan_block_ok(OPN, cch[c]))
+			mask &= ~(1 << c);
+	}
+	if (! mask)
+		return 0x00;
+	if (length > FM_BLOCK_LEN)
+		length = FM_BLOCK_LEN;
+
+	/* EG counter steps done by the sample loop */
+	eg_timer = OPN->eg_timer;
+	for (i = 0; i < length; i ++)
+	{
+		OPN->eg_ticks[i] = 0;
+		eg_timer += OPN->eg_timer_add;
+		while (eg_timer >= OPN->eg_timer_overflow)
+		{
+			eg_timer -= OPN->eg_timer_overflow;
+			OPN->eg_ticks[i] ++;
+		}
+	}
+
+	for (c = 0; c < 6; c ++)
+	{
+		if (mask & (1 << c))
+			chan_calc_block(OPN, cch[c], OPN->blk_out[c], length);
+	}
+	return mask;
+}
+
 /* write a OPN mode register 0x20-0x2f */
 static void OPNWriteMode(FM_OPN *OPN, int r, int v)
 {
@@ -2095,128 +2142,6 @@ static void reset_channels( FM_ST *ST , FM_CH *CH , int num )
 	}
 }
 
-/* initialize generic tables */
-static void init_tables(void)
-{
-	signed int i,x;
-	signed int n;
-	double o,m;
-
-	if (tablesInit)
-		return;
-	tablesInit = 1;
-
-	/* build Linear Power Table */
-	for (x=0; x<TL_RES_LEN; x++)
-	{
-		m = (1<<16) / pow(2, (x+1) * (ENV_STEP/4.0) / 8.0);
-		m = floor(m);
-
-		/* we never reach (1<<16) here due to the (x+1) */
-		/* result fits within 16 bits at maximum */
-
-		n = (int)m;     /* 16 bits here */
-		n >>= 4;        /* 12 bits here */
-		if (n&1)        /* round to nearest */
-			n = (n>>1)+1;
-		else
-			n = n>>1;
-						/* 11 bits here (rounded) */
-		n <<= 2;        /* 13 bits here (as in real chip) */
-
-
-		/* 14 bits (with sign bit) */
-		tl_tab[ x*2 + 0 ] = n;
-		tl_tab[ x*2 + 1 ] = -tl_tab[ x*2 + 0 ];
-
-		/* one entry in the 'Power' table use the following format, xxxxxyyyyyyyys with:            */
-		/*        s = sign bit                                                                      */
-		/* yyyyyyyy = 8-bits decimal part (0-TL_RES_LEN)                                            */
-		/* xxxxx    = 5-bits integer 'shift' value (0-31) but, since Power table output is 13 bits, */
-		/*            any value above 13 (included) would be discarded.                             */
-		for (i=1; i<13; i++)
-		{
-			tl_tab[ x*2+0 + i*2*TL_RES_LEN ] =  tl_tab[ x*2+0 ]>>i;
-			tl_tab[ x*2+1 + i*2*TL_RES_LEN ] = -tl_tab[ x*2+0 + i*2*TL_RES_LEN ];
-		}
-#if 0
-		logerror("tl %04i", x);
-		for (i=0; i<13; i++)
-			logerror(", [%02i] %4x", i*2, tl_tab[ x*2 /*+1*/ + i*2*TL_RES_LEN ]);
-		logerror("\n");
-#endif
-	}
-	/*logerror("FM.C: TL_TAB_LEN = %i elements (%i bytes)\n",TL_TAB_LEN, (int)sizeof(tl_tab));*/
-
-
-	/* build Logarithmic Sinus table */
-	for (i=0; i<SIN_LEN; i++)
-	{
-		/* non-standard sinus */
-		m = sin( ((i*2)+1) * M_PI / SIN_LEN ); /* checked against the real chip */
-		/* we never reach zero here due to ((i*2)+1) */
-
-		if (m>0.0)
-			o = 8*log(1.0/m)/log(2.0);  /* convert to 'decibels' */
-		else
-			o = 8*log(-1.0/m)/log(2.0); /* convert to 'decibels' */
-
-		o = o / (ENV_STEP/4);
-
-		n = (int)(2.0*o);
-		if (n&1)            /* round to nearest */
-			n = (n>>1)+1;
-		else
-			n = n>>1;
-
-		/* 13-bits (8.5) value is formatted for above 'Power' table */
-		sin_tab[ i ] = n*2 + (m>=0.0? 0: 1 );
-		/*logerror("FM.C: sin [%4i]= %4i (tl_tab value=%5i)\n", i, sin_tab[i],tl_tab[sin_tab[i]]);*/
-	}
-
-	/*logerror("FM.C: ENV_QUIET= %08x\n",ENV_QUIET );*/
-
-
-	/* build LFO PM modulation table */
-	for(i = 0; i < 8; i++) /* 8 PM depths */
-	{
-		UINT8 fnum;
-		for (fnum=0; fnum<128; fnum++) /* 7 bits meaningful of F-NUMBER */
-		{
-			UINT8 value;
-			UINT8 step;
-			UINT32 offset_depth = i;
-			UINT32 offset_fnum_bit;
-			UINT32 bit_tmp;
-
-			for (step=0; step<8; step++)
-			{
-				value = 0;
-				for (bit_tmp=0; bit_tmp<7; bit_tmp++) /* 7 bits */
-				{
-					if (fnum & (1<<bit_tmp)) /* only if bit "bit_tmp" is set */
-					{
-						offset_fnum_bit = bit_tmp * 8;
-						value += lfo_pm_output[offset_fnum_bit + offset_depth][step];
-					}
-				}
-				/* 32 steps for LFO PM (sinus) */
-				lfo_pm_table[(fnum*32*8) + (i*32) + step   + 0] = value;
-				lfo_pm_table[(fnum*32*8) + (i*32) +(step^7)+ 8] = value;
-				lfo_pm_table[(fnum*32*8) + (i*32) + step   +16] = -value;
-				lfo_pm_table[(fnum*32*8) + (i*32) +(step^7)+24] = -value;
-			}
-#if 0
-			logerror("LFO depth=%1x FNUM=%04x (<<4=%4x): ", i, fnum, fnum<<4);
-			for (step=0; step<16; step++) /* dump only positive part of waveforms */
-				logerror("%02x ", lfo_pm_table[(fnum*32*8) + (i*32) + step] );
-			logerror("\n");
-#endif
-
-		}
-	}
-}
-
 #endif /* BUILD_OPN */
 
 
@@ -2359,6 +2284,9 @@ void ym2203_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 	YM2203 *F2203 = (YM2203 *)chip;
 	FM_OPN *OPN =   &F2203->OPN;
 	UINT32 i;
+	UINT32 bpos;
+	UINT8 blk;
+	UINT8 c;
 	DEV_SMPL  *bufL,*bufR;
 	FM_CH   *cch[3];
 
@@ -2405,22 +2333,30 @@ void ym2203_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 	OPN->LFO_PM = 0;
 
 	/* buffering */
+	blk = 0x00;
 	for (i=0; i < length ; i++)
 	{
-		/* clear outputs */
-		OPN->out_fm[0] = 0;
-		OPN->out_fm[1] = 0;
-		OPN->out_fm[2] = 0;
+		/* render independent channels ahead */
+		bpos = i % FM_BLOCK_LEN;
+		if (! bpos)
+			blk = OPNCalcBlock(OPN, cch, 0x07, length - i);
 
-		/* update SSG-EG output */
-		update_ssg_eg_channel(&cch[0]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[1]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[2]->SLOT[SLOT1]);
+		for (c = 0; c < 3; c ++)
+		{
+			if (blk & (1 << c))
+			{
+				OPN->out_fm[c] = OPN->blk_out[c][bpos];
+				continue;
+			}
+			/* clear outputs */
+			OPN->out_fm[c] = 0;
 
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
+			/* update SSG-EG output */
+			update_ssg_eg_channel(&cch[c]->SLOT[SLOT1]);
+
+			/* calculate FM */
+			chan_calc(OPN, cch[c], c );
+		}
 
 		/* advance envelope generator */
 		OPN->eg_timer += OPN->eg_timer_add;
@@ -2429,9 +2365,11 @@ void ym2203_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 			OPN->eg_timer -= OPN->eg_timer_overflow;
 			OPN->eg_cnt++;
 
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
+			for (c = 0; c < 3; c ++)
+			{
+				if (! (blk & (1 << c)))
+					advance_eg_channel(OPN->eg_cnt, &cch[c]->SLOT[SLOT1]);
+			}
 		}
 
 		/* buffering */
@@ -2524,9 +2462,6 @@ void * ym2203_init(void *param, UINT32 clock, UINT32 rate,
 	if( F2203==NULL)
 		return NULL;
 
-	/* allocate total level table (128kb space) */
-	init_tables();
-
 	F2203->OPN.ST.param = param;
 	F2203->OPN.type = TYPE_YM2203;
 	F2203->OPN.P_CH = F2203->CH;
@@ -3012,7 +2947,10 @@ void ym2608_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 	FM_OPN *OPN   = &F2608->OPN;
 	YM_DELTAT *DELTAT = &F2608->deltaT;
 	UINT32 i;
+	UINT32 bpos;
+	UINT8 blk;
 	UINT8 j;
+	UINT8 c;
 	DEV_SMPL  *bufL,*bufR;
 	FM_CH   *cch[6];
 	INT32 *out_fm = OPN->out_fm;
@@ -3066,34 +3004,34 @@ void ym2608_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 
 
 	/* buffering */
+	blk = 0x00;
 	for(i=0; i < length ; i++)
 	{
+		/* render independent channels ahead */
+		bpos = i % FM_BLOCK_LEN;
+		if (! bpos)
+			blk = OPNCalcBlock(OPN, cch, 0x3F, length - i);
+
 		/* clear output acc. */
 		OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
 		OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
-		/* clear outputs */
-		out_fm[0] = 0;
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[3] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
-
-		/* update SSG-EG output */
-		update_ssg_eg_channel(&cch[0]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[1]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[2]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[3]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[4]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[5]->SLOT[SLOT1]);
 
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
-		chan_calc(OPN, cch[5], 5 );
+		for (c = 0; c < 6; c ++)
+		{
+			if (blk & (1 << c))
+			{
+				out_fm[c] = OPN->blk_out[c][bpos];
+				continue;
+			}
+			/* clear outputs */
+			out_fm[c] = 0;
+
+			/* update SSG-EG output */
+			update_ssg_eg_channel(&cch[c]->SLOT[SLOT1]);
+
+			/* calculate FM */
+			chan_calc(OPN, cch[c], c );
+		}
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 && ! F2608->MuteDeltaT )
@@ -3116,12 +3054,11 @@ void ym2608_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 			OPN->eg_timer -= OPN->eg_timer_overflow;
 			OPN->eg_cnt++;
 
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[4]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[5]->SLOT[SLOT1]);
+			for (c = 0; c < 6; c ++)
+			{
+				if (! (blk & (1 << c)))
+					advance_eg_channel(OPN->eg_cnt, &cch[c]->SLOT[SLOT1]);
+			}
 		}
 
 		/* buffering */
@@ -3206,9 +3143,6 @@ void * ym2608_init(void *param, UINT32 clock, UINT32 rate,
 	if( F2608==NULL)
 		return NULL;
 
-	/* allocate total level table (128kb space) */
-	init_tables();
-
 	F2608->OPN.ST.param = param;
 	F2608->OPN.type = TYPE_YM2608;
 	F2608->OPN.P_CH = F2608->CH;
@@ -3602,7 +3536,10 @@ void ym2610_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 	FM_OPN *OPN   = &F2610->OPN;
 	YM_DELTAT *DELTAT = &F2610->deltaT;
 	UINT32 i;
+	UINT32 bpos;
+	UINT8 blk;
 	UINT8 j;
+	UINT8 c;
 	DEV_SMPL  *bufL,*bufR;
 	FM_CH   *cch[4];
 	INT32 *out_fm = OPN->out_fm;
@@ -3665,28 +3602,35 @@ void ym2610_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 	}
 
 	/* buffering */
+	blk = 0x00;
 	for(i=0; i < length ; i++)
 	{
+		/* render independent channels ahead */
+		bpos = i % FM_BLOCK_LEN;
+		if (! bpos)
+			blk = OPNCalcBlock(OPN, cch, 0x0F, length - i);
+
 		/* clear output acc. */
 		OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
 		OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
-		/* clear outputs */
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
 
-		/* update SSG-EG output */
-		update_ssg_eg_channel(&cch[0]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[1]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[2]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[3]->SLOT[SLOT1]);
+		for (c = 0; c < 4; c ++)
+		{
+			j = c + 1 + (c >> 1);	/* channels are remapped to 1, 2, 4, 5 */
+			if (blk & (1 << c))
+			{
+				out_fm[j] = OPN->blk_out[c][bpos];
+				continue;
+			}
+			/* clear outputs */
+			out_fm[j] = 0;
 
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 1 );	/*remapped to 1*/
-		chan_calc(OPN, cch[1], 2 );	/*remapped to 2*/
-		chan_calc(OPN, cch[2], 4 );	/*remapped to 4*/
-		chan_calc(OPN, cch[3], 5 );	/*remapped to 5*/
+			/* update SSG-EG output */
+			update_ssg_eg_channel(&cch[c]->SLOT[SLOT1]);
+
+			/* calculate FM */
+			chan_calc(OPN, cch[c], j );
+		}
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 && ! F2610->MuteDeltaT )
@@ -3709,10 +3653,11 @@ void ym2610_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 			OPN->eg_timer -= OPN->eg_timer_overflow;
 			OPN->eg_cnt++;
 
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
+			for (c = 0; c < 4; c ++)
+			{
+				if (! (blk & (1 << c)))
+					advance_eg_channel(OPN->eg_cnt, &cch[c]->SLOT[SLOT1]);
+			}
 		}
 
 		/* buffering */
@@ -3779,7 +3724,10 @@ void ym2610b_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 	FM_OPN *OPN   = &F2610->OPN;
 	YM_DELTAT *DELTAT = &F2610->deltaT;
 	UINT32 i;
+	UINT32 bpos;
+	UINT8 blk;
 	UINT8 j;
+	UINT8 c;
 	DEV_SMPL  *bufL,*bufR;
 	FM_CH   *cch[6];
 	INT32 *out_fm = OPN->out_fm;
@@ -3832,34 +3780,34 @@ void ym2610b_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 	}
 
 	/* buffering */
+	blk = 0x00;
 	for(i=0; i < length ; i++)
 	{
+		/* render independent channels ahead */
+		bpos = i % FM_BLOCK_LEN;
+		if (! bpos)
+			blk = OPNCalcBlock(OPN, cch, 0x3F, length - i);
+
 		/* clear output acc. */
 		OPN->out_adpcm[OUTD_LEFT] = OPN->out_adpcm[OUTD_RIGHT] = OPN->out_adpcm[OUTD_CENTER] = 0;
 		OPN->out_delta[OUTD_LEFT] = OPN->out_delta[OUTD_RIGHT] = OPN->out_delta[OUTD_CENTER] = 0;
-		/* clear outputs */
-		out_fm[0] = 0;
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[3] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
-
-		/* update SSG-EG output */
-		update_ssg_eg_channel(&cch[0]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[1]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[2]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[3]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[4]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[5]->SLOT[SLOT1]);
 
-		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
-		chan_calc(OPN, cch[5], 5 );
+		for (c = 0; c < 6; c ++)
+		{
+			if (blk & (1 << c))
+			{
+				out_fm[c] = OPN->blk_out[c][bpos];
+				continue;
+			}
+			/* clear outputs */
+			out_fm[c] = 0;
+
+			/* update SSG-EG output */
+			update_ssg_eg_channel(&cch[c]->SLOT[SLOT1]);
+
+			/* calculate FM */
+			chan_calc(OPN, cch[c], c );
+		}
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 && ! F2610->MuteDeltaT )
@@ -3882,12 +3830,11 @@ void ym2610b_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 			OPN->eg_timer -= OPN->eg_timer_overflow;
 			OPN->eg_cnt++;
 
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[4]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[5]->SLOT[SLOT1]);
+			for (c = 0; c < 6; c ++)
+			{
+				if (! (blk & (1 << c)))
+					advance_eg_channel(OPN->eg_cnt, &cch[c]->SLOT[SLOT1]);
+			}
 		}
 
 
@@ -3967,9 +3914,6 @@ void *ym2610_init(void *param, UINT32 clock, UINT32 rate,
 	if( F2610==NULL)
 		return NULL;
 
-	/* allocate total level table (128kb space) */
-	init_tables();
-
 	/* FM */
 	F2610->OPN.ST.param = param;
 	F2610->OPN.type = TYPE_YM2610;
@@ -4371,6 +4315,9 @@ void ym2612_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 	INT32 dacout;
 	FM_CH   *cch[6];
 	INT32 lt,rt;
+	UINT32 bpos;
+	UINT8 blk;
+	UINT8 c;
 
 	/* set buffer */
 	if (buffer != NULL)
@@ -4427,35 +4374,39 @@ void ym2612_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 
 
 	/* buffering */
+	blk = 0x00;
 	for(i=0; i < length ; i++)
 	{
-		/* clear outputs */
-		out_fm[0] = 0;
-		out_fm[1] = 0;
-		out_fm[2] = 0;
-		out_fm[3] = 0;
-		out_fm[4] = 0;
-		out_fm[5] = 0;
-
-		/* update SSG-EG output */
-		update_ssg_eg_channel(&cch[0]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[1]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[2]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[3]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[4]->SLOT[SLOT1]);
-		update_ssg_eg_channel(&cch[5]->SLOT[SLOT1]);
+		/* render independent channels ahead (the DAC replaces channel 6, DAC test mode all of them) */
+		bpos = i % FM_BLOCK_LEN;
+		if (! bpos && ! F2612->dac_test)
+			blk = OPNCalcBlock(OPN, cch, F2612->dacen ? 0x1F : 0x3F, length - i);
+
+		for (c = 0; c < 6; c ++)
+		{
+			if (blk & (1 << c))
+			{
+				out_fm[c] = OPN->blk_out[c][bpos];
+				continue;
+			}
+			/* clear outputs */
+			out_fm[c] = 0;
+
+			/* update SSG-EG output */
+			update_ssg_eg_channel(&cch[c]->SLOT[SLOT1]);
+		}
 
 		/* calculate FM */
 		if (! F2612->dac_test)
 		{
-			chan_calc(OPN, cch[0], 0 );
-			chan_calc(OPN, cch[1], 1 );
-			chan_calc(OPN, cch[2], 2 );
-			chan_calc(OPN, cch[3], 3 );
-			chan_calc(OPN, cch[4], 4 );
+			for (c = 0; c < 5; c ++)
+			{
+				if (! (blk & (1 << c)))
+					chan_calc(OPN, cch[c], c );
+			}
 			if( F2612->dacen )
 				*cch[5]->connect4 += dacout;
-			else
+			else if (! (blk & 0x20))
 				chan_calc(OPN, cch[5], 5 );
 		}
 		else
@@ -4475,12 +4426,11 @@ void ym2612_update_one(void *chip, UINT32 length, DEV_SMPL **buffer)
 			OPN->eg_timer -= OPN->eg_timer_overflow;
 			OPN->eg_cnt++;
 
-			advance_eg_channel(OPN, &cch[0]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[1]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[2]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[3]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[4]->SLOT[SLOT1]);
-			advance_eg_channel(OPN, &cch[5]->SLOT[SLOT1]);
+			for (c = 0; c < 6; c ++)
+			{
+				if (! (blk & (1 << c)))
+					advance_eg_channel(OPN->eg_cnt, &cch[c]->SLOT[SLOT1]);
+			}
 		}
 
 		/* channels accumulator output clipping (14-bit max) */
@@ -4576,9 +4526,6 @@ void * ym2612_init(void *param, UINT32 clock, UINT32 rate,
 	if (F2612 == NULL)
 		return NULL;
 
-	/* allocate total level table (128kb space) */
-	init_tables();
-
 	/* FM */
 	F2612->OPN.ST.param = param;
 	F2612->OPN.type = TYPE_YM2612;
@@ -630,22 +630,80 @@ static bool playing(ics2115_voice *voice)
 	return voice->state.on && !(voice->osc_conf.bitflags.stop);
 }
 
-static void update_ramp(ics2115_voice *voice)
+enum
 {
-	//slow attack
-	if (voice->state.on && !voice->osc_conf.bitflags.stop)
+	SMPL_FMT_16BIT,
+	SMPL_FMT_8BIT,
+	SMPL_FMT_ULAW
+};
+
+// Renders the voice while it is playing and returns the number of samples done.
+// 'format' is a constant at each call site, so the compiler can generate a separate loop
+// for each sample format.
+INLINE UINT32 fill_playing(ics2115_state *chip, ics2115_voice *voice, UINT32 samples,
+							INT32 *loutput, INT32 *routput, UINT8 format, UINT8 *irq_invalid)
+{
+	const UINT8 *rom = chip->rom + ((voice->osc.saddr & 0x0F) << 20);
+	INT16 lpan = chip->panlaw[255 - voice->vol.pan];
+	INT16 rpan = chip->panlaw[voice->vol.pan];
+	UINT8 muted = voice->Muted;
+	UINT32 i;
+
+	for (i = 0; i < samples && playing(voice); i++)
 	{
+		UINT32 volacc = (voice->vol.acc >> 14) & 0xfff;
+		INT16 vlefti = volacc - lpan;
+		INT16 vrighti = volacc - rpan;
+		UINT16 vleft = vlefti > 0 ? (chip->volume[vlefti] * voice->state.ramp >> RAMP_SHIFT) : 0;
+		UINT16 vright = vrighti > 0 ? (chip->volume[vrighti] * voice->state.ramp >> RAMP_SHIFT) : 0;
+		UINT32 curaddr = voice->osc.acc >> 12;
+		UINT32 nextaddr;
+		INT16 sample1, sample2;
+		UINT16 fract;
+		INT32 sample;
+
+		// same as get_sample()
+		switch (format)
+		{
+		case SMPL_FMT_ULAW:
+			sample1 = chip->ulaw[rom[curaddr & 0xFFFFF]];
+			sample2 = chip->ulaw[rom[(curaddr + 1) & 0xFFFFF]];
+			break;
+		case SMPL_FMT_8BIT:
+			sample1 = ((INT8)rom[curaddr & 0xFFFFF]) << 8;
+			sample2 = ((INT8)rom[(curaddr + 1) & 0xFFFFF]) << 8;
+			break;
+		default:
+			if (voice->osc_conf.bitflags.loop && !voice->osc_conf.bitflags.loop_bidir &&
+					(voice->osc.left < (voice->osc.fc << 2)))
+				nextaddr = voice->osc.start >> 12;
+			else
+				nextaddr = curaddr + 2;
+			sample1 = rom[curaddr & 0xFFFFF] | (((INT8)rom[(curaddr + 1) & 0xFFFFF]) << 8);
+			sample2 = rom[nextaddr & 0xFFFFF] | (((INT8)rom[(nextaddr + 1) & 0xFFFFF]) << 8);
+			break;
+		}
+		fract = (voice->osc.acc >> 3) & 0x1ff;
+		sample = (((INT32)sample1 << 9) + (sample2 - sample1) * fract) >> 9;
+
+		if (!muted)
+		{
+			loutput[i] += (sample * vleft) >> (5 + VOLUME_BITS);
+			routput[i] += (sample * vright) >> (5 + VOLUME_BITS);
+		}
+
+		// slow attack
 		if (voice->state.ramp < 0x40)
 			voice->state.ramp += 0x1;
 		else
 			voice->state.ramp = 0x40;
+
+		if (update_oscillator(voice))
+			*irq_invalid = 1;
+		if (update_volume_envelope(voice))
+			*irq_invalid = 1;
 	}
-	//slow release
-	else
-	{
-		if (voice->state.ramp)
-			voice->state.ramp -= 0x1;
-	}
+	return i;
 }
 
 static UINT8 fill_output(ics2115_state *chip, ics2115_voice *voice, UINT32 samples, INT32 *loutput, INT32 *routput)
@@ -655,14 +713,20 @@ static UINT8 fill_output(ics2115_state *chip, ics2115_voice *voice, UINT32 sampl
 	UINT16 fine = 1 << (3 * (voice->vol.incr >> 6));
 	voice->vol.add = (voice->vol.incr & 0x3f) << (10 - fine);
 
-	for (i = 0; i < samples; i++)
+	if (voice->osc_conf.bitflags.ulaw)
+		i = fill_playing(chip, voice, samples, loutput, routput, SMPL_FMT_ULAW, &irq_invalid);
+	else if (voice->osc_conf.bitflags.eightbit)
+		i = fill_playing(chip, voice, samples, loutput, routput, SMPL_FMT_8BIT, &irq_invalid);
+	else
+		i = fill_playing(chip, voice, samples, loutput, routput, SMPL_FMT_16BIT, &irq_invalid);
+
+	// When the voice isn't playing, neither the sample position nor the volume envelope move.
+	// Only the release ramp runs down, and the voice is silent once it reaches 0.
+	if (i < samples && voice->state.ramp)
 	{
 		UINT32 volacc = (voice->vol.acc >> 14) & 0xfff;
 		INT16 vlefti = volacc - chip->panlaw[255 - voice->vol.pan]; // left index from acc - pan law
 		INT16 vrighti = volacc - chip->panlaw[voice->vol.pan]; // right index from acc - pan law
-		//check negative values so no cracks, is it a hardware feature ?
-		UINT16 vleft = vlefti > 0 ? (chip->volume[vlefti] * voice->state.ramp >> RAMP_SHIFT) : 0;
-		UINT16 vright = vrighti > 0 ? (chip->volume[vrighti] * voice->state.ramp >> RAMP_SHIFT) : 0;
 
 		//From GUS doc:
 		//In general, it is necessary to remember that all voices are being summed in to the
@@ -670,22 +734,23 @@ static UINT8 fill_output(ics2115_state *chip, ics2115_voice *voice, UINT32 sampl
 		//that the voice is pointing at is contributing to the summation.
 		//(austere note: this will of course fix some of the glitches due to multiple transition)
 		INT32 sample = get_sample(chip, voice);
+		UINT8 output = !chip->vmode && !voice->Muted;
 
-		//15-bit volume + (5-bit worth of 32 channel sum) + 16-bit samples = 4-bit extra
-		//if (playing(voice))
-		if ((!chip->vmode || playing(voice)) && (!voice->Muted))
+		for (; i < samples && voice->state.ramp; i++)
 		{
-			loutput[i] += (sample * vleft) >> (5 + VOLUME_BITS);
-			routput[i] += (sample * vright) >> (5 + VOLUME_BITS);
-		}
+			//check negative values so no cracks, is it a hardware feature ?
+			UINT16 vleft = vlefti > 0 ? (chip->volume[vlefti] * voice->state.ramp >> RAMP_SHIFT) : 0;
+			UINT16 vright = vrighti > 0 ? (chip->volume[vrighti] * voice->state.ramp >> RAMP_SHIFT) : 0;
 
-		update_ramp(voice);
-		if (playing(voice))
-		{
-			if (update_oscillator(voice))
-				irq_invalid = 1;
-			if (update_volume_envelope(voice))
-				irq_invalid = 1;
+			//15-bit volume + (5-bit worth of 32 channel sum) + 16-bit samples = 4-bit extra
+			if (output)
+			{
+				loutput[i] += (sample * vleft) >> (5 + VOLUME_BITS);
+				routput[i] += (sample * vright) >> (5 + VOLUME_BITS);
+			}
+
+			//slow release
+			voice->state.ramp -= 0x1;
 		}
 	}
 	return irq_invalid;
@@ -21,6 +21,7 @@
 #include "../snddef.h"
 #include "../EmuHelper.h"
 #include "../logging.h"
+#include "../pcmmix.h"
 #include "k054539.h"
 
 static void k054539_update(void *param, UINT32 samples, DEV_SMPL **outputs);
@@ -36,6 +37,7 @@ static void k054539_set_gain(void *chip, UINT8 channel, double _gain);
 
 static void k054539_alloc_rom(void* chip, UINT32 memsize);
 static void k054539_write_rom(void *chip, UINT32 offset, UINT32 length, const UINT8* data);
+static void k054539_attach_rom(void *chip, UINT32 length, const UINT8* data);
 
 static void k054539_set_mute_mask(void *chip, UINT32 MuteMask);
 static void k054539_set_log_cb(void* chip, DEVCB_LOG func, void* param);
@@ -47,6 +49,7 @@ static DEVDEF_RWFUNC devFunc[] =
 	{RWF_REGISTER | RWF_READ, DEVRW_A16D8, 0, k054539_r},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, k054539_write_rom},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, k054539_alloc_rom},
+	{RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, k054539_attach_rom},
 	{RWF_CHN_MUTE | RWF_WRITE, DEVRW_ALL, 0, k054539_set_mute_mask},
 	{0x00, 0x00, 0, NULL}
 };
@@ -169,6 +172,7 @@ struct _k054539_state {
 	UINT32 cur_ptr;
 	UINT32 rom_addr;
 	UINT8 *rom;
+	UINT8 rom_owned;
 	UINT32 rom_size;
 	UINT32 rom_mask;
 
@@ -214,18 +218,219 @@ static void k054539_keyoff(k054539_state *info, int channel)
 		info->regs[0x22c] &= ~(1 << channel);
 }
 
+#define K054539_BLOCK	256
+
+// channel state while rendering a block
+typedef struct
+{
+	k054539_state *info;
+	int ch;
+	UINT8 *base1;
+	UINT8 regupd;
+	UINT32 reg_pos;
+	UINT32 loop_pos;
+	int delta, fdelta, pdelta;
+	UINT32 cur_pos;
+	int cur_pfrac, cur_val, cur_pval;
+} k054539_voice;
+
+static void k054539_voice_load(k054539_state *info, int ch, k054539_voice *vc)
+{
+	UINT8 *base1 = info->regs + 0x20*ch;
+	UINT8 *base2 = info->regs + 0x200 + 0x2*ch;
+	k054539_channel *chan = info->channels + ch;
+
+	vc->info = info;
+	vc->ch = ch;
+	vc->base1 = base1;
+	vc->regupd = k054539_regupdate(info);
+	vc->reg_pos = base1[0x0c] | (base1[0x0d] << 8) | (base1[0x0e] << 16);
+	vc->loop_pos = (base2[1] & 1) ? (base1[0x08] | (base1[0x09] << 8) | (base1[0x0a] << 16)) : (UINT32)-1;
+
+	vc->delta = base1[0x00] | (base1[0x01] << 8) | (base1[0x02] << 16);
+	if(base2[0] & 0x20) {
+		vc->delta = -vc->delta;
+		vc->fdelta = +0x10000;
+		vc->pdelta = -1;
+	} else {
+		vc->fdelta = -0x10000;
+		vc->pdelta = +1;
+	}
+
+	vc->cur_pos = chan->pos;
+	vc->cur_pfrac = chan->pfrac;
+	vc->cur_val = chan->val;
+	vc->cur_pval = chan->pval;
+}
+
+static void k054539_voice_store(k054539_voice *vc)
+{
+	k054539_channel *chan = vc->info->channels + vc->ch;
+
+	chan->pos = vc->cur_pos;
+	chan->pfrac = vc->cur_pfrac;
+	chan->pval = vc->cur_pval;
+	chan->val = vc->cur_val;
+
+	if(vc->regupd) {
+		vc->base1[0x0c] = vc->cur_pos     & 0xff;
+		vc->base1[0x0d] = vc->cur_pos>> 8 & 0xff;
+		vc->base1[0x0e] = vc->cur_pos>>16 & 0xff;
+	}
+}
+
+// start of a sample: a write to the position register restarts the channel
+// Without register updates, this happens for every sample the channel moved.
+INLINE void k054539_voice_sync(k054539_voice *vc)
+{
+	if(vc->cur_pos != vc->reg_pos) {
+		vc->cur_pos = vc->reg_pos;
+		vc->cur_pfrac = 0;
+		vc->cur_val = 0;
+		vc->cur_pval = 0;
+	}
+}
+
+// end of a sample: returns 0 when the channel was keyed off
+INLINE UINT8 k054539_voice_next(k054539_voice *vc)
+{
+	if(vc->regupd)
+		vc->reg_pos = vc->cur_pos & 0xffffff;
+	return (vc->info->regs[0x22c] >> vc->ch) & 1;
+}
+
+// The render functions return the number of samples written to 'out'.
+static UINT32 k054539_render_pcm8(k054539_voice *vc, INT32 *out, UINT32 samples)
+{
+	k054539_state *info = vc->info;
+	UINT32 i;
+
+	for(i = 0; i < samples; ) {
+		k054539_voice_sync(vc);
+		vc->cur_pfrac += vc->delta;
+		while(vc->cur_pfrac & ~0xffff) {
+			vc->cur_pfrac += vc->fdelta;
+			vc->cur_pos += vc->pdelta;
+
+			vc->cur_pval = vc->cur_val;
+			vc->cur_val = (INT16)(info->rom[vc->cur_pos & info->rom_mask] << 8);
+			if(vc->cur_val == (INT16)0x8000 && vc->loop_pos != (UINT32)-1) {
+				vc->cur_pos = vc->loop_pos;
+				vc->cur_val = (INT16)(info->rom[vc->cur_pos & info->rom_mask] << 8);
+			}
+
+			if(vc->cur_val == (INT16)0x8000) {
+				k054539_keyoff(info, vc->ch);
+				vc->cur_val = 0;
+				break;
+			}
+		}
+		out[i++] = vc->cur_val;
+		if(!k054539_voice_next(vc))
+			break;
+	}
+	return i;
+}
+
+static UINT32 k054539_render_pcm16(k054539_voice *vc, INT32 *out, UINT32 samples)
+{
+	k054539_state *info = vc->info;
+	int pdelta = vc->pdelta << 1;
+	UINT32 i;
+
+	for(i = 0; i < samples; ) {
+		k054539_voice_sync(vc);
+		vc->cur_pfrac += vc->delta;
+		while(vc->cur_pfrac & ~0xffff) {
+			vc->cur_pfrac += vc->fdelta;
+			vc->cur_pos += pdelta;
+
+			vc->cur_pval = vc->cur_val;
+			vc->cur_val = (INT16)(info->rom[vc->cur_pos & info->rom_mask] | info->rom[(vc->cur_pos+1) & info->rom_mask]<<8);
+			if(vc->cur_val == (INT16)0x8000 && vc->loop_pos != (UINT32)-1) {
+				vc->cur_pos = vc->loop_pos;
+				vc->cur_val = (INT16)(info->rom[vc->cur_pos & info->rom_mask] | info->rom[(vc->cur_pos+1) & info->rom_mask]<<8);
+			}
+
+			if(vc->cur_val == (INT16)0x8000) {
+				k054539_keyoff(info, vc->ch);
+				vc->cur_val = 0;
+				break;
+			}
+		}
+		out[i++] = vc->cur_val;
+		if(!k054539_voice_next(vc))
+			break;
+	}
+	return i;
+}
+
+static UINT32 k054539_render_dpcm4(k054539_voice *vc, INT32 *out, UINT32 samples)
+{
+	k054539_state *info = vc->info;
+	UINT32 cur_pos;
+	int cur_pfrac;
+	UINT32 i;
+
+	for(i = 0; i < samples; ) {
+		k054539_voice_sync(vc);
+
+		// the position is counted in nibbles while stepping
+		cur_pos = vc->cur_pos << 1;
+		cur_pfrac = vc->cur_pfrac << 1;
+		if(cur_pfrac & 0x10000) {
+			cur_pfrac &= 0xffff;
+			cur_pos |= 1;
+		}
+
+		cur_pfrac += vc->delta;
+		while(cur_pfrac & ~0xffff) {
+			UINT8 nibble;
+
+			cur_pfrac += vc->fdelta;
+			cur_pos += vc->pdelta;
+
+			vc->cur_pval = vc->cur_val;
+			nibble = info->rom[(cur_pos>>1) & info->rom_mask];
+			if(nibble == 0x88 && vc->loop_pos != (UINT32)-1) {
+				cur_pos = vc->loop_pos << 1;
+				nibble = info->rom[(cur_pos>>1) & info->rom_mask];
+			}
+			if(nibble == 0x88) {
+				k054539_keyoff(info, vc->ch);
+				vc->cur_val = 0;
+				break;
+			}
+			if(cur_pos & 1)
+				nibble >>= 4;
+			vc->cur_val = PcmMix_DecodeDPCM4(vc->cur_pval, nibble);
+		}
+
+		cur_pfrac >>= 1;
+		if(cur_pos & 1)
+			cur_pfrac |= 0x8000;
+		vc->cur_pos = cur_pos >> 1;
+		vc->cur_pfrac = cur_pfrac;
+
+		out[i++] = vc->cur_val;
+		if(!k054539_voice_next(vc))
+			break;
+	}
+	return i;
+}
+
 static void k054539_update(void *param, UINT32 samples, DEV_SMPL **outputs)
 {
 	k054539_state *info = (k054539_state *)param;
 #define VOL_CAP 1.80
 
-	static const INT16 dpcm[16] = {
-		0 * 0x100,   1 * 0x100,   2 * 0x100,   4 * 0x100,  8 * 0x100, 16 * 0x100, 32 * 0x100, 64 * 0x100,
-		0 * 0x100, -64 * 0x100, -32 * 0x100, -16 * 0x100, -8 * 0x100, -4 * 0x100, -2 * 0x100, -1 * 0x100
-	};
-
 	INT16 *rbase = (INT16 *)info->ram;
-	UINT32 sample, ch;
+	INT32 vals[8][K054539_BLOCK];
+	float lvol[8], rvol[8];
+	double rbvol[8];
+	int rdelta[8];
+	UINT8 active;
+	UINT32 sample, blk_len, i, ch;
 
 	if(info->rom == NULL || !(info->regs[0x22f] & 1))
 	{
@@ -234,193 +439,112 @@ static void k054539_update(void *param, UINT32 samples, DEV_SMPL **outputs)
 		return;
 	}
 
-	for(sample = 0; sample != samples; sample++) {
-		float lval, rval;
-		if(!(info->flags & K054539_DISABLE_REVERB))
-			lval = rval = rbase[info->reverb_pos];
+	// The registers don't change during the update, so volume and pan are calculated once.
+	for(ch=0; ch<8; ch++) {
+		UINT8 *base1 = info->regs + 0x20*ch;
+		int vol, bval, pan;
+		double cur_gain, lv, rv, rbv;
+
+		vol = base1[0x03];
+
+		bval = vol + base1[0x04];
+		if (bval > 255)
+			bval = 255;
+
+		pan = base1[0x05];
+		// DJ Main: 81-87 right, 88 middle, 89-8f left
+		if (pan >= 0x81 && pan <= 0x8f)
+			pan -= 0x81;
+		else if (pan >= 0x11 && pan <= 0x1f)
+			pan -= 0x11;
 		else
-			lval = rval = 0;
-		rbase[info->reverb_pos] = 0;
-
-		for(ch=0; ch<8; ch++)
-			if(info->regs[0x22c] & (1<<ch) && ! info->Muted[ch]) {
-				UINT8 *base1 = info->regs + 0x20*ch;
-				UINT8 *base2 = info->regs + 0x200 + 0x2*ch;
-				k054539_channel *chan = info->channels + ch;
-				int delta, vol, bval, pan;
-				double cur_gain, lvol, rvol, rbvol;
-				UINT32 cur_pos;
-				int rdelta, fdelta, pdelta;
-				int cur_pfrac, cur_val, cur_pval;
-
-				delta = base1[0x00] | (base1[0x01] << 8) | (base1[0x02] << 16);
-
-				vol = base1[0x03];
-
-				bval = vol + base1[0x04];
-				if (bval > 255)
-					bval = 255;
-
-				pan = base1[0x05];
-				// DJ Main: 81-87 right, 88 middle, 89-8f left
-				if (pan >= 0x81 && pan <= 0x8f)
-					pan -= 0x81;
-				else if (pan >= 0x11 && pan <= 0x1f)
-					pan -= 0x11;
-				else
-					pan = 0x18 - 0x11;
-
-				cur_gain = info->gain[ch];
-
-				lvol = info->voltab[vol] * info->pantab[pan] * cur_gain;
-				if (lvol > VOL_CAP)
-					lvol = VOL_CAP;
-
-				rvol = info->voltab[vol] * info->pantab[0xe - pan] * cur_gain;
-				if (rvol > VOL_CAP)
-					rvol = VOL_CAP;
-
-				rbvol= info->voltab[bval] * cur_gain / 2;
-				if (rbvol > VOL_CAP)
-					rbvol = VOL_CAP;
-
-				rdelta = (base1[6] | (base1[7] << 8)) >> 3;
-				rdelta = (rdelta + info->reverb_pos) & 0x3fff;
-
-				cur_pos = base1[0x0c] | (base1[0x0d] << 8) | (base1[0x0e] << 16);
-
-				if(base2[0] & 0x20) {
-					delta = -delta;
-					fdelta = +0x10000;
-					pdelta = -1;
-				} else {
-					fdelta = -0x10000;
-					pdelta = +1;
-				}
+			pan = 0x18 - 0x11;
 
-				if(cur_pos != chan->pos) {
-					chan->pos = cur_pos;
-					cur_pfrac = 0;
-					cur_val = 0;
-					cur_pval = 0;
-				} else {
-					cur_pfrac = chan->pfrac;
-					cur_val = chan->val;
-					cur_pval = chan->pval;
-				}
+		cur_gain = info->gain[ch];
 
-				switch(base2[0] & 0xc) {
-				case 0x0: { // 8bit pcm
-					cur_pfrac += delta;
-					while(cur_pfrac & ~0xffff) {
-						cur_pfrac += fdelta;
-						cur_pos += pdelta;
-
-						cur_pval = cur_val;
-						cur_val = (INT16)(info->rom[cur_pos & info->rom_mask] << 8);
-						if(cur_val == (INT16)0x8000 && (base2[1] & 1)) {
-							cur_pos = base1[0x08] | (base1[0x09] << 8) | (base1[0x0a] << 16);
-							cur_val = (INT16)(info->rom[cur_pos & info->rom_mask] << 8);
-						}
-
-						if(cur_val == (INT16)0x8000) {
-							k054539_keyoff(info, ch);
-							cur_val = 0;
-							break;
-						}
-					}
-					break;
-				}
+		lv = info->voltab[vol] * info->pantab[pan] * cur_gain;
+		if (lv > VOL_CAP)
+			lv = VOL_CAP;
 
-				case 0x4: { // 16bit pcm lsb first
-					pdelta <<= 1;
-
-					cur_pfrac += delta;
-					while(cur_pfrac & ~0xffff) {
-						cur_pfrac += fdelta;
-						cur_pos += pdelta;
-
-						cur_pval = cur_val;
-						cur_val = (INT16)(info->rom[cur_pos & info->rom_mask] | info->rom[(cur_pos+1) & info->rom_mask]<<8);
-						if(cur_val == (INT16)0x8000 && (base2[1] & 1)) {
-							cur_pos = base1[0x08] | (base1[0x09] << 8) | (base1[0x0a] << 16);
-							cur_val = (INT16)(info->rom[cur_pos & info->rom_mask] | info->rom[(cur_pos+1) & info->rom_mask]<<8);
-						}
-
-						if(cur_val == (INT16)0x8000) {
-							k054539_keyoff(info, ch);
-							cur_val = 0;
-							break;
-						}
-					}
-					break;
-				}
+		rv = info->voltab[vol] * info->pantab[0xe - pan] * cur_gain;
+		if (rv > VOL_CAP)
+			rv = VOL_CAP;
 
-				case 0x8: { // 4bit dpcm
-					cur_pos <<= 1;
-					cur_pfrac <<= 1;
-					if(cur_pfrac & 0x10000) {
-						cur_pfrac &= 0xffff;
-						cur_pos |= 1;
-					}
+		rbv= info->voltab[bval] * cur_gain / 2;
+		if (rbv > VOL_CAP)
+			rbv = VOL_CAP;
 
-					cur_pfrac += delta;
-					while(cur_pfrac & ~0xffff) {
-						cur_pfrac += fdelta;
-						cur_pos += pdelta;
-
-						cur_pval = cur_val;
-						cur_val = info->rom[(cur_pos>>1) & info->rom_mask];
-						if(cur_val == 0x88 && (base2[1] & 1)) {
-							cur_pos = (base1[0x08] | (base1[0x09] << 8) | (base1[0x0a] << 16)) << 1;
-							cur_val = info->rom[(cur_pos>>1) & info->rom_mask];
-						}
-						if(cur_val == 0x88) {
-							k054539_keyoff(info, ch);
-							cur_val = 0;
-							break;
-						}
-						if(cur_pos & 1)
-							cur_val >>= 4;
-						else
-							cur_val &= 15;
-						cur_val = cur_pval + dpcm[cur_val];
-						if(cur_val < -32768)
-							cur_val = -32768;
-						else if(cur_val > 32767)
-							cur_val = 32767;
-					}
+		lvol[ch] = (float)lv;
+		rvol[ch] = (float)rv;
+		rbvol[ch] = rbv;
+		rdelta[ch] = (base1[6] | (base1[7] << 8)) >> 3;
+	}
 
-					cur_pfrac >>= 1;
-					if(cur_pos & 1)
-						cur_pfrac |= 0x8000;
-					cur_pos >>= 1;
-					break;
-				}
-				default:
-					emu_logf(&info->logger, DEVLOG_DEBUG, "Unknown sample type %x for channel %d\n", base2[0] & 0xc, ch);
-					info->regs[0x22c] &= ~(1<<ch);	// turn off channel to prevent spamming log messages
-					break;
-				}
+	for(sample = 0; sample < samples; sample += blk_len) {
+		blk_len = samples - sample;
+		if(blk_len > K054539_BLOCK)
+			blk_len = K054539_BLOCK;
+
+		// render the channels one after another
+		active = 0x00;
+		for(ch=0; ch<8; ch++) {
+			k054539_voice vc;
+			UINT8 *base2 = info->regs + 0x200 + 0x2*ch;
+			UINT32 count;
+
+			if(!(info->regs[0x22c] & (1<<ch)) || info->Muted[ch])
+				continue;
+
+			active |= (1<<ch);
+			k054539_voice_load(info, ch, &vc);
+			switch(base2[0] & 0xc) {
+			case 0x0: // 8bit pcm
+				count = k054539_render_pcm8(&vc, vals[ch], blk_len);
+				break;
+			case 0x4: // 16bit pcm lsb first
+				count = k054539_render_pcm16(&vc, vals[ch], blk_len);
+				break;
+			case 0x8: // 4bit dpcm
+				count = k054539_render_dpcm4(&vc, vals[ch], blk_len);
+				break;
+			default:
+				emu_logf(&info->logger, DEVLOG_DEBUG, "Unknown sample type %x for channel %d\n", base2[0] & 0xc, ch);
+				info->regs[0x22c] &= ~(1<<ch);	// turn off channel to prevent spamming log messages
+				k054539_voice_sync(&vc);
+				vals[ch][0] = vc.cur_val;
+				count = 1;
+				break;
+			}
+			k054539_voice_store(&vc);
 
-				lval += cur_val * (float)lvol;
-				rval += cur_val * (float)rvol;
-				rbase[(rdelta + info->reverb_pos) & 0x1fff] += (INT16)(cur_val*rbvol);
+			// a channel that was keyed off contributes silence for the rest of the block
+			for(i = count; i < blk_len; i++)
+				vals[ch][i] = 0;
+		}
 
-				chan->pos = cur_pos;
-				chan->pfrac = cur_pfrac;
-				chan->pval = cur_pval;
-				chan->val = cur_val;
+		// Mix in sample order. Reverb writes of one sample can be read back
+		// a few samples later, so the reverb buffer has to be processed sequentially.
+		for(i = 0; i < blk_len; i++) {
+			float lval, rval;
+			UINT32 rpos = info->reverb_pos;
 
-				if(k054539_regupdate(info)) {
-					base1[0x0c] = cur_pos     & 0xff;
-					base1[0x0d] = cur_pos>> 8 & 0xff;
-					base1[0x0e] = cur_pos>>16 & 0xff;
-				}
+			if(!(info->flags & K054539_DISABLE_REVERB))
+				lval = rval = rbase[rpos];
+			else
+				lval = rval = 0;
+			rbase[rpos] = 0;
+
+			for(ch=0; ch<8; ch++) {
+				if(!(active & (1<<ch)))
+					continue;
+				lval += vals[ch][i] * lvol[ch];
+				rval += vals[ch][i] * rvol[ch];
+				rbase[(rdelta[ch] + 2 * rpos) & 0x1fff] += (INT16)(vals[ch][i]*rbvol[ch]);
 			}
-		info->reverb_pos = (info->reverb_pos + 1) & 0x1fff;
-		outputs[0][sample] = (DEV_SMPL)(lval);
-		outputs[1][sample] = (DEV_SMPL)(rval);
+			info->reverb_pos = (rpos + 1) & 0x1fff;
+			outputs[0][sample + i] = (DEV_SMPL)(lval);
+			outputs[1][sample + i] = (DEV_SMPL)(rval);
+		}
 	}
 }
 
@@ -654,7 +778,7 @@ static void device_stop_k054539(void *chip)
 {
 	k054539_state *info = (k054539_state *)chip;
 	
-	free(info->rom);	info->rom = NULL;
+	rom_free(info->rom, info->rom_owned);	info->rom = NULL;
 	free(info->ram);	info->ram = NULL;
 	free(info);
 	
@@ -683,7 +807,7 @@ static void k054539_alloc_rom(void* chip, UINT32 memsize)
 	if (info->rom_size == memsize)
 		return;
 	
-	info->rom = (UINT8*)realloc(info->rom, memsize);
+	info->rom = (UINT8*)rom_realloc(info->rom, &info->rom_owned, memsize);
 	info->rom_size = memsize;
 	memset(info->rom, 0xFF, memsize);
 	
@@ -695,17 +819,33 @@ static void k054539_alloc_rom(void* chip, UINT32 memsize)
 static void k054539_write_rom(void *chip, UINT32 offset, UINT32 length, const UINT8* data)
 {
 	k054539_state *info = (k054539_state *)chip;
+	UINT8* rom;
 	
 	if (offset > info->rom_size)
 		return;
 	if (offset + length > info->rom_size)
 		length = info->rom_size - offset;
 	
+	rom = (UINT8*)rom_unshare(info->rom, &info->rom_owned, info->rom_size);
+	if (rom == NULL)
+		return;
+	info->rom = rom;
 	memcpy(info->rom + offset, data, length);
 	
 	return;
 }
 
+static void k054539_attach_rom(void *chip, UINT32 length, const UINT8* data)
+{
+	k054539_state *info = (k054539_state *)chip;
+	
+	info->rom = (UINT8*)rom_attach(info->rom, &info->rom_owned, data);
+	info->rom_size = (data != NULL) ? length : 0x00;
+	info->rom_mask = pow2_mask(info->rom_size);
+	
+	return;
+}
+
 
 static void k054539_set_mute_mask(void *chip, UINT32 MuteMask)
 {
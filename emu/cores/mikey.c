@@ -728,29 +728,65 @@ static void mikey_write( void* info, uint8_t address, uint8_t value )
   }
 }
 
+// number of samples that are output before the sample tick reaches 'tick', at most 'maxSmpls'
+static UINT32 mikey_samples_until( const mikey_t* mikey, int64_t tick, UINT32 maxSmpls )
+{
+  uint64_t const ticksPerSecond = (uint64_t)mikey->mTicksPerSample1 * mikey->mSampleRate + mikey->mTicksPerSample2;
+  int64_t dist;
+  uint64_t steps;
+
+  if ( tick <= mikey->mTick )
+    return 0;
+  // The sample tick is mNextTick rounded down to a multiple of 16,
+  // so it reaches 'tick' when mNextTick reaches the next multiple of 16.
+  dist = ( ( tick + 15 ) & ~15 ) - mikey->mNextTick;
+  if ( dist <= 0 )
+    return 1;
+  if ( dist >= (int64_t)maxSmpls * ( mikey->mTicksPerSample1 + 1 ) )
+    return maxSmpls;
+  // after n samples: mNextTick + (n * ticksPerSecond + mSamplesRemainder) / mSampleRate
+  steps = ( (uint64_t)dist * mikey->mSampleRate - mikey->mSamplesRemainder + ticksPerSecond - 1 ) / ticksPerSecond;
+  return ( steps + 1 < maxSmpls ) ? (UINT32)( steps + 1 ) : maxSmpls;
+}
+
+// advance the sample tick by 'count' (> 0) samples
+static void mikey_advance( mikey_t* mikey, UINT32 count )
+{
+  uint64_t rem;
+
+  rem = mikey->mSamplesRemainder + (uint64_t)( count - 1 ) * mikey->mTicksPerSample2;
+  mikey->mTick = ( mikey->mNextTick + (int64_t)( count - 1 ) * mikey->mTicksPerSample1 + (int64_t)( rem / mikey->mSampleRate ) ) & ~15;
+
+  rem = mikey->mSamplesRemainder + (uint64_t)count * mikey->mTicksPerSample2;
+  mikey->mNextTick += (int64_t)count * mikey->mTicksPerSample1 + (int64_t)( rem / mikey->mSampleRate );
+  mikey->mSamplesRemainder = (uint32_t)( rem % mikey->mSampleRate );
+}
+
 static void mikey_update( void* info, UINT32 samples, DEV_SMPL** outputs )
 {
   mikey_t* mikey = (mikey_t*)info;
   UINT32 i = 0;
-  for ( ;; )
+
+  // The output only changes when a timer fires or a register is written.
+  // Register writes happen between update calls, so each stretch up to the next
+  // timer event is filled with a single value.
+  while ( i < samples )
   {
     int64_t value = mikey_action_queue_pop( &mikey->mQueue );
-    while ( value > mikey->mTick )
+    UINT32 count = mikey_samples_until( mikey, value, samples - i );
+
+    if ( count > 0 )
     {
       mikey_audio_sample_t sample = mikey_pimpl_sampleAudio( &mikey->mMikey );
-      outputs[0][i] = sample.left;
-      outputs[1][i] = sample.right;
+      UINT32 end = i + count;
 
-      mikey->mTick = mikey->mNextTick & ~15;
-      mikey->mNextTick = mikey->mNextTick + mikey->mTicksPerSample1;
-      mikey->mSamplesRemainder += mikey->mTicksPerSample2;
-      if ( mikey->mSamplesRemainder >= mikey->mSampleRate )
+      for ( ; i < end; i++ )
       {
-        mikey->mSamplesRemainder -= mikey->mSampleRate;
-        mikey->mNextTick += 1;
+        outputs[0][i] = sample.left;
+        outputs[1][i] = sample.right;
       }
-
-      if ( ++i >= samples )
+      mikey_advance( mikey, count );
+      if ( i >= samples )
         return;
     }
 
@@ -46,6 +46,7 @@
 #include "../EmuCores.h"
 #include "../snddef.h"
 #include "../EmuHelper.h"
+#include "../pcmmix.h"
 #include "multipcm.h"
 
 static void MultiPCM_update(void *info, UINT32 samples, DEV_SMPL **outputs);
@@ -59,6 +60,7 @@ static UINT8 multipcm_r(void *info, UINT8 offset);
 
 static void multipcm_alloc_rom(void* info, UINT32 memsize);
 static void multipcm_write_rom(void *info, UINT32 offset, UINT32 length, const UINT8* data);
+static void multipcm_attach_rom(void *info, UINT32 length, const UINT8* data);
 
 static void multipcm_set_mute_mask(void *info, UINT32 MuteMask);
 
@@ -70,6 +72,7 @@ static DEVDEF_RWFUNC devFunc[] =
 	{RWF_REGISTER | RWF_READ, DEVRW_A8D8, 0, multipcm_r},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, multipcm_write_rom},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, multipcm_alloc_rom},
+	{RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, multipcm_attach_rom},
 	{RWF_CHN_MUTE | RWF_WRITE, DEVRW_ALL, 0, multipcm_set_mute_mask},
 	{0x00, 0x00, 0, NULL}
 };
@@ -214,8 +217,6 @@ struct _MultiPCM
 	UINT32 bank1;
 	float rate;
 
-	UINT32 attack_step[0x40];
-	UINT32 decay_release_step[0x40];    // Envelope step tables
 	UINT32 freq_step_table[0x400];      // Frequency step table
 
 	//INT32 left_pan_table[0x800];
@@ -231,6 +232,7 @@ struct _MultiPCM
 	UINT32 ROMMask;
 	UINT32 ROMSize;
 	UINT8 *ROM;
+	UINT8 ROMOwned;
 };
 
 
@@ -275,6 +277,10 @@ static const double BASE_TIMES[64] = {
 
 static INT32 linear_to_exp_volume[0x400];
 
+// Envelope step tables, they don't depend on the clock and are shared by all instances.
+static UINT32 attack_step[0x40];
+static UINT32 decay_release_step[0x40];
+
 #define TL_SHIFT    12
 #define EG_SHIFT    16
 
@@ -297,14 +303,14 @@ static void init_sample(MultiPCM *ptChip, sample_t *sample, UINT16 index)
 	sample->lfo_amplitude_reg = ptChip->ROM[address + 11] & 0xf;
 }
 
-static void envelope_generator_calc(MultiPCM *ptChip, slot_t *slot);
-static void retrigger_sample(MultiPCM *ptChip, slot_t *slot)
+static void envelope_generator_calc(slot_t *slot);
+static void retrigger_sample(slot_t *slot)
 {
 	slot->offset = 0;
 	slot->prev_sample = 0;
 	slot->total_level = slot->dest_total_level << TL_SHIFT;
 
-	envelope_generator_calc(ptChip, slot);
+	envelope_generator_calc(slot);
 	slot->envelope_gen.state = ATTACK;
 	slot->envelope_gen.volume = 0;
 }
@@ -324,21 +330,21 @@ static void update_step(MultiPCM *ptChip, slot_t *slot)
 	slot->step = (UINT32)(pitch / ptChip->rate);
 }
 
-static void envelope_generator_init(MultiPCM *ptChip, const double rates[64], double attack_decay_ratio)
+static void envelope_generator_init(const double rates[64], double attack_decay_ratio)
 {
 	INT32 i;
 	for (i = 4; i < 0x40; ++i)
 	{
 		// Times are based on 44100Hz clock, adjust to real chip clock
-		ptChip->attack_step[i] = (UINT32)((0x400 << EG_SHIFT) / (float)(rates[i] * 44100.0 / 1000.0));
-		ptChip->decay_release_step[i] = (UINT32)((0x400 << EG_SHIFT) / (float)(rates[i] * attack_decay_ratio * 44100.0 / 1000.0));
+		attack_step[i] = (UINT32)((0x400 << EG_SHIFT) / (float)(rates[i] * 44100.0 / 1000.0));
+		decay_release_step[i] = (UINT32)((0x400 << EG_SHIFT) / (float)(rates[i] * attack_decay_ratio * 44100.0 / 1000.0));
 	}
-	ptChip->attack_step[0] = ptChip->attack_step[1] = ptChip->attack_step[2] = ptChip->attack_step[3] = 0;
-	ptChip->attack_step[0x3f] = 0x400 << EG_SHIFT;
-	ptChip->decay_release_step[0] = ptChip->decay_release_step[1] = ptChip->decay_release_step[2] = ptChip->decay_release_step[3] = 0;
+	attack_step[0] = attack_step[1] = attack_step[2] = attack_step[3] = 0;
+	attack_step[0x3f] = 0x400 << EG_SHIFT;
+	decay_release_step[0] = decay_release_step[1] = decay_release_step[2] = decay_release_step[3] = 0;
 }
 
-static INT32 envelope_generator_update(MultiPCM *ptChip, slot_t *slot)
+static INT32 envelope_generator_update(slot_t *slot)
 {
 	switch(slot->envelope_gen.state)
 	{
@@ -388,9 +394,9 @@ static INT32 envelope_generator_update(MultiPCM *ptChip, slot_t *slot)
 	if (slot->envelope_gen.reverb && slot->envelope_gen.state != ATTACK
 		&& (slot->envelope_gen.volume >> EG_SHIFT) <= 0x300)
 	{
-		slot->envelope_gen.decay1_rate  = ptChip->decay_release_step[17];
-		slot->envelope_gen.decay2_rate  = ptChip->decay_release_step[17];
-		slot->envelope_gen.release_rate = ptChip->decay_release_step[17];
+		slot->envelope_gen.decay1_rate  = decay_release_step[17];
+		slot->envelope_gen.decay2_rate  = decay_release_step[17];
+		slot->envelope_gen.release_rate = decay_release_step[17];
 	}
 
 	return linear_to_exp_volume[slot->envelope_gen.volume >> EG_SHIFT];
@@ -415,7 +421,7 @@ INLINE UINT32 get_rate(const UINT32 *steps, INT32 rate, UINT32 val)
 	return steps[r];
 }
 
-static void envelope_generator_calc(MultiPCM *ptChip, slot_t *slot)
+static void envelope_generator_calc(slot_t *slot)
 {
 	INT32 octave = slot->octave;
 	INT32 rate;
@@ -433,10 +439,10 @@ static void envelope_generator_calc(MultiPCM *ptChip, slot_t *slot)
 		rate = 0;
 	}
 
-	slot->envelope_gen.attack_rate = get_rate(ptChip->attack_step, rate, slot->sample.attack_reg);
-	slot->envelope_gen.decay1_rate = get_rate(ptChip->decay_release_step, rate, slot->sample.decay1_reg);
-	slot->envelope_gen.decay2_rate = get_rate(ptChip->decay_release_step, rate, slot->sample.decay2_reg);
-	slot->envelope_gen.release_rate = get_rate(ptChip->decay_release_step, rate, slot->sample.release_reg);
+	slot->envelope_gen.attack_rate = get_rate(attack_step, rate, slot->sample.attack_reg);
+	slot->envelope_gen.decay1_rate = get_rate(decay_release_step, rate, slot->sample.decay1_reg);
+	slot->envelope_gen.decay2_rate = get_rate(decay_release_step, rate, slot->sample.decay2_reg);
+	slot->envelope_gen.release_rate = get_rate(decay_release_step, rate, slot->sample.release_reg);
 	slot->envelope_gen.decay_level = 0xf - slot->sample.decay_level;
 	slot->envelope_gen.reverb = 0;
 }
@@ -663,6 +669,9 @@ static UINT8 device_start_multipcm(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf)
 	}
 
 	lfo_init();
+
+	// Envelope steps
+	envelope_generator_init(BASE_TIMES, 14.32833);
 	}
 
 	// Pitch steps
@@ -672,9 +681,6 @@ static UINT8 device_start_multipcm(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf)
 		ptChip->freq_step_table[i] = value_to_fixed(TL_SHIFT, fcent);
 	}
 
-	// Envelope steps
-	envelope_generator_init(ptChip, BASE_TIMES, 14.32833);
-
 	// Total level interpolation steps
 	ptChip->total_level_steps[0] = -(INT32)((0x80 << TL_SHIFT) / (78.2f * 44100.0f / 1000.0f)); // lower
 	ptChip->total_level_steps[1] = (INT32)((0x80 << TL_SHIFT) / (78.2f * 2 * 44100.0f / 1000.0f)); // raise
@@ -692,7 +698,7 @@ static void device_stop_multipcm(void *info)
 {
 	MultiPCM *ptChip = (MultiPCM *)info;
 	
-	free(ptChip->ROM);
+	rom_free(ptChip->ROM, ptChip->ROMOwned);
 	free(ptChip);
 	
 	return;
@@ -744,7 +750,7 @@ static void write_slot(MultiPCM *ptChip, slot_t *slot, INT32 reg, UINT8 data)
 
 			// retrigger if key is on
 			if (slot->playing)
-				retrigger_sample(ptChip, slot);
+				retrigger_sample(slot);
 
 			break;
 		case 2: //Pitch
@@ -759,7 +765,7 @@ static void write_slot(MultiPCM *ptChip, slot_t *slot, INT32 reg, UINT8 data)
 			if (data & 0x80)       //KeyOn
 			{
 				slot->playing = 1;
-				retrigger_sample(ptChip, slot);
+				retrigger_sample(slot);
 			}
 			else
 			{
@@ -813,102 +819,116 @@ INLINE UINT8 read_byte(MultiPCM *ptChip, UINT32 addr)
 	return ptChip->ROM[addr & ptChip->ROMMask];
 }
 
-static void MultiPCM_update(void *info, UINT32 samples, DEV_SMPL **outputs)
+// render up to PCMMIX_BLOCK samples of a playing slot and add them to the output
+static void render_slot(MultiPCM *ptChip, slot_t *slot, UINT32 samples, DEV_SMPL *outL, DEV_SMPL *outR)
 {
-	MultiPCM *ptChip = (MultiPCM *)info;
-	UINT32 i, sl;
+	INT32 smplBuf[PCMMIX_BLOCK];
+	UINT32 volBuf[PCMMIX_BLOCK];
+	UINT8 tl_moving = ((slot->total_level >> TL_SHIFT) != slot->dest_total_level);
+	UINT32 vol = (slot->total_level >> TL_SHIFT) | (slot->pan << 7);
+	UINT32 i;
 
-	if (ptChip->ROM == NULL)
+	for (i = 0; i < samples && slot->playing; ++i)
 	{
-		memset(outputs[0], 0, samples * sizeof(DEV_SMPL));
-		memset(outputs[1], 0, samples * sizeof(DEV_SMPL));
-		return;
-	}
+		UINT32 spos = slot->offset >> TL_SHIFT;
+		UINT32 step = slot->step;
+		INT32 csample;
+		INT32 fpart = slot->offset & ((1 << TL_SHIFT) - 1);
+		INT32 sample;
 
-	for (i = 0; i < samples; ++i)
-	{
-		DEV_SMPL smpl = 0;
-		DEV_SMPL smpr = 0;
-		for (sl = 0; sl < 28; ++sl)
+		if (tl_moving)
+			volBuf[i] = (slot->total_level >> TL_SHIFT) | (slot->pan << 7);
+
+		if (slot->reverse)
 		{
-			slot_t *slot = &ptChip->slots[sl];
-			if (slot->playing && ! slot->muted)
-			{
-				UINT32 vol = (slot->total_level >> TL_SHIFT) | (slot->pan << 7);
-				UINT32 spos = slot->offset >> TL_SHIFT;
-				UINT32 step = slot->step;
-				INT32 csample;
-				INT32 fpart = slot->offset & ((1 << TL_SHIFT) - 1);
-				INT32 sample;
-
-				if (slot->reverse)
-				{
-					spos = slot->sample.end - spos - 1;
-				}
+			spos = slot->sample.end - spos - 1;
+		}
 
-				if (slot->sample.format & 4)	// 12-bit linear
-				{
-					UINT32 adr = slot->base + (spos >> 1) * 3;
-					if (!(spos & 1))
-					{ // ab.c ..
-						INT16 w0 = (read_byte(ptChip, adr) << 8) | ((read_byte(ptChip, adr + 1) & 0xf) << 4);
-						csample = w0;
-						break;
-					}
-					else
-					{ // ..C. AB
-						INT16 w0 = (read_byte(ptChip, adr + 2) << 8) | (read_byte(ptChip, adr + 1) & 0xf0);
-						csample = w0;
-						break;
-					}
-				}
-				else
-				{
-					csample = (INT16)(read_byte(ptChip, slot->base + spos) << 8);
-				}
+		csample = (INT16)(read_byte(ptChip, slot->base + spos) << 8);
 
-				sample = (csample * fpart + slot->prev_sample * ((1 << TL_SHIFT) - fpart)) >> TL_SHIFT;
+		sample = (csample * fpart + slot->prev_sample * ((1 << TL_SHIFT) - fpart)) >> TL_SHIFT;
 
-				if (slot->vibrato) // Vibrato enabled
-				{
-					step = step * pitch_lfo_step(&slot->pitch_lfo);
-					step >>= TL_SHIFT;
-				}
+		if (slot->vibrato) // Vibrato enabled
+		{
+			step = step * pitch_lfo_step(&slot->pitch_lfo);
+			step >>= TL_SHIFT;
+		}
 
-				slot->offset += step;
+		slot->offset += step;
 
-				if (spos ^ (slot->offset >> TL_SHIFT))
-				{
-					slot->prev_sample = csample;
-				}
+		if (spos ^ (slot->offset >> TL_SHIFT))
+		{
+			slot->prev_sample = csample;
+		}
 
-				if (slot->offset >= (slot->sample.end << TL_SHIFT))
-				{
-					slot->offset -= (slot->sample.end - slot->sample.loop) << TL_SHIFT;
-					// DD-9 expects the looped silence at the end of some samples to be the same whether reversed or not
-					slot->reverse = false;
-				}
+		if (slot->offset >= (slot->sample.end << TL_SHIFT))
+		{
+			slot->offset -= (slot->sample.end - slot->sample.loop) << TL_SHIFT;
+			// DD-9 expects the looped silence at the end of some samples to be the same whether reversed or not
+			slot->reverse = false;
+		}
 
-				if ((slot->total_level >> TL_SHIFT) != slot->dest_total_level)
-				{
-					slot->total_level += slot->total_level_step;
-				}
+		if (tl_moving && (slot->total_level >> TL_SHIFT) != slot->dest_total_level)
+		{
+			slot->total_level += slot->total_level_step;
+		}
 
-				if (slot->tremolo) // Tremolo enabled
-				{
-					sample = sample * amplitude_lfo_step(&slot->amplitude_lfo);
-					sample >>= TL_SHIFT;
-				}
+		if (slot->tremolo) // Tremolo enabled
+		{
+			sample = sample * amplitude_lfo_step(&slot->amplitude_lfo);
+			sample >>= TL_SHIFT;
+		}
 
-				sample = (sample * envelope_generator_update(ptChip, slot)) >> 10;
+		smplBuf[i] = (sample * envelope_generator_update(slot)) >> 10;
+	}
+	samples = i;
 
-				smpl += (left_pan_table[vol] * sample) >> TL_SHIFT;
-				smpr += (right_pan_table[vol] * sample) >> TL_SHIFT;
-			}
+	if (! tl_moving)
+	{
+		// total level and pan are constant during the block
+		PcmMix_AddStereo(smplBuf, samples, left_pan_table[vol], right_pan_table[vol], TL_SHIFT, outL, outR);
+	}
+	else
+	{
+		for (i = 0; i < samples; ++i)
+		{
+			outL[i] += (left_pan_table[volBuf[i]] * smplBuf[i]) >> TL_SHIFT;
+			outR[i] += (right_pan_table[volBuf[i]] * smplBuf[i]) >> TL_SHIFT;
 		}
+	}
+}
 
-		outputs[0][i] = smpl;
-		outputs[1][i] = smpr;
+static void MultiPCM_update(void *info, UINT32 samples, DEV_SMPL **outputs)
+{
+	MultiPCM *ptChip = (MultiPCM *)info;
+	UINT32 i, sl;
+	UINT32 blk_len;
+
+	memset(outputs[0], 0, samples * sizeof(DEV_SMPL));
+	memset(outputs[1], 0, samples * sizeof(DEV_SMPL));
+	if (ptChip->ROM == NULL)
+		return;
+
+	// Slots are independent of each other, so they are rendered one after another.
+	for (sl = 0; sl < 28; ++sl)
+	{
+		slot_t *slot = &ptChip->slots[sl];
+		if (! slot->playing || slot->muted)
+			continue;
+
+		// 12-bit linear samples stop the slot processing: The slot is not advanced and
+		// the following slots are skipped. (This matches the per-sample loop this was
+		// converted from, which left the slot loop with a 'break'.)
+		if (slot->sample.format & 4)
+			break;
+
+		for (i = 0; i < samples && slot->playing; i += blk_len)
+		{
+			blk_len = samples - i;
+			if (blk_len > PCMMIX_BLOCK)
+				blk_len = PCMMIX_BLOCK;
+			render_slot(ptChip, slot, blk_len, &outputs[0][i], &outputs[1][i]);
+		}
 	}
 }
 
@@ -973,7 +993,7 @@ static void multipcm_alloc_rom(void* info, UINT32 memsize)
 	if (ptChip->ROMSize == memsize)
 		return;
 	
-	ptChip->ROM = (UINT8*)realloc(ptChip->ROM, memsize);
+	ptChip->ROM = (UINT8*)rom_realloc(ptChip->ROM, &ptChip->ROMOwned, memsize);
 	ptChip->ROMSize = memsize;
 	memset(ptChip->ROM, 0xFF, memsize);
 	
@@ -985,17 +1005,33 @@ static void multipcm_alloc_rom(void* info, UINT32 memsize)
 static void multipcm_write_rom(void *info, UINT32 offset, UINT32 length, const UINT8* data)
 {
 	MultiPCM *ptChip = (MultiPCM *)info;
+	UINT8* rom;
 	
 	if (offset > ptChip->ROMSize)
 		return;
 	if (offset + length > ptChip->ROMSize)
 		length = ptChip->ROMSize - offset;
 	
+	rom = (UINT8*)rom_unshare(ptChip->ROM, &ptChip->ROMOwned, ptChip->ROMSize);
+	if (rom == NULL)
+		return;
+	ptChip->ROM = rom;
 	memcpy(ptChip->ROM + offset, data, length);
 	
 	return;
 }
 
+static void multipcm_attach_rom(void *info, UINT32 length, const UINT8* data)
+{
+	MultiPCM *ptChip = (MultiPCM *)info;
+	
+	ptChip->ROM = (UINT8*)rom_attach(ptChip->ROM, &ptChip->ROMOwned, data);
+	ptChip->ROMSize = (data != NULL) ? length : 0x00;
+	ptChip->ROMMask = pow2_mask(ptChip->ROMSize);
+	
+	return;
+}
+
 
 static void multipcm_set_mute_mask(void *info, UINT32 MuteMask)
 {
@@ -29,7 +29,7 @@ typedef struct nesapu_info NESAPU_INF;
 
 static void nes_stream_update_mame(void* chip, UINT32 samples, DEV_SMPL** outputs);
 static void nes_stream_update_nsfplay(void* chip, UINT32 samples, DEV_SMPL** outputs);
-static void nes_render_fds(void* chip_fds, UINT32 samples, DEV_SMPL** outputs);
+static void nes_render_fds(NESAPU_INF* info, UINT32 samples, DEV_SMPL** outputs);
 
 static UINT8 device_start_nes_mame(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf);
 static UINT8 device_start_nes_nsfplay(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf);
@@ -178,6 +178,7 @@ struct nesapu_info
 	void* chip_fds;
 	UINT8* memory;
 	UINT8 fds_disable;
+	UINT8 sample_render;	// render sample by sample (reference mode)
 };
 
 // bit shift for transforming the "usual" panning values (factor 1<<16) into
@@ -195,7 +196,7 @@ static void nes_stream_update_mame(void* chip, UINT32 samples, DEV_SMPL** output
 	
 #ifdef EC_NES_NSFP_FDS
 	if (info->chip_fds != NULL)
-		nes_render_fds(info->chip_fds, samples, outputs);
+		nes_render_fds(info, samples, outputs);
 #endif
 	
 	return;
@@ -209,17 +210,38 @@ static void nes_stream_update_nsfplay(void* chip, UINT32 samples, DEV_SMPL** out
 	UINT32 CurSmpl;
 	INT32 Buffer[4];
 	
-	for (CurSmpl = 0; CurSmpl < samples; CurSmpl ++)
+	if (info->sample_render)
 	{
-		NES_APU_np_Render(info->chip_apu, &Buffer[0]);
-		NES_DMC_np_Render(info->chip_dmc, &Buffer[2]);
-		outputs[0][CurSmpl] = Buffer[0] + Buffer[2];
-		outputs[1][CurSmpl] = Buffer[1] + Buffer[3];
+		for (CurSmpl = 0; CurSmpl < samples; CurSmpl ++)
+		{
+			NES_APU_np_Render(info->chip_apu, &Buffer[0]);
+			NES_DMC_np_Render(info->chip_dmc, &Buffer[2]);
+			outputs[0][CurSmpl] = Buffer[0] + Buffer[2];
+			outputs[1][CurSmpl] = Buffer[1] + Buffer[3];
+		}
+	}
+	else
+	{
+		UINT32 BlkLen;
+		DEV_SMPL* BlkOut[2];
+		
+		memset(outputs[0], 0x00, samples * sizeof(DEV_SMPL));
+		memset(outputs[1], 0x00, samples * sizeof(DEV_SMPL));
+		for (CurSmpl = 0; CurSmpl < samples; CurSmpl += BlkLen)
+		{
+			// The DMC's frame sequencer clocks the square channels of the APU,
+			// so the blocks end with the sample that clocks the sequencer.
+			BlkLen = NES_DMC_np_FrameSequenceSamples(info->chip_dmc, samples - CurSmpl);
+			BlkOut[0] = &outputs[0][CurSmpl];
+			BlkOut[1] = &outputs[1][CurSmpl];
+			NES_APU_np_RenderBlock(info->chip_apu, BlkLen, BlkOut);
+			NES_DMC_np_RenderBlock(info->chip_dmc, BlkLen, BlkOut);
+		}
 	}
 	
 #ifdef EC_NES_NSFP_FDS
 	if (info->chip_fds != NULL)
-		nes_render_fds(info->chip_fds, samples, outputs);
+		nes_render_fds(info, samples, outputs);
 #endif
 	
 	return;
@@ -227,14 +249,20 @@ static void nes_stream_update_nsfplay(void* chip, UINT32 samples, DEV_SMPL** out
 #endif
 
 #ifdef EC_NES_NSFP_FDS
-static void nes_render_fds(void* chip_fds, UINT32 samples, DEV_SMPL** outputs)
+static void nes_render_fds(NESAPU_INF* info, UINT32 samples, DEV_SMPL** outputs)
 {
 	UINT32 CurSmpl;
 	INT32 Buffer[2];
 	
+	if (! info->sample_render)
+	{
+		NES_FDS_RenderBlock(info->chip_fds, samples, outputs);
+		return;
+	}
+	
 	for (CurSmpl = 0; CurSmpl < samples; CurSmpl ++)
 	{
-		NES_FDS_Render(chip_fds, &Buffer[0]);
+		NES_FDS_Render(info->chip_fds, &Buffer[0]);
 		outputs[0][CurSmpl] += Buffer[0];
 		outputs[1][CurSmpl] += Buffer[1];
 	}
@@ -560,6 +588,7 @@ static void nes_set_chip_option_mame(void* chip, UINT32 NesOptions)
 	NESAPU_INF* info = (NESAPU_INF*)chip;
 	
 	nesapu_set_options(info->chip_apu, NesOptions);
+	info->sample_render = (NesOptions & OPT_NES_SAMPLE_RENDER) ? 1 : 0;
 	
 #ifdef EC_NES_NSFP_FDS
 	if (info->chip_fds != NULL)
@@ -588,6 +617,7 @@ static void nes_set_chip_option_nsfplay(void* chip, UINT32 NesOptions)
 	// DMC-only options
 	for (; CurOpt < 10; CurOpt ++)
 		NES_DMC_np_SetOption(info->chip_dmc, CurOpt-4+2, (NesOptions >> CurOpt) & 0x01);
+	info->sample_render = (NesOptions & OPT_NES_SAMPLE_RENDER) ? 1 : 0;
 	
 #ifdef EC_NES_NSFP_FDS
 	if (info->chip_fds != NULL)
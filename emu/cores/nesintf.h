@@ -38,6 +38,9 @@
 // [NSFPlay FDS core] options
 #define OPT_NES_4085_RESET			0x0400	// OPT_4085_RESET (default: disabled)
 #define OPT_NES_FDS_DISABLE			0x0800	// OPT_WRITE_PROTECT (default: disabled)
+// [NSFPlay APU/DMC and FDS cores] general options
+#define OPT_NES_SAMPLE_RENDER		0x1000	// render each sample separately instead of skipping over runs
+											// of constant output (reference mode) (default: disabled)
 
 // default option bitmask: 0x01B7
 //	OPT_NES_UNMUTE_ON_RESET | OPT_NES_NONLINEAR_MIXER | OPT_NES_PHASE_REFRESH |
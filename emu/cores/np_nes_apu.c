@@ -88,8 +88,16 @@ struct _NES_APU
 
 static void sweep_sqr(NES_APU* apu, int ch);	// calculates target sweep frequency
 static INT32 calc_sqr(NES_APU* apu, int ch, UINT32 clocks);
+static UINT32 sqr_change_clocks(NES_APU* apu, int ch);
 static void Tick(NES_APU* apu, UINT32 clocks);
 
+static const INT16 sqrtbl[4][16] = {
+	{0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	{0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	{0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0},
+	{1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}
+};
+
 
 static void sweep_sqr(NES_APU* apu, int i)
 {
@@ -176,12 +184,6 @@ void NES_APU_np_FrameSequence(void* chip, int s)
 
 static INT32 calc_sqr(NES_APU* apu, int i, UINT32 clocks)
 {
-	static const INT16 sqrtbl[4][16] = {
-		{0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-		{0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-		{0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0},
-		{1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}
-	};
 	INT32 ret;
 
 	apu->scounter[i] -= clocks;
@@ -204,6 +206,34 @@ static INT32 calc_sqr(NES_APU* apu, int i, UINT32 clocks)
 	return ret;
 }
 
+// number of clocks until the output level of the square changes, 0xFFFFFFFF = never
+// Only valid while the frame sequencer doesn't clock the channel.
+static UINT32 sqr_change_clocks(NES_APU* apu, int i)
+{
+	int v;
+	int cur;
+	int steps;
+
+	if ((apu->mask >> i) & 1)
+		return 0xFFFFFFFF;
+	if (! (apu->length_counter[i] > 0 && apu->freq[i] >= 8 && apu->sfreq[i] < 0x800))
+		return 0xFFFFFFFF;
+	v = apu->envelope_disable[i] ? apu->volume[i] : apu->envelope_counter[i];
+	if (v == 0)
+		return 0xFFFFFFFF;
+	if (apu->scounter[i] < 0)
+		return 0;
+
+	// search the next phase that switches the duty level (there is always one within 16 steps)
+	cur = sqrtbl[apu->duty[i]][apu->sphase[i]];
+	for (steps = 1; steps < 16; steps ++)
+	{
+		if (sqrtbl[apu->duty[i]][(apu->sphase[i] + steps) & 15] != cur)
+			break;
+	}
+	return (UINT32)apu->scounter[i] + 1 + (steps - 1) * (apu->freq[i] + 1);
+}
+
 bool NES_APU_np_Read(void* chip, UINT16 adr, UINT8* val)
 {
 	NES_APU* apu = (NES_APU*)chip;
@@ -279,6 +309,53 @@ UINT32 NES_APU_np_Render(void* chip, INT32 b[2])
 	return 2;
 }
 
+// Renders a block of samples and adds them to the output buffers.
+// Between changes of the square levels, the output is constant, so the channels are advanced
+// in a single step and the last output sample is repeated.
+// The frame sequencer (clocked by the DMC) must not modify the channels during the block.
+void NES_APU_np_RenderBlock(void* chip, UINT32 samples, DEV_SMPL** outputs)
+{
+	NES_APU* apu = (NES_APU*)chip;
+	UINT32 curSmpl;
+	UINT32 runLen;
+	UINT32 runEnd;
+	UINT32 clocks;
+	int i;
+	INT32 b[2];
+
+	curSmpl = 0;
+	while (curSmpl < samples)
+	{
+		NES_APU_np_Render(apu, b);
+		outputs[0][curSmpl] += b[0];
+		outputs[1][curSmpl] += b[1];
+		curSmpl ++;
+
+		runLen = samples - curSmpl;
+		for (i = 0; i < 2 && runLen > 0; i ++)
+		{
+			UINT32 dist = sqr_change_clocks(apu, i);
+			if (dist != 0xFFFFFFFF)
+				runLen = RC_STEPS_BELOW(&apu->tick_count, dist, runLen);
+		}
+		if (! runLen)
+			continue;
+
+		// advance over the whole run at once
+		RC_STEPS(&apu->tick_count, runLen);
+		clocks = RC_GET_VAL(&apu->tick_count);
+		RC_MASK(&apu->tick_count);
+		calc_sqr(apu, 0, clocks);
+		calc_sqr(apu, 1, clocks);
+
+		for (runEnd = curSmpl + runLen; curSmpl < runEnd; curSmpl ++)
+		{
+			outputs[0][curSmpl] += b[0];
+			outputs[1][curSmpl] += b[1];
+		}
+	}
+}
+
 void* NES_APU_np_Create(UINT32 clock, UINT32 rate)
 {
 	NES_APU* apu;
@@ -8,6 +8,7 @@ void NES_APU_np_Reset(void* chip);
 bool NES_APU_np_Read(void* chip, UINT16 adr, UINT8* val);
 bool NES_APU_np_Write(void* chip, UINT16 adr, UINT8 val);
 UINT32 NES_APU_np_Render(void* chip, INT32 b[2]);
+void NES_APU_np_RenderBlock(void* chip, UINT32 samples, DEV_SMPL** outputs);
 void NES_APU_np_SetRate(void* chip, UINT32 rate);
 void NES_APU_np_SetClock(void* chip, UINT32 clock);
 void NES_APU_np_SetOption(void* chip, int id, int b);
@@ -116,6 +116,8 @@ INLINE UINT32 calc_noise(NES_DMC* dmc, UINT32 clocks);
 static void FrameSequence(NES_DMC* dmc, int s);
 static void TickFrameSequence(NES_DMC* dmc, UINT32 clocks);
 static void Tick(NES_DMC* dmc, UINT32 clocks);
+static UINT32 frame_sequence_clocks(NES_DMC* dmc);
+static UINT32 run_length(NES_DMC* dmc, UINT32 maxSmpls);
 
 #define GETA_BITS	20
 static const UINT32 wavlen_table[2][16] = {
@@ -478,6 +480,71 @@ static void Tick(NES_DMC* dmc, UINT32 clocks)
 	dmc->out[2] = calc_dmc(dmc, clocks);
 }
 
+// number of clocks until TickFrameSequence clocks the frame sequencer
+static UINT32 frame_sequence_clocks(NES_DMC* dmc)
+{
+	if (dmc->frame_sequence_count > dmc->frame_sequence_length)
+		return 0;
+	return (UINT32)(dmc->frame_sequence_length - dmc->frame_sequence_count) + 1;
+}
+
+// Returns the number of samples following the current one that will have the same output.
+// This is limited by the frame sequencer and the next level change of each channel.
+static UINT32 run_length(NES_DMC* dmc, UINT32 maxSmpls)
+{
+	UINT32 runLen;
+
+	runLen = RC_STEPS_BELOW(&dmc->tick_count, frame_sequence_clocks(dmc), maxSmpls);
+
+	// triangle: every step changes the level
+	if (runLen > 0)
+	{
+		bool active = (dmc->linear_counter > 0 && dmc->length_counter[0] > 0
+			&& (!dmc->option[OPT_TRI_MUTE] || dmc->tri_freq > 0));
+		if (active || (dmc->option[OPT_TRI_NULL] && dmc->tphase > 0 && dmc->tphase < 31))
+		{
+			if (dmc->counter[0] < 0)
+				return 0;
+			runLen = RC_STEPS_BELOW(&dmc->tick_count, (UINT32)dmc->counter[0] + 1, runLen);
+		}
+	}
+
+	// noise: The level stays constant until the next shift, unless the previous
+	// sample was an average over several shifts.
+	if (runLen > 0 && !(dmc->mask & 2) && dmc->nfreq > 0)
+	{
+		UINT32 env = dmc->envelope_disable ? dmc->noise_volume : dmc->envelope_counter;
+		if (dmc->length_counter[1] < 1) env = 0;
+		if (env > 0)
+		{
+			UINT32 last = (dmc->noise & 0x4000) ? 0 : env;
+			if (dmc->out[1] != last || dmc->counter[1] < 0)
+				return 0;
+			runLen = RC_STEPS_BELOW(&dmc->tick_count, (UINT32)dmc->counter[1] + 1, runLen);
+		}
+	}
+
+	// DPCM: the DAC can only change while the sample is playing
+	if (runLen > 0 && !(dmc->mask & 4) && dmc->dfreq > 0 && !(dmc->empty && dmc->dlength == 0))
+	{
+		if (dmc->counter[2] < 0)
+			return 0;
+		runLen = RC_STEPS_BELOW(&dmc->tick_count, (UINT32)dmc->counter[2] + 1, runLen);
+	}
+
+	return runLen;
+}
+
+// number of samples up to (and including) the one that clocks the frame sequencer
+UINT32 NES_DMC_np_FrameSequenceSamples(void* chip, UINT32 maxSmpls)
+{
+	NES_DMC* dmc = (NES_DMC*)chip;
+
+	if (maxSmpls == 0)
+		return 0;
+	return RC_STEPS_BELOW(&dmc->tick_count, frame_sequence_clocks(dmc), maxSmpls - 1) + 1;
+}
+
 UINT32 NES_DMC_np_Render(void* chip, INT32 b[2])
 {
 	NES_DMC* dmc = (NES_DMC*)chip;
@@ -552,6 +619,48 @@ UINT32 NES_DMC_np_Render(void* chip, INT32 b[2])
 	return 2;
 }
 
+// Renders a block of samples and adds them to the output buffers.
+// Runs of samples without level changes are skipped in a single step.
+void NES_DMC_np_RenderBlock(void* chip, UINT32 samples, DEV_SMPL** outputs)
+{
+	NES_DMC* dmc = (NES_DMC*)chip;
+	UINT32 curSmpl;
+	UINT32 runLen;
+	UINT32 runEnd;
+	UINT32 clocks;
+	bool popOffset;
+	INT32 b[2];
+
+	curSmpl = 0;
+	while (curSmpl < samples)
+	{
+		// the anti-click offset rolls off by 1 per sample
+		popOffset = dmc->option[OPT_DPCM_ANTI_CLICK] && (dmc->dmc_pop || dmc->dmc_pop_offset != 0);
+		NES_DMC_np_Render(dmc, b);
+		outputs[0][curSmpl] += b[0];
+		outputs[1][curSmpl] += b[1];
+		curSmpl ++;
+
+		runLen = popOffset ? 0 : run_length(dmc, samples - curSmpl);
+		if (! runLen)
+			continue;
+
+		// advance over the whole run at once, the outputs of this are the same as before
+		RC_STEPS(&dmc->tick_count, runLen);
+		clocks = RC_GET_VAL(&dmc->tick_count);
+		RC_MASK(&dmc->tick_count);
+		TickFrameSequence(dmc, clocks);
+		calc_tri(dmc, clocks);
+		calc_noise(dmc, clocks);
+		calc_dmc(dmc, clocks);
+
+		for (runEnd = curSmpl + runLen; curSmpl < runEnd; curSmpl ++)
+		{
+			outputs[0][curSmpl] += b[0];
+			outputs[1][curSmpl] += b[1];
+		}
+	}
+}
 
 void NES_DMC_np_SetClock(void* chip, UINT32 c)
 {
@@ -8,6 +8,8 @@ void NES_DMC_np_SetRate(void* chip, UINT32 rate);
 void NES_DMC_np_SetPal(void* chip, bool is_pal);
 void NES_DMC_np_SetAPU(void* chip, void* apu_);
 UINT32 NES_DMC_np_Render(void* chip, INT32 b[2]);
+void NES_DMC_np_RenderBlock(void* chip, UINT32 samples, DEV_SMPL** outputs);
+UINT32 NES_DMC_np_FrameSequenceSamples(void* chip, UINT32 maxSmpls);
 void NES_DMC_np_SetMemory(void* chip, const UINT8* r);
 bool NES_DMC_np_Write(void* chip, UINT16 adr, UINT8 val);
 bool NES_DMC_np_Read(void* chip, UINT16 adr, UINT8* val);
@@ -408,6 +408,44 @@ UINT32 NES_FDS_Render(void* chip, INT32 b[2])
 	return 2;
 }
 
+// Renders a block of samples and adds them to the output buffers.
+// While the wave and modulator units are halted, the output level is fixed. As soon as the
+// lowpass filter has settled, the remaining samples are identical and aren't calculated anymore.
+void NES_FDS_RenderBlock(void* chip, UINT32 samples, DEV_SMPL** outputs)
+{
+	NES_FDS* fds = (NES_FDS*)chip;
+	UINT32 curSmpl;
+	INT32 b[2];
+
+	curSmpl = 0;
+	while (curSmpl < samples)
+	{
+		NES_FDS_Render(fds, b);
+		outputs[0][curSmpl] += b[0];
+		outputs[1][curSmpl] += b[1];
+		curSmpl ++;
+
+		if (fds->wav_halt && fds->mod_halt)
+		{
+			INT32 v = fds->fout * MASTER[fds->master_vol] >> 8;
+			INT32 rc_out = ((fds->rc_accum * fds->rc_k) + (v * fds->rc_l)) >> RC_BITS;
+			if (rc_out == fds->rc_accum)
+				break;
+		}
+	}
+	if (curSmpl >= samples)
+		return;
+
+	// The envelopes don't run while the wave is halted, so Tick() would change nothing.
+	RC_STEPS(&fds->tick_count, samples - curSmpl);
+	RC_MASK(&fds->tick_count);
+	for (; curSmpl < samples; curSmpl ++)
+	{
+		outputs[0][curSmpl] += b[0];
+		outputs[1][curSmpl] += b[1];
+	}
+}
+
 bool NES_FDS_Write(void* chip, UINT16 adr, UINT8 val)
 {
 	NES_FDS* fds = (NES_FDS*)chip;
@@ -5,6 +5,7 @@ void* NES_FDS_Create(UINT32 clock, UINT32 rate);
 void NES_FDS_Destroy(void* chip);
 void NES_FDS_Reset(void* chip);
 UINT32 NES_FDS_Render(void* chip, INT32 b[2]);
+void NES_FDS_RenderBlock(void* chip, UINT32 samples, DEV_SMPL** outputs);
 bool NES_FDS_Write(void* chip, UINT16 adr, UINT8 val);
 bool NES_FDS_Read(void* chip, UINT16 adr, UINT8* val);
 void NES_FDS_SetRate(void* chip, UINT32 r);
@@ -413,6 +413,13 @@ static void OPL3_EnvelopeCalc(opl3_slot *slot)
     uint8_t reset = 0;
     slot->eg_out = slot->eg_rout + (slot->reg_tl << 2)
                  + (slot->eg_ksl >> kslshift[slot->reg_ksl]) + *slot->trem;
+    if (!slot->key && slot->eg_gen == envelope_gen_num_release && (slot->eg_rout & 0x1f8) == 0x1f8)
+    {
+        /* Envelope off: the code below would only clamp the level, so skip the rate calculation. */
+        slot->pg_reset = 0;
+        slot->eg_rout = 0x1ff;
+        return;
+    }
     if (slot->key && slot->eg_gen == envelope_gen_num_release)
     {
         reset = 1;
@@ -1138,12 +1145,29 @@ INLINE int16_t OPL3_ClipSample(int32_t sample)
 }
 #endif
 
-INLINE void NOPL3_ProcessSlot(opl3_slot *slot)
+/* Process the slots first..last-1 stage by stage instead of slot by slot.
+ * This is equivalent, because the only dependencies between slots are
+ * - the noise generator and the rhythm bits (phase stage, still run in slot order)
+ * - the modulation input (operator stage, still run in slot order)
+ */
+static void NOPL3_ProcessSlots(opl3_chip *chip, uint8_t first, uint8_t last)
 {
-    OPL3_SlotCalcFB(slot);
-    OPL3_EnvelopeCalc(slot);
-    OPL3_PhaseGenerate(slot);
-    OPL3_SlotGenerate(slot);
+    opl3_slot *slot;
+    opl3_slot *slot_end = &chip->slot[last];
+
+    for (slot = &chip->slot[first]; slot < slot_end; slot++)
+    {
+        OPL3_SlotCalcFB(slot);
+        OPL3_EnvelopeCalc(slot);
+    }
+    for (slot = &chip->slot[first]; slot < slot_end; slot++)
+    {
+        OPL3_PhaseGenerate(slot);
+    }
+    for (slot = &chip->slot[first]; slot < slot_end; slot++)
+    {
+        OPL3_SlotGenerate(slot);
+    }
 }
 
 void NOPL3_Generate4Ch(opl3_chip *chip, int32_t *buf4)
@@ -1161,13 +1185,10 @@ void NOPL3_Generate4Ch(opl3_chip *chip, int32_t *buf4)
     buf4[3] = chip->mixbuff[3];
 
 #if OPL_QUIRK_CHANNELSAMPLEDELAY
-    for (ii = 0; ii < 15; ii++)
+    NOPL3_ProcessSlots(chip, 0, 15);
 #else
-    for (ii = 0; ii < 36; ii++)
+    NOPL3_ProcessSlots(chip, 0, 36);
 #endif
-    {
-        NOPL3_ProcessSlot(&chip->slot[ii]);
-    }
 
     mix[0] = mix[1] = 0;
     for (ii = 0; ii < 18; ii++)
@@ -1188,10 +1209,7 @@ void NOPL3_Generate4Ch(opl3_chip *chip, int32_t *buf4)
     chip->mixbuff[2] = mix[1];
 
 #if OPL_QUIRK_CHANNELSAMPLEDELAY
-    for (ii = 15; ii < 18; ii++)
-    {
-        NOPL3_ProcessSlot(&chip->slot[ii]);
-    }
+    NOPL3_ProcessSlots(chip, 15, 18);
 #endif
 
     //buf4[0] = OPL3_ClipSample(chip->mixbuff[0]);
@@ -1200,10 +1218,7 @@ void NOPL3_Generate4Ch(opl3_chip *chip, int32_t *buf4)
     buf4[2] = chip->mixbuff[2];
 
 #if OPL_QUIRK_CHANNELSAMPLEDELAY
-    for (ii = 18; ii < 33; ii++)
-    {
-        NOPL3_ProcessSlot(&chip->slot[ii]);
-    }
+    NOPL3_ProcessSlots(chip, 18, 33);
 #endif
 
     mix[0] = mix[1] = 0;
@@ -1225,10 +1240,7 @@ void NOPL3_Generate4Ch(opl3_chip *chip, int32_t *buf4)
     chip->mixbuff[3] = mix[1];
 
 #if OPL_QUIRK_CHANNELSAMPLEDELAY
-    for (ii = 33; ii < 36; ii++)
-    {
-        NOPL3_ProcessSlot(&chip->slot[ii]);
-    }
+    NOPL3_ProcessSlots(chip, 33, 36);
 #endif
 
     if ((chip->timer & 0x3f) == 0x3f)
@@ -449,12 +449,18 @@ static void OPM_PhaseCalcFNumBlock(opm_t *chip)
     uint32_t lfo = chip->lfo_pmd ? chip->lfo_pm_lock : 0;
     uint32_t pms = chip->opp ? chip->pg_opp_pms : chip->ch_pms[channel];
     uint32_t dt = chip->opp ? chip->pg_opp_dt2[slot] : chip->sl_dt2[slot];
-    int32_t lfo_pm = OPM_LFOApplyPMS(lfo & 127, pms);
-    uint32_t kcode = OPM_CalcKCode(kcf, lfo_pm, (lfo & 0x80) != 0 && pms != 0 ? 0 : 1, dt);
-    uint32_t fnum = OPM_KCToFNum(kcode);
-    uint32_t kcode_h = kcode >> 8;
-    chip->pg_fnum[slot] = fnum;
-    chip->pg_kcode[slot] = kcode_h;
+    /* The result only depends on these inputs, which rarely change. (bit 31 marks a valid key) */
+    uint32_t key = 0x80000000 | (kcf << 13) | ((lfo & 0xff) << 5) | (pms << 2) | dt;
+    if (chip->pg_fnum_key[slot] != key)
+    {
+        int32_t lfo_pm = OPM_LFOApplyPMS(lfo & 127, pms);
+        uint32_t kcode = OPM_CalcKCode(kcf, lfo_pm, (lfo & 0x80) != 0 && pms != 0 ? 0 : 1, dt);
+        uint32_t fnum = OPM_KCToFNum(kcode);
+        uint32_t kcode_h = kcode >> 8;
+        chip->pg_fnum[slot] = fnum;
+        chip->pg_kcode[slot] = kcode_h;
+        chip->pg_fnum_key[slot] = key;
+    }
 
     if (chip->opp)
     {
@@ -641,22 +647,7 @@ static void OPM_EnvelopePhase2(opm_t *chip)
     chip->eg_ratemax[1] = chip->eg_ratemax[0];
     chip->eg_ratemax[0] = (rate >> 1) == 31;
     ams = chip->sl_am_e[slot] ? chip->ch_ams[chan] : 0;
-    switch (ams)
-    {
-    default:
-    case 0:
-        chip->eg_am = 0;
-        break;
-    case 1:
-        chip->eg_am = chip->lfo_am_lock << 0;
-        break;
-    case 2:
-        chip->eg_am = chip->lfo_am_lock << 1;
-        break;
-    case 3:
-        chip->eg_am = chip->lfo_am_lock << 2;
-        break;
-    }
+    chip->eg_am = ams ? (chip->lfo_am_lock << (ams - 1)) : 0;
 }
 
 static void OPM_EnvelopePhase3(opm_t *chip)
@@ -1490,29 +1481,10 @@ static void OPM_DoLFOMult(opm_t *chip)
 
     chip->lfo_out2_b = chip->lfo_out2;
 
-    switch (chip->lfo_bit_counter & 7)
+    // bit counter 0..6 selects depth/LFO bit 6..0, 7 is a dead cycle
+    if ((chip->lfo_bit_counter & 7) != 7)
     {
-    case 0:
-        bit = (dp & 64) != 0 && (chip->lfo_out1 & 64) != 0;
-        break;
-    case 1:
-        bit = (dp & 32) != 0 && (chip->lfo_out1 & 32) != 0;
-        break;
-    case 2:
-        bit = (dp & 16) != 0 && (chip->lfo_out1 & 16) != 0;
-        break;
-    case 3:
-        bit = (dp & 8) != 0 && (chip->lfo_out1 & 8) != 0;
-        break;
-    case 4:
-        bit = (dp & 4) != 0 && (chip->lfo_out1 & 4) != 0;
-        break;
-    case 5:
-        bit = (dp & 2) != 0 && (chip->lfo_out1 & 2) != 0;
-        break;
-    case 6:
-        bit = (dp & 1) != 0 && (chip->lfo_out1 & 1) != 0;
-        break;
+        bit = (dp & chip->lfo_out1 & (64 >> (chip->lfo_bit_counter & 7))) != 0;
     }
 
     b1 = (chip->lfo_out2 & 1) != 0;
@@ -140,6 +140,7 @@ typedef struct {
     // Phase Gen
     uint16_t pg_fnum[32];
     uint8_t pg_kcode[32];
+    uint32_t pg_fnum_key[32];   // inputs that pg_fnum/pg_kcode were calculated from
     uint32_t pg_inc[32];
     uint32_t pg_phase[32];
     uint8_t pg_reset[32];
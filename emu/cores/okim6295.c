@@ -81,6 +81,8 @@ static void okim6295_w(void* chip, UINT8 offset, UINT8 data);
 
 static void okim6295_alloc_rom(void* info, UINT32 memsize);
 static void okim6295_write_rom(void* info, UINT32 offset, UINT32 length, const UINT8* data);
+static void okim6295_attach_rom(void* info, UINT32 length, const UINT8* data);
+static void okim6295_set_options(void *info, UINT32 Flags);
 static void okim6295_set_mute_mask(void *info, UINT32 MuteMask);
 static void okim6295_set_srchg_cb(void* chip, DEVCB_SRATE_CHG CallbackFunc, void* DataPtr);
 static void okim6295_set_log_cb(void* chip, DEVCB_LOG func, void* param);
@@ -92,6 +94,7 @@ static DEVDEF_RWFUNC devFunc[] =
 	{RWF_REGISTER | RWF_READ, DEVRW_A8D8, 0, okim6295_r},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, okim6295_write_rom},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, okim6295_alloc_rom},
+	{RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, okim6295_attach_rom},
 	{RWF_CLOCK | RWF_WRITE, DEVRW_VALUE, 0, okim6295_set_clock},
 	{RWF_SRATE | RWF_READ, DEVRW_VALUE, 0, okim6295_get_rate},
 	{RWF_CHN_MUTE | RWF_WRITE, DEVRW_ALL, 0, okim6295_set_mute_mask},
@@ -106,7 +109,7 @@ static DEV_DEF devDef =
 	device_reset_okim6295,
 	okim6295_update,
 	
-	NULL,	// SetOptionBits
+	okim6295_set_options,	// SetOptionBits
 	okim6295_set_mute_mask,
 	NULL,	// SetPanning
 	okim6295_set_srchg_cb,	// SetSampleRateChangeCallback
@@ -150,6 +153,23 @@ const DEV_DECL sndDev_MSM6295 =
 };
 
 
+// a decoded phrase, see OPT_OKIM6295_PHRASE_CACHE
+typedef struct _okim_phrase
+{
+	UINT32          start;          // key: start address
+	UINT32          count;          // key: number of samples
+	UINT32          bank;           // key: bank_offs or NMK bank registers
+	UINT8           nmk_mode;       // key: NMK112 mode
+	UINT32          decoded;        // number of samples decoded so far
+	UINT32          alloc;          // number of samples the buffers can hold
+	oki_adpcm_state adpcm;          // decoder state after the last decoded sample
+	UINT32          rom_lo;         // range of ROM offsets read by the decoded samples
+	UINT32          rom_hi;
+	UINT32          last_use;       // value of cache_clock when the phrase was last started
+	INT16*          signal;         // ADPCM output of each sample
+	UINT8*          step;           // ADPCM step after each sample
+} okim_phrase;
+
 // a single voice
 typedef struct _okim_voice
 {
@@ -162,6 +182,8 @@ typedef struct _okim_voice
 
 	INT32           volume;         // output volume
 	UINT8           Muted;
+
+	okim_phrase*    phrase;         // decoded phrase (NULL = decode from ROM)
 } okim_voice;
 
 struct _okim6295_state
@@ -188,6 +210,15 @@ struct _okim6295_state
 	
 	UINT32  ROMSize;
 	UINT8*  ROM;
+	UINT8   ROMOwned;
+	
+	#define OKIM6295_PHRASES 128
+	#define OKIM6295_CACHE_MAX 0x1000000	// maximum memory used by decoded phrases, in bytes
+	#define OKIM6295_CACHE_BLOCK 0x400		// initial buffer size of a phrase, in samples
+	UINT8 cache_enable;
+	UINT32 cache_clock; // incremented for each started phrase, for replacing the least recently used one
+	UINT32 cache_size;
+	okim_phrase phrases[OKIM6295_PHRASES];
 	
 	DEVCB_SRATE_CHG SmpRateFunc;
 	void* SmpRateData;
@@ -248,7 +279,8 @@ INLINE void WriteLE32(UINT8* buffer, UINT32 value)
 #define NMK_BANKMASK	(NMK_BANKSIZE - 1)		// 0xFFFF
 #define NMK_ROMBASE		(4 * NMK_BANKSIZE)		// 0x40000
 
-static UINT8 memory_raw_read_byte(okim6295_state *chip, UINT32 offset)
+// map a chip address to a ROM offset, using the current bank settings
+INLINE UINT32 memory_map_offset(const okim6295_state *chip, UINT32 offset)
 {
 	UINT32 CurOfs;
 	
@@ -273,12 +305,257 @@ static UINT8 memory_raw_read_byte(okim6295_state *chip, UINT32 offset)
 		}
 		CurOfs |= (chip->nmk_bank[BankID & 0x03] << NMK_BANKBITS);
 	}
+	return CurOfs;
+}
+
+static UINT8 memory_raw_read_byte(okim6295_state *chip, UINT32 offset)
+{
+	UINT32 CurOfs = memory_map_offset(chip, offset);
+	
 	if (CurOfs < chip->ROMSize)
 		return chip->ROM[CurOfs];
 	else
 		return 0x00;
 }
 
+/**********************************************************************************************
+
+     phrase cache -- decodes each phrase once and plays it back from the decoded data
+
+***********************************************************************************************/
+
+// The decoded data is only valid for the current memory mapping. ROM writes discard the
+// phrases that read from the written range.
+// Phrases are decoded while they are played, so voices that are stopped early
+// don't waste time on decoding the rest of the phrase.
+// The ADPCM state of the voice is kept up to date during playback, so voices can
+// switch back to decoding from ROM at any point.
+
+static UINT32 cache_bank_key(const okim6295_state *chip)
+{
+	if (! chip->nmk_mode)
+		return chip->bank_offs;
+	return	(chip->nmk_bank[0] <<  0) | (chip->nmk_bank[1] <<  8) |
+			(chip->nmk_bank[2] << 16) | (chip->nmk_bank[3] << 24);
+}
+
+static void cache_detach_voices(okim6295_state *chip, const okim_phrase *phrase)
+{
+	int i;
+
+	// phrase == NULL: detach all voices
+	for (i = 0; i < OKIM6295_VOICES; i++)
+	{
+		if (phrase == NULL || chip->voice[i].phrase == phrase)
+			chip->voice[i].phrase = NULL;
+	}
+}
+
+static void cache_free_phrase(okim6295_state *chip, okim_phrase *phrase)
+{
+	if (phrase->signal == NULL)
+		return;
+
+	cache_detach_voices(chip, phrase);
+	chip->cache_size -= phrase->alloc * (sizeof(INT16) + sizeof(UINT8));
+	free(phrase->signal);	phrase->signal = NULL;
+	free(phrase->step);	phrase->step = NULL;
+	phrase->alloc = 0;
+}
+
+static void cache_flush(okim6295_state *chip)
+{
+	int i;
+
+	cache_detach_voices(chip, NULL);
+	for (i = 0; i < OKIM6295_PHRASES; i++)
+		cache_free_phrase(chip, &chip->phrases[i]);
+}
+
+// discard all phrases that read from the ROM range [start, end)
+static void cache_invalidate(okim6295_state *chip, UINT32 start, UINT32 end)
+{
+	okim_phrase *phrase;
+	int i;
+
+	for (i = 0; i < OKIM6295_PHRASES; i++)
+	{
+		phrase = &chip->phrases[i];
+		if (phrase->signal != NULL && phrase->decoded > 0 &&
+			phrase->rom_lo < end && phrase->rom_hi >= start)
+			cache_free_phrase(chip, phrase);
+	}
+}
+
+// free the least recently used phrases until 'size' more bytes fit into the cache
+static UINT8 cache_make_room(okim6295_state *chip, UINT32 size, const okim_phrase *keep)
+{
+	okim_phrase *oldest;
+	okim_phrase *phrase;
+	int i;
+
+	while (chip->cache_size + size > OKIM6295_CACHE_MAX)
+	{
+		oldest = NULL;
+		for (i = 0; i < OKIM6295_PHRASES; i++)
+		{
+			phrase = &chip->phrases[i];
+			if (phrase->signal == NULL || phrase == keep)
+				continue;
+			if (oldest == NULL || (INT32)(phrase->last_use - oldest->last_use) < 0)
+				oldest = phrase;
+		}
+		if (oldest == NULL)
+			return 0;
+		cache_free_phrase(chip, oldest);
+	}
+	return 1;
+}
+
+// grow the buffers of a phrase to hold at least 'samples' samples
+static UINT8 cache_grow_phrase(okim6295_state *chip, okim_phrase *phrase, UINT32 samples)
+{
+	UINT32 alloc;
+	INT16 *signal;
+	UINT8 *step;
+
+	alloc = phrase->alloc ? phrase->alloc : OKIM6295_CACHE_BLOCK;
+	while (alloc < samples)
+		alloc *= 2;
+	if (alloc > phrase->count)
+		alloc = phrase->count;
+	if (! cache_make_room(chip, (alloc - phrase->alloc) * (sizeof(INT16) + sizeof(UINT8)), phrase))
+		return 0;
+
+	signal = (INT16*)realloc(phrase->signal, alloc * sizeof(INT16));
+	if (signal == NULL)
+		return 0;
+	phrase->signal = signal;
+	step = (UINT8*)realloc(phrase->step, alloc * sizeof(UINT8));
+	if (step == NULL)
+		return 0;
+	phrase->step = step;
+	chip->cache_size += (alloc - phrase->alloc) * (sizeof(INT16) + sizeof(UINT8));
+	phrase->alloc = alloc;
+	return 1;
+}
+
+// make sure that the first 'samples' samples of the phrase are decoded
+// Decoding uses the current memory mapping, which is the one of the phrase as long as voices use it.
+static UINT8 cache_decode(okim6295_state *chip, okim_phrase *phrase, UINT32 samples)
+{
+	UINT32 i;
+	UINT32 ofs;
+	UINT8 nibble;
+
+	if (samples > phrase->count)
+		samples = phrase->count;
+	if (samples <= phrase->decoded)
+		return 1;
+	if (samples > phrase->alloc && ! cache_grow_phrase(chip, phrase, samples))
+		return 0;
+
+	for (i = phrase->decoded; i < samples; i++)
+	{
+		ofs = memory_map_offset(chip, phrase->start + i / 2);
+		if (ofs < phrase->rom_lo)
+			phrase->rom_lo = ofs;
+		if (ofs > phrase->rom_hi)
+			phrase->rom_hi = ofs;
+		nibble = ((ofs < chip->ROMSize) ? chip->ROM[ofs] : 0x00) >> (((i & 1) << 2) ^ 4);
+		phrase->signal[i] = oki_adpcm_clock(&phrase->adpcm, nibble);
+		phrase->step[i] = (UINT8)phrase->adpcm.step;
+	}
+	phrase->decoded = samples;
+	return 1;
+}
+
+static okim_phrase* cache_get_phrase(okim6295_state *chip, UINT32 start, UINT32 count)
+{
+	UINT32 bank = cache_bank_key(chip);
+	okim_phrase *phrase;
+	okim_phrase *oldest;
+	UINT32 i;
+
+	chip->cache_clock ++;
+	oldest = NULL;
+	for (i = 0; i < OKIM6295_PHRASES; i++)
+	{
+		phrase = &chip->phrases[i];
+		if (phrase->signal == NULL)
+		{
+			if (oldest == NULL || oldest->signal != NULL)
+				oldest = phrase;	// prefer unused slots
+			continue;
+		}
+		if (phrase->start == start && phrase->count == count &&
+			phrase->bank == bank && phrase->nmk_mode == chip->nmk_mode)
+		{
+			phrase->last_use = chip->cache_clock;
+			return phrase;
+		}
+		if (oldest == NULL || (oldest->signal != NULL && (INT32)(phrase->last_use - oldest->last_use) < 0))
+			oldest = phrase;
+	}
+
+	// replace the least recently used phrase
+	phrase = oldest;
+	cache_free_phrase(chip, phrase);
+	phrase->start = start;
+	phrase->count = count;
+	phrase->bank = bank;
+	phrase->nmk_mode = chip->nmk_mode;
+	phrase->decoded = 0;
+	phrase->rom_lo = (UINT32)-1;
+	phrase->rom_hi = 0;
+	phrase->last_use = chip->cache_clock;
+	oki_adpcm_init(&phrase->adpcm, NULL, NULL);
+	if (! cache_grow_phrase(chip, phrase, 1))
+	{
+		free(phrase->signal);	phrase->signal = NULL;
+		free(phrase->step);	phrase->step = NULL;
+		phrase->alloc = 0;
+		return NULL;
+	}
+
+	return phrase;
+}
+
+static UINT8 generate_cached(okim6295_state *chip, okim_voice *voice, DEV_SMPL *buffer, UINT32 samples)
+{
+	okim_phrase *phrase = voice->phrase;
+	const INT16 *src;
+	INT32 volume = voice->volume;
+	UINT32 i;
+
+	if (samples > voice->count - voice->sample)
+		samples = voice->count - voice->sample;
+	if (! samples)
+		return 1;
+	if (! cache_decode(chip, phrase, voice->sample + samples))
+	{
+		// not enough memory - continue decoding from ROM
+		voice->phrase = NULL;
+		return 0;
+	}
+
+	// output to the buffer, scaling by the volume
+	src = &phrase->signal[voice->sample];
+	for (i = 0; i < samples; i++)
+		buffer[i] += src[i] * volume / 2;
+
+	// keep the ADPCM state in sync with the decoded data
+	voice->sample += samples;
+	voice->adpcm.signal = phrase->signal[voice->sample - 1];
+	voice->adpcm.step = phrase->step[voice->sample - 1];
+	if (voice->sample >= voice->count)
+	{
+		voice->playing = 0;
+		voice->phrase = NULL;
+	}
+	return 1;
+}
+
 static void generate_adpcm(okim6295_state *chip, okim_voice *voice, DEV_SMPL *buffer, UINT32 samples)
 {
 	UINT32 i;
@@ -287,6 +564,9 @@ static void generate_adpcm(okim6295_state *chip, okim_voice *voice, DEV_SMPL *bu
 	if (!voice->playing || voice->Muted)
 		return;
 
+	if (voice->phrase != NULL && generate_cached(chip, voice, buffer, samples))
+		return;
+
 	// loop while we still have samples to generate
 	for (i = 0; i < samples; i++)
 	{
@@ -380,7 +660,8 @@ static void device_stop_okim6295(void* chipptr)
 {
 	okim6295_state *chip = (okim6295_state *)chipptr;
 	
-	free(chip->ROM);
+	cache_flush(chip);
+	rom_free(chip->ROM, chip->ROMOwned);
 	free(chip);
 	
 	return;
@@ -407,6 +688,7 @@ static void device_reset_okim6295(void *chip)
 	info->bank_offs = 0;
 	info->nmk_mode = 0x00;
 	memset(info->nmk_bank, 0x00, 4 * sizeof(UINT8));
+	cache_detach_voices(info, NULL);
 	
 	for (voice = 0; voice < OKIM6295_VOICES; voice++)
 	{
@@ -539,6 +821,8 @@ static void okim6295_write_command(okim6295_state *info, UINT8 data)
 						// also reset the ADPCM parameters
 						oki_adpcm_reset(&voice->adpcm);
 						voice->volume = volume_table[data & 0x0f];
+						voice->phrase = (info->cache_enable && info->ROM != NULL) ?
+							cache_get_phrase(info, start, voice->count) : NULL;
 					}
 
 					// invalid samples go here
@@ -599,15 +883,21 @@ static void okim6295_w(void* chip, UINT8 offset, UINT8 data)
 		okim6295_set_pin7(info, data);
 		break;
 	case 0x0E:	// NMK112 bank switch enable
+		if (info->nmk_mode != data)
+			cache_detach_voices(info, NULL);
 		info->nmk_mode = data;
 		break;
 	case 0x0F:
+		if (info->bank_offs != (data << 18))
+			cache_detach_voices(info, NULL);
 		okim6295_set_bank_base(info, data << 18);
 		break;
 	case 0x10:
 	case 0x11:
 	case 0x12:
 	case 0x13:
+		if (info->nmk_bank[offset & 0x03] != data)
+			cache_detach_voices(info, NULL);
 		info->nmk_bank[offset & 0x03] = data;
 		break;
 	}
@@ -622,7 +912,8 @@ static void okim6295_alloc_rom(void* info, UINT32 memsize)
 	if (chip->ROMSize == memsize)
 		return;
 	
-	chip->ROM = (UINT8*)realloc(chip->ROM, memsize);
+	cache_flush(chip);
+	chip->ROM = (UINT8*)rom_realloc(chip->ROM, &chip->ROMOwned, memsize);
 	chip->ROMSize = memsize;
 	memset(chip->ROM, 0xFF, chip->ROMSize);
 	
@@ -632,17 +923,46 @@ static void okim6295_alloc_rom(void* info, UINT32 memsize)
 static void okim6295_write_rom(void* info, UINT32 offset, UINT32 length, const UINT8* data)
 {
 	okim6295_state *chip = (okim6295_state *)info;
+	UINT8* rom;
 	
 	if (offset >= chip->ROMSize)
 		return;
 	if (offset + length > chip->ROMSize)
 		length = chip->ROMSize - offset;
 	
+	cache_invalidate(chip, offset, offset + length);
+	rom = (UINT8*)rom_unshare(chip->ROM, &chip->ROMOwned, chip->ROMSize);
+	if (rom == NULL)
+		return;
+	chip->ROM = rom;
 	memcpy(&chip->ROM[offset], data, length);
 	
 	return;
 }
 
+static void okim6295_attach_rom(void* info, UINT32 length, const UINT8* data)
+{
+	okim6295_state *chip = (okim6295_state *)info;
+	
+	if (data != chip->ROM || length != chip->ROMSize)
+		cache_flush(chip);
+	chip->ROM = (UINT8*)rom_attach(chip->ROM, &chip->ROMOwned, data);
+	chip->ROMSize = (data != NULL) ? length : 0x00;
+	
+	return;
+}
+
+
+static void okim6295_set_options(void *info, UINT32 Flags)
+{
+	okim6295_state *chip = (okim6295_state *)info;
+	
+	chip->cache_enable = (Flags & OPT_OKIM6295_PHRASE_CACHE) ? 1 : 0;
+	if (! chip->cache_enable)
+		cache_flush(chip);
+	
+	return;
+}
 
 static void okim6295_set_mute_mask(void *info, UINT32 MuteMask)
 {
@@ -5,6 +5,8 @@
 
 // cfg.flags: pin 7 state, controls clock divider - 0 = clk/165, 1 = clk/132
 
+#define OPT_OKIM6295_PHRASE_CACHE	0x01	// decode each phrase once and play it from memory (default: disabled)
+
 extern const DEV_DECL sndDev_MSM6295;
 
 #endif	// __OKIM6295_H__
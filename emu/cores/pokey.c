@@ -106,13 +106,15 @@ static UINT8 device_start_pokey(const DEV_GEN_CFG *, DEV_INFO *);
 static void device_stop_pokey(void *);
 static void device_reset_pokey(void *);
 static void pokey_set_mute_mask(void *, UINT32 mutes);
+static void pokey_set_options(void *, UINT32 options);
 
 static void pokey_step_one_clock(pokey_device *);
 static void pokey_sid_w(pokey_device *d, UINT8 state);
 INLINE void pokey_process_channel(pokey_device *d, int ch);
 
 static void pokey_potgo(pokey_device *d);
-static void pokey_vol_init(pokey_device *d);
+static void pokey_free_output_tables(pokey_device *d);
+static void pokey_calc_output_tables(pokey_device *d);
 static void poly_init_4_5(UINT32 *poly, int size);
 static void poly_init_9_17(UINT32 *poly, int size);
 
@@ -132,7 +134,7 @@ static DEV_DEF devDef =
 	device_reset_pokey,
 	pokey_update,
 	
-	NULL,	// SetOptionBits
+	pokey_set_options,	// SetOptionBits
 	pokey_set_mute_mask,
 	NULL,	// SetPanning
 	NULL,	// SetSampleRateChangeCallback
@@ -293,6 +295,7 @@ struct pokey_device
 	UINT32 m_out_raw;         /* raw output */
 	UINT8 m_old_raw_inval;    /* true: recalc m_out_raw required */
 	double m_out_filter;      /* filtered output */
+	INT32 m_out_filter_fp;    /* filtered output, fixed point version */
 
 	INT32 m_clock_cnt[3];     /* clock counters */
 	UINT32 m_p4;              /* poly4 index */
@@ -329,13 +332,21 @@ struct pokey_device
 	UINT32 m_poly5[0x1f];
 	UINT32 m_poly9[0x1ff];
 	UINT32 m_poly17[0x1ffff];
-	double m_voltab[0x10000];
 
 	enum output_type m_output_type;
 	double m_r_pullup;
 	double m_cap;
 	double m_v_ref;
 
+	/* The analog output models depend only on m_out_raw and the fixed circuit
+	 * parameters, so their coefficients are calculated once per configuration.
+	 */
+	UINT8 m_filter_fixed;     /* run the output filter in fixed point */
+	double *m_filt_v0;        /* target voltage per raw output */
+	double *m_filt_mult;      /* filter multiplier per raw output */
+	INT32 *m_filt_v0_fp;      /* target voltage, fixed point (FILT_FRAC_BITS, scaled to 0x7fff) */
+	INT32 *m_filt_mult_fp;    /* filter multiplier, fixed point (MULT_FRAC_BITS) */
+
 	int m_icount;
 };
 
@@ -381,6 +392,7 @@ static void pokey_set_output_rc(pokey_device *d, double r, double c, double v)
 	d->m_r_pullup = r;
 	d->m_cap = c;
 	d->m_v_ref = v;
+	pokey_calc_output_tables(d);
 }
 
 static void pokey_set_output_opamp(pokey_device *d, double r, double c, double v)
@@ -389,6 +401,7 @@ static void pokey_set_output_opamp(pokey_device *d, double r, double c, double v
 	d->m_r_pullup = r;
 	d->m_cap = c;
 	d->m_v_ref = v;
+	pokey_calc_output_tables(d);
 }
 
 static void pokey_set_output_opamp_low_pass(pokey_device *d, double r, double c, double v)
@@ -397,11 +410,13 @@ static void pokey_set_output_opamp_low_pass(pokey_device *d, double r, double c,
 	d->m_r_pullup = r;
 	d->m_cap = c;
 	d->m_v_ref = v;
+	pokey_calc_output_tables(d);
 }
 
 static void set_output_discrete(pokey_device *d)
 {
 	d->m_output_type = DISCRETE_VAR_R;
+	pokey_calc_output_tables(d);
 }
 /* end mame's original pokey.h */
 
@@ -417,6 +432,29 @@ static void set_output_discrete(pokey_device *d)
 
 #define POKEY_DEFAULT_GAIN (32767/11/4)
 
+#define FILT_FRAC_BITS  8   /* fraction bits of the fixed point output filter */
+#define MULT_FRAC_BITS  24  /* fraction bits of the fixed point filter multiplier */
+
+/* conductance of the output for each channel volume, generated by tables_gen.c */
+#include "pokey_tables.h"
+
+/* resistance of the output for a combination of channel volumes */
+INLINE double pokey_out_resistance(UINT32 raw)
+{
+	double rTot = 0;
+	int i;
+
+	for (i=0; i<4; i++)
+		rTot += chan_cond[(raw >> (i*4)) & 0x0f];
+	return 1.0 / rTot;
+}
+
+/* circuit values used when an analog output model is selected via the option bits */
+#define OUT_R_PULLUP    10000.0 /* RC low-pass: pull-up resistor */
+#define OUT_CAP         10e-9
+#define OUT_R_OPAMP     1000.0  /* op-amp stages: feedback resistor */
+#define OUT_V_REF       5.0
+
 #define CHAN1   0
 #define CHAN2   1
 #define CHAN3   2
@@ -495,6 +533,7 @@ static void pokey_set_mute_mask(void *info, UINT32 mask)
 static void device_stop_pokey(void *info)
 {
 	pokey_device *d = (pokey_device *)info;
+	pokey_free_output_tables(d);
 	free(d);
 }
 
@@ -526,7 +565,6 @@ static UINT8 device_start_pokey(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf)
 	/* initialize 9 / 17 arrays */
 	poly_init_9_17(d->m_poly9,   9);
 	poly_init_9_17(d->m_poly17, 17);
-	pokey_vol_init(d);
 
 	//m_pot_r_cb.resolve_all();
 	//m_allpot_r_cb.resolve();
@@ -593,6 +631,7 @@ static void device_reset_pokey(void *info)
 	d->m_pot_counter = 0;
 	d->m_kbd_cnt = 0;
 	d->m_out_filter = 0;
+	d->m_out_filter_fp = 0;
 	d->m_out_raw = 0;
 	d->m_old_raw_inval = 1;
 	d->m_kbd_state = 0;
@@ -998,23 +1037,101 @@ void pokey_update(void *info, UINT32 samples, DEV_SMPL **outputs)
 			outputs[0][sampindex] = out;
 			outputs[1][sampindex] = out;
 		}
-		else if (d->m_output_type == RC_LOWPASS)
+		else if (d->m_output_type == RC_LOWPASS || d->m_output_type == OPAMP_LOW_PASS)
+		{
+			/* store sum of output signals into the buffer */
+			if (d->m_filter_fixed)
+			{
+				INT32 V0 = d->m_filt_v0_fp[d->m_out_raw];
+				INT64 step = (INT64)(V0 - d->m_out_filter_fp) * d->m_filt_mult_fp[d->m_out_raw];
+				d->m_out_filter_fp += (INT32)((step + (1 << (MULT_FRAC_BITS - 1))) >> MULT_FRAC_BITS);
+				outputs[0][sampindex] = d->m_out_filter_fp >> FILT_FRAC_BITS;
+			}
+			else
+			{
+				d->m_out_filter += (d->m_filt_v0[d->m_out_raw] - d->m_out_filter) * d->m_filt_mult[d->m_out_raw];
+				/* TODO verify that d->m_out_filter is in the range -1.0 - +1.0 */
+				outputs[0][sampindex] = (DEV_SMPL)(d->m_out_filter * 0x7fff);
+			}
+			outputs[1][sampindex] = outputs[0][sampindex];
+		}
+		else if (d->m_output_type == OPAMP_C_TO_GROUND)
+		{
+			/* TODO verify that V0 is in the range -1.0 - +1.0 */
+			if (d->m_filter_fixed)
+				outputs[0][sampindex] = d->m_filt_v0_fp[d->m_out_raw] >> FILT_FRAC_BITS;
+			else
+				outputs[0][sampindex] = (DEV_SMPL)(d->m_filt_v0[d->m_out_raw] * 0x7fff);
+			outputs[1][sampindex] = outputs[0][sampindex];
+		}
+		else if (d->m_output_type == DISCRETE_VAR_R)
 		{
-			double rTot = d->m_voltab[d->m_out_raw];
+			/* store sum of output signals into the buffer */
 
-			double V0 = rTot / (rTot+d->m_r_pullup) * d->m_v_ref / 5.0;
-			double mult = (d->m_cap == 0.0) ? 1.0 : 1.0 - exp(-(rTot + d->m_r_pullup) / (d->m_cap * d->m_r_pullup * rTot) * d->m_clock_period);
+			/* TODO verify that the resistance is in the range -1.0 - +1.0 */
+			outputs[0][sampindex] = (DEV_SMPL)(pokey_out_resistance(d->m_out_raw) * 0x7fff);
+			outputs[1][sampindex] = outputs[0][sampindex];
+		}
+	}
+}
 
-			/* store sum of output signals into the buffer */
-			d->m_out_filter += (V0 - d->m_out_filter) * mult;
+static void pokey_free_output_tables(pokey_device *d)
+{
+	free(d->m_filt_v0);
+	free(d->m_filt_mult);
+	free(d->m_filt_v0_fp);
+	free(d->m_filt_mult_fp);
+	d->m_filt_v0 = d->m_filt_mult = NULL;
+	d->m_filt_v0_fp = d->m_filt_mult_fp = NULL;
+}
+
+static void pokey_calc_output_tables(pokey_device *d)
+{
+	UINT32 j;
+	/* OPAMP_C_TO_GROUND has no filter, so it only needs the target voltage */
+	UINT8 need_mult = (d->m_output_type != OPAMP_C_TO_GROUND);
+	UINT8 alloc_ok;
+
+	/* only the tables of the selected model and precision are kept */
+	pokey_free_output_tables(d);
+	if (d->m_output_type == LEGACY_LINEAR || d->m_output_type == DISCRETE_VAR_R)
+		return;
 
-			/* TODO verify that d->m_out_filter is in the range -1.0 - +1.0 */
-			outputs[0][sampindex] = (DEV_SMPL)(d->m_out_filter * 0x7fff);
-			outputs[1][sampindex] = (DEV_SMPL)(d->m_out_filter * 0x7fff);
+	if (d->m_filter_fixed)
+	{
+		d->m_filt_v0_fp = (INT32 *)malloc(0x10000 * sizeof(INT32));
+		if (need_mult)
+			d->m_filt_mult_fp = (INT32 *)malloc(0x10000 * sizeof(INT32));
+		alloc_ok = (d->m_filt_v0_fp != NULL && (!need_mult || d->m_filt_mult_fp != NULL));
+	}
+	else
+	{
+		d->m_filt_v0 = (double *)malloc(0x10000 * sizeof(double));
+		if (need_mult)
+			d->m_filt_mult = (double *)malloc(0x10000 * sizeof(double));
+		alloc_ok = (d->m_filt_v0 != NULL && (!need_mult || d->m_filt_mult != NULL));
+	}
+	if (!alloc_ok)
+	{
+		/* out of memory - fall back to linear output */
+		pokey_free_output_tables(d);
+		d->m_output_type = LEGACY_LINEAR;
+		return;
+	}
+
+	for (j = 0; j < 0x10000; j++)
+	{
+		double rTot = pokey_out_resistance(j);
+		double V0;
+		double mult;
+
+		if (d->m_output_type == RC_LOWPASS)
+		{
+			V0 = rTot / (rTot+d->m_r_pullup) * d->m_v_ref / 5.0;
+			mult = (d->m_cap == 0.0) ? 1.0 : 1.0 - exp(-(rTot + d->m_r_pullup) / (d->m_cap * d->m_r_pullup * rTot) * d->m_clock_period);
 		}
 		else if (d->m_output_type == OPAMP_C_TO_GROUND)
 		{
-			double rTot = d->m_voltab[d->m_out_raw];
 			/* In this configuration there is a capacitor in parallel to the pokey output to ground.
 			 * With a LM324 in LTSpice this causes the opamp circuit to oscillate at around 100 kHz.
 			 * We are ignoring the capacitor here, since this oscillation would not be audible.
@@ -1023,38 +1140,68 @@ void pokey_update(void *info, UINT32 samples, DEV_SMPL **outputs)
 			/* This post-pokey stage usually has a high-pass filter behind it
 			 * It is approximated by eliminating m_v_ref ( -1.0 term)
 			 */
-
-			double V0 = ((rTot+d->m_r_pullup) / rTot - 1.0) * d->m_v_ref  / 5.0;
-			/* store sum of output signals into the buffer */
-
-			/* TODO verify that V0 is in the range -1.0 - +1.0 */
-			outputs[0][sampindex] = (DEV_SMPL)(V0 * 0x7fff);
-			outputs[1][sampindex] = (DEV_SMPL)(V0 * 0x7fff);
+			V0 = ((rTot+d->m_r_pullup) / rTot - 1.0) * d->m_v_ref  / 5.0;
+			mult = 1.0;
 		}
-		else if (d->m_output_type == OPAMP_LOW_PASS)
+		else //if (d->m_output_type == OPAMP_LOW_PASS)
 		{
-			double rTot = d->m_voltab[d->m_out_raw];
 			/* This post-pokey stage usually has a low-pass filter behind it
 			 * It is approximated by not adding in VRef below.
 			 */
+			V0 = (d->m_r_pullup / rTot) * d->m_v_ref  / 5.0;
+			mult = (d->m_cap == 0.0) ? 1.0 : 1.0 - exp(-1.0 / (d->m_cap * d->m_r_pullup) * d->m_clock_period);
+		}
 
-			double V0 = (d->m_r_pullup / rTot) * d->m_v_ref  / 5.0;
-			double mult = (d->m_cap == 0.0) ? 1.0 : 1.0 - exp(-1.0 / (d->m_cap * d->m_r_pullup) * d->m_clock_period);
-
-			/* store sum of output signals into the buffer */
-			d->m_out_filter += (V0 - d->m_out_filter) * mult;
-
-			/* TODO verify that d->m_out_filter is in the range -1.0 - +1.0 */
-			outputs[0][sampindex] = (DEV_SMPL)(d->m_out_filter * 0x7fff);
-			outputs[1][sampindex] = (DEV_SMPL)(d->m_out_filter * 0x7fff);
+		if (d->m_filter_fixed)
+		{
+			d->m_filt_v0_fp[j] = (INT32)floor(V0 * 0x7fff * (1 << FILT_FRAC_BITS) + 0.5);
+			if (need_mult)
+				d->m_filt_mult_fp[j] = (INT32)floor(mult * (1 << MULT_FRAC_BITS) + 0.5);
 		}
-		else if (d->m_output_type == DISCRETE_VAR_R)
+		else
 		{
-			/* store sum of output signals into the buffer */
+			d->m_filt_v0[j] = V0;
+			if (need_mult)
+				d->m_filt_mult[j] = mult;
+		}
+	}
+}
+
+static void pokey_set_options(void *info, UINT32 options)
+{
+	pokey_device *d = (pokey_device *)info;
+	UINT8 fixed = (options & OPT_POKEY_FILTER_FIXED) ? 1 : 0;
+	enum output_type type = (enum output_type)((options & OPT_POKEY_OUTPUT_MASK) >> 4);
 
-			/* TODO verify that d->m_voltab is in the range -1.0 - +1.0 */
-			outputs[0][sampindex] = (DEV_SMPL)(d->m_voltab[d->m_out_raw] * 0x7fff);
-			outputs[1][sampindex] = (DEV_SMPL)(d->m_voltab[d->m_out_raw] * 0x7fff);
+	if (fixed != d->m_filter_fixed)
+	{
+		/* carry over the filter state */
+		if (fixed)
+			d->m_out_filter_fp = (INT32)floor(d->m_out_filter * 0x7fff * (1 << FILT_FRAC_BITS) + 0.5);
+		else
+			d->m_out_filter = (double)d->m_out_filter_fp / (0x7fff * (1 << FILT_FRAC_BITS));
+		d->m_filter_fixed = fixed;
+		if (type == d->m_output_type)
+			pokey_calc_output_tables(d);	/* switch to the tables of the new precision */
+	}
+
+	if (type != d->m_output_type)
+	{
+		switch(type)
+		{
+		case RC_LOWPASS:
+			pokey_set_output_rc(d, OUT_R_PULLUP, OUT_CAP, OUT_V_REF);
+			break;
+		case OPAMP_C_TO_GROUND:
+			pokey_set_output_opamp(d, OUT_R_OPAMP, 0.0, OUT_V_REF);
+			break;
+		case OPAMP_LOW_PASS:
+			pokey_set_output_opamp_low_pass(d, OUT_R_OPAMP, OUT_CAP, OUT_V_REF);
+			break;
+		default:
+			d->m_output_type = LEGACY_LINEAR;
+			pokey_calc_output_tables(d);
+			break;
 		}
 	}
 }
@@ -1408,51 +1555,6 @@ static void pokey_potgo(pokey_device *d)
 	}
 }
 
-static void pokey_vol_init(pokey_device *d)
-{
-	double resistors[4] = {90000, 26500, 8050, 3400};
-	double pull_up = 10000;
-	/* just a guess, there has to be a resistance since the doc specifies that
-	 * Vout is at least 4.2V if all channels turned off.
-	 */
-	double r_off = 8e6;
-	double r_chan[16];
-	double rTot;
-	int i, j;
-
-	for (j=0; j<16; j++)
-	{
-		rTot = 1.0 / 1e12; /* avoid div by 0 */;
-		for (i=0; i<4; i++)
-		{
-			if (j & (1 << i))
-				rTot += 1.0 / resistors[i];
-			else
-				rTot += 1.0 / r_off;
-		}
-		r_chan[j] = 1.0 / rTot;
-	}
-	//if (VERBOSE & LOG_GENERAL)
-	if (0)
-		for (j=0; j<16; j++)
-		{
-			rTot = 1.0 / r_chan[j] + 3.0 / r_chan[0];
-			rTot = 1.0 / rTot;
-			//LOG("%3d - %4.3f\n", j, rTot / (rTot+pull_up)*4.75);
-		}
-	for (j=0; j<0x10000; j++)
-	{
-		rTot = 0;
-		for (i=0; i<4; i++)
-		{
-			rTot += 1.0 / r_chan[(j >> (i*4)) & 0x0f];
-		}
-		rTot = 1.0 / rTot;
-		d->m_voltab[j] = rTot;
-	}
-
-}
-
 static void poly_init_4_5(UINT32 *poly, int size)
 {
 	//LOG_POLY("poly %d\n", size);
@@ -3,6 +3,13 @@
 
 #include "../EmuStructs.h"
 
+#define OPT_POKEY_FILTER_FIXED	0x01	// run the analog output filter in fixed point (default: disabled)
+#define OPT_POKEY_OUTPUT_LINEAR		0x00	// output model: linear sum of the channel volumes (default)
+#define OPT_POKEY_OUTPUT_RC			0x10	// output model: pull-up resistor with RC low-pass filter
+#define OPT_POKEY_OUTPUT_OPAMP		0x20	// output model: op-amp stage, capacitor to ground
+#define OPT_POKEY_OUTPUT_OPAMP_LP	0x30	// output model: op-amp stage with low-pass filter
+#define OPT_POKEY_OUTPUT_MASK		0x30
+
 extern const DEV_DECL sndDev_Pokey;
 
 #endif	// __POKEY_H__
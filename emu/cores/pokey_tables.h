@@ -0,0 +1,8 @@
+// Lookup tables for pokey.c
+// generated by tables_gen.c - do not edit
+
+static const double chan_cond[16] =
+{
+	5.000009999999999e-07, 1.1486112111111108e-05, 3.8110850056603781e-05, 4.9096961167714896e-05, 0.00012459860348447205, 0.00013558471459558315, 0.00016220945254107581, 0.00017319556365218692,
+	0.0002944926480588235, 0.00030547875916993463, 0.00033210349711542726, 0.0003430896082265384, 0.00041859125054329559, 0.00042957736165440667, 0.00045620209959989935, 0.00046718821071101038
+};
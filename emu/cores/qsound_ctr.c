@@ -22,6 +22,18 @@
 
 #define CLAMP(x, low, high)  (((x) > (high)) ? (high) : (((x) < (low)) ? (low) : (x)))
 
+#define BLOCK_SIZE	128	// number of samples processed per stage in state_normal_block()
+
+// DSP states
+enum {
+	STATE_INIT1		= 0x288,
+	STATE_INIT2		= 0x61a,
+	STATE_REFRESH1	= 0x039,
+	STATE_REFRESH2	= 0x04f,
+	STATE_NORMAL1	= 0x314,
+	STATE_NORMAL2 	= 0x6b2,
+};
+
 struct qsound_voice {
 	UINT16 bank;
 	INT16 addr; // top word is the sample address
@@ -77,6 +89,7 @@ struct qsound_chip {
 	DEV_DATA _devData;
 	
 	UINT8* romData;
+	UINT8 romOwned;
 	UINT32 romSize;
 	UINT32 romMask;
 	UINT32 muteMask;
@@ -124,13 +137,14 @@ static void state_init(struct qsound_chip *chip);
 static void state_refresh_filter_1(struct qsound_chip *chip);
 static void state_refresh_filter_2(struct qsound_chip *chip);
 static void state_normal_update(struct qsound_chip *chip);
+static UINT32 state_normal_block(struct qsound_chip *chip, UINT32 samples, DEV_SMPL* outL, DEV_SMPL* outR);
 
 INLINE INT16 get_sample(struct qsound_chip *chip, UINT16 bank,UINT16 address);
 INLINE const INT16* get_filter_table(struct qsound_chip *chip, UINT16 offset);
 INLINE INT16 pcm_update(struct qsound_chip *chip, int voice_no, INT32 *echo_out);
 INLINE void adpcm_update(struct qsound_chip *chip, int voice_no, int nibble);
 INLINE INT16 echo(struct qsound_echo *r,INT32 input);
-INLINE INT32 fir(struct qsound_fir *f, INT16 input);
+static void fir_block(struct qsound_fir *f, INT32 *data, UINT32 samples);
 INLINE INT32 delay(struct qsound_delay *d, INT32 input);
 INLINE void delay_update(struct qsound_delay *d);
 
@@ -147,6 +161,7 @@ static void qsoundc_write_data(void* info, UINT8 address, UINT16 data);
 
 static void qsoundc_alloc_rom(void* info, UINT32 memsize);
 static void qsoundc_write_rom(void* info, UINT32 offset, UINT32 length, const UINT8* data);
+static void qsoundc_attach_rom(void* info, UINT32 length, const UINT8* data);
 static void qsoundc_set_options(void* info, UINT32 options);
 static void qsoundc_set_mute_mask(void* info, UINT32 MuteMask);
 
@@ -157,6 +172,7 @@ static DEVDEF_RWFUNC devFunc[] =
 	{RWF_REGISTER | RWF_QUICKWRITE, DEVRW_A8D16, 0, qsoundc_write_data},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, qsoundc_write_rom},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, qsoundc_alloc_rom},
+	{RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, qsoundc_attach_rom},
 	{RWF_CHN_MUTE | RWF_WRITE, DEVRW_ALL, 0, qsoundc_set_mute_mask},
 	{0x00, 0x00, 0, NULL}
 };
@@ -207,7 +223,7 @@ static void device_stop_qsound_ctr(void* info)
 {
 	struct qsound_chip* chip = (struct qsound_chip*)info;
 	
-	free(chip->romData);
+	rom_free(chip->romData, chip->romOwned);
 	free(chip);
 	
 	return;
@@ -282,11 +298,21 @@ static void qsoundc_update(void* param, UINT32 samples, DEV_SMPL** outputs)
 		return;
 	}
 
-	for (curSmpl = 0; curSmpl < samples; curSmpl ++)
+	curSmpl = 0;
+	while (curSmpl < samples)
 	{
-		update_sample(chip);
-		outputs[0][curSmpl] = chip->out[0];
-		outputs[1][curSmpl] = chip->out[1];
+		if (chip->state == STATE_NORMAL1 || chip->state == STATE_NORMAL2)
+		{
+			curSmpl += state_normal_block(chip, samples - curSmpl,
+				&outputs[0][curSmpl], &outputs[1][curSmpl]);
+		}
+		else
+		{
+			update_sample(chip);
+			outputs[0][curSmpl] = chip->out[0];
+			outputs[1][curSmpl] = chip->out[1];
+			curSmpl ++;
+		}
 	}
 	
 	return;
@@ -299,7 +325,7 @@ static void qsoundc_alloc_rom(void* info, UINT32 memsize)
 	if (chip->romSize == memsize)
 		return;
 	
-	chip->romData = (UINT8*)realloc(chip->romData, memsize);
+	chip->romData = (UINT8*)rom_realloc(chip->romData, &chip->romOwned, memsize);
 	chip->romSize = memsize;
 	chip->romMask = pow2_mask(memsize);
 	memset(chip->romData, 0xFF, memsize);
@@ -310,17 +336,33 @@ static void qsoundc_alloc_rom(void* info, UINT32 memsize)
 static void qsoundc_write_rom(void* info, UINT32 offset, UINT32 length, const UINT8* data)
 {
 	struct qsound_chip* chip = (struct qsound_chip*)info;
+	UINT8* rom;
 	
 	if (offset > chip->romSize)
 		return;
 	if (offset + length > chip->romSize)
 		length = chip->romSize - offset;
 	
+	rom = (UINT8*)rom_unshare(chip->romData, &chip->romOwned, chip->romSize);
+	if (rom == NULL)
+		return;
+	chip->romData = rom;
 	memcpy(chip->romData + offset, data, length);
 	
 	return;
 }
 
+static void qsoundc_attach_rom(void* info, UINT32 length, const UINT8* data)
+{
+	struct qsound_chip* chip = (struct qsound_chip*)info;
+	
+	chip->romData = (UINT8*)rom_attach(chip->romData, &chip->romOwned, data);
+	chip->romSize = (data != NULL) ? length : 0x00;
+	chip->romMask = pow2_mask(chip->romSize);
+	
+	return;
+}
+
 static void qsoundc_set_options(void* info, UINT32 options)
 {
 	struct qsound_chip* chip = (struct qsound_chip*)info;
@@ -428,16 +470,6 @@ static const INT16 adpcm_step_table[16] = {
 	58, 58, 58, 58, 77, 102, 128, 154
 };
 
-// DSP states
-enum {
-	STATE_INIT1		= 0x288,
-	STATE_INIT2		= 0x61a,
-	STATE_REFRESH1	= 0x039,
-	STATE_REFRESH2	= 0x04f,
-	STATE_NORMAL1	= 0x314,
-	STATE_NORMAL2 	= 0x6b2,
-};
-
 enum {
 	PANTBL_LEFT		= 0,
 	PANTBL_RIGHT	= 1,
@@ -820,14 +852,43 @@ INLINE INT16 echo(struct qsound_echo *r,INT32 input)
 // Process a sample update
 static void state_normal_update(struct qsound_chip *chip)
 {
+	DEV_SMPL outL, outR;
+	
+	state_normal_block(chip, 1, &outL, &outR);
+}
+
+// Process a block of sample updates.
+// Each stage (voices, echo, mixing, filters, delay lines) runs over the whole block
+// before the next one starts. Registers can't change within a block, so the
+// block only has to end where the DSP switches to a different state.
+// Returns the number of samples rendered.
+static UINT32 state_normal_block(struct qsound_chip *chip, UINT32 samples, DEV_SMPL* outL, DEV_SMPL* outR)
+{
+	INT16 voice_buf[16+3][BLOCK_SIZE];
+	INT32 echo_buf[BLOCK_SIZE];
+	INT32 dry_buf[BLOCK_SIZE];
+	INT32 wet_buf[BLOCK_SIZE];
+	INT16 dry_vol[16+3];
+	INT16 wet_vol[16+3];
+	DEV_SMPL* outputs[2];
+	int mode2 = (chip->state == STATE_NORMAL2);
 	int v, ch;
-	INT32 echo_input = 0;
-	INT16 echo_output;
+	UINT32 smpl;
+	
+	if(samples > BLOCK_SIZE)
+		samples = BLOCK_SIZE;
+	// after 6 samples, the next state is executed.
+	if(chip->next_state != chip->state)
+	{
+		UINT32 state_left = (chip->state_counter < 6) ? (6 - chip->state_counter) : 1;
+		if(samples > state_left)
+			samples = state_left;
+	}
 	
 	chip->ready_flag = 0x80;
 
 	// recalculate echo length
-	if(chip->state == STATE_NORMAL2)
+	if(mode2)
 		chip->echo.length = chip->echo.end_pos - 0x53c;
 	else
 		chip->echo.length = chip->echo.end_pos - 0x554;
@@ -835,22 +896,37 @@ static void state_normal_update(struct qsound_chip *chip)
 	chip->echo.length = CLAMP(chip->echo.length, 0, 1024);
 	
 	// update PCM voices
+	memset(echo_buf, 0, samples * sizeof(INT32));
 	for(v=0; v<16; v++)
-		chip->voice_output[v] = pcm_update(chip, v, &echo_input);
+	{
+		for(smpl=0; smpl<samples; smpl++)
+			voice_buf[v][smpl] = pcm_update(chip, v, &echo_buf[smpl]);
+	}
 
-	// update ADPCM voices (one every third sample)
-	adpcm_update(chip, chip->state_counter % 3, chip->state_counter / 3);
+	for(smpl=0; smpl<samples; smpl++)
+	{
+		// update ADPCM voices (one every third sample)
+		adpcm_update(chip, chip->state_counter % 3, chip->state_counter / 3);
+		for(v=16; v<19; v++)
+			voice_buf[v][smpl] = chip->voice_output[v];
+		
+		chip->state_counter++;
+		if(chip->state_counter > 5)
+		{
+			chip->state_counter = 0;
+			chip->state = chip->next_state;
+		}
+	}
 	
-	echo_output = echo(&chip->echo,echo_input);
+	for(smpl=0; smpl<samples; smpl++)
+		echo_buf[smpl] = echo(&chip->echo,echo_buf[smpl]);
 	
 	// now, we do the magic stuff
+	outputs[0] = outL;
+	outputs[1] = outR;
 	for(ch=0; ch<2; ch++)
 	{
-		// Echo is output on the unfiltered component of the left channel and
-		// the filtered component of the right channel.
-		INT32 wet = (ch == 1) ? echo_output<<14 : 0;
-		INT32 dry = (ch == 0) ? echo_output<<14 : 0;
-		INT32 output = 0;
+		DEV_SMPL* out = outputs[ch];
 		
 		for(v=0; v<19; v++)
 		{
@@ -858,67 +934,115 @@ static void state_normal_update(struct qsound_chip *chip)
 			if(pan_index > 97)
 				pan_index = 97;
 			
-			// Apply different volume tables on the dry and wet inputs.
-			dry -= (chip->voice_output[v] * chip->pan_tables[ch][PANTBL_DRY][pan_index]);
-			wet -= (chip->voice_output[v] * chip->pan_tables[ch][PANTBL_WET][pan_index]);
+			dry_vol[v] = chip->pan_tables[ch][PANTBL_DRY][pan_index];
+			wet_vol[v] = chip->pan_tables[ch][PANTBL_WET][pan_index];
+		}
+		
+		// Echo is output on the unfiltered component of the left channel and
+		// the filtered component of the right channel.
+		for(smpl=0; smpl<samples; smpl++)
+		{
+			dry_buf[smpl] = (ch == 0) ? echo_buf[smpl]<<14 : 0;
+			wet_buf[smpl] = (ch == 1) ? echo_buf[smpl]<<14 : 0;
+		}
+		
+		// Apply different volume tables on the dry and wet inputs.
+		for(v=0; v<19; v++)
+		{
+			const INT16* vbuf = voice_buf[v];
+			INT32 dvol = dry_vol[v];
+			INT32 wvol = wet_vol[v];
+			
+			for(smpl=0; smpl<samples; smpl++)
+			{
+				dry_buf[smpl] -= vbuf[smpl] * dvol;
+				wet_buf[smpl] -= vbuf[smpl] * wvol;
+			}
 		}
 
 		// Saturate accumulated voices
-		dry = CLAMP(dry, -0x1fffffff, 0x1fffffff) << 2;
-		wet = CLAMP(wet, -0x1fffffff, 0x1fffffff) << 2;
+		for(smpl=0; smpl<samples; smpl++)
+		{
+			dry_buf[smpl] = CLAMP(dry_buf[smpl], -0x1fffffff, 0x1fffffff) << 2;
+			wet_buf[smpl] = CLAMP(wet_buf[smpl], -0x1fffffff, 0x1fffffff) << 2;
+		}
 		
 		// Apply FIR filter on 'wet' input
-		wet = fir(&chip->filter[ch], wet >> 16);
+		fir_block(&chip->filter[ch], wet_buf, samples);
 		
 		// in mode 2, we do this on the 'dry' input too
-		if(chip->state == STATE_NORMAL2)
-			dry = fir(&chip->alt_filter[ch], dry >> 16);
-		
-		// output goes through a delay line and attenuation
-		output = (delay(&chip->wet[ch], wet) + delay(&chip->dry[ch], dry));
-		
-		// DSP round function
-		output = (output + 0x2000) >> 14;
-		chip->out[ch] = CLAMP(output, -0x7fff, 0x7fff);
+		if(mode2)
+			fir_block(&chip->alt_filter[ch], dry_buf, samples);
 		
-		if(chip->delay_update)
+		for(smpl=0; smpl<samples; smpl++)
 		{
-			delay_update(&chip->wet[ch]);
-			delay_update(&chip->dry[ch]);
+			// output goes through a delay line and attenuation
+			INT32 output = (delay(&chip->wet[ch], wet_buf[smpl]) + delay(&chip->dry[ch], dry_buf[smpl]));
+			
+			// DSP round function
+			output = (output + 0x2000) >> 14;
+			out[smpl] = CLAMP(output, -0x7fff, 0x7fff);
+			
+			if(smpl == 0 && chip->delay_update)
+			{
+				delay_update(&chip->wet[ch]);
+				delay_update(&chip->dry[ch]);
+			}
 		}
+		chip->out[ch] = out[samples-1];
 	}
 	
 	chip->delay_update = 0;
 	
-	// after 6 samples, the next state is executed.
-	chip->state_counter++;
-	if(chip->state_counter > 5)
-	{
-		chip->state_counter = 0;
-		chip->state = chip->next_state;
-	}
+	return samples;
 }
 
-// Apply the FIR filter used as the Q1 transfer function
-INLINE INT32 fir(struct qsound_fir *f, INT16 input)
+// Apply the FIR filter used as the Q1 transfer function to a block of samples.
+// The delay line is unrolled into a linear buffer, so that each output sample is
+// a plain dot product the compiler can vectorize.
+static void fir_block(struct qsound_fir *f, INT32 *data, UINT32 samples)
 {
-	INT32 output = 0, tap = 0;
+	INT16 buf[95-1 + BLOCK_SIZE];
+	int hist = (f->tap_count > 1) ? (f->tap_count - 1) : 0;
+	int pos, tap;
+	UINT32 smpl;
+	
+	// oldest sample first
+	pos = f->delay_pos;
+	for(tap=0; tap<hist; tap++)
+	{
+		buf[tap] = f->delay_line[pos++];
+		if(pos >= hist)
+			pos = 0;
+	}
+	for(smpl=0; smpl<samples; smpl++)
+		buf[hist+smpl] = data[smpl] >> 16;
 	
-	for(; tap < (f->tap_count-1); tap++)
+	for(smpl=0; smpl<samples; smpl++)
 	{
-		output -= (f->taps[tap] * f->delay_line[f->delay_pos++])<<2;
+		const INT16 *x = &buf[smpl];
+		INT32 output = 0;
 		
-		if(f->delay_pos >= f->tap_count-1)
-			f->delay_pos = 0;
+		for(tap=0; tap<=hist; tap++)
+			output -= f->taps[tap] * x[tap];
+		data[smpl] = output * 4;
 	}
 	
-	output -= (f->taps[tap] * input)<<2;
-	
-	f->delay_line[f->delay_pos++] = input;
-	if(f->delay_pos >= f->tap_count-1)
+	// write back the newest samples, keeping the layout of the circular delay line
+	if(hist == 0)
+	{
+		f->delay_line[0] = buf[samples-1];
 		f->delay_pos = 0;
-	
-	return output;
+		return;
+	}
+	f->delay_pos = (int)((f->delay_pos + samples) % hist);
+	pos = f->delay_pos;
+	for(tap=0; tap<hist; tap++)
+	{
+		f->delay_line[pos++] = buf[samples+tap];
+		if(pos >= hist)
+			pos = 0;
+	}
 }
 
 // Apply delay line and component volume
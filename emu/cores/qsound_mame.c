@@ -51,6 +51,7 @@ static void qsound_write_data(void *info, UINT8 address, UINT16 data);
 
 static void qsound_alloc_rom(void* info, UINT32 memsize);
 static void qsound_write_rom(void *info, UINT32 offset, UINT32 length, const UINT8* data);
+static void qsound_attach_rom(void *info, UINT32 length, const UINT8* data);
 static void qsound_set_mute_mask(void *info, UINT32 MuteMask);
 static UINT32 qsound_get_mute_mask(void *info);
 static void qsound_set_log_cb(void* info, DEVCB_LOG func, void* param);
@@ -63,6 +64,7 @@ static DEVDEF_RWFUNC devFunc[] =
 	{RWF_REGISTER | RWF_QUICKWRITE, DEVRW_A8D16, 0, qsound_write_data},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, qsound_write_rom},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, qsound_alloc_rom},
+	{RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, qsound_attach_rom},
 	{RWF_CHN_MUTE | RWF_WRITE, DEVRW_ALL, 0, qsound_set_mute_mask},
 	{0x00, 0x00, 0, NULL}
 };
@@ -117,6 +119,7 @@ struct _qsound_state
 	qsound_channel channel[QSOUND_CHANNELS];
 	
 	INT8 *sample_rom;		/* Q sound sample ROM */
+	UINT8 sample_rom_owned;
 	UINT32 sample_rom_length;
 	UINT32 sample_rom_mask;
 
@@ -155,7 +158,7 @@ static UINT8 device_start_qsound(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf)
 static void device_stop_qsound(void *info)
 {
 	qsound_state *chip = (qsound_state *)info;
-	free(chip->sample_rom);
+	rom_free(chip->sample_rom, chip->sample_rom_owned);
 	free(chip);
 }
 
@@ -378,7 +381,7 @@ static void qsound_alloc_rom(void* info, UINT32 memsize)
 	if (chip->sample_rom_length == memsize)
 		return;
 	
-	chip->sample_rom = (INT8*)realloc(chip->sample_rom, memsize);
+	chip->sample_rom = (INT8*)rom_realloc(chip->sample_rom, &chip->sample_rom_owned, memsize);
 	chip->sample_rom_length = memsize;
 	chip->sample_rom_mask = pow2_mask(memsize);
 	memset(chip->sample_rom, 0xFF, memsize);
@@ -389,17 +392,33 @@ static void qsound_alloc_rom(void* info, UINT32 memsize)
 static void qsound_write_rom(void *info, UINT32 offset, UINT32 length, const UINT8* data)
 {
 	qsound_state* chip = (qsound_state *)info;
+	INT8* rom;
 	
 	if (offset > chip->sample_rom_length)
 		return;
 	if (offset + length > chip->sample_rom_length)
 		length = chip->sample_rom_length - offset;
 	
+	rom = (INT8*)rom_unshare(chip->sample_rom, &chip->sample_rom_owned, chip->sample_rom_length);
+	if (rom == NULL)
+		return;
+	chip->sample_rom = rom;
 	memcpy(chip->sample_rom + offset, data, length);
 	
 	return;
 }
 
+static void qsound_attach_rom(void *info, UINT32 length, const UINT8* data)
+{
+	qsound_state* chip = (qsound_state *)info;
+	
+	chip->sample_rom = (INT8*)rom_attach(chip->sample_rom, &chip->sample_rom_owned, data);
+	chip->sample_rom_length = (data != NULL) ? length : 0x00;
+	chip->sample_rom_mask = pow2_mask(chip->sample_rom_length);
+	
+	return;
+}
+
 
 static void qsound_set_mute_mask(void *info, UINT32 MuteMask)
 {
@@ -13,6 +13,7 @@
 #include "../EmuStructs.h"
 #include "../EmuHelper.h"
 #include "../EmuCores.h"
+#include "../pcmmix.h"
 #include "rf5c68.h"
 
 
@@ -79,6 +80,8 @@ struct _pcm_channel
 	UINT16		step;
 	UINT16		loopst;
 	UINT8		Muted;
+	INT32		vol_l;	// left/right gain, updated on envelope/pan writes
+	INT32		vol_r;
 };
 
 
@@ -109,7 +112,8 @@ static void rf5c68_update(void *info, UINT32 samples, DEV_SMPL **outputs)
 	DEV_SMPL *left = outputs[0];
 	DEV_SMPL *right = outputs[1];
 	UINT8 i;
-	UINT32 j;
+	UINT32 j, k, count;
+	INT32 smplBuf[PCMMIX_BLOCK];
 
 	/* start with clean buffers */
 	memset(left, 0, samples * sizeof(*left));
@@ -127,46 +131,44 @@ static void rf5c68_update(void *info, UINT32 samples, DEV_SMPL **outputs)
 		/* if this channel is active, accumulate samples */
 		if (chan->enable && ! chan->Muted)
 		{
-			int lv = (chan->pan & 0x0f) * chan->env;
-			int rv = ((chan->pan >> 4) & 0x0f) * chan->env;
 
 			/* loop over the sample buffer */
-			for (j = 0; j < samples; j++)
+			for (j = 0; j < samples; j += count)
 			{
-				int sample;
+				count = samples - j;
+				if (count > PCMMIX_BLOCK)
+					count = PCMMIX_BLOCK;
 
-				/* trigger sample callback */
-				if(chip->sample_end_cb)
+				for (k = 0; k < count; k++)
 				{
-					if(((chan->addr >> 11) & 0xfff) == 0xfff)
-						chip->sample_end_cb(chip->sample_cb_param,(chan->addr >> 11)/0x2000);
-				}
+					UINT8 sample;
 
-				/* fetch the sample and handle looping */
-				sample = chip->data[(chan->addr >> 11) & 0xffff];
-				if (sample == 0xff)
-				{
-					chan->addr = chan->loopst << 11;
-					sample = chip->data[(chan->addr >> 11) & 0xffff];
+					/* trigger sample callback */
+					if(chip->sample_end_cb)
+					{
+						if(((chan->addr >> 11) & 0xfff) == 0xfff)
+							chip->sample_end_cb(chip->sample_cb_param,(chan->addr >> 11)/0x2000);
+					}
 
-					/* if we loop to a loop point, we're effectively dead */
+					/* fetch the sample and handle looping */
+					sample = chip->data[(chan->addr >> 11) & 0xffff];
 					if (sample == 0xff)
-						break;
+					{
+						chan->addr = chan->loopst << 11;
+						sample = chip->data[(chan->addr >> 11) & 0xffff];
+
+						/* if we loop to a loop point, we're effectively dead */
+						if (sample == 0xff)
+							break;
+					}
+					chan->addr += chan->step;
+					smplBuf[k] = PcmMix_DecodeSM8(sample);
 				}
-				chan->addr += chan->step;
 
 				/* add to the buffer */
-				if (sample & 0x80)
-				{
-					sample &= 0x7f;
-					left[j] += (sample * lv) >> 5;
-					right[j] += (sample * rv) >> 5;
-				}
-				else
-				{
-					left[j] -= (sample * lv) >> 5;
-					right[j] -= (sample * rv) >> 5;
-				}
+				PcmMix_AddStereoTrunc(smplBuf, k, chan->vol_l, chan->vol_r, 5, &left[j], &right[j]);
+				if (k < count)
+					break;
 			}
 		}
 	}
@@ -265,6 +267,7 @@ static void device_reset_rf5c68(void *info)
 		chan->addr = 0;
 		chan->step = 0;
 		chan->loopst = 0;
+		chan->vol_l = chan->vol_r = 0;
 	}
 }
 
@@ -294,6 +297,12 @@ static UINT8 rf5c68_r(void *info, UINT8 offset)
 	return (chip->chan[(offset & 0x0e) >> 1].addr) >> shift;
 }
 
+static void rf5c68_update_gain(pcm_channel *chan)
+{
+	chan->vol_l = (chan->pan & 0x0f) * chan->env;
+	chan->vol_r = ((chan->pan >> 4) & 0x0f) * chan->env;
+}
+
 static void rf5c68_w(void *info, UINT8 offset, UINT8 data)
 {
 	rf5c68_state *chip = (rf5c68_state *)info;
@@ -305,10 +314,12 @@ static void rf5c68_w(void *info, UINT8 offset, UINT8 data)
 	{
 		case 0x00:	/* envelope */
 			chan->env = data;
+			rf5c68_update_gain(chan);
 			break;
 
 		case 0x01:	/* pan */
 			chan->pan = data;
+			rf5c68_update_gain(chan);
 			break;
 
 		case 0x02:	/* FDL */
@@ -2233,6 +2233,24 @@ static void timers_run(GB_gameboy_t *gb, uint8_t cycles)
     
     GB_SLEEP(gb, div, 1, 3);
     while (true) {
+        /* Only DIV steps that toggle the APU bit cause an event, so the steps before it
+           just accumulate cycles and are done at once. */
+        uint16_t apu_bit = gb->cgb_double_speed? 0x2000 : 0x1000;
+        unsigned quiet_steps = (apu_bit - (gb->div_counter & (apu_bit - 1)) + 3) / 4 - 1;
+        if (quiet_steps) {
+            unsigned steps = ((unsigned)gb->div_cycles + 3) / 4;
+            if (steps > quiet_steps) {
+                steps = quiet_steps;
+            }
+            gb->div_counter += steps * 4;
+            gb->apu.apu_cycles += steps << !gb->cgb_double_speed;
+            gb->apu_output.sample_cycles += steps * ((gb->apu_output.sample_rate << !gb->cgb_double_speed) << 1);
+            gb->div_cycles -= steps * 4;
+            if (gb->div_cycles <= 0) {
+                gb->div_state = 2;
+                return;
+            }
+        }
         //advance_tima_state_machine(gb);
         GB_set_internal_div_counter(gb, gb->div_counter + 4);
         gb->apu.apu_cycles += 1 << !gb->cgb_double_speed;
@@ -857,6 +857,7 @@ static void SCSP_w16(void* info, UINT16 addr, UINT16 val)
 		else if(addr<0xC00)
 		{
 			*((UINT16 *) (scsp->DSP.MPRO+(addr-0x800)/2))=val;
+			scsp->DSP.Dirty=1;
 
 			if(addr==0xBF0)
 			{
@@ -58,11 +58,105 @@ static INT32 UNPACK(UINT16 val)
 	return uval;
 }
 
+#define DSPOP_TWT   0x00001
+#define DSPOP_XSEL  0x00002
+#define DSPOP_IWT   0x00004
+#define DSPOP_TABLE 0x00008
+#define DSPOP_MRD   0x00010 //only set on odd steps
+#define DSPOP_MWT   0x00020 //only set on odd steps
+#define DSPOP_EWT   0x00040
+#define DSPOP_ADRL  0x00080
+#define DSPOP_FRCL  0x00100
+#define DSPOP_YRL   0x00200
+#define DSPOP_NEGB  0x00400
+#define DSPOP_ZERO  0x00800
+#define DSPOP_BSEL  0x01000
+#define DSPOP_NOFL  0x02000
+#define DSPOP_ADREB 0x04000
+#define DSPOP_NXADR 0x08000
+#define DSPOP_STOP  0x10000 //invalid IRA, stops the program
+//step uses the SHIFTED value of the previous ACC
+#define DSPOP_USE_SHIFTED   (DSPOP_TWT | DSPOP_FRCL | DSPOP_MWT | DSPOP_EWT)
+//step changes more than ACC
+#define DSPOP_SIDE_EFFECTS  (DSPOP_TWT | DSPOP_IWT | DSPOP_MRD | DSPOP_MWT | DSPOP_EWT | DSPOP_ADRL | \
+                             DSPOP_FRCL | DSPOP_YRL | DSPOP_STOP)
+
 void SCSPDSP_Init(SCSPDSP *DSP)
 {
 	memset(DSP,0,sizeof(SCSPDSP));
 	DSP->RBL=(8*1024); // Initial RBL is 0
 	DSP->Stopped=1;
+	DSP->Dirty=1;
+}
+
+// Decode the microprogram once, so that SCSPDSP_Step doesn't have to do it for every sample.
+// Steps whose only effect is the accumulator are dropped when the next step doesn't use it.
+static void SCSPDSP_Compile(SCSPDSP *DSP)
+{
+	SCSPDSP_OP ops[128];
+	UINT8 keep[128];
+	int accUsed;
+	int step;
+	int opCount;
+
+	for(step=0;step<DSP->LastStep;++step)
+	{
+		const UINT16 *IPtr=DSP->MPRO+step*4;
+		SCSPDSP_OP *op=&ops[step];
+		UINT32 flags=0;
+
+		op->TRA   = (IPtr[0] >>  8) & 0x7F;
+		op->TWA   = (IPtr[0] >>  0) & 0x7F;
+		op->IRA   = (IPtr[1] >>  6) & 0x3F;
+		op->IWA   = (IPtr[1] >>  0) & 0x1F;
+		op->YSEL  = (IPtr[1] >> 13) & 0x03;
+		op->EWA   = (IPtr[2] >>  8) & 0x0F;
+		op->SHIFT = (IPtr[2] >>  4) & 0x03;
+		op->COEF  = (IPtr[3] >>  9) & 0x3f;
+		op->MASA  = (IPtr[3] >>  2) & 0x1f;
+
+		if(IPtr[0] & 0x0080) flags|=DSPOP_TWT;
+		if(IPtr[1] & 0x8000) flags|=DSPOP_XSEL;
+		if(IPtr[1] & 0x0020) flags|=DSPOP_IWT;
+		if(IPtr[2] & 0x8000) flags|=DSPOP_TABLE;
+		if((IPtr[2] & 0x2000) && (step&1)) flags|=DSPOP_MRD; //memory only allowed on odd? DoA inserts NOPs on even
+		if((IPtr[2] & 0x4000) && (step&1)) flags|=DSPOP_MWT;
+		if(IPtr[2] & 0x1000) flags|=DSPOP_EWT;
+		if(IPtr[2] & 0x0080) flags|=DSPOP_ADRL;
+		if(IPtr[2] & 0x0040) flags|=DSPOP_FRCL;
+		if(IPtr[2] & 0x0008) flags|=DSPOP_YRL;
+		if(IPtr[2] & 0x0004) flags|=DSPOP_NEGB;
+		if(IPtr[2] & 0x0002) flags|=DSPOP_ZERO;
+		if(IPtr[2] & 0x0001) flags|=DSPOP_BSEL;
+		if(IPtr[3] & 0x8000) flags|=DSPOP_NOFL;
+		if(IPtr[3] & 0x0002) flags|=DSPOP_ADREB;
+		if(IPtr[3] & 0x0001) flags|=DSPOP_NXADR;
+		if(op->IRA>0x31) flags|=DSPOP_STOP;
+		op->FLAGS=flags;
+	}
+
+	// backwards liveness pass for ACC
+	accUsed=0;  //ACC is local to SCSPDSP_Step
+	for(step=DSP->LastStep-1;step>=0;--step)
+	{
+		const SCSPDSP_OP *op=&ops[step];
+		int useAcc;
+
+		keep[step]=(op->FLAGS & DSPOP_SIDE_EFFECTS) || accUsed;
+		useAcc=(op->FLAGS & DSPOP_USE_SHIFTED) ||
+			((op->FLAGS & DSPOP_ADRL) && op->SHIFT==3) ||
+			((op->FLAGS & (DSPOP_ZERO|DSPOP_BSEL))==DSPOP_BSEL);
+		accUsed=keep[step] && useAcc;
+	}
+
+	opCount=0;
+	for(step=0;step<DSP->LastStep;++step)
+	{
+		if(keep[step])
+			DSP->OPS[opCount++]=ops[step];
+	}
+	DSP->OPCount=opCount;
+	DSP->Dirty=0;
 }
 
 void SCSPDSP_Step(SCSPDSP *DSP)
@@ -78,228 +172,180 @@ void SCSPDSP_Step(SCSPDSP *DSP)
 	INT32 Y_REG=0;      //24 bit
 	UINT32 ADDR=0;
 	UINT32 ADRS_REG=0;  //13 bit
-	int step;
+	const SCSPDSP_OP *op;
+	const SCSPDSP_OP *opEnd;
 
 	if(DSP->Stopped)
 		return;
+	if(DSP->Dirty)
+		SCSPDSP_Compile(DSP);
 
 	memset(DSP->EFREG,0,2*16);
-	for(step=0;step</*128*/DSP->LastStep;++step)
+	opEnd=DSP->OPS+DSP->OPCount;
+	for(op=DSP->OPS;op<opEnd;++op)
 	{
-		UINT16 *IPtr=DSP->MPRO+step*4;
-
-//		if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//			break;
-
-		UINT32 TRA   = (IPtr[0] >>  8) & 0x7F;
-		UINT32 TWT   = (IPtr[0] >>  7) & 0x01;
-		UINT32 TWA   = (IPtr[0] >>  0) & 0x7F;
-
-		UINT32 XSEL  = (IPtr[1] >> 15) & 0x01;
-		UINT32 YSEL  = (IPtr[1] >> 13) & 0x03;
-		UINT32 IRA   = (IPtr[1] >>  6) & 0x3F;
-		UINT32 IWT   = (IPtr[1] >>  5) & 0x01;
-		UINT32 IWA   = (IPtr[1] >>  0) & 0x1F;
-
-		UINT32 TABLE = (IPtr[2] >> 15) & 0x01;
-		UINT32 MWT   = (IPtr[2] >> 14) & 0x01;
-		UINT32 MRD   = (IPtr[2] >> 13) & 0x01;
-		UINT32 EWT   = (IPtr[2] >> 12) & 0x01;
-		UINT32 EWA   = (IPtr[2] >>  8) & 0x0F;
-		UINT32 ADRL  = (IPtr[2] >>  7) & 0x01;
-		UINT32 FRCL  = (IPtr[2] >>  6) & 0x01;
-		UINT32 SHIFT = (IPtr[2] >>  4) & 0x03;
-		UINT32 YRL   = (IPtr[2] >>  3) & 0x01;
-		UINT32 NEGB  = (IPtr[2] >>  2) & 0x01;
-		UINT32 ZERO  = (IPtr[2] >>  1) & 0x01;
-		UINT32 BSEL  = (IPtr[2] >>  0) & 0x01;
-
-		UINT32 NOFL  = (IPtr[3] >> 15) & 0x01;	//????
-		UINT32 COEF  = (IPtr[3] >>  9) & 0x3f;
-
-		UINT32 MASA  = (IPtr[3] >>  2) & 0x1f;	//???
-		UINT32 ADREB = (IPtr[3] >>  1) & 0x01;
-		UINT32 NXADR = (IPtr[3] >>  0) & 0x01;
-
+		UINT32 FLAGS=op->FLAGS;
 		INT64 v;
 
 		//operations are done at 24 bit precision
-#if 0
-		if(MASA)
-			int a=1;
-		if(NOFL)
-			int a=1;
-#endif
 		//INPUTS RW
 // colmns97 hits this
 //		assert(IRA<0x32);
-		if(IRA<=0x1f)
-			INPUTS=DSP->MEMS[IRA];
-		else if(IRA<=0x2F)
-			INPUTS=DSP->MIXS[IRA-0x20]<<4;  //MIXS is 20 bit
-		else if(IRA<=0x31)
-			INPUTS=DSP->EXTS[IRA-0x30]<<8;  //EXTS is 16 bit
+		if(op->IRA<=0x1f)
+			INPUTS=DSP->MEMS[op->IRA];
+		else if(op->IRA<=0x2F)
+			INPUTS=DSP->MIXS[op->IRA-0x20]<<4;  //MIXS is 20 bit
+		else if(op->IRA<=0x31)
+			INPUTS=DSP->EXTS[op->IRA-0x30]<<8;  //EXTS is 16 bit
 		else
 			return;
 
 		INPUTS<<=8;
 		INPUTS>>=8;
-		//if(INPUTS&0x00800000)
-		//	INPUTS|=0xFF000000;
 
-		if(IWT)
+		if(FLAGS & DSPOP_IWT)
 		{
-			DSP->MEMS[IWA]=MEMVAL;  //MEMVAL was selected in previous MRD
-			if(IRA==IWA)
+			DSP->MEMS[op->IWA]=MEMVAL;  //MEMVAL was selected in previous MRD
+			if(op->IRA==op->IWA)
 				INPUTS=MEMVAL;
 		}
 
 		//Operand sel
 		//B
-		if(!ZERO)
+		if(!(FLAGS & DSPOP_ZERO))
 		{
-			if(BSEL)
+			if(FLAGS & DSPOP_BSEL)
 				B=ACC;
 			else
 			{
-				B=DSP->TEMP[(TRA+DSP->DEC)&0x7F];
+				B=DSP->TEMP[(op->TRA+DSP->DEC)&0x7F];
 				B<<=8;
 				B>>=8;
-				//if(B&0x00800000)
-				//	B|=0xFF000000;  //Sign extend
 			}
-			if(NEGB)
+			if(FLAGS & DSPOP_NEGB)
 				B=0-B;
 		}
 		else
 			B=0;
 
 		//X
-		if(XSEL)
+		if(FLAGS & DSPOP_XSEL)
 			X=INPUTS;
 		else
 		{
-			X=DSP->TEMP[(TRA+DSP->DEC)&0x7F];
+			X=DSP->TEMP[(op->TRA+DSP->DEC)&0x7F];
 			X<<=8;
 			X>>=8;
-			//if(X&0x00800000)
-			//	X|=0xFF000000;
 		}
 
 		//Y
-		if(YSEL==0)
+		switch(op->YSEL)
+		{
+		case 0:
 			Y=FRC_REG;
-		else if(YSEL==1)
-			Y=DSP->COEF[COEF]>>3;   //COEF is 16 bits
-		else if(YSEL==2)
+			break;
+		case 1:
+			Y=DSP->COEF[op->COEF]>>3;   //COEF is 16 bits
+			break;
+		case 2:
 			Y=(Y_REG>>11)&0x1FFF;
-		else if(YSEL==3)
+			break;
+		case 3:
 			Y=(Y_REG>>4)&0x0FFF;
+			break;
+		}
 
-		if(YRL)
+		if(FLAGS & DSPOP_YRL)
 			Y_REG=INPUTS;
 
 		//Shifter
-		if(SHIFT==0)
+		switch(op->SHIFT)
 		{
+		case 0:
 			SHIFTED=ACC;
 			if(SHIFTED>0x007FFFFF)
 				SHIFTED=0x007FFFFF;
 			if(SHIFTED<(-0x00800000))
 				SHIFTED=-0x00800000;
-		}
-		else if(SHIFT==1)
-		{
+			break;
+		case 1:
 			SHIFTED=ACC*2;
 			if(SHIFTED>0x007FFFFF)
 				SHIFTED=0x007FFFFF;
 			if(SHIFTED<(-0x00800000))
 				SHIFTED=-0x00800000;
-		}
-		else if(SHIFT==2)
-		{
+			break;
+		case 2:
 			SHIFTED=ACC*2;
 			SHIFTED<<=8;
 			SHIFTED>>=8;
-			//SHIFTED&=0x00FFFFFF;
-			//if(SHIFTED&0x00800000)
-			//	SHIFTED|=0xFF000000;
-		}
-		else if(SHIFT==3)
-		{
+			break;
+		case 3:
 			SHIFTED=ACC;
 			SHIFTED<<=8;
 			SHIFTED>>=8;
-			//SHIFTED&=0x00FFFFFF;
-			//if(SHIFTED&0x00800000)
-			//	SHIFTED|=0xFF000000;
+			break;
 		}
 
 		//ACCUM
 		Y<<=19;
 		Y>>=19;
-		//if(Y&0x1000)
-		//	Y|=0xFFFFF000;
 
 		v=(((INT64) X*(INT64) Y)>>12);
 		ACC=(int) v+B;
 
-		if(TWT)
-			DSP->TEMP[(TWA+DSP->DEC)&0x7F]=SHIFTED;
+		if(FLAGS & DSPOP_TWT)
+			DSP->TEMP[(op->TWA+DSP->DEC)&0x7F]=SHIFTED;
 
-		if(FRCL)
+		if(FLAGS & DSPOP_FRCL)
 		{
-			if(SHIFT==3)
+			if(op->SHIFT==3)
 				FRC_REG=SHIFTED&0x0FFF;
 			else
 				FRC_REG=(SHIFTED>>11)&0x1FFF;
 		}
 
-		if(MRD || MWT)
-		//if(0)
+		if(FLAGS & (DSPOP_MRD | DSPOP_MWT))
 		{
-			ADDR=DSP->MADRS[MASA];
-			if(!TABLE)
+			ADDR=DSP->MADRS[op->MASA];
+			if(!(FLAGS & DSPOP_TABLE))
 				ADDR+=DSP->DEC;
-			if(ADREB)
+			if(FLAGS & DSPOP_ADREB)
 				ADDR+=ADRS_REG&0x0FFF;
-			if(NXADR)
+			if(FLAGS & DSPOP_NXADR)
 				ADDR++;
-			if(!TABLE)
+			if(!(FLAGS & DSPOP_TABLE))
 				ADDR&=DSP->RBL-1;
 			else
 				ADDR&=0xFFFF;
-			//ADDR<<=1;
-			//ADDR+=DSP->RBP<<13;
-			//MEMVAL=DSP->SCSPRAM[ADDR>>1];
 			ADDR+=DSP->RBP<<12;
 			if (ADDR > 0x7ffff) ADDR = 0;
-			if(MRD && (step&1)) //memory only allowed on odd? DoA inserts NOPs on even
+			if(FLAGS & DSPOP_MRD)
 			{
-				if(NOFL)
+				if(FLAGS & DSPOP_NOFL)
 					MEMVAL=DSP->SCSPRAM[ADDR]<<8;
 				else
 					MEMVAL=UNPACK(DSP->SCSPRAM[ADDR]);
 			}
-			if(MWT && (step&1))
+			if(FLAGS & DSPOP_MWT)
 			{
-				if(NOFL)
+				if(FLAGS & DSPOP_NOFL)
 					DSP->SCSPRAM[ADDR]=SHIFTED>>8;
 				else
 					DSP->SCSPRAM[ADDR]=PACK(SHIFTED);
 			}
 		}
 
-		if(ADRL)
+		if(FLAGS & DSPOP_ADRL)
 		{
-			if(SHIFT==3)
+			if(op->SHIFT==3)
 				ADRS_REG=(SHIFTED>>12)&0xFFF;
 			else
 				ADRS_REG=(INPUTS>>16);
 		}
 
-		if(EWT)
-			DSP->EFREG[EWA]+=SHIFTED>>8;
+		if(FLAGS & DSPOP_EWT)
+			DSP->EFREG[op->EWA]+=SHIFTED>>8;
 
 	}
 	--DSP->DEC;
@@ -326,5 +372,5 @@ void SCSPDSP_Start(SCSPDSP *DSP)
 			break;
 	}
 	DSP->LastStep=i+1;
-
+	DSP->Dirty=1;
 }
@@ -1,6 +1,19 @@
 #ifndef __SCSPDSP_H__
 #define __SCSPDSP_H__
 
+//pre-decoded DSP instruction, see SCSPDSP_Compile
+typedef struct _SCSPDSP_OP
+{
+	UINT32 FLAGS;   //DSPOP_* flags
+	UINT8 TRA, TWA;
+	UINT8 IRA, IWA;
+	UINT8 YSEL;
+	UINT8 SHIFT;
+	UINT8 EWA;
+	UINT8 COEF;
+	UINT8 MASA;
+} SCSPDSP_OP;
+
 //the DSP Context
 typedef struct _SCSPDSP
 {
@@ -28,6 +41,11 @@ typedef struct _SCSPDSP
 
 	int Stopped;
 	int LastStep;
+
+//compiled program
+	SCSPDSP_OP OPS[128];
+	int OPCount;
+	int Dirty;  //MPRO/LastStep changed, recompile before the next step
 } SCSPDSP;
 
 void SCSPDSP_Init(SCSPDSP *DSP);
@@ -13,6 +13,7 @@
 #include "../EmuCores.h"
 #include "../snddef.h"
 #include "../EmuHelper.h"
+#include "../pcmmix.h"
 
 #include "segapcm.h"
 
@@ -95,6 +96,17 @@ const DEV_DECL sndDev_SegaPCM =
 };
 
 
+// channel parameters, decoded from the register RAM when it is written
+typedef struct _segapcm_channel
+{
+	UINT32 offset;	// ROM bank offset
+	UINT32 loop;	// loop address
+	UINT8 end;		// (end address >> 16) + 1
+	UINT8 step;		// address delta
+	UINT8 vol_l;
+	UINT8 vol_r;
+} SEGAPCM_CHN;
+
 typedef struct _segapcm_state segapcm_state;
 struct _segapcm_state
 {
@@ -102,6 +114,7 @@ struct _segapcm_state
 
 	UINT8  *ram;
 	UINT8 low[16];
+	SEGAPCM_CHN chn[16];
 	UINT32 ROMSize;
 	UINT8 *rom;
 #ifdef _DEBUG
@@ -113,6 +126,28 @@ struct _segapcm_state
 	UINT8 Muted[16];
 };
 
+static void segapcm_decode_channel(segapcm_state *spcm, UINT8 ch)
+{
+	const UINT8 *regs = spcm->ram+8*ch;
+	SEGAPCM_CHN *chn = &spcm->chn[ch];
+
+	chn->offset = (regs[0x86] & spcm->bankmask) << spcm->bankshift;
+	chn->loop = (regs[0x05] << 16) | (regs[0x04] << 8);
+	chn->end = regs[6] + 1;
+	chn->step = regs[7];
+	// fixed Bitmask for volume multiplication, thanks to ctr -Valley Bell
+	chn->vol_l = regs[2] & 0x7F;
+	chn->vol_r = regs[3] & 0x7F;
+}
+
+static void segapcm_decode_all(segapcm_state *spcm)
+{
+	UINT8 ch;
+
+	for (ch = 0; ch < 16; ch++)
+		segapcm_decode_channel(spcm, ch);
+}
+
 static void SEGAPCM_update(void *chip, UINT32 samples, DEV_SMPL **outputs)
 {
 	segapcm_state *spcm = (segapcm_state *)chip;
@@ -149,45 +184,53 @@ static void SEGAPCM_update(void *chip, UINT32 samples, DEV_SMPL **outputs)
 	for (ch = 0; ch < 16; ch++)
 	{
 		UINT8 *regs = spcm->ram+8*ch;
+		const SEGAPCM_CHN *chn = &spcm->chn[ch];
 
 		/* only process active channels */
 		if (!(regs[0x86] & 1) && ! spcm->Muted[ch])
 		{
-			UINT32 offset = (regs[0x86] & spcm->bankmask) << spcm->bankshift;
+			UINT32 offset = chn->offset;
 			UINT32 addr = (regs[0x85] << 16) | (regs[0x84] << 8) | spcm->low[ch];
-			UINT32 loop = (regs[0x05] << 16) | (regs[0x04] << 8);
-			UINT8 end = regs[6] + 1;
-			UINT32 i;
+			UINT8 end = chn->end;
+			UINT8 step = chn->step;
+			UINT32 i, j, count;
+			INT32 smplBuf[PCMMIX_BLOCK];
 
 			/* loop over samples on this channel */
-			for (i = 0; i < samples; i++)
+			for (i = 0; i < samples; i += count)
 			{
-				INT8 v = 0;
+				count = samples - i;
+				if (count > PCMMIX_BLOCK)
+					count = PCMMIX_BLOCK;
 
-				/* handle looping if we've hit the end */
-				if ((addr >> 16) == end)
+				for (j = 0; j < count; j++)
 				{
-					if (regs[0x86] & 2)
+					/* handle looping if we've hit the end */
+					if ((addr >> 16) == end)
 					{
-						regs[0x86] |= 1;
-						break;
+						if (regs[0x86] & 2)
+						{
+							regs[0x86] |= 1;
+							segapcm_decode_channel(spcm, ch);
+							break;
+						}
+						else addr = chn->loop;
 					}
-					else addr = loop;
-				}
 
-				/* fetch the sample */
-				v = spcm->rom[offset | (addr >> 8)] - 0x80;
+					/* fetch the sample and advance */
+					smplBuf[j] = PcmMix_DecodeU8(spcm->rom[offset | (addr >> 8)]);
 #ifdef _DEBUG
-				if ((spcm->romusage[(offset | addr >> 8)] & 0x03) == 0x02 && (regs[2] || regs[3]))
-					printf("Access to empty ROM section! (0x%06X)\n", offset | ((addr >> 8)));
-				spcm->romusage[offset | (addr >> 8)] |= 0x01;
+					if ((spcm->romusage[(offset | addr >> 8)] & 0x03) == 0x02 && (regs[2] || regs[3]))
+						printf("Access to empty ROM section! (0x%06X)\n", offset | ((addr >> 8)));
+					spcm->romusage[offset | (addr >> 8)] |= 0x01;
 #endif
+					addr = (addr + step) & 0xffffff;
+				}
 
-				/* apply panning and advance */
-				// fixed Bitmask for volume multiplication, thanks to ctr -Valley Bell
-				outputs[0][i] += v * (regs[2] & 0x7F);
-				outputs[1][i] += v * (regs[3] & 0x7F);
-				addr = (addr + regs[7]) & 0xffffff;
+				/* apply panning */
+				PcmMix_AddStereo(smplBuf, j, chn->vol_l, chn->vol_r, 0, &outputs[0][i], &outputs[1][i]);
+				if (j < count)
+					break;
 			}
 
 			/* store back the updated address */
@@ -215,7 +258,7 @@ static UINT8 device_start_segapcm(const SEGAPCM_CFG* cfg, DEV_INFO* retDevInf)
 #ifdef _DEBUG
 	spcm->romusage = NULL;
 #endif
-	spcm->ram = (UINT8*)malloc(0x800);
+	spcm->ram = (UINT8*)calloc(0x800, 1);
 	// RAM clear is done at device_reset
 	
 	sega_pcm_alloc_rom(spcm, STD_ROM_SIZE);
@@ -246,6 +289,7 @@ static void device_reset_segapcm(void *chip)
 	segapcm_state *spcm = (segapcm_state *)chip;
 	
 	memset(spcm->ram, 0xFF, 0x800);
+	segapcm_decode_all(spcm);
 	
 	return;
 }
@@ -255,7 +299,10 @@ static void sega_pcm_w(void *chip, UINT16 offset, UINT8 data)
 {
 	segapcm_state *spcm = (segapcm_state *)chip;
 	
-	spcm->ram[offset & 0x07ff] = data;
+	offset &= 0x07ff;
+	spcm->ram[offset] = data;
+	if (offset < 0x100)
+		segapcm_decode_channel(spcm, (offset >> 3) & 0x0F);
 }
 
 static UINT8 sega_pcm_r(void *chip, UINT16 offset)
@@ -287,6 +334,7 @@ static void sega_pcm_alloc_rom(void *chip, UINT32 memsize)
 	spcm->ROMSize = memsize;
 	
 	spcm->bankmask = spcm->intf_mask & (0x1fffff >> spcm->bankshift);
+	segapcm_decode_all(spcm);
 	
 	return;
 }
@@ -145,6 +145,8 @@
 #include "../EmuCores.h"
 #include "../EmuHelper.h"
 #include "../logging.h"
+#include "../RatioCntr.h"
+#include "../blep.h"
 #include "sn764intf.h"
 #include "sn76496.h"
 
@@ -158,7 +160,10 @@ static void sn76496_connect_t6w28(void *noisechip, void *tonechip);
 static void sn76496_shutdown(void *chip);
 static void sn76496_reset(void *chip);
 static void sn76496_freq_limiter(void* chip, UINT32 sample_rate);
+static void sn76496_set_options(void *chip, UINT32 Options);
 static void sn76496_set_mute_mask(void *chip, UINT32 MuteMask);
+static UINT32 sn76496_get_sample_rate(void *chip);
+static void sn76496_set_srchg_cb(void *chip, DEVCB_SRATE_CHG CallbackFunc, void* DataPtr);
 static void sn76496_set_log_cb(void *info, DEVCB_LOG func, void* param);
 
 static UINT8 device_start_sn76496_mame(const SN76496_CFG* cfg, DEV_INFO* retDevInf);
@@ -168,6 +173,7 @@ static void sn76496_w_mame(void *chip, UINT8 reg, UINT8 data);
 static DEVDEF_RWFUNC devFunc[] =
 {
 	{RWF_REGISTER | RWF_WRITE, DEVRW_A8D8, 0, sn76496_w_mame},
+	{RWF_SRATE | RWF_READ, DEVRW_VALUE, 0, sn76496_get_sample_rate},
 	{RWF_CHN_MUTE | RWF_WRITE, DEVRW_ALL, 0, sn76496_set_mute_mask},
 	{0x00, 0x00, 0, NULL}
 };
@@ -180,10 +186,10 @@ DEV_DEF devDef_SN76496_MAME =
 	sn76496_reset,
 	sn76496_update,
 	
-	NULL,	// SetOptionBits
+	sn76496_set_options,	// SetOptionBits
 	sn76496_set_mute_mask,
 	NULL,	// SetPanning
-	NULL,	// SetSampleRateChangeCallback
+	sn76496_set_srchg_cb,	// SetSampleRateChangeCallback
 	sn76496_set_log_cb,	// SetLoggingCallback
 	NULL,	// LinkDevice
 	
@@ -229,6 +235,13 @@ struct _sn76496_state
 	UINT32 MuteMsk[4];
 	UINT8 NgpFlags;         // bit 7 - NGP Mode on/off, bit 0 - is 2nd NGP chip
 	sn76496_state* NgpChip2;    // pointer to other chip instance of T6W28
+	
+	DEVCB_SRATE_CHG SmpRateFunc;
+	void* SmpRateData;
+	
+	UINT32 smpl_rate;       // output sample rate of the band-limited step mode
+	BLEP_BUF* blep;         // band-limited step buffer (NULL = render at native rate)
+	RATIO_CNTR blep_tick;   // time of the next chip tick, in output samples
 };
 
 
@@ -333,6 +346,201 @@ INLINE void countdown_cycles(sn76496_state *R)
 	}
 }
 
+INLINE void clock_noise(sn76496_state *R)
+{
+	// if noisemode is 1, both taps are enabled
+	// if noisemode is 0, the lower tap, whitenoisetap2, is held at 0
+	// The != was a bit-XOR (^) before
+	if (((R->RNG & R->whitenoise_tap1) != 0) != (((R->RNG & R->whitenoise_tap2) != (R->ncr_style_psg ? R->whitenoise_tap2 : 0)) && in_noise_mode(R)))
+	{
+		R->RNG >>= 1;
+		R->RNG |= R->feedback_mask;
+	}
+	else
+	{
+		R->RNG >>= 1;
+	}
+	R->output[3] = R->RNG & 1;
+}
+
+// --- band-limited step synthesis ---
+// The chip is advanced from one output transition to the next and only the transitions are
+// rendered, directly at the output sample rate. Used when a custom sample rate is requested.
+
+// advance a tone channel by multiple clock ticks
+INLINE void skip_tone(sn76496_state *R, UINT8 i, UINT32 ticks)
+{
+	UINT32 next = (R->count[i] > 1) ? (UINT32)R->count[i] : 1;	// ticks until the next flip
+	UINT32 period;
+
+	if (ticks < next)
+	{
+		R->count[i] -= ticks;
+		return;
+	}
+	ticks -= next;
+	period = (R->period[i] > 1) ? (UINT32)R->period[i] : 1;
+	R->output[i] ^= ((ticks / period) & 1) ^ 1;
+	R->count[i] = R->period[i] - (INT32)(ticks % period);
+}
+
+// advance the noise channel by multiple clock ticks
+INLINE void skip_noise(sn76496_state *R, UINT32 ticks)
+{
+	UINT32 next = (R->count[3] > 1) ? (UINT32)R->count[3] : 1;	// ticks until the next shift
+	UINT32 period;
+
+	if (ticks < next)
+	{
+		R->count[3] -= ticks;
+		return;
+	}
+	ticks -= next;
+	period = (R->period[3] > 1) ? (UINT32)R->period[3] : 1;
+	clock_noise(R);
+	for (; ticks >= period; ticks -= period)
+		clock_noise(R);
+	R->count[3] = R->period[3] - (INT32)ticks;
+}
+
+// same mixing as sn76496_update, returns the current output level
+static void sn76496_blep_mix(const sn76496_state *R, INT32* outL, INT32* outR)
+{
+	const sn76496_state *R2 = R->NgpChip2;
+	INT32 out = 0;
+	INT32 out2 = 0;
+	INT32 vol;
+	INT32 volL, volR;
+	UINT32 muteMsk;
+	INT32 ggst[2];
+	UINT8 i;
+
+	ggst[0] = 0x01;
+	ggst[1] = 0x01;
+	for (i = 0; i < 4; i ++)
+	{
+		// T6W28: the first chip outputs the tone channels, the second one outputs the noise channel
+		if (R->NgpFlags && (i == 3) != (R->NgpFlags & 0x01))
+			continue;
+
+		vol = R->output[i] ? +1 : -1;
+		if (i != 3)
+		{
+			if (R->period[i] <= R->FNumLimit && R->period[i] > 1)
+				vol = 0;
+		}
+		volL = volR = R->volume[i];
+		muteMsk = R->MuteMsk[i];
+		if (R->NgpFlags & 0x01)
+		{
+			volL = R2->volume[i];
+			muteMsk = R2->MuteMsk[i];	// use MuteMask from chip 0
+		}
+		else if (R->NgpFlags)
+		{
+			volR = R2->volume[i];
+		}
+		vol &= muteMsk;
+
+		if (R->stereo)
+		{
+			ggst[0] = (R->stereo_mask & (0x10 << i)) ? 1 : 0;
+			ggst[1] = (R->stereo_mask & (0x01 << i)) ? 1 : 0;
+		}
+		// the T6W28 tone chip only treats period 0 as PCM, like sn76496_update
+		if (i == 3 || (R->NgpFlags ? (R->period[i] != 0) : (R->period[i] > 1)))
+		{
+			out += vol * volL * ggst[0];
+			out2 += vol * volR * ggst[1];
+		}
+		else if (muteMsk)
+		{
+			// Make Bipolar Output with PCM possible
+			out += volL * ggst[0];
+			out2 += volR * ggst[1];
+		}
+	}
+	if(R->negate) { out = -out; out2 = -out2; }
+
+	*outL = out >> 1;	// >>1 to make up for bipolar output
+	*outR = out2 >> 1;
+}
+
+static void sn76496_update_blep(sn76496_state *R, UINT32 samples, DEV_SMPL** outputs)
+{
+	UINT32 smplPos;
+	UINT32 blkLen;
+	UINT32 ticks;
+	UINT32 step;
+	UINT32 next;
+	INT32 outL, outR;
+	UINT8 noise;
+	UINT8 i;
+
+	// The noise channel only needs to be scheduled when it is audible.
+	// (On the T6W28, only the second chip outputs it.)
+	if (R->NgpFlags)
+		noise = (R->NgpFlags & 0x01) && R->NgpChip2->MuteMsk[3];
+	else
+		noise = R->MuteMsk[3] ? 1 : 0;
+
+	for (smplPos = 0; smplPos < samples; smplPos += blkLen)
+	{
+		blkLen = samples - smplPos;
+		if (blkLen > BLEP_BLOCK)
+			blkLen = BLEP_BLOCK;
+
+		// pick up register changes
+		sn76496_blep_mix(R, &outL, &outR);
+		Blep_SetLevel(R->blep, 0, outL, outR);
+
+		ticks = Blep_GetTicks(&R->blep_tick, blkLen);
+		while (ticks > 0)
+		{
+			// find the next tick that can change the output
+			step = ticks;
+			for (i = 0; i < 3; i ++)
+			{
+				// skip channels that output a constant level
+				if (R->period[i] <= 1 || R->period[i] <= R->FNumLimit)
+					continue;
+				next = (R->count[i] > 1) ? (UINT32)R->count[i] : 1;
+				if (step > next)
+					step = next;
+			}
+			if (noise)
+			{
+				next = (R->count[3] > 1) ? (UINT32)R->count[3] : 1;
+				if (step > next)
+					step = next;
+			}
+
+			for (i = 0; i < 3; i ++)
+				skip_tone(R, i, step);
+			skip_noise(R, step);
+			if (R->cycles_to_ready >= (INT32)step)
+			{
+				R->cycles_to_ready -= step;
+				R->ready_state = 0;
+			}
+			else
+			{
+				R->cycles_to_ready = 0;
+				R->ready_state = 1;
+			}
+
+			RC_STEPS(&R->blep_tick, step - 1);
+			sn76496_blep_mix(R, &outL, &outR);
+			Blep_SetLevel(R->blep, R->blep_tick.val, outL, outR);
+			RC_STEP(&R->blep_tick);
+			ticks -= step;
+		}
+
+		Blep_Render(R->blep, blkLen, &outputs[0][smplPos], &outputs[1][smplPos]);
+		RC_VAL_SUB(&R->blep_tick, blkLen);
+	}
+}
+
 static void sn76496_update(void* param, UINT32 samples, DEV_SMPL** outputs)
 {
 	UINT32 i;
@@ -346,6 +554,12 @@ static void sn76496_update(void* param, UINT32 samples, DEV_SMPL** outputs)
 	INT32 vol[4];
 	INT32 ggst[2];
 
+	if (R->blep != NULL)
+	{
+		sn76496_update_blep(R, samples, outputs);
+		return;
+	}
+	
 	R2 = R->NgpFlags ? R->NgpChip2 : NULL;
 	if (R->NgpFlags)
 	{
@@ -400,20 +614,7 @@ static void sn76496_update(void* param, UINT32 samples, DEV_SMPL** outputs)
 			R->count[3]--;
 			if (R->count[3] <= 0)
 			{
-				// if noisemode is 1, both taps are enabled
-				// if noisemode is 0, the lower tap, whitenoisetap2, is held at 0
-				// The != was a bit-XOR (^) before
-				if (((R->RNG & R->whitenoise_tap1) != 0) != (((R->RNG & R->whitenoise_tap2) != (R->ncr_style_psg ? R->whitenoise_tap2 : 0)) && in_noise_mode(R)))
-				{
-					R->RNG >>= 1;
-					R->RNG |= R->feedback_mask;
-				}
-				else
-				{
-					R->RNG >>= 1;
-				}
-				R->output[3] = R->RNG & 1;
-
+				clock_noise(R);
 				R->count[3] = R->period[3];
 			}
 		//}
@@ -566,6 +767,7 @@ static void sn76496_shutdown(void *chip)
 {
 	sn76496_state *R = (sn76496_state*)chip;
 	
+	free(R->blep);
 	free(R);
 	return;
 }
@@ -602,6 +804,12 @@ static void sn76496_reset(void *chip)
 
 	R->ready_state = 1;
 
+	if (R->blep != NULL)
+	{
+		Blep_Reset(R->blep);
+		RC_RESET(&R->blep_tick);
+	}
+
 	return;
 }
 
@@ -614,6 +822,37 @@ static void sn76496_freq_limiter(void* chip, UINT32 sample_rate)
 	return;
 }
 
+static void sn76496_set_options(void *chip, UINT32 Options)
+{
+	sn76496_state *R = (sn76496_state*)chip;
+	UINT8 useBlep;
+	
+	useBlep = (Options & OPT_SN76496_BLEP) ? 1 : 0;
+	if (R->smpl_rate == R->clock / 2 / R->clock_divider)
+		useBlep = 0;	// the native rate was requested
+	if (useBlep == (R->blep != NULL))
+		return;
+	
+	if (useBlep)
+	{
+		R->blep = (BLEP_BUF*)malloc(sizeof(BLEP_BUF));
+		if (R->blep == NULL)
+			return;
+		Blep_Init(R->blep);
+		RC_SET_RATIO(&R->blep_tick, R->smpl_rate * 2 * R->clock_divider, R->clock);
+		RC_RESET(&R->blep_tick);
+	}
+	else
+	{
+		free(R->blep);
+		R->blep = NULL;
+	}
+	if (R->SmpRateFunc != NULL)
+		R->SmpRateFunc(R->SmpRateData, sn76496_get_sample_rate(R));
+	
+	return;
+}
+
 static void sn76496_set_mute_mask(void *chip, UINT32 MuteMask)
 {
 	sn76496_state *R = (sn76496_state*)chip;
@@ -625,6 +864,26 @@ static void sn76496_set_mute_mask(void *chip, UINT32 MuteMask)
 	return;
 }
 
+static UINT32 sn76496_get_sample_rate(void *chip)
+{
+	sn76496_state *R = (sn76496_state*)chip;
+	
+	if (R->blep != NULL)
+		return R->smpl_rate;
+	return R->clock / 2 / R->clock_divider;
+}
+
+static void sn76496_set_srchg_cb(void *chip, DEVCB_SRATE_CHG CallbackFunc, void* DataPtr)
+{
+	sn76496_state *R = (sn76496_state*)chip;
+	
+	// set Sample Rate Change Callback routine
+	R->SmpRateFunc = CallbackFunc;
+	R->SmpRateData = DataPtr;
+	
+	return;
+}
+
 static void sn76496_set_log_cb(void *chip, DEVCB_LOG func, void* param)
 {
 	sn76496_state *R = (sn76496_state*)chip;
@@ -672,6 +931,9 @@ static UINT8 device_start_sn76496_mame(const SN76496_CFG* cfg, DEV_INFO* retDevI
 	chip->NgpFlags = 0x00;
 	chip->NgpChip2 = NULL;
 	rate = chip->clock / 2 / chip->clock_divider;
+	// sample rate for the band-limited step mode (see OPT_SN76496_BLEP)
+	chip->smpl_rate = rate;
+	SRATE_CUSTOM_HIGHEST(cfg->_genCfg.srMode, chip->smpl_rate, cfg->_genCfg.smplRate);
 	
 	// build volume table (2dB per step)
 	// four channels, each gets 1/4 of the total range
@@ -44,6 +44,8 @@ typedef struct sn76496_config
 // The noise device needs cfg.t6w28_tone to be set to the dataPtr of the tone device.
 // Both devices will then be linked together.
 
+#define OPT_SN76496_BLEP	0x01	// [MAME core] render at the CUSTOM/HIGHEST sample rate using band-limited steps (default: disabled)
+
 extern const DEV_DECL sndDev_SN76496;
 
 #define SN76496_W_REG	0x00	// normal register write
@@ -0,0 +1,821 @@
+// Lookup table generator
+// Generates the read-only lookup tables of the sound cores (paths relative to the emu/ directory):
+//	cores/fmopn_tables.h	(fmopn.c)
+//	cores/ym2151_tables.h	(ym2151.c)
+//	cores/fmopl_tables.h	(fmopl.c)
+//	cores/ymf262_tables.h	(ymf262.c)
+//	cores/ym2413_tables.h	(ym2413.c)
+//	cores/ymf271_tables.h	(ymf271.c)
+//	cores/emu2413_tables.h	(emu2413.c)
+//	cores/pokey_tables.h	(pokey.c)
+//	blep_tables.h	(blep.c)
+// The tables used to be calculated when the first chip was started.
+// (The BLEP kernel was calculated for every chip instance.)
+// The "check_tables" CMake target regenerates them and compares them with the checked-in files.
+//
+// Usage: tables_gen [emu directory]
+#define _USE_MATH_DEFINES
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI	3.14159265358979323846
+#endif
+
+#define ENV_BITS		10
+#define ENV_LEN			(1<<ENV_BITS)
+#define ENV_STEP		(128.0/ENV_LEN)
+
+#define SIN_BITS		10
+#define SIN_LEN			(1<<SIN_BITS)
+#define SIN_MASK		(SIN_LEN-1)
+
+#define TL_RES_LEN		(256)	/* 8 bits addressing (real chip) */
+
+#define TL_NEG_MINUS	0	/* negative values: -x */
+#define TL_NEG_INVERT	1	/* negative values: ~x (YMF262) */
+
+static const char* outPath = ".";
+
+
+static FILE* OpenTableFile(const char* fileName, const char* coreFile)
+{
+	char filePath[0x200];
+	FILE* hFile;
+
+	sprintf(filePath, "%s/%s", outPath, fileName);
+	hFile = fopen(filePath, "wt");
+	if (hFile == NULL)
+	{
+		fprintf(stderr, "Error opening %s!\n", filePath);
+		exit(1);
+	}
+	fprintf(hFile, "// Lookup tables for %s\n", coreFile);
+	fprintf(hFile, "// generated by tables_gen.c - do not edit\n");
+	return hFile;
+}
+
+static void WriteTable(FILE* hFile, const char* decl, const int* data, int count)
+{
+	int curVal;
+
+	fprintf(hFile, "\n%s =\n{\n", decl);
+	for (curVal = 0; curVal < count; curVal ++)
+	{
+		if ((curVal & 0x0F) == 0x00)
+			fputc('\t', hFile);
+		fprintf(hFile, "%d", data[curVal]);
+		if (curVal + 1 < count)
+			fputc(',', hFile);
+		if ((curVal & 0x0F) == 0x0F || curVal + 1 == count)
+			fputc('\n', hFile);
+		else
+			fputc(' ', hFile);
+	}
+	fprintf(hFile, "};\n");
+	return;
+}
+
+static void WriteIndent(FILE* hFile, int level)
+{
+	for (; level > 0; level --)
+		fputc('\t', hFile);
+	return;
+}
+
+#define VAL_INT		0	// int, decimal
+#define VAL_DOUBLE	1	// double, with enough digits to be read back exactly
+#define VAL_HEX32	2	// unsigned int, hexadecimal
+
+// write the values of a multi-dimensional table, one brace level per dimension
+static void WriteNestedValues(FILE* hFile, const void* data, int valType,
+							  const int* dims, int dimCount, int level, int* dataPos)
+{
+	int curVal;
+
+	if (level == dimCount - 1)
+	{
+		for (curVal = 0; curVal < dims[level]; curVal ++)
+		{
+			if ((curVal & 0x07) == 0x00)
+				WriteIndent(hFile, level + 1);
+			if (valType == VAL_DOUBLE)
+				fprintf(hFile, "%.17g", ((const double*)data)[*dataPos]);
+			else if (valType == VAL_HEX32)
+				fprintf(hFile, "0x%08XU", ((const unsigned int*)data)[*dataPos]);
+			else
+				fprintf(hFile, "%d", ((const int*)data)[*dataPos]);
+			(*dataPos) ++;
+			if (curVal + 1 < dims[level])
+				fputc(',', hFile);
+			if ((curVal & 0x07) == 0x07 || curVal + 1 == dims[level])
+				fputc('\n', hFile);
+			else
+				fputc(' ', hFile);
+		}
+		return;
+	}
+
+	for (curVal = 0; curVal < dims[level]; curVal ++)
+	{
+		WriteIndent(hFile, level + 1);
+		fprintf(hFile, "{\n");
+		WriteNestedValues(hFile, data, valType, dims, dimCount, level + 1, dataPos);
+		WriteIndent(hFile, level + 1);
+		fprintf(hFile, (curVal + 1 < dims[level]) ? "},\n" : "}\n");
+	}
+	return;
+}
+
+// write a table with 'dimCount' dimensions of the sizes given in 'dims'
+static void WriteNestedTable(FILE* hFile, const char* decl, const void* data, int valType,
+							 const int* dims, int dimCount)
+{
+	int dataPos = 0;
+
+	fprintf(hFile, "\n%s =\n{\n", decl);
+	WriteNestedValues(hFile, data, valType, dims, dimCount, 0, &dataPos);
+	fprintf(hFile, "};\n");
+	return;
+}
+
+/* Linear Power Table
+   rows: number of 'shift' rows, shl: final left shift (output bits - 11) */
+static int GenerateTLTable(int* tl_tab, int rows, int shl, int negMode)
+{
+	int i, x, n;
+	double m;
+
+	for (x = 0; x < TL_RES_LEN; x ++)
+	{
+		m = (1<<16) / pow(2, (x+1) * (ENV_STEP/4.0) / 8.0);
+		m = floor(m);
+
+		/* we never reach (1<<16) here due to the (x+1) */
+		/* result fits within 16 bits at maximum */
+
+		n = (int)m;     /* 16 bits here */
+		n >>= 4;        /* 12 bits here */
+		if (n&1)        /* round to nearest */
+			n = (n>>1)+1;
+		else
+			n = n>>1;
+						/* 11 bits here (rounded) */
+		n <<= shl;
+
+		for (i = 0; i < rows; i ++)
+		{
+			tl_tab[ x*2+0 + i*2*TL_RES_LEN ] = n >> i;
+			if (negMode == TL_NEG_INVERT)
+				tl_tab[ x*2+1 + i*2*TL_RES_LEN ] = ~(n >> i);
+			else
+				tl_tab[ x*2+1 + i*2*TL_RES_LEN ] = -(n >> i);
+		}
+	}
+
+	return rows * 2 * TL_RES_LEN;
+}
+
+/* Logarithmic Sinus table (waveform 0) */
+static void GenerateSinTable(int* sin_tab)
+{
+	int i, n;
+	double o, m;
+
+	for (i = 0; i < SIN_LEN; i ++)
+	{
+		/* non-standard sinus */
+		m = sin( ((i*2)+1) * M_PI / SIN_LEN ); /* checked against the real chip */
+		/* we never reach zero here due to ((i*2)+1) */
+
+		o = 8*log(1.0/fabs(m))/log(2.0);    /* convert to 'decibels' */
+
+		o = o / (ENV_STEP/4);
+
+		n = (int)(2.0*o);
+		if (n&1)            /* round to nearest */
+			n = (n>>1)+1;
+		else
+			n = n>>1;
+
+		/* 13-bits (8.5) value is formatted for the 'Power' table */
+		sin_tab[ i ] = n*2 + (m>=0.0? 0: 1 );
+	}
+
+	return;
+}
+
+/* OPL waveforms 1..7 (OPL2 uses waveforms 0..3, OPLL uses 0..1) */
+static void GenerateOPLWaveforms(int* sin_tab, int waveCount, int tlTabLen)
+{
+	int i, x;
+
+	for (i = 0; i < SIN_LEN; i ++)
+	{
+		/* waveform 1:  __      __     */
+		/*             /  \____/  \____*/
+		/* output only first half of the sinus waveform (positive one) */
+		if (i & (1<<(SIN_BITS-1)) )
+			sin_tab[1*SIN_LEN+i] = tlTabLen;
+		else
+			sin_tab[1*SIN_LEN+i] = sin_tab[i];
+		if (waveCount <= 2)
+			continue;
+
+		/* waveform 2:  __  __  __  __ */
+		/*             /  \/  \/  \/  \*/
+		/* abs(sin) */
+		sin_tab[2*SIN_LEN+i] = sin_tab[i & (SIN_MASK>>1) ];
+
+		/* waveform 3:  _   _   _   _  */
+		/*             / |_/ |_/ |_/ |_*/
+		/* abs(output only first quarter of the sinus waveform) */
+		if (i & (1<<(SIN_BITS-2)) )
+			sin_tab[3*SIN_LEN+i] = tlTabLen;
+		else
+			sin_tab[3*SIN_LEN+i] = sin_tab[i & (SIN_MASK>>2)];
+		if (waveCount <= 4)
+			continue;
+
+		/* waveform 4:                 */
+		/*             /\  ____/\  ____*/
+		/*               \/      \/    */
+		/* output whole sinus waveform in half the cycle(step=2) and output 0 on the other half of cycle */
+		if (i & (1<<(SIN_BITS-1)) )
+			sin_tab[4*SIN_LEN+i] = tlTabLen;
+		else
+			sin_tab[4*SIN_LEN+i] = sin_tab[i*2];
+
+		/* waveform 5:                 */
+		/*             /\/\____/\/\____*/
+		/*                             */
+		/* output abs(whole sinus) waveform in half the cycle(step=2) and output 0 on the other half of cycle */
+		if (i & (1<<(SIN_BITS-1)) )
+			sin_tab[5*SIN_LEN+i] = tlTabLen;
+		else
+			sin_tab[5*SIN_LEN+i] = sin_tab[(i*2) & (SIN_MASK>>1) ];
+
+		/* waveform 6: ____    ____    */
+		/*                             */
+		/*                 ____    ____*/
+		/* output maximum in half the cycle and output minimum on the other half of cycle */
+		if (i & (1<<(SIN_BITS-1)) )
+			sin_tab[6*SIN_LEN+i] = 1;   /* negative */
+		else
+			sin_tab[6*SIN_LEN+i] = 0;   /* positive */
+
+		/* waveform 7:                 */
+		/*             |\____  |\____  */
+		/*                   \|      \|*/
+		/* output sawtooth waveform    */
+		if (i & (1<<(SIN_BITS-1)) )
+			x = ((SIN_LEN-1)-i)*16 + 1; /* negative: from 8177 to 1 */
+		else
+			x = i*16;   /*positive: from 0 to 8176 */
+		if (x > tlTabLen)
+			x = tlTabLen; /* clip to the allowed range */
+		sin_tab[7*SIN_LEN+i] = x;
+	}
+
+	return;
+}
+
+/* OPN LFO PM modulation table */
+static const unsigned char lfo_pm_output[7*8][8]={
+/* 7 bits meaningful (of F-NUMBER), 8 LFO output levels per one depth (out of 32), 8 LFO depths */
+/* FNUM BIT 4: 000 0001xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 5 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 6 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 7 */ {0,   0,   0,   0,   1,   1,   1,   1},
+
+/* FNUM BIT 5: 000 0010xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 5 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 6 */ {0,   0,   0,   0,   1,   1,   1,   1},
+/* DEPTH 7 */ {0,   0,   1,   1,   2,   2,   2,   3},
+
+/* FNUM BIT 6: 000 0100xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 3 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 4 */ {0,   0,   0,   0,   0,   0,   0,   1},
+/* DEPTH 5 */ {0,   0,   0,   0,   1,   1,   1,   1},
+/* DEPTH 6 */ {0,   0,   1,   1,   2,   2,   2,   3},
+/* DEPTH 7 */ {0,   0,   2,   3,   4,   4,   5,   6},
+
+/* FNUM BIT 7: 000 1000xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 2 */ {0,   0,   0,   0,   0,   0,   1,   1},
+/* DEPTH 3 */ {0,   0,   0,   0,   1,   1,   1,   1},
+/* DEPTH 4 */ {0,   0,   0,   1,   1,   1,   1,   2},
+/* DEPTH 5 */ {0,   0,   1,   1,   2,   2,   2,   3},
+/* DEPTH 6 */ {0,   0,   2,   3,   4,   4,   5,   6},
+/* DEPTH 7 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
+
+/* FNUM BIT 8: 001 0000xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   1,   1,   1,   1},
+/* DEPTH 2 */ {0,   0,   0,   1,   1,   1,   2,   2},
+/* DEPTH 3 */ {0,   0,   1,   1,   2,   2,   3,   3},
+/* DEPTH 4 */ {0,   0,   1,   2,   2,   2,   3,   4},
+/* DEPTH 5 */ {0,   0,   2,   3,   4,   4,   5,   6},
+/* DEPTH 6 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
+/* DEPTH 7 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
+
+/* FNUM BIT 9: 010 0000xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   2,   2,   2,   2},
+/* DEPTH 2 */ {0,   0,   0,   2,   2,   2,   4,   4},
+/* DEPTH 3 */ {0,   0,   2,   2,   4,   4,   6,   6},
+/* DEPTH 4 */ {0,   0,   2,   4,   4,   4,   6,   8},
+/* DEPTH 5 */ {0,   0,   4,   6,   8,   8, 0xa, 0xc},
+/* DEPTH 6 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
+/* DEPTH 7 */ {0,   0,0x10,0x18,0x20,0x20,0x28,0x30},
+
+/* FNUM BIT10: 100 0000xxxx */
+/* DEPTH 0 */ {0,   0,   0,   0,   0,   0,   0,   0},
+/* DEPTH 1 */ {0,   0,   0,   0,   4,   4,   4,   4},
+/* DEPTH 2 */ {0,   0,   0,   4,   4,   4,   8,   8},
+/* DEPTH 3 */ {0,   0,   4,   4,   8,   8, 0xc, 0xc},
+/* DEPTH 4 */ {0,   0,   4,   8,   8,   8, 0xc,0x10},
+/* DEPTH 5 */ {0,   0,   8, 0xc,0x10,0x10,0x14,0x18},
+/* DEPTH 6 */ {0,   0,0x10,0x18,0x20,0x20,0x28,0x30},
+/* DEPTH 7 */ {0,   0,0x20,0x30,0x40,0x40,0x50,0x60},
+
+};
+
+static void GenerateOPNLfoPMTable(int* lfo_pm_table)
+{
+	int i;
+	int fnum;
+	int step;
+	int bit_tmp;
+	int value;
+
+	for (i = 0; i < 8; i ++) /* 8 PM depths */
+	{
+		for (fnum = 0; fnum < 128; fnum ++) /* 7 bits meaningful of F-NUMBER */
+		{
+			for (step = 0; step < 8; step ++)
+			{
+				value = 0;
+				for (bit_tmp = 0; bit_tmp < 7; bit_tmp ++) /* 7 bits */
+				{
+					if (fnum & (1<<bit_tmp)) /* only if bit "bit_tmp" is set */
+						value += lfo_pm_output[bit_tmp * 8 + i][step];
+				}
+				/* 32 steps for LFO PM (sinus) */
+				lfo_pm_table[(fnum*32*8) + (i*32) + step   + 0] = value;
+				lfo_pm_table[(fnum*32*8) + (i*32) +(step^7)+ 8] = value;
+				lfo_pm_table[(fnum*32*8) + (i*32) + step   +16] = -value;
+				lfo_pm_table[(fnum*32*8) + (i*32) +(step^7)+24] = -value;
+			}
+		}
+	}
+
+	return;
+}
+
+
+static int tl_tab[13*2*TL_RES_LEN];
+static int sin_tab[SIN_LEN * 8];
+static int lfo_pm_table[128*8*32];
+
+static void WriteOPNTables(const char* fileName, const char* coreFile, int withLFO)
+{
+	FILE* hFile;
+	int tlTabLen;
+
+	hFile = OpenTableFile(fileName, coreFile);
+	tlTabLen = GenerateTLTable(tl_tab, 13, 2, TL_NEG_MINUS);
+	WriteTable(hFile, "static const signed int tl_tab[TL_TAB_LEN]", tl_tab, tlTabLen);
+	GenerateSinTable(sin_tab);
+	WriteTable(hFile, "static const unsigned int sin_tab[SIN_LEN]", sin_tab, SIN_LEN);
+	if (withLFO)
+	{
+		GenerateOPNLfoPMTable(lfo_pm_table);
+		WriteTable(hFile, "/* 128 combinations of 7 bits meaningful (of F-NUMBER), 8 LFO depths, 32 LFO output levels per one depth */\n"
+				"static const INT16 lfo_pm_table[128*8*32]", lfo_pm_table, 128*8*32);
+	}
+	fclose(hFile);
+	return;
+}
+
+static void WriteOPLTables(const char* fileName, const char* coreFile,
+						   int tlRows, int tlShift, int negMode, int waveCount)
+{
+	FILE* hFile;
+	char sinDecl[0x40];
+	int tlTabLen;
+
+	hFile = OpenTableFile(fileName, coreFile);
+	tlTabLen = GenerateTLTable(tl_tab, tlRows, tlShift, negMode);
+	WriteTable(hFile, "static const signed int tl_tab[TL_TAB_LEN]", tl_tab, tlTabLen);
+	GenerateSinTable(sin_tab);
+	GenerateOPLWaveforms(sin_tab, waveCount, tlTabLen);
+	sprintf(sinDecl, "static const unsigned int sin_tab[SIN_LEN * %d]", waveCount);
+	WriteTable(hFile, sinDecl, sin_tab, SIN_LEN * waveCount);
+	fclose(hFile);
+	return;
+}
+
+/* YMF271 (OPX) tables */
+#define OPX_MAXOUT			(+32768)
+#define OPX_MINOUT			(-32768)
+#define OPX_LFO_LENGTH		256
+#define OPX_PLFO_MAX		(+1.0)
+#define OPX_PLFO_MIN		(-1.0)
+#define OPX_PLFO_SHIFT		31
+#define OPX_ALFO_MAX		(+65536)
+#define OPX_ALFO_MIN		(0)
+
+static const double opx_channel_attenuation_table[16] =
+{
+	0.0, 2.5, 6.0, 8.5, 12.0, 14.5, 18.1, 20.6, 24.1, 26.6, 30.1, 32.6, 36.1, 96.1, 96.1, 96.1
+};
+
+static int opx_waves[8][SIN_LEN];
+static double opx_plfo[4][8][OPX_LFO_LENGTH];
+static unsigned int opx_plfo_fixed[4][8][OPX_LFO_LENGTH];
+static int opx_alfo[4][OPX_LFO_LENGTH];
+static int opx_attenuation[16];
+static int opx_total_level[128];
+static int opx_env_volume[256];
+
+static void GenerateOPXTables(void)
+{
+	int i,j,k;
+
+	for (i=0; i < SIN_LEN; i++)
+	{
+		double m = sin( ((i*2)+1) * M_PI / SIN_LEN );
+		double m2 = sin( ((i*4)+1) * M_PI / SIN_LEN );
+
+		// Waveform 0: sin(wt)    (0 <= wt <= 2PI)
+		opx_waves[0][i] = (short)(m * OPX_MAXOUT);
+
+		// Waveform 1: sin^2(wt)  (0 <= wt <= PI)     -sin^2(wt) (PI <= wt <= 2PI)
+		opx_waves[1][i] = (i < (SIN_LEN/2)) ? (short)((m * m) * OPX_MAXOUT) : (short)((m * m) * OPX_MINOUT);
+
+		// Waveform 2: sin(wt)    (0 <= wt <= PI)     -sin(wt)   (PI <= wt <= 2PI)
+		opx_waves[2][i] = (i < (SIN_LEN/2)) ? (short)(m * OPX_MAXOUT) : (short)(-m * OPX_MAXOUT);
+
+		// Waveform 3: sin(wt)    (0 <= wt <= PI)     0
+		opx_waves[3][i] = (i < (SIN_LEN/2)) ? (short)(m * OPX_MAXOUT) : 0;
+
+		// Waveform 4: sin(2wt)   (0 <= wt <= PI)     0
+		opx_waves[4][i] = (i < (SIN_LEN/2)) ? (short)(m2 * OPX_MAXOUT) : 0;
+
+		// Waveform 5: |sin(2wt)| (0 <= wt <= PI)     0
+		opx_waves[5][i] = (i < (SIN_LEN/2)) ? (short)(fabs(m2) * OPX_MAXOUT) : 0;
+
+		// Waveform 6:     1      (0 <= wt <= 2PI)
+		opx_waves[6][i] = (short)(1 * OPX_MAXOUT);
+
+		opx_waves[7][i] = 0;
+	}
+
+	for (i = 0; i < OPX_LFO_LENGTH; i++)
+	{
+		int tri_wave;
+		double ftri_wave, fsaw_wave;
+		double plfo[4];
+
+		// LFO phase modulation
+		plfo[0] = 0;
+
+		fsaw_wave = ((i % (OPX_LFO_LENGTH/2)) * OPX_PLFO_MAX) / (double)((OPX_LFO_LENGTH/2)-1);
+		plfo[1] = (i < (OPX_LFO_LENGTH/2)) ? fsaw_wave : fsaw_wave - OPX_PLFO_MAX;
+
+		plfo[2] = (i < (OPX_LFO_LENGTH/2)) ? OPX_PLFO_MAX : OPX_PLFO_MIN;
+
+		ftri_wave = ((i % (OPX_LFO_LENGTH/4)) * OPX_PLFO_MAX) / (double)(OPX_LFO_LENGTH/4);
+		switch (i / (OPX_LFO_LENGTH/4))
+		{
+			case 0: plfo[3] = ftri_wave; break;
+			case 1: plfo[3] = OPX_PLFO_MAX - ftri_wave; break;
+			case 2: plfo[3] = 0 - ftri_wave; break;
+			case 3: plfo[3] = 0 - (OPX_PLFO_MAX - ftri_wave); break;
+			default: plfo[3] = 0; break;
+		}
+
+		for (j = 0; j < 4; j++)
+		{
+			opx_plfo[j][0][i] = pow(2.0, 0.0);
+			opx_plfo[j][1][i] = pow(2.0, (3.378 * plfo[j]) / 1200.0);
+			opx_plfo[j][2][i] = pow(2.0, (5.0646 * plfo[j]) / 1200.0);
+			opx_plfo[j][3][i] = pow(2.0, (6.7495 * plfo[j]) / 1200.0);
+			opx_plfo[j][4][i] = pow(2.0, (10.1143 * plfo[j]) / 1200.0);
+			opx_plfo[j][5][i] = pow(2.0, (20.1699 * plfo[j]) / 1200.0);
+			opx_plfo[j][6][i] = pow(2.0, (40.1076 * plfo[j]) / 1200.0);
+			opx_plfo[j][7][i] = pow(2.0, (79.307 * plfo[j]) / 1200.0);
+			for (k = 0; k < 8; k++)
+				opx_plfo_fixed[j][k][i] = (unsigned int)(opx_plfo[j][k][i] * (double)(1U << OPX_PLFO_SHIFT) + 0.5);
+		}
+
+		// LFO amplitude modulation
+		opx_alfo[0][i] = 0;
+
+		opx_alfo[1][i] = OPX_ALFO_MAX - ((i * OPX_ALFO_MAX) / OPX_LFO_LENGTH);
+
+		opx_alfo[2][i] = (i < (OPX_LFO_LENGTH/2)) ? OPX_ALFO_MAX : OPX_ALFO_MIN;
+
+		tri_wave = ((i % (OPX_LFO_LENGTH/2)) * OPX_ALFO_MAX) / (OPX_LFO_LENGTH/2);
+		opx_alfo[3][i] = (i < (OPX_LFO_LENGTH/2)) ? OPX_ALFO_MAX-tri_wave : tri_wave;
+	}
+
+	for (i = 0; i < 256; i++)
+		opx_env_volume[i] = (int)(65536.0 / pow(10.0, ((double)i / (256.0 / 96.0)) / 20.0));
+
+	for (i = 0; i < 16; i++)
+		opx_attenuation[i] = (int)(65536.0 / pow(10.0, opx_channel_attenuation_table[i] / 20.0));
+
+	for (i = 0; i < 128; i++)
+	{
+		double db = 0.75 * (double)i;
+		opx_total_level[i] = (int)(65536.0 / pow(10.0, db / 20.0));
+	}
+
+	return;
+}
+
+static void WriteOPXTables(const char* fileName, const char* coreFile)
+{
+	static const int waveDims[2] = {8, SIN_LEN};
+	static const int plfoDims[3] = {4, 8, OPX_LFO_LENGTH};
+	static const int alfoDims[2] = {4, OPX_LFO_LENGTH};
+	FILE* hFile;
+
+	GenerateOPXTables();
+	hFile = OpenTableFile(fileName, coreFile);
+	WriteNestedTable(hFile, "static const INT16 lut_waves[8][SIN_LEN]", opx_waves, VAL_INT, waveDims, 2);
+	WriteNestedTable(hFile, "static const double lut_plfo[4][8][LFO_LENGTH]", opx_plfo, VAL_DOUBLE, plfoDims, 3);
+	WriteNestedTable(hFile, "static const UINT32 lut_plfo_fixed[4][8][LFO_LENGTH]", opx_plfo_fixed, VAL_HEX32, plfoDims, 3);
+	WriteNestedTable(hFile, "static const int lut_alfo[4][LFO_LENGTH]", opx_alfo, VAL_INT, alfoDims, 2);
+	WriteTable(hFile, "static const int lut_attenuation[16]", opx_attenuation, 16);
+	WriteTable(hFile, "static const int lut_total_level[128]", opx_total_level, 128);
+	WriteTable(hFile, "static const int lut_env_volume[256]", opx_env_volume, 256);
+	fclose(hFile);
+	return;
+}
+
+/* EMU2413 tables */
+#define OPLL_PG_WIDTH	(1 << 10)
+#define OPLL_TONE_NUM	3
+
+/* preset tone dumps, same as default_inst in emu2413.c */
+static const unsigned char opll_default_inst[OPLL_TONE_NUM][(16 + 3) * 8] = {{
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // 0: User
+0x71,0x61,0x1e,0x17,0xd0,0x78,0x00,0x17, // 1: Violin
+0x13,0x41,0x1a,0x0d,0xd8,0xf7,0x23,0x13, // 2: Guitar
+0x13,0x01,0x99,0x00,0xf2,0xc4,0x21,0x23, // 3: Piano
+0x11,0x61,0x0e,0x07,0x8d,0x64,0x70,0x27, // 4: Flute
+0x32,0x21,0x1e,0x06,0xe1,0x76,0x01,0x28, // 5: Clarinet
+0x31,0x22,0x16,0x05,0xe0,0x71,0x00,0x18, // 6: Oboe
+0x21,0x61,0x1d,0x07,0x82,0x81,0x11,0x07, // 7: Trumpet
+0x33,0x21,0x2d,0x13,0xb0,0x70,0x00,0x07, // 8: Organ
+0x61,0x61,0x1b,0x06,0x64,0x65,0x10,0x17, // 9: Horn
+0x41,0x61,0x0b,0x18,0x85,0xf0,0x81,0x07, // A: Synthesizer
+0x33,0x01,0x83,0x11,0xea,0xef,0x10,0x04, // B: Harpsichord
+0x17,0xc1,0x24,0x07,0xf8,0xf8,0x22,0x12, // C: Vibraphone
+0x61,0x50,0x0c,0x05,0xd2,0xf5,0x40,0x42, // D: Synthsizer Bass
+0x01,0x01,0x55,0x03,0xe9,0x90,0x03,0x02, // E: Acoustic Bass
+0x41,0x41,0x89,0x03,0xf1,0xe4,0xc0,0x13, // F: Electric Guitar
+0x01,0x01,0x18,0x0f,0xdf,0xf8,0x6a,0x6d, // R: Bass Drum (from VRC7)
+0x01,0x01,0x00,0x00,0xc8,0xd8,0xa7,0x68, // R: High-Hat(M) / Snare Drum(C) (from VRC7)
+0x05,0x01,0x00,0x00,0xf8,0xaa,0x59,0x55, // R: Tom-tom(M) / Top Cymbal(C) (from VRC7)
+},{
+#include "opll_vrc7tone.h"
+},{
+/* YMF281B presets */
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, // 0: User
+0x62,0x21,0x1a,0x07,0xf0,0x6f,0x00,0x16, // 1: Electric Strings (form Chabin's patch)
+0x40,0x10,0x45,0x00,0xf6,0x83,0x73,0x63, // 2: Bow Wow (based on plgDavid's patch, KSL fixed)
+0x13,0x01,0x99,0x00,0xf2,0xc3,0x21,0x23, // 3: Electric Guitar (similar to YM2413 but different DR(C))
+0x01,0x61,0x0b,0x0f,0xf9,0x64,0x70,0x17, // 4: Organ (based on Chabin, TL/DR fixed)
+0x32,0x21,0x1e,0x06,0xe1,0x76,0x01,0x28, // 5: Clarinet (identical to YM2413)
+0x60,0x01,0x82,0x0e,0xf9,0x61,0x20,0x27, // 6: Saxophone (based on plgDavid, PM/EG fixed)
+0x21,0x61,0x1c,0x07,0x84,0x81,0x11,0x07, // 7: Trumpet (similar to YM2413 but different TL/DR(M))
+0x37,0x32,0xc9,0x01,0x66,0x64,0x40,0x28, // 8: Street Organ (from Chabin)
+0x01,0x21,0x07,0x03,0xa5,0x71,0x51,0x07, // 9: Synth Brass (based on Chabin, TL fixed)
+0x06,0x01,0x5e,0x07,0xf3,0xf3,0xf6,0x13, // A: Electric Piano (based on Chabin, DR/RR/KR fixed)
+0x00,0x00,0x18,0x06,0xf5,0xf3,0x20,0x23, // B: Bass (based on Chabin, EG fixed) 
+0x17,0xc1,0x24,0x07,0xf8,0xf8,0x22,0x12, // C: Vibraphone (identical to YM2413)
+0x35,0x64,0x00,0x00,0xff,0xf3,0x77,0xf5, // D: Chimes (from plgDavid)
+0x11,0x31,0x00,0x07,0xdd,0xf3,0xff,0xfb, // E: Tom Tom II (from plgDavid)
+0x3a,0x21,0x00,0x07,0x80,0x84,0x0f,0xf5, // F: Noise (based on plgDavid, AR fixed)
+0x01,0x01,0x18,0x0f,0xdf,0xf8,0x6a,0x6d, // R: Bass Drum (identical to YM2413)
+0x01,0x01,0x00,0x00,0xc8,0xd8,0xa7,0x68, // R: High-Hat(M) / Snare Drum(C) (identical to YM2413)
+0x05,0x01,0x00,0x00,0xf8,0xaa,0x59,0x55, // R: Tom-tom(M) / Top Cymbal(C) (identical to YM2413)
+}};
+
+static int opll_fullsin[OPLL_PG_WIDTH];
+static int opll_halfsin[OPLL_PG_WIDTH];
+static unsigned int opll_patch[OPLL_TONE_NUM][(16 + 3) * 2][13];
+
+static void GenerateOPLLTables(void)
+{
+	int x, i, j;
+
+	/* fullsin_table[x] = round(-log2(sin((x + 0.5) * PI / (PG_WIDTH / 4) / 2)) * 256) */
+	for (x = 0; x < OPLL_PG_WIDTH / 4; x++)
+		opll_fullsin[x] = (int)floor(-log2(sin((x + 0.5) * M_PI / (OPLL_PG_WIDTH / 4) / 2)) * 256 + 0.5);
+	for (x = 0; x < OPLL_PG_WIDTH / 4; x++)
+		opll_fullsin[OPLL_PG_WIDTH / 4 + x] = opll_fullsin[OPLL_PG_WIDTH / 4 - x - 1];
+	for (x = 0; x < OPLL_PG_WIDTH / 2; x++)
+		opll_fullsin[OPLL_PG_WIDTH / 2 + x] = 0x8000 | opll_fullsin[x];
+
+	for (x = 0; x < OPLL_PG_WIDTH / 2; x++)
+		opll_halfsin[x] = opll_fullsin[x];
+	for (x = OPLL_PG_WIDTH / 2; x < OPLL_PG_WIDTH; x++)
+		opll_halfsin[x] = 0xfff;
+
+	/* EOPLL_dumpToPatch, members in EOPLL_PATCH order: TL, FB, EG, ML, AR, DR, SL, RR, KR, KL, AM, PM, WS */
+	for (i = 0; i < OPLL_TONE_NUM; i++)
+	{
+		for (j = 0; j < 16 + 3; j++)
+		{
+			const unsigned char* dump = &opll_default_inst[i][j * 8];
+			unsigned int* mod = opll_patch[i][j * 2 + 0];
+			unsigned int* car = opll_patch[i][j * 2 + 1];
+
+			mod[0] = dump[2] & 63;			car[0] = 0;
+			mod[1] = dump[3] & 7;			car[1] = 0;
+			mod[2] = (dump[0] >> 5) & 1;	car[2] = (dump[1] >> 5) & 1;
+			mod[3] = dump[0] & 15;			car[3] = dump[1] & 15;
+			mod[4] = (dump[4] >> 4) & 15;	car[4] = (dump[5] >> 4) & 15;
+			mod[5] = dump[4] & 15;			car[5] = dump[5] & 15;
+			mod[6] = (dump[6] >> 4) & 15;	car[6] = (dump[7] >> 4) & 15;
+			mod[7] = dump[6] & 15;			car[7] = dump[7] & 15;
+			mod[8] = (dump[0] >> 4) & 1;	car[8] = (dump[1] >> 4) & 1;
+			mod[9] = (dump[2] >> 6) & 3;	car[9] = (dump[3] >> 6) & 3;
+			mod[10] = (dump[0] >> 7) & 1;	car[10] = (dump[1] >> 7) & 1;
+			mod[11] = (dump[0] >> 6) & 1;	car[11] = (dump[1] >> 6) & 1;
+			mod[12] = (dump[3] >> 3) & 1;	car[12] = (dump[3] >> 4) & 1;
+		}
+	}
+
+	return;
+}
+
+static void WriteOPLLTables(const char* fileName, const char* coreFile)
+{
+	FILE* hFile;
+	int i, j, k;
+
+	GenerateOPLLTables();
+	hFile = OpenTableFile(fileName, coreFile);
+	WriteTable(hFile, "static const uint16_t fullsin_table[PG_WIDTH]", opll_fullsin, OPLL_PG_WIDTH);
+	WriteTable(hFile, "static const uint16_t halfsin_table[PG_WIDTH]", opll_halfsin, OPLL_PG_WIDTH);
+
+	fprintf(hFile, "\nstatic const EOPLL_PATCH default_patch[EOPLL_TONE_NUM][(16 + 3) * 2] =\n{\n");
+	for (i = 0; i < OPLL_TONE_NUM; i++)
+	{
+		fprintf(hFile, "\t{\n");
+		for (j = 0; j < (16 + 3) * 2; j++)
+		{
+			fprintf(hFile, "\t\t{");
+			for (k = 0; k < 13; k++)
+				fprintf(hFile, (k + 1 < 13) ? "%u, " : "%u", opll_patch[i][j][k]);
+			fprintf(hFile, (j + 1 < (16 + 3) * 2) ? "},\n" : "}\n");
+		}
+		fprintf(hFile, (i + 1 < OPLL_TONE_NUM) ? "\t},\n" : "\t}\n");
+	}
+	fprintf(hFile, "};\n");
+	fclose(hFile);
+	return;
+}
+
+/* POKEY output conductance per channel volume (1 / r_chan) */
+static double pokey_chan_cond[16];
+
+static void GeneratePokeyTables(void)
+{
+	static const double resistors[4] = {90000, 26500, 8050, 3400};
+	/* just a guess, there has to be a resistance since the doc specifies that
+	 * Vout is at least 4.2V if all channels turned off.
+	 */
+	double r_off = 8e6;
+	double r_chan;
+	double rTot;
+	int i, j;
+
+	for (j=0; j<16; j++)
+	{
+		rTot = 1.0 / 1e12; /* avoid div by 0 */
+		for (i=0; i<4; i++)
+		{
+			if (j & (1 << i))
+				rTot += 1.0 / resistors[i];
+			else
+				rTot += 1.0 / r_off;
+		}
+		r_chan = 1.0 / rTot;
+		pokey_chan_cond[j] = 1.0 / r_chan;
+	}
+
+	return;
+}
+
+static void WritePokeyTables(const char* fileName, const char* coreFile)
+{
+	static const int condDims[1] = {16};
+	FILE* hFile;
+
+	GeneratePokeyTables();
+	hFile = OpenTableFile(fileName, coreFile);
+	WriteNestedTable(hFile, "static const double chan_cond[16]", pokey_chan_cond, VAL_DOUBLE, condDims, 1);
+	fclose(hFile);
+	return;
+}
+
+#define BLEP_PHASE_BITS		5
+#define BLEP_PHASES			(1 << BLEP_PHASE_BITS)
+#define BLEP_TAPS			16
+#define BLEP_KERNEL_BITS	15
+#define BLEP_CUTOFF			0.80	// low-pass cutoff, relative to Nyquist frequency
+
+static int blep_kernel[BLEP_PHASES][BLEP_TAPS];
+
+static void GenerateBlepKernel(void)
+{
+	double imp[BLEP_TAPS];
+	int curPhase;
+	int curTap;
+
+	for (curPhase = 0; curPhase < BLEP_PHASES; curPhase ++)
+	{
+		double frac = (curPhase + 0.5) / BLEP_PHASES;
+		double sum = 0.0;
+		int isum = 0;
+		int maxTap = 0;
+
+		for (curTap = 0; curTap < BLEP_TAPS; curTap ++)
+		{
+			// Distance to the impulse centre. The additional half sample compensates for the
+			// summation in Blep_Render, so that steps are delayed by exactly (BLEP_TAPS/2 - 1) samples.
+			double x = (double)curTap - (BLEP_TAPS / 2 - 0.5) - frac;
+			double u = x / (BLEP_TAPS / 2 + 0.5);
+			double sinc = (x == 0.0) ? 1.0 : sin(M_PI * BLEP_CUTOFF * x) / (M_PI * BLEP_CUTOFF * x);
+			double window = 0.42 + 0.5 * cos(M_PI * u) + 0.08 * cos(2.0 * M_PI * u);	// Blackman
+
+			imp[curTap] = sinc * window;
+			sum += imp[curTap];
+		}
+
+		// normalize each phase to exactly 1.0, so that the integrated output has no DC drift
+		for (curTap = 0; curTap < BLEP_TAPS; curTap ++)
+		{
+			blep_kernel[curPhase][curTap] = (int)floor(imp[curTap] / sum * (1 << BLEP_KERNEL_BITS) + 0.5);
+			isum += blep_kernel[curPhase][curTap];
+			if (blep_kernel[curPhase][curTap] > blep_kernel[curPhase][maxTap])
+				maxTap = curTap;
+		}
+		blep_kernel[curPhase][maxTap] += (1 << BLEP_KERNEL_BITS) - isum;
+	}
+
+	return;
+}
+
+static void WriteBlepTables(const char* fileName, const char* coreFile)
+{
+	static const int kernelDims[2] = {BLEP_PHASES, BLEP_TAPS};
+	FILE* hFile;
+
+	GenerateBlepKernel();
+	hFile = OpenTableFile(fileName, coreFile);
+	WriteNestedTable(hFile, "const INT16 blep_kernel[BLEP_PHASES][BLEP_TAPS]", blep_kernel, VAL_INT, kernelDims, 2);
+	fclose(hFile);
+	return;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc > 1)
+		outPath = argv[1];
+
+	WriteOPNTables("cores/fmopn_tables.h", "fmopn.c", 1);
+	WriteOPNTables("cores/ym2151_tables.h", "ym2151.c", 0);
+	WriteOPLTables("cores/fmopl_tables.h", "fmopl.c", 12, 1, TL_NEG_MINUS, 4);
+	WriteOPLTables("cores/ymf262_tables.h", "ymf262.c", 13, 1, TL_NEG_INVERT, 8);
+	WriteOPLTables("cores/ym2413_tables.h", "ym2413.c", 11, 0, TL_NEG_MINUS, 2);
+	WriteOPXTables("cores/ymf271_tables.h", "ymf271.c");
+	WriteOPLLTables("cores/emu2413_tables.h", "emu2413.c");
+	WritePokeyTables("cores/pokey_tables.h", "pokey.c");
+	WriteBlepTables("blep_tables.h", "blep.c");
+
+	return 0;
+}
@@ -640,6 +640,82 @@ static void advance_state(upd7759_state *chip)
 
 *************************************************************/
 
+static void upd7759_update_stand_alone(upd7759_state *chip, UINT32 samples, DEV_SMPL *buffer, DEV_SMPL *buffer2)
+{
+	/* In stand-alone mode, the chip reads everything from ROM by itself, so the state machine
+	   only needs to run when the current state ends. The samples in between repeat the
+	   current output value. */
+	UINT32 i;
+	UINT32 run;
+	UINT32 runEnd;
+	UINT64 end_pos;
+	UINT64 new_pos;
+
+	i = 0;
+	while (i < samples)
+	{
+		/* store the current sample */
+		INT16 sample = chip->Muted ? 0 : chip->sample;
+
+		/* count the samples that end before the current state runs out of clocks */
+		run = samples - i;
+		if (chip->rom == NULL)
+		{
+			/* no clocks are handled without ROM */
+			chip->pos += run * chip->step;
+		}
+		else
+		{
+			end_pos = (chip->clocks_left > 0) ? ((UINT64)chip->clocks_left << FRAC_BITS) : 0;
+			if (end_pos <= chip->pos)
+				run = 0;
+			else if ((end_pos - chip->pos - 1) / chip->step < run)
+				run = (UINT32)((end_pos - chip->pos - 1) / chip->step);
+
+			/* this consumes all full clocks, but never the whole state */
+			new_pos = chip->pos + (UINT64)run * chip->step;
+			chip->clocks_left -= (INT32)(new_pos >> FRAC_BITS);
+			chip->pos = (UINT32)(new_pos & FRAC_MASK);
+		}
+		for (runEnd = i + run; i < runEnd; i ++)
+		{
+			buffer[i] = sample << 7;
+			buffer2[i] = sample << 7;
+		}
+		if (i >= samples)
+			break;
+
+		/* This sample ends the state, so it is processed like before. */
+		buffer[i] = sample << 7;
+		buffer2[i] = sample << 7;
+		i ++;
+
+		/* advance by the number of clocks/output sample */
+		chip->pos += chip->step;
+
+		/* handle clocks */
+		while (chip->pos >= FRAC_ONE)
+		{
+			int clocks_this_time = chip->pos >> FRAC_BITS;
+			if (clocks_this_time > chip->clocks_left)
+				clocks_this_time = chip->clocks_left;
+
+			/* clock once */
+			chip->pos -= clocks_this_time * FRAC_ONE;
+			chip->clocks_left -= clocks_this_time;
+
+			/* if we're out of clocks, time to handle the next state */
+			if (chip->clocks_left == 0)
+			{
+				/* advance one state; if we hit idle, bail */
+				advance_state(chip);
+				if (chip->state == STATE_IDLE)
+					break;
+			}
+		}
+	}
+}
+
 static void upd7759_update(void *param, UINT32 samples, DEV_SMPL **outputs)
 {
 	upd7759_state *chip = (upd7759_state *)param;
@@ -649,7 +725,14 @@ static void upd7759_update(void *param, UINT32 samples, DEV_SMPL **outputs)
 
 	/* loop until done */
 	i = 0;
-	if (chip->state != STATE_IDLE)
+	if (chip->state != STATE_IDLE && chip->mode == MODE_STAND_ALONE)
+	{
+		upd7759_update_stand_alone(chip, samples, buffer, buffer2);
+		i = samples;
+	}
+	else if (chip->state != STATE_IDLE)
+	{
+		/* slave mode: the data is supplied by the host */
 		for (; i < samples; i++)
 		{
 			/* store the current sample */
@@ -660,41 +743,16 @@ static void upd7759_update(void *param, UINT32 samples, DEV_SMPL **outputs)
 			/* advance by the number of clocks/output sample */
 			chip->pos += chip->step;
 
-			if (chip->mode == MODE_STAND_ALONE)
+			while(chip->clocks_left <= (INT32)(chip->pos >> FRAC_BITS))
 			{
-				/* handle clocks, but only in standalone mode */
-				while (chip->rom != NULL && chip->pos >= FRAC_ONE)
-				{
-					int clocks_this_time = chip->pos >> FRAC_BITS;
-					if (clocks_this_time > chip->clocks_left)
-						clocks_this_time = chip->clocks_left;
-
-					/* clock once */
-					chip->pos -= clocks_this_time * FRAC_ONE;
-					chip->clocks_left -= clocks_this_time;
-
-					/* if we're out of clocks, time to handle the next state */
-					if (chip->clocks_left == 0)
-					{
-						/* advance one state; if we hit idle, bail */
-						advance_state(chip);
-						if (chip->state == STATE_IDLE)
-							break;
-					}
-				}
-			}
-			else
-			{
-				while(chip->clocks_left <= (INT32)(chip->pos >> FRAC_BITS))
-				{
-					chip->pos -= chip->clocks_left << FRAC_BITS;
-					chip->clocks_left = 0;
-					upd7759_slave_update(chip);
-				}
-				chip->clocks_left -= (chip->pos >> FRAC_BITS);
-				chip->pos &= FRAC_MASK;
+				chip->pos -= chip->clocks_left << FRAC_BITS;
+				chip->clocks_left = 0;
+				upd7759_slave_update(chip);
 			}
+			chip->clocks_left -= (chip->pos >> FRAC_BITS);
+			chip->pos &= FRAC_MASK;
 		}
+	}
 
 	/* if we got out early, just zap the rest of the buffer */
 	if (i < samples)
@@ -63,6 +63,7 @@ Registers:
 #include "../snddef.h"
 #include "../EmuHelper.h"
 #include "../logging.h"
+#include "../pcmmix.h"
 #include "x1_010.h"
 
 
@@ -205,6 +206,8 @@ static void seta_update(void *param, UINT32 samples, DEV_SMPL **outputs)
 	INT8    *start, *end, data;
 	UINT8   *env;
 	UINT32  smp_offs, smp_step, env_offs, env_step, delta;
+	UINT32  smp_end, count, blkLen;
+	INT32   smplBuf[PCMMIX_BLOCK];
 	DEV_SMPL *bufL = outputs[0];
 	DEV_SMPL *bufR = outputs[1];
 
@@ -236,18 +239,21 @@ static void seta_update(void *param, UINT32 samples, DEV_SMPL **outputs)
 					emu_logf(&info->logger, DEVLOG_TRACE, "Play sample %p - %p, channel %X volume %d:%d freq %X step %X offset %X\n",
 						start, end, ch, volL, volR, freq, smp_step, smp_offs );
 				}
-				for( i = 0; i < samples; i++ ) {
-					delta = smp_offs>>FREQ_BASE_BITS;
-					// sample ended?
-					if( start+delta >= end ) {
-						reg->status &= ~0x01;                   // Key off
-						break;
-					}
-					data = start[delta];
-					bufL[i] += (data*volL/256);
-					bufR[i] += (data*volR/256);
-					smp_offs += smp_step;
+				// number of samples until the sample ends
+				smp_end  = (end > start) ? (UINT32)(end - start) << FREQ_BASE_BITS : 0;
+				count    = PcmMix_StepsUntil(smp_offs, smp_step, smp_end);
+				if( count > samples )
+					count = samples;
+				for( i = 0; i < count; i += blkLen ) {
+					blkLen = count - i;
+					if( blkLen > PCMMIX_BLOCK )
+						blkLen = PCMMIX_BLOCK;
+					smp_offs = PcmMix_Fetch8(smplBuf, blkLen, (const UINT8 *)start, 0xFFFFFFFF,
+											smp_offs, smp_step, FREQ_BASE_BITS, 0x00);
+					PcmMix_AddStereoTrunc(smplBuf, blkLen, volL, volR, 8, &bufL[i], &bufR[i]);
 				}
+				if( count < samples )
+					reg->status &= ~0x01;                       // Key off
 				info->smp_offset[ch] = smp_offs;
 			} else {                                            // Wave form
 				start    = (INT8 *)&(info->reg[reg->volume*128+0x1000]);
@@ -266,16 +266,22 @@ typedef struct
  *   TL_RES_LEN - sinus resolution (X axis)
  */
 #define TL_TAB_LEN (13*2*TL_RES_LEN)
-static signed int tl_tab[TL_TAB_LEN];
 
 #define ENV_QUIET       (TL_TAB_LEN>>3)
 
-/* sin waveform table in 'decibel' scale */
-static unsigned int sin_tab[SIN_LEN];
+/* tl_tab:  Linear Power Table
+   sin_tab: sin waveform table in 'decibel' scale */
+#include "ym2151_tables.h"
 
 
 /* translate from D1L to volume index (16 D1L levels) */
-static UINT32 d1l_tab[16];
+/* every 3 'dB' except for all bits = 1 = 45+48 'dB' */
+#define SC(db) (UINT32) ( db * (4.0/ENV_STEP) )
+static const UINT32 d1l_tab[16] = {
+	SC( 0),SC( 1),SC( 2),SC( 3),SC( 4),SC( 5),SC( 6),SC( 7),
+	SC( 8),SC( 9),SC(10),SC(11),SC(12),SC(13),SC(14),SC(31)
+};
+#undef SC
 
 
 #define RATE_STEPS (8)
@@ -527,73 +533,6 @@ static const UINT8 lfo_noise_waveform[256] = {
 
 
 
-static UINT8 tablesInit = 0;
-
-static void init_tables(void)
-{
-	signed int i,x,n;
-	double o,m;
-
-	if (tablesInit)
-		return;
-	tablesInit = 1;
-
-	for (x=0; x<TL_RES_LEN; x++)
-	{
-		// note: this formula is broken in MAME 0.183
-		m = (1<<16) / pow(2, (x+1) * (ENV_STEP/4.0) / 8.0);
-		m = floor(m);
-
-		/* we never reach (1<<16) here due to the (x+1) */
-		/* result fits within 16 bits at maximum */
-
-		n = (int)m;     /* 16 bits here */
-		n >>= 4;        /* 12 bits here */
-		if (n&1)        /* round to closest */
-			n = (n>>1)+1;
-		else
-			n = n>>1;
-						/* 11 bits here (rounded) */
-		n <<= 2;        /* 13 bits here (as in real chip) */
-		tl_tab[ x*2 + 0 ] = n;
-		tl_tab[ x*2 + 1 ] = -tl_tab[ x*2 + 0 ];
-
-		for (i=1; i<13; i++)
-		{
-			tl_tab[ x*2+0 + i*2*TL_RES_LEN ] =  tl_tab[ x*2+0 ]>>i;
-			tl_tab[ x*2+1 + i*2*TL_RES_LEN ] = -tl_tab[ x*2+0 + i*2*TL_RES_LEN ];
-		}
-	}
-
-	for (i=0; i<SIN_LEN; i++)
-	{
-		/* non-standard sinus */
-		m = sin( ((i*2)+1) * M_PI / SIN_LEN ); /* verified on the real chip */
-
-		/* we never reach zero here due to ((i*2)+1) */
-
-		/* convert to 'decibels' */
-		o = 8*log(1.0/fabs(m))/log(2.0);
-
-		o = o / (ENV_STEP/4);
-
-		n = (int)(2.0*o);
-		if (n&1)                        /* round to closest */
-			n = (n>>1)+1;
-		else
-			n = n>>1;
-
-		sin_tab[ i ] = n*2 + (m>=0.0? 0: 1 );
-	}
-
-	/* calculate d1l_tab table */
-	for (i=0; i<16; i++)
-	{
-		d1l_tab[i] = (i!=15 ? i : i+16) * (4.0/ENV_STEP);   /* every 3 'dB' except for all bits = 1 = 45+48 'dB' */
-	}
-}
-
-
 static void init_chip_tables(YM2151 *chip)
 {
 	int i,j;
@@ -1233,7 +1172,6 @@ static void * ym2151_init(UINT32 clock, UINT32 rate)
 	PSG->irqhandler = NULL;
 	PSG->portwritehandler = NULL;
 
-	init_tables();
 	init_chip_tables(PSG);
 
 	PSG->tim_A      = 0;
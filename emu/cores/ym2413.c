@@ -432,14 +432,13 @@ static const UINT8 mul_tab[16] = {
 *   TL_RES_LEN - sinus resolution (X axis)
 */
 #define TL_TAB_LEN (11*2*TL_RES_LEN)
-static signed int tl_tab[TL_TAB_LEN];
 
 #define ENV_QUIET       (TL_TAB_LEN>>5)
 
-/* sin waveform table in 'decibel' scale */
-/* two waveforms on OPLL type chips */
-static unsigned int sin_tab[SIN_LEN * 2];
-
+/* tl_tab:  Linear Power Table
+   sin_tab: sin waveform table in 'decibel' scale,
+            two waveforms on OPLL type chips */
+#include "ym2413_tables.h"
 
 /* LFO Amplitude Modulation table (verified on real YM3812)
    27 output levels (triangle waveform); 1 level takes one of: 192, 256 or 448 samples
@@ -597,9 +596,6 @@ static unsigned char vrc7_instable[(16 + 3) * 8] =
 #define SLOT8_1 (&chip->P_CH[8].SLOT[SLOT1])
 #define SLOT8_2 (&chip->P_CH[8].SLOT[SLOT2])
 
-
-static UINT8 tablesInit = 0;
-
 /* advance LFO to next sample */
 INLINE void advance_lfo(YM2413 *chip)
 {
@@ -1115,75 +1111,6 @@ INLINE void rhythm_calc( YM2413 *chip, OPLL_CH *CH, unsigned int noise )
 }
 
 
-/* generic table initialize */
-static int init_tables(void)
-{
-	signed int i,x;
-	signed int n;
-	double o,m;
-
-	if (tablesInit)
-		return 1;
-	tablesInit = 1;
-
-	for (x=0; x<TL_RES_LEN; x++)
-	{
-		m = (1<<16) / pow(2, (x+1) * (ENV_STEP/4.0) / 8.0);
-		m = floor(m);
-
-		/* we never reach (1<<16) here due to the (x+1) */
-		/* result fits within 16 bits at maximum */
-
-		n = (int)m;     /* 16 bits here */
-		n >>= 4;        /* 12 bits here */
-		if (n&1)        /* round to nearest */
-			n = (n>>1)+1;
-		else
-			n = n>>1;
-						/* 11 bits here (rounded) */
-		tl_tab[ x*2 + 0 ] = n;
-		tl_tab[ x*2 + 1 ] = -tl_tab[ x*2 + 0 ];
-
-		for (i=1; i<11; i++)
-		{
-			tl_tab[ x*2+0 + i*2*TL_RES_LEN ] =  tl_tab[ x*2+0 ]>>i;
-			tl_tab[ x*2+1 + i*2*TL_RES_LEN ] = -tl_tab[ x*2+0 + i*2*TL_RES_LEN ];
-		}
-	}
-
-	for (i=0; i<SIN_LEN; i++)
-	{
-		/* non-standard sinus */
-		m = sin( ((i*2)+1) * M_PI / SIN_LEN ); /* checked against the real chip */
-
-		/* we never reach zero here due to ((i*2)+1) */
-
-		o = 8*log(1.0/fabs(m))/log(2.0);    /* convert to 'decibels' */
-
-		o = o / (ENV_STEP/4);
-
-		n = (int)(2.0*o);
-		if (n&1)                        /* round to nearest */
-			n = (n>>1)+1;
-		else
-			n = n>>1;
-
-		/* waveform 0: standard sinus  */
-		sin_tab[ i ] = n*2 + (m>=0.0? 0: 1 );
-
-		/* waveform 1:  __      __     */
-		/*             /  \____/  \____*/
-		/* output only first half of the sinus waveform (positive one) */
-		if (i & (1<<(SIN_BITS-1)) )
-			sin_tab[1*SIN_LEN+i] = TL_TAB_LEN;
-		else
-			sin_tab[1*SIN_LEN+i] = sin_tab[i];
-	}
-
-	return 1;
-}
-
-
 static void OPLL_initalize(YM2413 *chip)
 {
 	int i;
@@ -1779,9 +1706,6 @@ static YM2413 *OPLLCreate(UINT32 clock, UINT32 rate)
 {
 	YM2413 *chip;
 
-	if( !init_tables() )
-		return NULL;
-
 	/* allocate memory block */
 	chip = (YM2413 *)calloc(1, sizeof(YM2413));
 
@@ -0,0 +1,938 @@
+// Lookup tables for ymf262.c
+// generated by tables_gen.c - do not edit
+
+static const signed int tl_tab[TL_TAB_LEN] =
+{
+	4084, -4085, 4074, -4075, 4062, -4063, 4052, -4053, 4040, -4041, 4030, -4031, 4020, -4021, 4008, -4009,
+	3998, -3999, 3986, -3987, 3976, -3977, 3966, -3967, 3954, -3955, 3944, -3945, 3932, -3933, 3922, -3923,
+	3912, -3913, 3902, -3903, 3890, -3891, 3880, -3881, 3870, -3871, 3860, -3861, 3848, -3849, 3838, -3839,
+	3828, -3829, 3818, -3819, 3808, -3809, 3796, -3797, 3786, -3787, 3776, -3777, 3766, -3767, 3756, -3757,
+	3746, -3747, 3736, -3737, 3726, -3727, 3716, -3717, 3706, -3707, 3696, -3697, 3686, -3687, 3676, -3677,
+	3666, -3667, 3656, -3657, 3646, -3647, 3636, -3637, 3626, -3627, 3616, -3617, 3606, -3607, 3596, -3597,
+	3588, -3589, 3578, -3579, 3568, -3569, 3558, -3559, 3548, -3549, 3538, -3539, 3530, -3531, 3520, -3521,
+	3510, -3511, 3500, -3501, 3492, -3493, 3482, -3483, 3472, -3473, 3464, -3465, 3454, -3455, 3444, -3445,
+	3434, -3435, 3426, -3427, 3416, -3417, 3408, -3409, 3398, -3399, 3388, -3389, 3380, -3381, 3370, -3371,
+	3362, -3363, 3352, -3353, 3344, -3345, 3334, -3335, 3326, -3327, 3316, -3317, 3308, -3309, 3298, -3299,
+	3290, -3291, 3280, -3281, 3272, -3273, 3262, -3263, 3254, -3255, 3246, -3247, 3236, -3237, 3228, -3229,
+	3218, -3219, 3210, -3211, 3202, -3203, 3192, -3193, 3184, -3185, 3176, -3177, 3168, -3169, 3158, -3159,
+	3150, -3151, 3142, -3143, 3132, -3133, 3124, -3125, 3116, -3117, 3108, -3109, 3100, -3101, 3090, -3091,
+	3082, -3083, 3074, -3075, 3066, -3067, 3058, -3059, 3050, -3051, 3040, -3041, 3032, -3033, 3024, -3025,
+	3016, -3017, 3008, -3009, 3000, -3001, 2992, -2993, 2984, -2985, 2976, -2977, 2968, -2969, 2960, -2961,
+	2952, -2953, 2944, -2945, 2936, -2937, 2928, -2929, 2920, -2921, 2912, -2913, 2904, -2905, 2896, -2897,
+	2888, -2889, 2880, -2881, 2872, -2873, 2866, -2867, 2858, -2859, 2850, -2851, 2842, -2843, 2834, -2835,
+	2826, -2827, 2818, -2819, 2812, -2813, 2804, -2805, 2796, -2797, 2788, -2789, 2782, -2783, 2774, -2775,
+	2766, -2767, 2758, -2759, 2752, -2753, 2744, -2745, 2736, -2737, 2728, -2729, 2722, -2723, 2714, -2715,
+	2706, -2707, 2700, -2701, 2692, -2693, 2684, -2685, 2678, -2679, 2670, -2671, 2664, -2665, 2656, -2657,
+	2648, -2649, 2642, -2643, 2634, -2635, 2628, -2629, 2620, -2621, 2614, -2615, 2606, -2607, 2600, -2601,
+	2592, -2593, 2584, -2585, 2578, -2579, 2572, -2573, 2564, -2565, 2558, -2559, 2550, -2551, 2544, -2545,
+	2536, -2537, 2530, -2531, 2522, -2523, 2516, -2517, 2510, -2511, 2502, -2503, 2496, -2497, 2488, -2489,
+	2482, -2483, 2476, -2477, 2468, -2469, 2462, -2463, 2456, -2457, 2448, -2449, 2442, -2443, 2436, -2437,
+	2428, -2429, 2422, -2423, 2416, -2417, 2410, -2411, 2402, -2403, 2396, -2397, 2390, -2391, 2384, -2385,
+	2376, -2377, 2370, -2371, 2364, -2365, 2358, -2359, 2352, -2353, 2344, -2345, 2338, -2339, 2332, -2333,
+	2326, -2327, 2320, -2321, 2314, -2315, 2308, -2309, 2300, -2301, 2294, -2295, 2288, -2289, 2282, -2283,
+	2276, -2277, 2270, -2271, 2264, -2265, 2258, -2259, 2252, -2253, 2246, -2247, 2240, -2241, 2234, -2235,
+	2228, -2229, 2222, -2223, 2216, -2217, 2210, -2211, 2204, -2205, 2198, -2199, 2192, -2193, 2186, -2187,
+	2180, -2181, 2174, -2175, 2168, -2169, 2162, -2163, 2156, -2157, 2150, -2151, 2144, -2145, 2138, -2139,
+	2132, -2133, 2128, -2129, 2122, -2123, 2116, -2117, 2110, -2111, 2104, -2105, 2098, -2099, 2092, -2093,
+	2088, -2089, 2082, -2083, 2076, -2077, 2070, -2071, 2064, -2065, 2060, -2061, 2054, -2055, 2048, -2049,
+	2042, -2043, 2037, -2038, 2031, -2032, 2026, -2027, 2020, -2021, 2015, -2016, 2010, -2011, 2004, -2005,
+	1999, -2000, 1993, -1994, 1988, -1989, 1983, -1984, 1977, -1978, 1972, -1973, 1966, -1967, 1961, -1962,
+	1956, -1957, 1951, -1952, 1945, -1946, 1940, -1941, 1935, -1936, 1930, -1931, 1924, -1925, 1919, -1920,
+	1914, -1915, 1909, -1910, 1904, -1905, 1898, -1899, 1893, -1894, 1888, -1889, 1883, -1884, 1878, -1879,
+	1873, -1874, 1868, -1869, 1863, -1864, 1858, -1859, 1853, -1854, 1848, -1849, 1843, -1844, 1838, -1839,
+	1833, -1834, 1828, -1829, 1823, -1824, 1818, -1819, 1813, -1814, 1808, -1809, 1803, -1804, 1798, -1799,
+	1794, -1795, 1789, -1790, 1784, -1785, 1779, -1780, 1774, -1775, 1769, -1770, 1765, -1766, 1760, -1761,
+	1755, -1756, 1750, -1751, 1746, -1747, 1741, -1742, 1736, -1737, 1732, -1733, 1727, -1728, 1722, -1723,
+	1717, -1718, 1713, -1714, 1708, -1709, 1704, -1705, 1699, -1700, 1694, -1695, 1690, -1691, 1685, -1686,
+	1681, -1682, 1676, -1677, 1672, -1673, 1667, -1668, 1663, -1664, 1658, -1659, 1654, -1655, 1649, -1650,
+	1645, -1646, 1640, -1641, 1636, -1637, 1631, -1632, 1627, -1628, 1623, -1624, 1618, -1619, 1614, -1615,
+	1609, -1610, 1605, -1606, 1601, -1602, 1596, -1597, 1592, -1593, 1588, -1589, 1584, -1585, 1579, -1580,
+	1575, -1576, 1571, -1572, 1566, -1567, 1562, -1563, 1558, -1559, 1554, -1555, 1550, -1551, 1545, -1546,
+	1541, -1542, 1537, -1538, 1533, -1534, 1529, -1530, 1525, -1526, 1520, -1521, 1516, -1517, 1512, -1513,
+	1508, -1509, 1504, -1505, 1500, -1501, 1496, -1497, 1492, -1493, 1488, -1489, 1484, -1485, 1480, -1481,
+	1476, -1477, 1472, -1473, 1468, -1469, 1464, -1465, 1460, -1461, 1456, -1457, 1452, -1453, 1448, -1449,
+	1444, -1445, 1440, -1441, 1436, -1437, 1433, -1434, 1429, -1430, 1425, -1426, 1421, -1422, 1417, -1418,
+	1413, -1414, 1409, -1410, 1406, -1407, 1402, -1403, 1398, -1399, 1394, -1395, 1391, -1392, 1387, -1388,
+	1383, -1384, 1379, -1380, 1376, -1377, 1372, -1373, 1368, -1369, 1364, -1365, 1361, -1362, 1357, -1358,
+	1353, -1354, 1350, -1351, 1346, -1347, 1342, -1343, 1339, -1340, 1335, -1336, 1332, -1333, 1328, -1329,
+	1324, -1325, 1321, -1322, 1317, -1318, 1314, -1315, 1310, -1311, 1307, -1308, 1303, -1304, 1300, -1301,
+	1296, -1297, 1292, -1293, 1289, -1290, 1286, -1287, 1282, -1283, 1279, -1280, 1275, -1276, 1272, -1273,
+	1268, -1269, 1265, -1266, 1261, -1262, 1258, -1259, 1255, -1256, 1251, -1252, 1248, -1249, 1244, -1245,
+	1241, -1242, 1238, -1239, 1234, -1235, 1231, -1232, 1228, -1229, 1224, -1225, 1221, -1222, 1218, -1219,
+	1214, -1215, 1211, -1212, 1208, -1209, 1205, -1206, 1201, -1202, 1198, -1199, 1195, -1196, 1192, -1193,
+	1188, -1189, 1185, -1186, 1182, -1183, 1179, -1180, 1176, -1177, 1172, -1173, 1169, -1170, 1166, -1167,
+	1163, -1164, 1160, -1161, 1157, -1158, 1154, -1155, 1150, -1151, 1147, -1148, 1144, -1145, 1141, -1142,
+	1138, -1139, 1135, -1136, 1132, -1133, 1129, -1130, 1126, -1127, 1123, -1124, 1120, -1121, 1117, -1118,
+	1114, -1115, 1111, -1112, 1108, -1109, 1105, -1106, 1102, -1103, 1099, -1100, 1096, -1097, 1093, -1094,
+	1090, -1091, 1087, -1088, 1084, -1085, 1081, -1082, 1078, -1079, 1075, -1076, 1072, -1073, 1069, -1070,
+	1066, -1067, 1064, -1065, 1061, -1062, 1058, -1059, 1055, -1056, 1052, -1053, 1049, -1050, 1046, -1047,
+	1044, -1045, 1041, -1042, 1038, -1039, 1035, -1036, 1032, -1033, 1030, -1031, 1027, -1028, 1024, -1025,
+	1021, -1022, 1018, -1019, 1015, -1016, 1013, -1014, 1010, -1011, 1007, -1008, 1005, -1006, 1002, -1003,
+	999, -1000, 996, -997, 994, -995, 991, -992, 988, -989, 986, -987, 983, -984, 980, -981,
+	978, -979, 975, -976, 972, -973, 970, -971, 967, -968, 965, -966, 962, -963, 959, -960,
+	957, -958, 954, -955, 952, -953, 949, -950, 946, -947, 944, -945, 941, -942, 939, -940,
+	936, -937, 934, -935, 931, -932, 929, -930, 926, -927, 924, -925, 921, -922, 919, -920,
+	916, -917, 914, -915, 911, -912, 909, -910, 906, -907, 904, -905, 901, -902, 899, -900,
+	897, -898, 894, -895, 892, -893, 889, -890, 887, -888, 884, -885, 882, -883, 880, -881,
+	877, -878, 875, -876, 873, -874, 870, -871, 868, -869, 866, -867, 863, -864, 861, -862,
+	858, -859, 856, -857, 854, -855, 852, -853, 849, -850, 847, -848, 845, -846, 842, -843,
+	840, -841, 838, -839, 836, -837, 833, -834, 831, -832, 829, -830, 827, -828, 824, -825,
+	822, -823, 820, -821, 818, -819, 815, -816, 813, -814, 811, -812, 809, -810, 807, -808,
+	804, -805, 802, -803, 800, -801, 798, -799, 796, -797, 794, -795, 792, -793, 789, -790,
+	787, -788, 785, -786, 783, -784, 781, -782, 779, -780, 777, -778, 775, -776, 772, -773,
+	770, -771, 768, -769, 766, -767, 764, -765, 762, -763, 760, -761, 758, -759, 756, -757,
+	754, -755, 752, -753, 750, -751, 748, -749, 746, -747, 744, -745, 742, -743, 740, -741,
+	738, -739, 736, -737, 734, -735, 732, -733, 730, -731, 728, -729, 726, -727, 724, -725,
+	722, -723, 720, -721, 718, -719, 716, -717, 714, -715, 712, -713, 710, -711, 708, -709,
+	706, -707, 704, -705, 703, -704, 701, -702, 699, -700, 697, -698, 695, -696, 693, -694,
+	691, -692, 689, -690, 688, -689, 686, -687, 684, -685, 682, -683, 680, -681, 678, -679,
+	676, -677, 675, -676, 673, -674, 671, -672, 669, -670, 667, -668, 666, -667, 664, -665,
+	662, -663, 660, -661, 658, -659, 657, -658, 655, -656, 653, -654, 651, -652, 650, -651,
+	648, -649, 646, -647, 644, -645, 643, -644, 641, -642, 639, -640, 637, -638, 636, -637,
+	634, -635, 632, -633, 630, -631, 629, -630, 627, -628, 625, -626, 624, -625, 622, -623,
+	620, -621, 619, -620, 617, -618, 615, -616, 614, -615, 612, -613, 610, -611, 609, -610,
+	607, -608, 605, -606, 604, -605, 602, -603, 600, -601, 599, -600, 597, -598, 596, -597,
+	594, -595, 592, -593, 591, -592, 589, -590, 588, -589, 586, -587, 584, -585, 583, -584,
+	581, -582, 580, -581, 578, -579, 577, -578, 575, -576, 573, -574, 572, -573, 570, -571,
+	569, -570, 567, -568, 566, -567, 564, -565, 563, -564, 561, -562, 560, -561, 558, -559,
+	557, -558, 555, -556, 554, -555, 552, -553, 551, -552, 549, -550, 548, -549, 546, -547,
+	545, -546, 543, -544, 542, -543, 540, -541, 539, -540, 537, -538, 536, -537, 534, -535,
+	533, -534, 532, -533, 530, -531, 529, -530, 527, -528, 526, -527, 524, -525, 523, -524,
+	522, -523, 520, -521, 519, -520, 517, -518, 516, -517, 515, -516, 513, -514, 512, -513,
+	510, -511, 509, -510, 507, -508, 506, -507, 505, -506, 503, -504, 502, -503, 501, -502,
+	499, -500, 498, -499, 497, -498, 495, -496, 494, -495, 493, -494, 491, -492, 490, -491,
+	489, -490, 487, -488, 486, -487, 485, -486, 483, -484, 482, -483, 481, -482, 479, -480,
+	478, -479, 477, -478, 476, -477, 474, -475, 473, -474, 472, -473, 470, -471, 469, -470,
+	468, -469, 467, -468, 465, -466, 464, -465, 463, -464, 462, -463, 460, -461, 459, -460,
+	458, -459, 457, -458, 455, -456, 454, -455, 453, -454, 452, -453, 450, -451, 449, -450,
+	448, -449, 447, -448, 446, -447, 444, -445, 443, -444, 442, -443, 441, -442, 440, -441,
+	438, -439, 437, -438, 436, -437, 435, -436, 434, -435, 433, -434, 431, -432, 430, -431,
+	429, -430, 428, -429, 427, -428, 426, -427, 424, -425, 423, -424, 422, -423, 421, -422,
+	420, -421, 419, -420, 418, -419, 416, -417, 415, -416, 414, -415, 413, -414, 412, -413,
+	411, -412, 410, -411, 409, -410, 407, -408, 406, -407, 405, -406, 404, -405, 403, -404,
+	402, -403, 401, -402, 400, -401, 399, -400, 398, -399, 397, -398, 396, -397, 394, -395,
+	393, -394, 392, -393, 391, -392, 390, -391, 389, -390, 388, -389, 387, -388, 386, -387,
+	385, -386, 384, -385, 383, -384, 382, -383, 381, -382, 380, -381, 379, -380, 378, -379,
+	377, -378, 376, -377, 375, -376, 374, -375, 373, -374, 372, -373, 371, -372, 370, -371,
+	369, -370, 368, -369, 367, -368, 366, -367, 365, -366, 364, -365, 363, -364, 362, -363,
+	361, -362, 360, -361, 359, -360, 358, -359, 357, -358, 356, -357, 355, -356, 354, -355,
+	353, -354, 352, -353, 351, -352, 350, -351, 349, -350, 348, -349, 347, -348, 346, -347,
+	345, -346, 344, -345, 344, -345, 343, -344, 342, -343, 341, -342, 340, -341, 339, -340,
+	338, -339, 337, -338, 336, -337, 335, -336, 334, -335, 333, -334, 333, -334, 332, -333,
+	331, -332, 330, -331, 329, -330, 328, -329, 327, -328, 326, -327, 325, -326, 325, -326,
+	324, -325, 323, -324, 322, -323, 321, -322, 320, -321, 319, -320, 318, -319, 318, -319,
+	317, -318, 316, -317, 315, -316, 314, -315, 313, -314, 312, -313, 312, -313, 311, -312,
+	310, -311, 309, -310, 308, -309, 307, -308, 307, -308, 306, -307, 305, -306, 304, -305,
+	303, -304, 302, -303, 302, -303, 301, -302, 300, -301, 299, -300, 298, -299, 298, -299,
+	297, -298, 296, -297, 295, -296, 294, -295, 294, -295, 293, -294, 292, -293, 291, -292,
+	290, -291, 290, -291, 289, -290, 288, -289, 287, -288, 286, -287, 286, -287, 285, -286,
+	284, -285, 283, -284, 283, -284, 282, -283, 281, -282, 280, -281, 280, -281, 279, -280,
+	278, -279, 277, -278, 277, -278, 276, -277, 275, -276, 274, -275, 274, -275, 273, -274,
+	272, -273, 271, -272, 271, -272, 270, -271, 269, -270, 268, -269, 268, -269, 267, -268,
+	266, -267, 266, -267, 265, -266, 264, -265, 263, -264, 263, -264, 262, -263, 261, -262,
+	261, -262, 260, -261, 259, -260, 258, -259, 258, -259, 257, -258, 256, -257, 256, -257,
+	255, -256, 254, -255, 253, -254, 253, -254, 252, -253, 251, -252, 251, -252, 250, -251,
+	249, -250, 249, -250, 248, -249, 247, -248, 247, -248, 246, -247, 245, -246, 245, -246,
+	244, -245, 243, -244, 243, -244, 242, -243, 241, -242, 241, -242, 240, -241, 239, -240,
+	239, -240, 238, -239, 238, -239, 237, -238, 236, -237, 236, -237, 235, -236, 234, -235,
+	234, -235, 233, -234, 232, -233, 232, -233, 231, -232, 231, -232, 230, -231, 229, -230,
+	229, -230, 228, -229, 227, -228, 227, -228, 226, -227, 226, -227, 225, -226, 224, -225,
+	224, -225, 223, -224, 223, -224, 222, -223, 221, -222, 221, -222, 220, -221, 220, -221,
+	219, -220, 218, -219, 218, -219, 217, -218, 217, -218, 216, -217, 215, -216, 215, -216,
+	214, -215, 214, -215, 213, -214, 213, -214, 212, -213, 211, -212, 211, -212, 210, -211,
+	210, -211, 209, -210, 209, -210, 208, -209, 207, -208, 207, -208, 206, -207, 206, -207,
+	205, -206, 205, -206, 204, -205, 203, -204, 203, -204, 202, -203, 202, -203, 201, -202,
+	201, -202, 200, -201, 200, -201, 199, -200, 199, -200, 198, -199, 198, -199, 197, -198,
+	196, -197, 196, -197, 195, -196, 195, -196, 194, -195, 194, -195, 193, -194, 193, -194,
+	192, -193, 192, -193, 191, -192, 191, -192, 190, -191, 190, -191, 189, -190, 189, -190,
+	188, -189, 188, -189, 187, -188, 187, -188, 186, -187, 186, -187, 185, -186, 185, -186,
+	184, -185, 184, -185, 183, -184, 183, -184, 182, -183, 182, -183, 181, -182, 181, -182,
+	180, -181, 180, -181, 179, -180, 179, -180, 178, -179, 178, -179, 177, -178, 177, -178,
+	176, -177, 176, -177, 175, -176, 175, -176, 174, -175, 174, -175, 173, -174, 173, -174,
+	172, -173, 172, -173, 172, -173, 171, -172, 171, -172, 170, -171, 170, -171, 169, -170,
+	169, -170, 168, -169, 168, -169, 167, -168, 167, -168, 166, -167, 166, -167, 166, -167,
+	165, -166, 165, -166, 164, -165, 164, -165, 163, -164, 163, -164, 162, -163, 162, -163,
+	162, -163, 161, -162, 161, -162, 160, -161, 160, -161, 159, -160, 159, -160, 159, -160,
+	158, -159, 158, -159, 157, -158, 157, -158, 156, -157, 156, -157, 156, -157, 155, -156,
+	155, -156, 154, -155, 154, -155, 153, -154, 153, -154, 153, -154, 152, -153, 152, -153,
+	151, -152, 151, -152, 151, -152, 150, -151, 150, -151, 149, -150, 149, -150, 149, -150,
+	148, -149, 148, -149, 147, -148, 147, -148, 147, -148, 146, -147, 146, -147, 145, -146,
+	145, -146, 145, -146, 144, -145, 144, -145, 143, -144, 143, -144, 143, -144, 142, -143,
+	142, -143, 141, -142, 141, -142, 141, -142, 140, -141, 140, -141, 140, -141, 139, -140,
+	139, -140, 138, -139, 138, -139, 138, -139, 137, -138, 137, -138, 137, -138, 136, -137,
+	136, -137, 135, -136, 135, -136, 135, -136, 134, -135, 134, -135, 134, -135, 133, -134,
+	133, -134, 133, -134, 132, -133, 132, -133, 131, -132, 131, -132, 131, -132, 130, -131,
+	130, -131, 130, -131, 129, -130, 129, -130, 129, -130, 128, -129, 128, -129, 128, -129,
+	127, -128, 127, -128, 126, -127, 126, -127, 126, -127, 125, -126, 125, -126, 125, -126,
+	124, -125, 124, -125, 124, -125, 123, -124, 123, -124, 123, -124, 122, -123, 122, -123,
+	122, -123, 121, -122, 121, -122, 121, -122, 120, -121, 120, -121, 120, -121, 119, -120,
+	119, -120, 119, -120, 119, -120, 118, -119, 118, -119, 118, -119, 117, -118, 117, -118,
+	117, -118, 116, -117, 116, -117, 116, -117, 115, -116, 115, -116, 115, -116, 114, -115,
+	114, -115, 114, -115, 113, -114, 113, -114, 113, -114, 113, -114, 112, -113, 112, -113,
+	112, -113, 111, -112, 111, -112, 111, -112, 110, -111, 110, -111, 110, -111, 110, -111,
+	109, -110, 109, -110, 109, -110, 108, -109, 108, -109, 108, -109, 107, -108, 107, -108,
+	107, -108, 107, -108, 106, -107, 106, -107, 106, -107, 105, -106, 105, -106, 105, -106,
+	105, -106, 104, -105, 104, -105, 104, -105, 103, -104, 103, -104, 103, -104, 103, -104,
+	102, -103, 102, -103, 102, -103, 101, -102, 101, -102, 101, -102, 101, -102, 100, -101,
+	100, -101, 100, -101, 100, -101, 99, -100, 99, -100, 99, -100, 99, -100, 98, -99,
+	98, -99, 98, -99, 97, -98, 97, -98, 97, -98, 97, -98, 96, -97, 96, -97,
+	96, -97, 96, -97, 95, -96, 95, -96, 95, -96, 95, -96, 94, -95, 94, -95,
+	94, -95, 94, -95, 93, -94, 93, -94, 93, -94, 93, -94, 92, -93, 92, -93,
+	92, -93, 92, -93, 91, -92, 91, -92, 91, -92, 91, -92, 90, -91, 90, -91,
+	90, -91, 90, -91, 89, -90, 89, -90, 89, -90, 89, -90, 88, -89, 88, -89,
+	88, -89, 88, -89, 87, -88, 87, -88, 87, -88, 87, -88, 86, -87, 86, -87,
+	86, -87, 86, -87, 86, -87, 85, -86, 85, -86, 85, -86, 85, -86, 84, -85,
+	84, -85, 84, -85, 84, -85, 83, -84, 83, -84, 83, -84, 83, -84, 83, -84,
+	82, -83, 82, -83, 82, -83, 82, -83, 81, -82, 81, -82, 81, -82, 81, -82,
+	81, -82, 80, -81, 80, -81, 80, -81, 80, -81, 79, -80, 79, -80, 79, -80,
+	79, -80, 79, -80, 78, -79, 78, -79, 78, -79, 78, -79, 78, -79, 77, -78,
+	77, -78, 77, -78, 77, -78, 76, -77, 76, -77, 76, -77, 76, -77, 76, -77,
+	75, -76, 75, -76, 75, -76, 75, -76, 75, -76, 74, -75, 74, -75, 74, -75,
+	74, -75, 74, -75, 73, -74, 73, -74, 73, -74, 73, -74, 73, -74, 72, -73,
+	72, -73, 72, -73, 72, -73, 72, -73, 71, -72, 71, -72, 71, -72, 71, -72,
+	71, -72, 70, -71, 70, -71, 70, -71, 70, -71, 70, -71, 70, -71, 69, -70,
+	69, -70, 69, -70, 69, -70, 69, -70, 68, -69, 68, -69, 68, -69, 68, -69,
+	68, -69, 67, -68, 67, -68, 67, -68, 67, -68, 67, -68, 67, -68, 66, -67,
+	66, -67, 66, -67, 66, -67, 66, -67, 65, -66, 65, -66, 65, -66, 65, -66,
+	65, -66, 65, -66, 64, -65, 64, -65, 64, -65, 64, -65, 64, -65, 64, -65,
+	63, -64, 63, -64, 63, -64, 63, -64, 63, -64, 62, -63, 62, -63, 62, -63,
+	62, -63, 62, -63, 62, -63, 61, -62, 61, -62, 61, -62, 61, -62, 61, -62,
+	61, -62, 60, -61, 60, -61, 60, -61, 60, -61, 60, -61, 60, -61, 59, -60,
+	59, -60, 59, -60, 59, -60, 59, -60, 59, -60, 59, -60, 58, -59, 58, -59,
+	58, -59, 58, -59, 58, -59, 58, -59, 57, -58, 57, -58, 57, -58, 57, -58,
+	57, -58, 57, -58, 56, -57, 56, -57, 56, -57, 56, -57, 56, -57, 56, -57,
+	56, -57, 55, -56, 55, -56, 55, -56, 55, -56, 55, -56, 55, -56, 55, -56,
+	54, -55, 54, -55, 54, -55, 54, -55, 54, -55, 54, -55, 53, -54, 53, -54,
+	53, -54, 53, -54, 53, -54, 53, -54, 53, -54, 52, -53, 52, -53, 52, -53,
+	52, -53, 52, -53, 52, -53, 52, -53, 51, -52, 51, -52, 51, -52, 51, -52,
+	51, -52, 51, -52, 51, -52, 50, -51, 50, -51, 50, -51, 50, -51, 50, -51,
+	50, -51, 50, -51, 50, -51, 49, -50, 49, -50, 49, -50, 49, -50, 49, -50,
+	49, -50, 49, -50, 48, -49, 48, -49, 48, -49, 48, -49, 48, -49, 48, -49,
+	48, -49, 48, -49, 47, -48, 47, -48, 47, -48, 47, -48, 47, -48, 47, -48,
+	47, -48, 47, -48, 46, -47, 46, -47, 46, -47, 46, -47, 46, -47, 46, -47,
+	46, -47, 46, -47, 45, -46, 45, -46, 45, -46, 45, -46, 45, -46, 45, -46,
+	45, -46, 45, -46, 44, -45, 44, -45, 44, -45, 44, -45, 44, -45, 44, -45,
+	44, -45, 44, -45, 43, -44, 43, -44, 43, -44, 43, -44, 43, -44, 43, -44,
+	43, -44, 43, -44, 43, -44, 42, -43, 42, -43, 42, -43, 42, -43, 42, -43,
+	42, -43, 42, -43, 42, -43, 41, -42, 41, -42, 41, -42, 41, -42, 41, -42,
+	41, -42, 41, -42, 41, -42, 41, -42, 40, -41, 40, -41, 40, -41, 40, -41,
+	40, -41, 40, -41, 40, -41, 40, -41, 40, -41, 39, -40, 39, -40, 39, -40,
+	39, -40, 39, -40, 39, -40, 39, -40, 39, -40, 39, -40, 39, -40, 38, -39,
+	38, -39, 38, -39, 38, -39, 38, -39, 38, -39, 38, -39, 38, -39, 38, -39,
+	37, -38, 37, -38, 37, -38, 37, -38, 37, -38, 37, -38, 37, -38, 37, -38,
+	37, -38, 37, -38, 36, -37, 36, -37, 36, -37, 36, -37, 36, -37, 36, -37,
+	36, -37, 36, -37, 36, -37, 36, -37, 35, -36, 35, -36, 35, -36, 35, -36,
+	35, -36, 35, -36, 35, -36, 35, -36, 35, -36, 35, -36, 35, -36, 34, -35,
+	34, -35, 34, -35, 34, -35, 34, -35, 34, -35, 34, -35, 34, -35, 34, -35,
+	34, -35, 33, -34, 33, -34, 33, -34, 33, -34, 33, -34, 33, -34, 33, -34,
+	33, -34, 33, -34, 33, -34, 33, -34, 32, -33, 32, -33, 32, -33, 32, -33,
+	32, -33, 32, -33, 32, -33, 32, -33, 32, -33, 32, -33, 32, -33, 32, -33,
+	31, -32, 31, -32, 31, -32, 31, -32, 31, -32, 31, -32, 31, -32, 31, -32,
+	31, -32, 31, -32, 31, -32, 30, -31, 30, -31, 30, -31, 30, -31, 30, -31,
+	30, -31, 30, -31, 30, -31, 30, -31, 30, -31, 30, -31, 30, -31, 29, -30,
+	29, -30, 29, -30, 29, -30, 29, -30, 29, -30, 29, -30, 29, -30, 29, -30,
+	29, -30, 29, -30, 29, -30, 29, -30, 28, -29, 28, -29, 28, -29, 28, -29,
+	28, -29, 28, -29, 28, -29, 28, -29, 28, -29, 28, -29, 28, -29, 28, -29,
+	28, -29, 27, -28, 27, -28, 27, -28, 27, -28, 27, -28, 27, -28, 27, -28,
+	27, -28, 27, -28, 27, -28, 27, -28, 27, -28, 27, -28, 26, -27, 26, -27,
+	26, -27, 26, -27, 26, -27, 26, -27, 26, -27, 26, -27, 26, -27, 26, -27,
+	26, -27, 26, -27, 26, -27, 26, -27, 25, -26, 25, -26, 25, -26, 25, -26,
+	25, -26, 25, -26, 25, -26, 25, -26, 25, -26, 25, -26, 25, -26, 25, -26,
+	25, -26, 25, -26, 25, -26, 24, -25, 24, -25, 24, -25, 24, -25, 24, -25,
+	24, -25, 24, -25, 24, -25, 24, -25, 24, -25, 24, -25, 24, -25, 24, -25,
+	24, -25, 24, -25, 23, -24, 23, -24, 23, -24, 23, -24, 23, -24, 23, -24,
+	23, -24, 23, -24, 23, -24, 23, -24, 23, -24, 23, -24, 23, -24, 23, -24,
+	23, -24, 23, -24, 22, -23, 22, -23, 22, -23, 22, -23, 22, -23, 22, -23,
+	22, -23, 22, -23, 22, -23, 22, -23, 22, -23, 22, -23, 22, -23, 22, -23,
+	22, -23, 22, -23, 21, -22, 21, -22, 21, -22, 21, -22, 21, -22, 21, -22,
+	21, -22, 21, -22, 21, -22, 21, -22, 21, -22, 21, -22, 21, -22, 21, -22,
+	21, -22, 21, -22, 21, -22, 20, -21, 20, -21, 20, -21, 20, -21, 20, -21,
+	20, -21, 20, -21, 20, -21, 20, -21, 20, -21, 20, -21, 20, -21, 20, -21,
+	20, -21, 20, -21, 20, -21, 20, -21, 20, -21, 19, -20, 19, -20, 19, -20,
+	19, -20, 19, -20, 19, -20, 19, -20, 19, -20, 19, -20, 19, -20, 19, -20,
+	19, -20, 19, -20, 19, -20, 19, -20, 19, -20, 19, -20, 19, -20, 19, -20,
+	18, -19, 18, -19, 18, -19, 18, -19, 18, -19, 18, -19, 18, -19, 18, -19,
+	18, -19, 18, -19, 18, -19, 18, -19, 18, -19, 18, -19, 18, -19, 18, -19,
+	18, -19, 18, -19, 18, -19, 18, -19, 17, -18, 17, -18, 17, -18, 17, -18,
+	17, -18, 17, -18, 17, -18, 17, -18, 17, -18, 17, -18, 17, -18, 17, -18,
+	17, -18, 17, -18, 17, -18, 17, -18, 17, -18, 17, -18, 17, -18, 17, -18,
+	17, -18, 16, -17, 16, -17, 16, -17, 16, -17, 16, -17, 16, -17, 16, -17,
+	16, -17, 16, -17, 16, -17, 16, -17, 16, -17, 16, -17, 16, -17, 16, -17,
+	16, -17, 16, -17, 16, -17, 16, -17, 16, -17, 16, -17, 16, -17, 16, -17,
+	15, -16, 15, -16, 15, -16, 15, -16, 15, -16, 15, -16, 15, -16, 15, -16,
+	15, -16, 15, -16, 15, -16, 15, -16, 15, -16, 15, -16, 15, -16, 15, -16,
+	15, -16, 15, -16, 15, -16, 15, -16, 15, -16, 15, -16, 15, -16, 14, -15,
+	14, -15, 14, -15, 14, -15, 14, -15, 14, -15, 14, -15, 14, -15, 14, -15,
+	14, -15, 14, -15, 14, -15, 14, -15, 14, -15, 14, -15, 14, -15, 14, -15,
+	14, -15, 14, -15, 14, -15, 14, -15, 14, -15, 14, -15, 14, -15, 14, -15,
+	14, -15, 13, -14, 13, -14, 13, -14, 13, -14, 13, -14, 13, -14, 13, -14,
+	13, -14, 13, -14, 13, -14, 13, -14, 13, -14, 13, -14, 13, -14, 13, -14,
+	13, -14, 13, -14, 13, -14, 13, -14, 13, -14, 13, -14, 13, -14, 13, -14,
+	13, -14, 13, -14, 13, -14, 13, -14, 12, -13, 12, -13, 12, -13, 12, -13,
+	12, -13, 12, -13, 12, -13, 12, -13, 12, -13, 12, -13, 12, -13, 12, -13,
+	12, -13, 12, -13, 12, -13, 12, -13, 12, -13, 12, -13, 12, -13, 12, -13,
+	12, -13, 12, -13, 12, -13, 12, -13, 12, -13, 12, -13, 12, -13, 12, -13,
+	12, -13, 12, -13, 11, -12, 11, -12, 11, -12, 11, -12, 11, -12, 11, -12,
+	11, -12, 11, -12, 11, -12, 11, -12, 11, -12, 11, -12, 11, -12, 11, -12,
+	11, -12, 11, -12, 11, -12, 11, -12, 11, -12, 11, -12, 11, -12, 11, -12,
+	11, -12, 11, -12, 11, -12, 11, -12, 11, -12, 11, -12, 11, -12, 11, -12,
+	11, -12, 11, -12, 10, -11, 10, -11, 10, -11, 10, -11, 10, -11, 10, -11,
+	10, -11, 10, -11, 10, -11, 10, -11, 10, -11, 10, -11, 10, -11, 10, -11,
+	10, -11, 10, -11, 10, -11, 10, -11, 10, -11, 10, -11, 10, -11, 10, -11,
+	10, -11, 10, -11, 10, -11, 10, -11, 10, -11, 10, -11, 10, -11, 10, -11,
+	10, -11, 10, -11, 10, -11, 10, -11, 10, -11, 9, -10, 9, -10, 9, -10,
+	9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10,
+	9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10,
+	9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10,
+	9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10, 9, -10,
+	9, -10, 9, -10, 9, -10, 9, -10, 8, -9, 8, -9, 8, -9, 8, -9,
+	8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9,
+	8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9,
+	8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9,
+	8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9,
+	8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9, 8, -9,
+	7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8,
+	7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8,
+	7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8,
+	7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8,
+	7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8,
+	7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8, 7, -8,
+	7, -8, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7,
+	6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7,
+	6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7,
+	6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7,
+	6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7,
+	6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7,
+	6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7, 6, -7,
+	6, -7, 6, -7, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6,
+	5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6,
+	5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6,
+	5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6,
+	5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6,
+	5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6,
+	5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6,
+	5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 5, -6,
+	5, -6, 5, -6, 5, -6, 5, -6, 5, -6, 4, -5, 4, -5, 4, -5,
+	4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5,
+	4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5,
+	4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5,
+	4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5,
+	4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5,
+	4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5,
+	4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5,
+	4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5,
+	4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5,
+	4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5, 4, -5,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4, 3, -4,
+	3, -4, 3, -4, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3, 2, -3,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2, 1, -2,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+	0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1
+};
+
+static const unsigned int sin_tab[SIN_LEN * 8] =
+{
+	4274, 3462, 3086, 2838, 2652, 2504, 2380, 2274, 2182, 2100, 2026, 1958, 1898, 1840, 1788, 1738,
+	1692, 1650, 1608, 1570, 1534, 1498, 1464, 1434, 1402, 1374, 1344, 1318, 1292, 1266, 1242, 1218,
+	1196, 1174, 1152, 1132, 1112, 1092, 1072, 1054, 1036, 1018, 1002, 984, 968, 952, 936, 922,
+	906, 892, 878, 864, 850, 836, 822, 810, 798, 784, 772, 760, 750, 738, 726, 716,
+	704, 694, 682, 672, 662, 652, 642, 632, 622, 614, 604, 594, 586, 578, 568, 560,
+	552, 542, 534, 526, 518, 510, 502, 496, 488, 480, 472, 466, 458, 452, 444, 438,
+	430, 424, 418, 410, 404, 398, 392, 386, 380, 374, 368, 362, 356, 350, 344, 338,
+	334, 328, 322, 318, 312, 306, 302, 296, 292, 286, 282, 276, 272, 268, 262, 258,
+	254, 250, 244, 240, 236, 232, 228, 224, 220, 216, 212, 208, 204, 200, 196, 192,
+	188, 184, 182, 178, 174, 170, 166, 164, 160, 156, 154, 150, 148, 144, 140, 138,
+	134, 132, 128, 126, 124, 120, 118, 114, 112, 110, 106, 104, 102, 98, 96, 94,
+	92, 90, 86, 84, 82, 80, 78, 76, 74, 72, 70, 68, 66, 64, 62, 60,
+	58, 56, 54, 52, 50, 48, 46, 46, 44, 42, 40, 40, 38, 36, 34, 34,
+	32, 30, 30, 28, 26, 26, 24, 24, 22, 20, 20, 18, 18, 16, 16, 14,
+	14, 14, 12, 12, 10, 10, 10, 8, 8, 8, 6, 6, 6, 4, 4, 4,
+	4, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 4,
+	4, 4, 4, 6, 6, 6, 8, 8, 8, 10, 10, 10, 12, 12, 14, 14,
+	14, 16, 16, 18, 18, 20, 20, 22, 24, 24, 26, 26, 28, 30, 30, 32,
+	34, 34, 36, 38, 40, 40, 42, 44, 46, 46, 48, 50, 52, 54, 56, 58,
+	60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 90, 92,
+	94, 96, 98, 102, 104, 106, 110, 112, 114, 118, 120, 124, 126, 128, 132, 134,
+	138, 140, 144, 148, 150, 154, 156, 160, 164, 166, 170, 174, 178, 182, 184, 188,
+	192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 250, 254,
+	258, 262, 268, 272, 276, 282, 286, 292, 296, 302, 306, 312, 318, 322, 328, 334,
+	338, 344, 350, 356, 362, 368, 374, 380, 386, 392, 398, 404, 410, 418, 424, 430,
+	438, 444, 452, 458, 466, 472, 480, 488, 496, 502, 510, 518, 526, 534, 542, 552,
+	560, 568, 578, 586, 594, 604, 614, 622, 632, 642, 652, 662, 672, 682, 694, 704,
+	716, 726, 738, 750, 760, 772, 784, 798, 810, 822, 836, 850, 864, 878, 892, 906,
+	922, 936, 952, 968, 984, 1002, 1018, 1036, 1054, 1072, 1092, 1112, 1132, 1152, 1174, 1196,
+	1218, 1242, 1266, 1292, 1318, 1344, 1374, 1402, 1434, 1464, 1498, 1534, 1570, 1608, 1650, 1692,
+	1738, 1788, 1840, 1898, 1958, 2026, 2100, 2182, 2274, 2380, 2504, 2652, 2838, 3086, 3462, 4274,
+	4275, 3463, 3087, 2839, 2653, 2505, 2381, 2275, 2183, 2101, 2027, 1959, 1899, 1841, 1789, 1739,
+	1693, 1651, 1609, 1571, 1535, 1499, 1465, 1435, 1403, 1375, 1345, 1319, 1293, 1267, 1243, 1219,
+	1197, 1175, 1153, 1133, 1113, 1093, 1073, 1055, 1037, 1019, 1003, 985, 969, 953, 937, 923,
+	907, 893, 879, 865, 851, 837, 823, 811, 799, 785, 773, 761, 751, 739, 727, 717,
+	705, 695, 683, 673, 663, 653, 643, 633, 623, 615, 605, 595, 587, 579, 569, 561,
+	553, 543, 535, 527, 519, 511, 503, 497, 489, 481, 473, 467, 459, 453, 445, 439,
+	431, 425, 419, 411, 405, 399, 393, 387, 381, 375, 369, 363, 357, 351, 345, 339,
+	335, 329, 323, 319, 313, 307, 303, 297, 293, 287, 283, 277, 273, 269, 263, 259,
+	255, 251, 245, 241, 237, 233, 229, 225, 221, 217, 213, 209, 205, 201, 197, 193,
+	189, 185, 183, 179, 175, 171, 167, 165, 161, 157, 155, 151, 149, 145, 141, 139,
+	135, 133, 129, 127, 125, 121, 119, 115, 113, 111, 107, 105, 103, 99, 97, 95,
+	93, 91, 87, 85, 83, 81, 79, 77, 75, 73, 71, 69, 67, 65, 63, 61,
+	59, 57, 55, 53, 51, 49, 47, 47, 45, 43, 41, 41, 39, 37, 35, 35,
+	33, 31, 31, 29, 27, 27, 25, 25, 23, 21, 21, 19, 19, 17, 17, 15,
+	15, 15, 13, 13, 11, 11, 11, 9, 9, 9, 7, 7, 7, 5, 5, 5,
+	5, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 5,
+	5, 5, 5, 7, 7, 7, 9, 9, 9, 11, 11, 11, 13, 13, 15, 15,
+	15, 17, 17, 19, 19, 21, 21, 23, 25, 25, 27, 27, 29, 31, 31, 33,
+	35, 35, 37, 39, 41, 41, 43, 45, 47, 47, 49, 51, 53, 55, 57, 59,
+	61, 63, 65, 67, 69, 71, 73, 75, 77, 79, 81, 83, 85, 87, 91, 93,
+	95, 97, 99, 103, 105, 107, 111, 113, 115, 119, 121, 125, 127, 129, 133, 135,
+	139, 141, 145, 149, 151, 155, 157, 161, 165, 167, 171, 175, 179, 183, 185, 189,
+	193, 197, 201, 205, 209, 213, 217, 221, 225, 229, 233, 237, 241, 245, 251, 255,
+	259, 263, 269, 273, 277, 283, 287, 293, 297, 303, 307, 313, 319, 323, 329, 335,
+	339, 345, 351, 357, 363, 369, 375, 381, 387, 393, 399, 405, 411, 419, 425, 431,
+	439, 445, 453, 459, 467, 473, 481, 489, 497, 503, 511, 519, 527, 535, 543, 553,
+	561, 569, 579, 587, 595, 605, 615, 623, 633, 643, 653, 663, 673, 683, 695, 705,
+	717, 727, 739, 751, 761, 773, 785, 799, 811, 823, 837, 851, 865, 879, 893, 907,
+	923, 937, 953, 969, 985, 1003, 1019, 1037, 1055, 1073, 1093, 1113, 1133, 1153, 1175, 1197,
+	1219, 1243, 1267, 1293, 1319, 1345, 1375, 1403, 1435, 1465, 1499, 1535, 1571, 1609, 1651, 1693,
+	1739, 1789, 1841, 1899, 1959, 2027, 2101, 2183, 2275, 2381, 2505, 2653, 2839, 3087, 3463, 4275,
+	4274, 3462, 3086, 2838, 2652, 2504, 2380, 2274, 2182, 2100, 2026, 1958, 1898, 1840, 1788, 1738,
+	1692, 1650, 1608, 1570, 1534, 1498, 1464, 1434, 1402, 1374, 1344, 1318, 1292, 1266, 1242, 1218,
+	1196, 1174, 1152, 1132, 1112, 1092, 1072, 1054, 1036, 1018, 1002, 984, 968, 952, 936, 922,
+	906, 892, 878, 864, 850, 836, 822, 810, 798, 784, 772, 760, 750, 738, 726, 716,
+	704, 694, 682, 672, 662, 652, 642, 632, 622, 614, 604, 594, 586, 578, 568, 560,
+	552, 542, 534, 526, 518, 510, 502, 496, 488, 480, 472, 466, 458, 452, 444, 438,
+	430, 424, 418, 410, 404, 398, 392, 386, 380, 374, 368, 362, 356, 350, 344, 338,
+	334, 328, 322, 318, 312, 306, 302, 296, 292, 286, 282, 276, 272, 268, 262, 258,
+	254, 250, 244, 240, 236, 232, 228, 224, 220, 216, 212, 208, 204, 200, 196, 192,
+	188, 184, 182, 178, 174, 170, 166, 164, 160, 156, 154, 150, 148, 144, 140, 138,
+	134, 132, 128, 126, 124, 120, 118, 114, 112, 110, 106, 104, 102, 98, 96, 94,
+	92, 90, 86, 84, 82, 80, 78, 76, 74, 72, 70, 68, 66, 64, 62, 60,
+	58, 56, 54, 52, 50, 48, 46, 46, 44, 42, 40, 40, 38, 36, 34, 34,
+	32, 30, 30, 28, 26, 26, 24, 24, 22, 20, 20, 18, 18, 16, 16, 14,
+	14, 14, 12, 12, 10, 10, 10, 8, 8, 8, 6, 6, 6, 4, 4, 4,
+	4, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 4,
+	4, 4, 4, 6, 6, 6, 8, 8, 8, 10, 10, 10, 12, 12, 14, 14,
+	14, 16, 16, 18, 18, 20, 20, 22, 24, 24, 26, 26, 28, 30, 30, 32,
+	34, 34, 36, 38, 40, 40, 42, 44, 46, 46, 48, 50, 52, 54, 56, 58,
+	60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 90, 92,
+	94, 96, 98, 102, 104, 106, 110, 112, 114, 118, 120, 124, 126, 128, 132, 134,
+	138, 140, 144, 148, 150, 154, 156, 160, 164, 166, 170, 174, 178, 182, 184, 188,
+	192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 250, 254,
+	258, 262, 268, 272, 276, 282, 286, 292, 296, 302, 306, 312, 318, 322, 328, 334,
+	338, 344, 350, 356, 362, 368, 374, 380, 386, 392, 398, 404, 410, 418, 424, 430,
+	438, 444, 452, 458, 466, 472, 480, 488, 496, 502, 510, 518, 526, 534, 542, 552,
+	560, 568, 578, 586, 594, 604, 614, 622, 632, 642, 652, 662, 672, 682, 694, 704,
+	716, 726, 738, 750, 760, 772, 784, 798, 810, 822, 836, 850, 864, 878, 892, 906,
+	922, 936, 952, 968, 984, 1002, 1018, 1036, 1054, 1072, 1092, 1112, 1132, 1152, 1174, 1196,
+	1218, 1242, 1266, 1292, 1318, 1344, 1374, 1402, 1434, 1464, 1498, 1534, 1570, 1608, 1650, 1692,
+	1738, 1788, 1840, 1898, 1958, 2026, 2100, 2182, 2274, 2380, 2504, 2652, 2838, 3086, 3462, 4274,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	4274, 3462, 3086, 2838, 2652, 2504, 2380, 2274, 2182, 2100, 2026, 1958, 1898, 1840, 1788, 1738,
+	1692, 1650, 1608, 1570, 1534, 1498, 1464, 1434, 1402, 1374, 1344, 1318, 1292, 1266, 1242, 1218,
+	1196, 1174, 1152, 1132, 1112, 1092, 1072, 1054, 1036, 1018, 1002, 984, 968, 952, 936, 922,
+	906, 892, 878, 864, 850, 836, 822, 810, 798, 784, 772, 760, 750, 738, 726, 716,
+	704, 694, 682, 672, 662, 652, 642, 632, 622, 614, 604, 594, 586, 578, 568, 560,
+	552, 542, 534, 526, 518, 510, 502, 496, 488, 480, 472, 466, 458, 452, 444, 438,
+	430, 424, 418, 410, 404, 398, 392, 386, 380, 374, 368, 362, 356, 350, 344, 338,
+	334, 328, 322, 318, 312, 306, 302, 296, 292, 286, 282, 276, 272, 268, 262, 258,
+	254, 250, 244, 240, 236, 232, 228, 224, 220, 216, 212, 208, 204, 200, 196, 192,
+	188, 184, 182, 178, 174, 170, 166, 164, 160, 156, 154, 150, 148, 144, 140, 138,
+	134, 132, 128, 126, 124, 120, 118, 114, 112, 110, 106, 104, 102, 98, 96, 94,
+	92, 90, 86, 84, 82, 80, 78, 76, 74, 72, 70, 68, 66, 64, 62, 60,
+	58, 56, 54, 52, 50, 48, 46, 46, 44, 42, 40, 40, 38, 36, 34, 34,
+	32, 30, 30, 28, 26, 26, 24, 24, 22, 20, 20, 18, 18, 16, 16, 14,
+	14, 14, 12, 12, 10, 10, 10, 8, 8, 8, 6, 6, 6, 4, 4, 4,
+	4, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 4,
+	4, 4, 4, 6, 6, 6, 8, 8, 8, 10, 10, 10, 12, 12, 14, 14,
+	14, 16, 16, 18, 18, 20, 20, 22, 24, 24, 26, 26, 28, 30, 30, 32,
+	34, 34, 36, 38, 40, 40, 42, 44, 46, 46, 48, 50, 52, 54, 56, 58,
+	60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 90, 92,
+	94, 96, 98, 102, 104, 106, 110, 112, 114, 118, 120, 124, 126, 128, 132, 134,
+	138, 140, 144, 148, 150, 154, 156, 160, 164, 166, 170, 174, 178, 182, 184, 188,
+	192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 250, 254,
+	258, 262, 268, 272, 276, 282, 286, 292, 296, 302, 306, 312, 318, 322, 328, 334,
+	338, 344, 350, 356, 362, 368, 374, 380, 386, 392, 398, 404, 410, 418, 424, 430,
+	438, 444, 452, 458, 466, 472, 480, 488, 496, 502, 510, 518, 526, 534, 542, 552,
+	560, 568, 578, 586, 594, 604, 614, 622, 632, 642, 652, 662, 672, 682, 694, 704,
+	716, 726, 738, 750, 760, 772, 784, 798, 810, 822, 836, 850, 864, 878, 892, 906,
+	922, 936, 952, 968, 984, 1002, 1018, 1036, 1054, 1072, 1092, 1112, 1132, 1152, 1174, 1196,
+	1218, 1242, 1266, 1292, 1318, 1344, 1374, 1402, 1434, 1464, 1498, 1534, 1570, 1608, 1650, 1692,
+	1738, 1788, 1840, 1898, 1958, 2026, 2100, 2182, 2274, 2380, 2504, 2652, 2838, 3086, 3462, 4274,
+	4274, 3462, 3086, 2838, 2652, 2504, 2380, 2274, 2182, 2100, 2026, 1958, 1898, 1840, 1788, 1738,
+	1692, 1650, 1608, 1570, 1534, 1498, 1464, 1434, 1402, 1374, 1344, 1318, 1292, 1266, 1242, 1218,
+	1196, 1174, 1152, 1132, 1112, 1092, 1072, 1054, 1036, 1018, 1002, 984, 968, 952, 936, 922,
+	906, 892, 878, 864, 850, 836, 822, 810, 798, 784, 772, 760, 750, 738, 726, 716,
+	704, 694, 682, 672, 662, 652, 642, 632, 622, 614, 604, 594, 586, 578, 568, 560,
+	552, 542, 534, 526, 518, 510, 502, 496, 488, 480, 472, 466, 458, 452, 444, 438,
+	430, 424, 418, 410, 404, 398, 392, 386, 380, 374, 368, 362, 356, 350, 344, 338,
+	334, 328, 322, 318, 312, 306, 302, 296, 292, 286, 282, 276, 272, 268, 262, 258,
+	254, 250, 244, 240, 236, 232, 228, 224, 220, 216, 212, 208, 204, 200, 196, 192,
+	188, 184, 182, 178, 174, 170, 166, 164, 160, 156, 154, 150, 148, 144, 140, 138,
+	134, 132, 128, 126, 124, 120, 118, 114, 112, 110, 106, 104, 102, 98, 96, 94,
+	92, 90, 86, 84, 82, 80, 78, 76, 74, 72, 70, 68, 66, 64, 62, 60,
+	58, 56, 54, 52, 50, 48, 46, 46, 44, 42, 40, 40, 38, 36, 34, 34,
+	32, 30, 30, 28, 26, 26, 24, 24, 22, 20, 20, 18, 18, 16, 16, 14,
+	14, 14, 12, 12, 10, 10, 10, 8, 8, 8, 6, 6, 6, 4, 4, 4,
+	4, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 4,
+	4, 4, 4, 6, 6, 6, 8, 8, 8, 10, 10, 10, 12, 12, 14, 14,
+	14, 16, 16, 18, 18, 20, 20, 22, 24, 24, 26, 26, 28, 30, 30, 32,
+	34, 34, 36, 38, 40, 40, 42, 44, 46, 46, 48, 50, 52, 54, 56, 58,
+	60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 90, 92,
+	94, 96, 98, 102, 104, 106, 110, 112, 114, 118, 120, 124, 126, 128, 132, 134,
+	138, 140, 144, 148, 150, 154, 156, 160, 164, 166, 170, 174, 178, 182, 184, 188,
+	192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 250, 254,
+	258, 262, 268, 272, 276, 282, 286, 292, 296, 302, 306, 312, 318, 322, 328, 334,
+	338, 344, 350, 356, 362, 368, 374, 380, 386, 392, 398, 404, 410, 418, 424, 430,
+	438, 444, 452, 458, 466, 472, 480, 488, 496, 502, 510, 518, 526, 534, 542, 552,
+	560, 568, 578, 586, 594, 604, 614, 622, 632, 642, 652, 662, 672, 682, 694, 704,
+	716, 726, 738, 750, 760, 772, 784, 798, 810, 822, 836, 850, 864, 878, 892, 906,
+	922, 936, 952, 968, 984, 1002, 1018, 1036, 1054, 1072, 1092, 1112, 1132, 1152, 1174, 1196,
+	1218, 1242, 1266, 1292, 1318, 1344, 1374, 1402, 1434, 1464, 1498, 1534, 1570, 1608, 1650, 1692,
+	1738, 1788, 1840, 1898, 1958, 2026, 2100, 2182, 2274, 2380, 2504, 2652, 2838, 3086, 3462, 4274,
+	4274, 3462, 3086, 2838, 2652, 2504, 2380, 2274, 2182, 2100, 2026, 1958, 1898, 1840, 1788, 1738,
+	1692, 1650, 1608, 1570, 1534, 1498, 1464, 1434, 1402, 1374, 1344, 1318, 1292, 1266, 1242, 1218,
+	1196, 1174, 1152, 1132, 1112, 1092, 1072, 1054, 1036, 1018, 1002, 984, 968, 952, 936, 922,
+	906, 892, 878, 864, 850, 836, 822, 810, 798, 784, 772, 760, 750, 738, 726, 716,
+	704, 694, 682, 672, 662, 652, 642, 632, 622, 614, 604, 594, 586, 578, 568, 560,
+	552, 542, 534, 526, 518, 510, 502, 496, 488, 480, 472, 466, 458, 452, 444, 438,
+	430, 424, 418, 410, 404, 398, 392, 386, 380, 374, 368, 362, 356, 350, 344, 338,
+	334, 328, 322, 318, 312, 306, 302, 296, 292, 286, 282, 276, 272, 268, 262, 258,
+	254, 250, 244, 240, 236, 232, 228, 224, 220, 216, 212, 208, 204, 200, 196, 192,
+	188, 184, 182, 178, 174, 170, 166, 164, 160, 156, 154, 150, 148, 144, 140, 138,
+	134, 132, 128, 126, 124, 120, 118, 114, 112, 110, 106, 104, 102, 98, 96, 94,
+	92, 90, 86, 84, 82, 80, 78, 76, 74, 72, 70, 68, 66, 64, 62, 60,
+	58, 56, 54, 52, 50, 48, 46, 46, 44, 42, 40, 40, 38, 36, 34, 34,
+	32, 30, 30, 28, 26, 26, 24, 24, 22, 20, 20, 18, 18, 16, 16, 14,
+	14, 14, 12, 12, 10, 10, 10, 8, 8, 8, 6, 6, 6, 4, 4, 4,
+	4, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	4274, 3462, 3086, 2838, 2652, 2504, 2380, 2274, 2182, 2100, 2026, 1958, 1898, 1840, 1788, 1738,
+	1692, 1650, 1608, 1570, 1534, 1498, 1464, 1434, 1402, 1374, 1344, 1318, 1292, 1266, 1242, 1218,
+	1196, 1174, 1152, 1132, 1112, 1092, 1072, 1054, 1036, 1018, 1002, 984, 968, 952, 936, 922,
+	906, 892, 878, 864, 850, 836, 822, 810, 798, 784, 772, 760, 750, 738, 726, 716,
+	704, 694, 682, 672, 662, 652, 642, 632, 622, 614, 604, 594, 586, 578, 568, 560,
+	552, 542, 534, 526, 518, 510, 502, 496, 488, 480, 472, 466, 458, 452, 444, 438,
+	430, 424, 418, 410, 404, 398, 392, 386, 380, 374, 368, 362, 356, 350, 344, 338,
+	334, 328, 322, 318, 312, 306, 302, 296, 292, 286, 282, 276, 272, 268, 262, 258,
+	254, 250, 244, 240, 236, 232, 228, 224, 220, 216, 212, 208, 204, 200, 196, 192,
+	188, 184, 182, 178, 174, 170, 166, 164, 160, 156, 154, 150, 148, 144, 140, 138,
+	134, 132, 128, 126, 124, 120, 118, 114, 112, 110, 106, 104, 102, 98, 96, 94,
+	92, 90, 86, 84, 82, 80, 78, 76, 74, 72, 70, 68, 66, 64, 62, 60,
+	58, 56, 54, 52, 50, 48, 46, 46, 44, 42, 40, 40, 38, 36, 34, 34,
+	32, 30, 30, 28, 26, 26, 24, 24, 22, 20, 20, 18, 18, 16, 16, 14,
+	14, 14, 12, 12, 10, 10, 10, 8, 8, 8, 6, 6, 6, 4, 4, 4,
+	4, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	4274, 3086, 2652, 2380, 2182, 2026, 1898, 1788, 1692, 1608, 1534, 1464, 1402, 1344, 1292, 1242,
+	1196, 1152, 1112, 1072, 1036, 1002, 968, 936, 906, 878, 850, 822, 798, 772, 750, 726,
+	704, 682, 662, 642, 622, 604, 586, 568, 552, 534, 518, 502, 488, 472, 458, 444,
+	430, 418, 404, 392, 380, 368, 356, 344, 334, 322, 312, 302, 292, 282, 272, 262,
+	254, 244, 236, 228, 220, 212, 204, 196, 188, 182, 174, 166, 160, 154, 148, 140,
+	134, 128, 124, 118, 112, 106, 102, 96, 92, 86, 82, 78, 74, 70, 66, 62,
+	58, 54, 50, 46, 44, 40, 38, 34, 32, 30, 26, 24, 22, 20, 18, 16,
+	14, 12, 10, 10, 8, 6, 6, 4, 4, 2, 2, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 4, 4, 6, 8, 8, 10, 12, 14,
+	14, 16, 18, 20, 24, 26, 28, 30, 34, 36, 40, 42, 46, 48, 52, 56,
+	60, 64, 68, 72, 76, 80, 84, 90, 94, 98, 104, 110, 114, 120, 126, 132,
+	138, 144, 150, 156, 164, 170, 178, 184, 192, 200, 208, 216, 224, 232, 240, 250,
+	258, 268, 276, 286, 296, 306, 318, 328, 338, 350, 362, 374, 386, 398, 410, 424,
+	438, 452, 466, 480, 496, 510, 526, 542, 560, 578, 594, 614, 632, 652, 672, 694,
+	716, 738, 760, 784, 810, 836, 864, 892, 922, 952, 984, 1018, 1054, 1092, 1132, 1174,
+	1218, 1266, 1318, 1374, 1434, 1498, 1570, 1650, 1738, 1840, 1958, 2100, 2274, 2504, 2838, 3462,
+	4275, 3087, 2653, 2381, 2183, 2027, 1899, 1789, 1693, 1609, 1535, 1465, 1403, 1345, 1293, 1243,
+	1197, 1153, 1113, 1073, 1037, 1003, 969, 937, 907, 879, 851, 823, 799, 773, 751, 727,
+	705, 683, 663, 643, 623, 605, 587, 569, 553, 535, 519, 503, 489, 473, 459, 445,
+	431, 419, 405, 393, 381, 369, 357, 345, 335, 323, 313, 303, 293, 283, 273, 263,
+	255, 245, 237, 229, 221, 213, 205, 197, 189, 183, 175, 167, 161, 155, 149, 141,
+	135, 129, 125, 119, 113, 107, 103, 97, 93, 87, 83, 79, 75, 71, 67, 63,
+	59, 55, 51, 47, 45, 41, 39, 35, 33, 31, 27, 25, 23, 21, 19, 17,
+	15, 13, 11, 11, 9, 7, 7, 5, 5, 3, 3, 3, 1, 1, 1, 1,
+	1, 1, 1, 1, 3, 3, 3, 3, 5, 5, 7, 9, 9, 11, 13, 15,
+	15, 17, 19, 21, 25, 27, 29, 31, 35, 37, 41, 43, 47, 49, 53, 57,
+	61, 65, 69, 73, 77, 81, 85, 91, 95, 99, 105, 111, 115, 121, 127, 133,
+	139, 145, 151, 157, 165, 171, 179, 185, 193, 201, 209, 217, 225, 233, 241, 251,
+	259, 269, 277, 287, 297, 307, 319, 329, 339, 351, 363, 375, 387, 399, 411, 425,
+	439, 453, 467, 481, 497, 511, 527, 543, 561, 579, 595, 615, 633, 653, 673, 695,
+	717, 739, 761, 785, 811, 837, 865, 893, 923, 953, 985, 1019, 1055, 1093, 1133, 1175,
+	1219, 1267, 1319, 1375, 1435, 1499, 1571, 1651, 1739, 1841, 1959, 2101, 2275, 2505, 2839, 3463,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	4274, 3086, 2652, 2380, 2182, 2026, 1898, 1788, 1692, 1608, 1534, 1464, 1402, 1344, 1292, 1242,
+	1196, 1152, 1112, 1072, 1036, 1002, 968, 936, 906, 878, 850, 822, 798, 772, 750, 726,
+	704, 682, 662, 642, 622, 604, 586, 568, 552, 534, 518, 502, 488, 472, 458, 444,
+	430, 418, 404, 392, 380, 368, 356, 344, 334, 322, 312, 302, 292, 282, 272, 262,
+	254, 244, 236, 228, 220, 212, 204, 196, 188, 182, 174, 166, 160, 154, 148, 140,
+	134, 128, 124, 118, 112, 106, 102, 96, 92, 86, 82, 78, 74, 70, 66, 62,
+	58, 54, 50, 46, 44, 40, 38, 34, 32, 30, 26, 24, 22, 20, 18, 16,
+	14, 12, 10, 10, 8, 6, 6, 4, 4, 2, 2, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 4, 4, 6, 8, 8, 10, 12, 14,
+	14, 16, 18, 20, 24, 26, 28, 30, 34, 36, 40, 42, 46, 48, 52, 56,
+	60, 64, 68, 72, 76, 80, 84, 90, 94, 98, 104, 110, 114, 120, 126, 132,
+	138, 144, 150, 156, 164, 170, 178, 184, 192, 200, 208, 216, 224, 232, 240, 250,
+	258, 268, 276, 286, 296, 306, 318, 328, 338, 350, 362, 374, 386, 398, 410, 424,
+	438, 452, 466, 480, 496, 510, 526, 542, 560, 578, 594, 614, 632, 652, 672, 694,
+	716, 738, 760, 784, 810, 836, 864, 892, 922, 952, 984, 1018, 1054, 1092, 1132, 1174,
+	1218, 1266, 1318, 1374, 1434, 1498, 1570, 1650, 1738, 1840, 1958, 2100, 2274, 2504, 2838, 3462,
+	4274, 3086, 2652, 2380, 2182, 2026, 1898, 1788, 1692, 1608, 1534, 1464, 1402, 1344, 1292, 1242,
+	1196, 1152, 1112, 1072, 1036, 1002, 968, 936, 906, 878, 850, 822, 798, 772, 750, 726,
+	704, 682, 662, 642, 622, 604, 586, 568, 552, 534, 518, 502, 488, 472, 458, 444,
+	430, 418, 404, 392, 380, 368, 356, 344, 334, 322, 312, 302, 292, 282, 272, 262,
+	254, 244, 236, 228, 220, 212, 204, 196, 188, 182, 174, 166, 160, 154, 148, 140,
+	134, 128, 124, 118, 112, 106, 102, 96, 92, 86, 82, 78, 74, 70, 66, 62,
+	58, 54, 50, 46, 44, 40, 38, 34, 32, 30, 26, 24, 22, 20, 18, 16,
+	14, 12, 10, 10, 8, 6, 6, 4, 4, 2, 2, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 2, 2, 2, 4, 4, 6, 8, 8, 10, 12, 14,
+	14, 16, 18, 20, 24, 26, 28, 30, 34, 36, 40, 42, 46, 48, 52, 56,
+	60, 64, 68, 72, 76, 80, 84, 90, 94, 98, 104, 110, 114, 120, 126, 132,
+	138, 144, 150, 156, 164, 170, 178, 184, 192, 200, 208, 216, 224, 232, 240, 250,
+	258, 268, 276, 286, 296, 306, 318, 328, 338, 350, 362, 374, 386, 398, 410, 424,
+	438, 452, 466, 480, 496, 510, 526, 542, 560, 578, 594, 614, 632, 652, 672, 694,
+	716, 738, 760, 784, 810, 836, 864, 892, 922, 952, 984, 1018, 1054, 1092, 1132, 1174,
+	1218, 1266, 1318, 1374, 1434, 1498, 1570, 1650, 1738, 1840, 1958, 2100, 2274, 2504, 2838, 3462,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240,
+	256, 272, 288, 304, 320, 336, 352, 368, 384, 400, 416, 432, 448, 464, 480, 496,
+	512, 528, 544, 560, 576, 592, 608, 624, 640, 656, 672, 688, 704, 720, 736, 752,
+	768, 784, 800, 816, 832, 848, 864, 880, 896, 912, 928, 944, 960, 976, 992, 1008,
+	1024, 1040, 1056, 1072, 1088, 1104, 1120, 1136, 1152, 1168, 1184, 1200, 1216, 1232, 1248, 1264,
+	1280, 1296, 1312, 1328, 1344, 1360, 1376, 1392, 1408, 1424, 1440, 1456, 1472, 1488, 1504, 1520,
+	1536, 1552, 1568, 1584, 1600, 1616, 1632, 1648, 1664, 1680, 1696, 1712, 1728, 1744, 1760, 1776,
+	1792, 1808, 1824, 1840, 1856, 1872, 1888, 1904, 1920, 1936, 1952, 1968, 1984, 2000, 2016, 2032,
+	2048, 2064, 2080, 2096, 2112, 2128, 2144, 2160, 2176, 2192, 2208, 2224, 2240, 2256, 2272, 2288,
+	2304, 2320, 2336, 2352, 2368, 2384, 2400, 2416, 2432, 2448, 2464, 2480, 2496, 2512, 2528, 2544,
+	2560, 2576, 2592, 2608, 2624, 2640, 2656, 2672, 2688, 2704, 2720, 2736, 2752, 2768, 2784, 2800,
+	2816, 2832, 2848, 2864, 2880, 2896, 2912, 2928, 2944, 2960, 2976, 2992, 3008, 3024, 3040, 3056,
+	3072, 3088, 3104, 3120, 3136, 3152, 3168, 3184, 3200, 3216, 3232, 3248, 3264, 3280, 3296, 3312,
+	3328, 3344, 3360, 3376, 3392, 3408, 3424, 3440, 3456, 3472, 3488, 3504, 3520, 3536, 3552, 3568,
+	3584, 3600, 3616, 3632, 3648, 3664, 3680, 3696, 3712, 3728, 3744, 3760, 3776, 3792, 3808, 3824,
+	3840, 3856, 3872, 3888, 3904, 3920, 3936, 3952, 3968, 3984, 4000, 4016, 4032, 4048, 4064, 4080,
+	4096, 4112, 4128, 4144, 4160, 4176, 4192, 4208, 4224, 4240, 4256, 4272, 4288, 4304, 4320, 4336,
+	4352, 4368, 4384, 4400, 4416, 4432, 4448, 4464, 4480, 4496, 4512, 4528, 4544, 4560, 4576, 4592,
+	4608, 4624, 4640, 4656, 4672, 4688, 4704, 4720, 4736, 4752, 4768, 4784, 4800, 4816, 4832, 4848,
+	4864, 4880, 4896, 4912, 4928, 4944, 4960, 4976, 4992, 5008, 5024, 5040, 5056, 5072, 5088, 5104,
+	5120, 5136, 5152, 5168, 5184, 5200, 5216, 5232, 5248, 5264, 5280, 5296, 5312, 5328, 5344, 5360,
+	5376, 5392, 5408, 5424, 5440, 5456, 5472, 5488, 5504, 5520, 5536, 5552, 5568, 5584, 5600, 5616,
+	5632, 5648, 5664, 5680, 5696, 5712, 5728, 5744, 5760, 5776, 5792, 5808, 5824, 5840, 5856, 5872,
+	5888, 5904, 5920, 5936, 5952, 5968, 5984, 6000, 6016, 6032, 6048, 6064, 6080, 6096, 6112, 6128,
+	6144, 6160, 6176, 6192, 6208, 6224, 6240, 6256, 6272, 6288, 6304, 6320, 6336, 6352, 6368, 6384,
+	6400, 6416, 6432, 6448, 6464, 6480, 6496, 6512, 6528, 6544, 6560, 6576, 6592, 6608, 6624, 6640,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+	6641, 6625, 6609, 6593, 6577, 6561, 6545, 6529, 6513, 6497, 6481, 6465, 6449, 6433, 6417, 6401,
+	6385, 6369, 6353, 6337, 6321, 6305, 6289, 6273, 6257, 6241, 6225, 6209, 6193, 6177, 6161, 6145,
+	6129, 6113, 6097, 6081, 6065, 6049, 6033, 6017, 6001, 5985, 5969, 5953, 5937, 5921, 5905, 5889,
+	5873, 5857, 5841, 5825, 5809, 5793, 5777, 5761, 5745, 5729, 5713, 5697, 5681, 5665, 5649, 5633,
+	5617, 5601, 5585, 5569, 5553, 5537, 5521, 5505, 5489, 5473, 5457, 5441, 5425, 5409, 5393, 5377,
+	5361, 5345, 5329, 5313, 5297, 5281, 5265, 5249, 5233, 5217, 5201, 5185, 5169, 5153, 5137, 5121,
+	5105, 5089, 5073, 5057, 5041, 5025, 5009, 4993, 4977, 4961, 4945, 4929, 4913, 4897, 4881, 4865,
+	4849, 4833, 4817, 4801, 4785, 4769, 4753, 4737, 4721, 4705, 4689, 4673, 4657, 4641, 4625, 4609,
+	4593, 4577, 4561, 4545, 4529, 4513, 4497, 4481, 4465, 4449, 4433, 4417, 4401, 4385, 4369, 4353,
+	4337, 4321, 4305, 4289, 4273, 4257, 4241, 4225, 4209, 4193, 4177, 4161, 4145, 4129, 4113, 4097,
+	4081, 4065, 4049, 4033, 4017, 4001, 3985, 3969, 3953, 3937, 3921, 3905, 3889, 3873, 3857, 3841,
+	3825, 3809, 3793, 3777, 3761, 3745, 3729, 3713, 3697, 3681, 3665, 3649, 3633, 3617, 3601, 3585,
+	3569, 3553, 3537, 3521, 3505, 3489, 3473, 3457, 3441, 3425, 3409, 3393, 3377, 3361, 3345, 3329,
+	3313, 3297, 3281, 3265, 3249, 3233, 3217, 3201, 3185, 3169, 3153, 3137, 3121, 3105, 3089, 3073,
+	3057, 3041, 3025, 3009, 2993, 2977, 2961, 2945, 2929, 2913, 2897, 2881, 2865, 2849, 2833, 2817,
+	2801, 2785, 2769, 2753, 2737, 2721, 2705, 2689, 2673, 2657, 2641, 2625, 2609, 2593, 2577, 2561,
+	2545, 2529, 2513, 2497, 2481, 2465, 2449, 2433, 2417, 2401, 2385, 2369, 2353, 2337, 2321, 2305,
+	2289, 2273, 2257, 2241, 2225, 2209, 2193, 2177, 2161, 2145, 2129, 2113, 2097, 2081, 2065, 2049,
+	2033, 2017, 2001, 1985, 1969, 1953, 1937, 1921, 1905, 1889, 1873, 1857, 1841, 1825, 1809, 1793,
+	1777, 1761, 1745, 1729, 1713, 1697, 1681, 1665, 1649, 1633, 1617, 1601, 1585, 1569, 1553, 1537,
+	1521, 1505, 1489, 1473, 1457, 1441, 1425, 1409, 1393, 1377, 1361, 1345, 1329, 1313, 1297, 1281,
+	1265, 1249, 1233, 1217, 1201, 1185, 1169, 1153, 1137, 1121, 1105, 1089, 1073, 1057, 1041, 1025,
+	1009, 993, 977, 961, 945, 929, 913, 897, 881, 865, 849, 833, 817, 801, 785, 769,
+	753, 737, 721, 705, 689, 673, 657, 641, 625, 609, 593, 577, 561, 545, 529, 513,
+	497, 481, 465, 449, 433, 417, 401, 385, 369, 353, 337, 321, 305, 289, 273, 257,
+	241, 225, 209, 193, 177, 161, 145, 129, 113, 97, 81, 65, 49, 33, 17, 1
+};
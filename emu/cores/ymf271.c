@@ -52,6 +52,7 @@ static void ymf271_w(void *info, UINT8 offset, UINT8 data);
 static void ymf271_alloc_rom(void* info, UINT32 memsize);
 static void ymf271_write_rom(void *info, UINT32 offset, UINT32 length, const UINT8* data);
 
+static void ymf271_set_options(void *info, UINT32 options);
 static void ymf271_set_mute_mask(void *info, UINT32 MuteMask);
 static void ymf271_set_log_cb(void *info, DEVCB_LOG func, void* param);
 
@@ -74,7 +75,7 @@ static DEV_DEF devDef =
 	device_reset_ymf271,
 	ymf271_update,
 	
-	NULL,	// SetOptionBits
+	ymf271_set_options,	// SetOptionBits
 	ymf271_set_mute_mask,
 	NULL,	// SetPanning
 	NULL,	// SetSampleRateChangeCallback
@@ -132,6 +133,7 @@ const DEV_DECL sndDev_YMF271 =
 #define LFO_SHIFT       8
 #define PLFO_MAX        (+1.0)
 #define PLFO_MIN        (-1.0)
+#define PLFO_SHIFT      31  // fixed point shift of lut_plfo_fixed
 #define ALFO_MAX        (+65536)
 #define ALFO_MIN        (0)
 
@@ -279,11 +281,6 @@ static const double pow_table[16] = { 128, 256, 512, 1024, 2048, 4096, 8192, 163
 
 static const double fs_frequency[4] = { 1.0/1.0, 1.0/2.0, 1.0/4.0, 1.0/8.0 };
 
-static const double channel_attenuation_table[16] =
-{
-	0.0, 2.5, 6.0, 8.5, 12.0, 14.5, 18.1, 20.6, 24.1, 26.6, 30.1, 32.6, 36.1, 96.1, 96.1, 96.1
-};
-
 static const int modulation_level[8] = { 16, 8, 4, 2, 1, 32, 64, 128 };
 
 // feedback_level * 16
@@ -345,6 +342,7 @@ typedef struct
 	INT32 lfo_phase, lfo_step;
 	INT32 lfo_amplitude;
 	double lfo_phasemod;
+	UINT32 lfo_pm_fixed;        // lfo_phasemod in PLFO_SHIFT fixed point
 } YMF271Slot;
 
 typedef struct
@@ -358,16 +356,13 @@ typedef struct
 	DEV_DATA _devData;
 	DEV_LOGGER logger;
 	
-	// lookup tables
-	INT16 *lut_waves[8];
-	double *lut_plfo[4][8];
-	int *lut_alfo[4];
-	double lut_ar[64];
-	double lut_dc[64];
-	double lut_lfo[256];
-	int lut_attenuation[16];
-	int lut_total_level[128];
-	int lut_env_volume[256];
+	// lookup tables (depending on the clock)
+	INT32 lut_ar_step[64];      // attack step
+	INT32 lut_dc_step[64];      // decay2/release step
+	INT32 lut_d1_step[16][64];  // decay1 step for each decay1 level
+	INT32 lut_lfo_step[256];
+
+	UINT8 fixed_point;
 
 	// internal state
 	YMF271Slot slots[48];
@@ -403,13 +398,57 @@ typedef struct
 } YMF271Chip;
 
 
+/* lookup tables shared by all instances, generated by tables_gen.c
+   lut_waves: the 8 waveforms
+   lut_plfo/lut_plfo_fixed: LFO phase modulation factors (double/1.31 fixed point)
+   lut_alfo: LFO amplitude modulation
+   lut_attenuation/lut_total_level/lut_env_volume: volume factors (16.16 fixed point) */
+#include "ymf271_tables.h"
+
+
 INLINE UINT8 ymf271_read_memory(YMF271Chip *chip, UINT32 offset);
 
 
-INLINE void calculate_step(YMF271Slot *slot)
+// Integer version of calculate_step.
+// Except for F-Number, multiple and the phase modulation, all factors are powers of 2,
+// so the step is F * (2 * multiple) * phasemod, shifted by the combined exponent.
+INLINE void calculate_step_fixed(YMF271Slot *slot)
+{
+	UINT64 st;
+	int shift;
+
+	shift = (slot->block < 8) ? (slot->block + 7) : (slot->block - 9);	// pow_table
+
+	if (slot->waveform == 7)
+	{
+		// external waveform (PCM)
+		st = slot->fns | 2048;
+		shift -= slot->fs + 3;
+	}
+	else
+	{
+		// internal waveform (FM)
+		st = slot->fns;
+		shift -= 3;
+	}
+	st *= slot->multiple ? (slot->multiple * 2) : 1;
+
+	// LFO phase modulation
+	st *= slot->lfo_pm_fixed;
+
+	slot->step = (UINT32)(st >> (PLFO_SHIFT - shift));
+}
+
+INLINE void calculate_step(YMF271Chip *chip, YMF271Slot *slot)
 {
 	double st;
 
+	if (chip->fixed_point)
+	{
+		calculate_step_fixed(slot);
+		return;
+	}
+
 	if (slot->waveform == 7)
 	{
 		// external waveform (PCM)
@@ -582,7 +621,6 @@ INLINE int get_external_keycode(int block, int fns)
 static void init_envelope(YMF271Chip *chip, YMF271Slot *slot)
 {
 	int keycode, rate;
-	int decay_level = 255 - (slot->decay1lvl << 4);
 
 	if (slot->waveform != 7)
 	{
@@ -596,19 +634,19 @@ static void init_envelope(YMF271Chip *chip, YMF271Slot *slot)
 
 	// init attack state
 	rate = get_keyscaled_rate(slot->ar * 2, keycode, slot->keyscale);
-	slot->env_attack_step = (rate < 4) ? 0 : (int)(((double)(255-0) / chip->lut_ar[rate]) * 65536.0);
+	slot->env_attack_step = chip->lut_ar_step[rate];
 
 	// init decay1 state
 	rate = get_keyscaled_rate(slot->decay1rate * 2, keycode, slot->keyscale);
-	slot->env_decay1_step = (rate < 4) ? 0 : (int)(((double)(255-decay_level) / chip->lut_dc[rate]) * 65536.0);
+	slot->env_decay1_step = chip->lut_d1_step[slot->decay1lvl][rate];
 
 	// init decay2 state
 	rate = get_keyscaled_rate(slot->decay2rate * 2, keycode, slot->keyscale);
-	slot->env_decay2_step = (rate < 4) ? 0 : (int)(((double)(255-0) / chip->lut_dc[rate]) * 65536.0);
+	slot->env_decay2_step = chip->lut_dc_step[rate];
 
 	// init release state
 	rate = get_keyscaled_rate(slot->relrate * 4, keycode, slot->keyscale);
-	slot->env_release_step = (rate < 4) ? 0 : (int)(((double)(255-0) / chip->lut_dc[rate]) * 65536.0);
+	slot->env_release_step = chip->lut_dc_step[rate];
 
 	slot->volume = (255-160) << ENV_VOLUME_SHIFT; // -60db
 	slot->env_state = ENV_ATTACK;
@@ -619,18 +657,25 @@ static void init_lfo(YMF271Chip *chip, YMF271Slot *slot)
 	slot->lfo_phase = 0;
 	slot->lfo_amplitude = 0;
 	slot->lfo_phasemod = 0;
+	slot->lfo_pm_fixed = 0;
 
-	slot->lfo_step = (int)((((double)LFO_LENGTH * chip->lut_lfo[slot->lfoFreq]) / 44100.0) * 256.0);
+	slot->lfo_step = chip->lut_lfo_step[slot->lfoFreq];
 }
 
 INLINE void update_lfo(YMF271Chip *chip, YMF271Slot *slot)
 {
+	int lfo_pos;
+
 	slot->lfo_phase += slot->lfo_step;
+	lfo_pos = (slot->lfo_phase >> LFO_SHIFT) & (LFO_LENGTH-1);
 
-	slot->lfo_amplitude = chip->lut_alfo[slot->lfowave][(slot->lfo_phase >> LFO_SHIFT) & (LFO_LENGTH-1)];
-	slot->lfo_phasemod = chip->lut_plfo[slot->lfowave][slot->pms][(slot->lfo_phase >> LFO_SHIFT) & (LFO_LENGTH-1)];
+	slot->lfo_amplitude = lut_alfo[slot->lfowave][lfo_pos];
+	if (chip->fixed_point)
+		slot->lfo_pm_fixed = lut_plfo_fixed[slot->lfowave][slot->pms][lfo_pos];
+	else
+		slot->lfo_phasemod = lut_plfo[slot->lfowave][slot->pms][lfo_pos];
 
-	calculate_step(slot);
+	calculate_step(chip, slot);
 }
 
 INLINE int calculate_slot_volume(YMF271Chip *chip, YMF271Slot *slot)
@@ -649,9 +694,9 @@ INLINE int calculate_slot_volume(YMF271Chip *chip, YMF271Slot *slot)
 		case 3: lfo_volume = 65536 - ((slot->lfo_amplitude * 4277) >> 16); break;   // 23.625dB
 	}
 
-	env_volume = (chip->lut_env_volume[255 - (slot->volume >> ENV_VOLUME_SHIFT)] * lfo_volume) >> 16;
+	env_volume = (lut_env_volume[255 - (slot->volume >> ENV_VOLUME_SHIFT)] * lfo_volume) >> 16;
 
-	volume = (env_volume * chip->lut_total_level[slot->tl]) >> 16;
+	volume = (env_volume * lut_total_level[slot->tl]) >> 16;
 
 	return volume;
 }
@@ -717,10 +762,10 @@ static void update_pcm(YMF271Chip *chip, int slotnum, INT32 *mixp, UINT32 length
 
 		final_volume = calculate_slot_volume(chip, slot);
 
-		ch0_vol = (final_volume * chip->lut_attenuation[slot->ch0_level]) >> 16;
-		ch1_vol = (final_volume * chip->lut_attenuation[slot->ch1_level]) >> 16;
-		ch2_vol = (final_volume * chip->lut_attenuation[slot->ch2_level]) >> 16;
-		ch3_vol = (final_volume * chip->lut_attenuation[slot->ch3_level]) >> 16;
+		ch0_vol = (final_volume * lut_attenuation[slot->ch0_level]) >> 16;
+		ch1_vol = (final_volume * lut_attenuation[slot->ch1_level]) >> 16;
+		ch2_vol = (final_volume * lut_attenuation[slot->ch2_level]) >> 16;
+		ch3_vol = (final_volume * lut_attenuation[slot->ch3_level]) >> 16;
 
 		if (ch0_vol > 65536) ch0_vol = 65536;
 		if (ch1_vol > 65536) ch1_vol = 65536;
@@ -757,7 +802,7 @@ static INT64 calculate_op(YMF271Chip *chip, int slotnum, INT64 inp)
 		slot_input = ((inp << (SIN_BITS-2)) * modulation_level[slot->feedback]);
 	}
 
-	slot_output = chip->lut_waves[slot->waveform][((slot->stepptr + slot_input) >> 16) & SIN_MASK];
+	slot_output = lut_waves[slot->waveform][((slot->stepptr + slot_input) >> 16) & SIN_MASK];
 	slot_output = (slot_output * env) >> 16;
 	slot->stepptr += slot->step;
 
@@ -1017,14 +1062,14 @@ static void ymf271_update(void *info, UINT32 samples, DEV_SMPL** outputs)
 								break;
 						}
 
-						mixp[i*2+0] += ((output1 * chip->lut_attenuation[chip->slots[slot1].ch0_level]) +
-										(output2 * chip->lut_attenuation[chip->slots[slot2].ch0_level]) +
-										(output3 * chip->lut_attenuation[chip->slots[slot3].ch0_level]) +
-										(output4 * chip->lut_attenuation[chip->slots[slot4].ch0_level])) >> 16;
-						mixp[i*2+1] += ((output1 * chip->lut_attenuation[chip->slots[slot1].ch1_level]) +
-										(output2 * chip->lut_attenuation[chip->slots[slot2].ch1_level]) +
-										(output3 * chip->lut_attenuation[chip->slots[slot3].ch1_level]) +
-										(output4 * chip->lut_attenuation[chip->slots[slot4].ch1_level])) >> 16;
+						mixp[i*2+0] += ((output1 * lut_attenuation[chip->slots[slot1].ch0_level]) +
+										(output2 * lut_attenuation[chip->slots[slot2].ch0_level]) +
+										(output3 * lut_attenuation[chip->slots[slot3].ch0_level]) +
+										(output4 * lut_attenuation[chip->slots[slot4].ch0_level])) >> 16;
+						mixp[i*2+1] += ((output1 * lut_attenuation[chip->slots[slot1].ch1_level]) +
+										(output2 * lut_attenuation[chip->slots[slot2].ch1_level]) +
+										(output3 * lut_attenuation[chip->slots[slot3].ch1_level]) +
+										(output4 * lut_attenuation[chip->slots[slot4].ch1_level])) >> 16;
 					}
 				}
 				break;
@@ -1083,10 +1128,10 @@ static void ymf271_update(void *info, UINT32 samples, DEV_SMPL** outputs)
 									break;
 							}
 
-							mixp[i*2+0] += ((output1 * chip->lut_attenuation[chip->slots[slot1].ch0_level]) +
-											(output3 * chip->lut_attenuation[chip->slots[slot3].ch0_level])) >> 16;
-							mixp[i*2+1] += ((output1 * chip->lut_attenuation[chip->slots[slot1].ch1_level]) +
-											(output3 * chip->lut_attenuation[chip->slots[slot3].ch1_level])) >> 16;
+							mixp[i*2+0] += ((output1 * lut_attenuation[chip->slots[slot1].ch0_level]) +
+											(output3 * lut_attenuation[chip->slots[slot3].ch0_level])) >> 16;
+							mixp[i*2+1] += ((output1 * lut_attenuation[chip->slots[slot1].ch1_level]) +
+											(output3 * lut_attenuation[chip->slots[slot3].ch1_level])) >> 16;
 						}
 					}
 				}
@@ -1192,12 +1237,12 @@ static void ymf271_update(void *info, UINT32 samples, DEV_SMPL** outputs)
 								break;
 						}
 
-						mixp[i*2+0] += ((output1 * chip->lut_attenuation[chip->slots[slot1].ch0_level]) +
-										(output2 * chip->lut_attenuation[chip->slots[slot2].ch0_level]) +
-										(output3 * chip->lut_attenuation[chip->slots[slot3].ch0_level])) >> 16;
-						mixp[i*2+0] += ((output1 * chip->lut_attenuation[chip->slots[slot1].ch1_level]) +
-										(output2 * chip->lut_attenuation[chip->slots[slot2].ch1_level]) +
-										(output3 * chip->lut_attenuation[chip->slots[slot3].ch1_level])) >> 16;
+						mixp[i*2+0] += ((output1 * lut_attenuation[chip->slots[slot1].ch0_level]) +
+										(output2 * lut_attenuation[chip->slots[slot2].ch0_level]) +
+										(output3 * lut_attenuation[chip->slots[slot3].ch0_level])) >> 16;
+						mixp[i*2+0] += ((output1 * lut_attenuation[chip->slots[slot1].ch1_level]) +
+										(output2 * lut_attenuation[chip->slots[slot2].ch1_level]) +
+										(output3 * lut_attenuation[chip->slots[slot3].ch1_level])) >> 16;
 					}
 				}
 
@@ -1244,7 +1289,7 @@ static void write_register(YMF271Chip *chip, int slotnum, int reg, UINT8 data)
 
 				slot->active = 1;
 
-				calculate_step(slot);
+				calculate_step(chip, slot);
 				calculate_status_end(chip,slotnum,0);
 				init_envelope(chip, slot);
 				init_lfo(chip, slot);
@@ -1731,130 +1776,38 @@ static UINT8 ymf271_r(void *info, UINT8 offset)
 	return 0xff;
 }
 
-static void init_tables(YMF271Chip *chip)
+static void init_chip_tables(YMF271Chip *chip)
 {
 	int i,j;
 	double clock_correction;
-
-	for (i = 0; i < 8; i++)
-		chip->lut_waves[i] = (INT16*)malloc(sizeof(INT16) * SIN_LEN);
-
-	for (i = 0; i < 4*8; i++)
-		chip->lut_plfo[i>>3][i&7] = (double*)malloc(sizeof(double) * LFO_LENGTH);
-
-	for (i = 0; i < 4; i++)
-		chip->lut_alfo[i] = (int*)malloc(sizeof(int) * LFO_LENGTH);
-	
-	for (i=0; i < SIN_LEN; i++)
-	{
-		double m = sin( ((i*2)+1) * M_PI / SIN_LEN );
-		double m2 = sin( ((i*4)+1) * M_PI / SIN_LEN );
-
-		// Waveform 0: sin(wt)    (0 <= wt <= 2PI)
-		chip->lut_waves[0][i] = (INT16)(m * MAXOUT);
-
-		// Waveform 1: sin?(wt)   (0 <= wt <= PI)     -sin?(wt)  (PI <= wt <= 2PI)
-		chip->lut_waves[1][i] = (i < (SIN_LEN/2)) ? (INT16)((m * m) * MAXOUT) : (INT16)((m * m) * MINOUT);
-
-		// Waveform 2: sin(wt)    (0 <= wt <= PI)     -sin(wt)   (PI <= wt <= 2PI)
-		chip->lut_waves[2][i] = (i < (SIN_LEN/2)) ? (INT16)(m * MAXOUT) : (INT16)(-m * MAXOUT);
-
-		// Waveform 3: sin(wt)    (0 <= wt <= PI)     0
-		chip->lut_waves[3][i] = (i < (SIN_LEN/2)) ? (INT16)(m * MAXOUT) : 0;
-
-		// Waveform 4: sin(2wt)   (0 <= wt <= PI)     0
-		chip->lut_waves[4][i] = (i < (SIN_LEN/2)) ? (INT16)(m2 * MAXOUT) : 0;
-
-		// Waveform 5: |sin(2wt)| (0 <= wt <= PI)     0
-		chip->lut_waves[5][i] = (i < (SIN_LEN/2)) ? (INT16)(fabs(m2) * MAXOUT) : 0;
-
-		// Waveform 6:     1      (0 <= wt <= 2PI)
-		chip->lut_waves[6][i] = (INT16)(1 * MAXOUT);
-
-		chip->lut_waves[7][i] = 0;
-	}
-
-	for (i = 0; i < LFO_LENGTH; i++)
-	{
-		int tri_wave;
-		double ftri_wave, fsaw_wave;
-		double plfo[4];
-
-		// LFO phase modulation
-		plfo[0] = 0;
-
-		fsaw_wave = ((i % (LFO_LENGTH/2)) * PLFO_MAX) / (double)((LFO_LENGTH/2)-1);
-		plfo[1] = (i < (LFO_LENGTH/2)) ? fsaw_wave : fsaw_wave - PLFO_MAX;
-
-		plfo[2] = (i < (LFO_LENGTH/2)) ? PLFO_MAX : PLFO_MIN;
-
-		ftri_wave = ((i % (LFO_LENGTH/4)) * PLFO_MAX) / (double)(LFO_LENGTH/4);
-		switch (i / (LFO_LENGTH/4))
-		{
-			case 0: plfo[3] = ftri_wave; break;
-			case 1: plfo[3] = PLFO_MAX - ftri_wave; break;
-			case 2: plfo[3] = 0 - ftri_wave; break;
-			case 3: plfo[3] = 0 - (PLFO_MAX - ftri_wave); break;
-			default: plfo[3] = 0; /*assert(0);*/ break;
-		}
-
-		for (j = 0; j < 4; j++)
-		{
-			chip->lut_plfo[j][0][i] = pow(2.0, 0.0);
-			chip->lut_plfo[j][1][i] = pow(2.0, (3.378 * plfo[j]) / 1200.0);
-			chip->lut_plfo[j][2][i] = pow(2.0, (5.0646 * plfo[j]) / 1200.0);
-			chip->lut_plfo[j][3][i] = pow(2.0, (6.7495 * plfo[j]) / 1200.0);
-			chip->lut_plfo[j][4][i] = pow(2.0, (10.1143 * plfo[j]) / 1200.0);
-			chip->lut_plfo[j][5][i] = pow(2.0, (20.1699 * plfo[j]) / 1200.0);
-			chip->lut_plfo[j][6][i] = pow(2.0, (40.1076 * plfo[j]) / 1200.0);
-			chip->lut_plfo[j][7][i] = pow(2.0, (79.307 * plfo[j]) / 1200.0);
-		}
-
-		// LFO amplitude modulation
-		chip->lut_alfo[0][i] = 0;
-
-		chip->lut_alfo[1][i] = ALFO_MAX - ((i * ALFO_MAX) / LFO_LENGTH);
-
-		chip->lut_alfo[2][i] = (i < (LFO_LENGTH/2)) ? ALFO_MAX : ALFO_MIN;
-
-		tri_wave = ((i % (LFO_LENGTH/2)) * ALFO_MAX) / (LFO_LENGTH/2);
-		chip->lut_alfo[3][i] = (i < (LFO_LENGTH/2)) ? ALFO_MAX-tri_wave : tri_wave;
-	}
-	
-	for (i = 0; i < 256; i++)
-	{
-		chip->lut_env_volume[i] = (int)(65536.0 / pow(10.0, ((double)i / (256.0 / 96.0)) / 20.0));
-	}
-
-	for (i = 0; i < 16; i++)
-	{
-		chip->lut_attenuation[i] = (int)(65536.0 / pow(10.0, channel_attenuation_table[i] / 20.0));
-	}
-	for (i = 0; i < 128; i++)
-	{
-		double db = 0.75 * (double)i;
-		chip->lut_total_level[i] = (int)(65536.0 / pow(10.0, db / 20.0));
-	}
+	double lut_lfo, lut_ar, lut_dc;
 
 	// timing may use a non-standard XTAL
 	clock_correction = (double)(STD_CLOCK) / (double)(chip->clock);
 	for (i = 0; i < 256; i++)
 	{
-		chip->lut_lfo[i] = LFO_frequency_table[i] * clock_correction;
+		lut_lfo = LFO_frequency_table[i] * clock_correction;
+		chip->lut_lfo_step[i] = (int)((((double)LFO_LENGTH * lut_lfo) / 44100.0) * 256.0);
 	}
 
 	for (i = 0; i < 64; i++)
 	{
 		// attack rate in number of samples
-		chip->lut_ar[i] = (ARTime[i] * clock_correction * 44100.0) / 1000.0;
+		lut_ar = (ARTime[i] * clock_correction * 44100.0) / 1000.0;
+		chip->lut_ar_step[i] = (i < 4) ? 0 : (int)(((double)(255-0) / lut_ar) * 65536.0);
 	}
 	for (i = 0; i < 64; i++)
 	{
 		// decay/release rate in number of samples
-		chip->lut_dc[i] = (DCTime[i] * clock_correction * 44100.0) / 1000.0;
+		lut_dc = (DCTime[i] * clock_correction * 44100.0) / 1000.0;
+		chip->lut_dc_step[i] = (i < 4) ? 0 : (int)(((double)(255-0) / lut_dc) * 65536.0);
+		// decay1 goes down by (decay1lvl << 4)
+		for (j = 0; j < 16; j++)
+			chip->lut_d1_step[j][i] = (i < 4) ? 0 : (int)(((double)(j << 4) / lut_dc) * 65536.0);
 	}
 }
 
+
 static UINT8 device_start_ymf271(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf)
 {
 	YMF271Chip *chip;
@@ -1877,7 +1830,8 @@ static UINT8 device_start_ymf271(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf)
 	chip->ext_write_handler = NULL;
 	chip->ext_param = NULL;
 
-	init_tables(chip);
+	init_chip_tables(chip);
+	chip->fixed_point = 0;
 
 	chip->mixbuf_smpls = rate / 10;
 	chip->mix_buffer = (INT32*)malloc(chip->mixbuf_smpls*2 * sizeof(INT32));
@@ -1892,19 +1846,10 @@ static UINT8 device_start_ymf271(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf)
 
 void device_stop_ymf271(void *info)
 {
-	int i;
 	YMF271Chip *chip = (YMF271Chip *)info;
 	
 	free(chip->mem_base);	chip->mem_base = NULL;
 	
-	for (i=0; i < 8; i++)
-		free(chip->lut_waves[i]);
-	for (i = 0; i < 4*8; i++)
-		free(chip->lut_plfo[i>>3][i&7]);
-	
-	for (i = 0; i < 4; i++)
-		free(chip->lut_alfo[i]);
-	
 	free(chip->mix_buffer);
 	free(chip);
 	
@@ -1962,6 +1907,15 @@ static void ymf271_write_rom(void *info, UINT32 offset, UINT32 length, const UIN
 	return;
 }
 
+static void ymf271_set_options(void *info, UINT32 options)
+{
+	YMF271Chip *chip = (YMF271Chip *)info;
+	
+	chip->fixed_point = (options & OPT_YMF271_FIXED_POINT) ? 1 : 0;
+	
+	return;
+}
+
 static void ymf271_set_mute_mask(void *info, UINT32 MuteMask)
 {
 	YMF271Chip *chip = (YMF271Chip *)info;
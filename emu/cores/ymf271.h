@@ -3,6 +3,8 @@
 
 #include "../EmuStructs.h"
 
+#define OPT_YMF271_FIXED_POINT	0x01	// calculate the LFO phase modulation using integer math (default: disabled)
+
 extern const DEV_DECL sndDev_YMF271;
 
 #endif	// __YMF271_H__
@@ -0,0 +1,3423 @@
+// Lookup tables for ymf271.c
+// generated by tables_gen.c - do not edit
+
+static const INT16 lut_waves[8][SIN_LEN] =
+{
+	{
+		100, 301, 502, 703, 904, 1105, 1306, 1507,
+		1708, 1909, 2109, 2310, 2510, 2711, 2911, 3111,
+		3311, 3511, 3711, 3911, 4110, 4310, 4509, 4708,
+		4907, 5106, 5304, 5503, 5701, 5898, 6096, 6294,
+		6491, 6688, 6884, 7081, 7277, 7473, 7669, 7864,
+		8059, 8254, 8448, 8642, 8836, 9029, 9223, 9415,
+		9608, 9800, 9991, 10183, 10374, 10564, 10754, 10944,
+		11133, 11322, 11511, 11699, 11886, 12073, 12260, 12446,
+		12632, 12817, 13002, 13186, 13370, 13554, 13736, 13919,
+		14100, 14282, 14462, 14642, 14822, 15001, 15180, 15357,
+		15535, 15712, 15888, 16063, 16238, 16413, 16586, 16759,
+		16932, 17104, 17275, 17445, 17615, 17784, 17953, 18121,
+		18288, 18454, 18620, 18785, 18950, 19113, 19276, 19439,
+		19600, 19761, 19921, 20080, 20239, 20396, 20553, 20709,
+		20865, 21020, 21173, 21326, 21479, 21630, 21781, 21931,
+		22080, 22228, 22375, 22521, 22667, 22812, 22956, 23099,
+		23241, 23382, 23523, 23662, 23801, 23939, 24075, 24211,
+		24346, 24480, 24614, 24746, 24877, 25008, 25137, 25266,
+		25393, 25520, 25645, 25770, 25894, 26016, 26138, 26259,
+		26379, 26498, 26615, 26732, 26848, 26963, 27076, 27189,
+		27301, 27411, 27521, 27630, 27737, 27844, 27949, 28054,
+		28157, 28259, 28361, 28461, 28560, 28658, 28755, 28851,
+		28946, 29039, 29132, 29223, 29314, 29403, 29491, 29578,
+		29664, 29749, 29833, 29915, 29997, 30077, 30156, 30235,
+		30312, 30387, 30462, 30535, 30608, 30679, 30749, 30818,
+		30886, 30952, 31018, 31082, 31145, 31207, 31268, 31327,
+		31386, 31443, 31499, 31554, 31607, 31660, 31711, 31761,
+		31810, 31857, 31904, 31949, 31993, 32036, 32078, 32118,
+		32157, 32195, 32232, 32268, 32302, 32335, 32367, 32398,
+		32427, 32456, 32483, 32509, 32533, 32557, 32579, 32600,
+		32619, 32638, 32655, 32671, 32686, 32700, 32712, 32723,
+		32733, 32741, 32749, 32755, 32760, 32764, 32766, 32767,
+		32767, 32766, 32764, 32760, 32755, 32749, 32741, 32733,
+		32723, 32712, 32700, 32686, 32671, 32655, 32638, 32619,
+		32600, 32579, 32557, 32533, 32509, 32483, 32456, 32427,
+		32398, 32367, 32335, 32302, 32268, 32232, 32195, 32157,
+		32118, 32078, 32036, 31993, 31949, 31904, 31857, 31810,
+		31761, 31711, 31660, 31607, 31554, 31499, 31443, 31386,
+		31327, 31268, 31207, 31145, 31082, 31018, 30952, 30886,
+		30818, 30749, 30679, 30608, 30535, 30462, 30387, 30312,
+		30235, 30156, 30077, 29997, 29915, 29833, 29749, 29664,
+		29578, 29491, 29403, 29314, 29223, 29132, 29039, 28946,
+		28851, 28755, 28658, 28560, 28461, 28361, 28259, 28157,
+		28054, 27949, 27844, 27737, 27630, 27521, 27411, 27301,
+		27189, 27076, 26963, 26848, 26732, 26615, 26498, 26379,
+		26259, 26138, 26016, 25894, 25770, 25645, 25520, 25393,
+		25266, 25137, 25008, 24877, 24746, 24614, 24480, 24346,
+		24211, 24075, 23939, 23801, 23662, 23523, 23382, 23241,
+		23099, 22956, 22812, 22667, 22521, 22375, 22228, 22080,
+		21931, 21781, 21630, 21479, 21326, 21173, 21020, 20865,
+		20709, 20553, 20396, 20239, 20080, 19921, 19761, 19600,
+		19439, 19276, 19113, 18950, 18785, 18620, 18454, 18288,
+		18121, 17953, 17784, 17615, 17445, 17275, 17104, 16932,
+		16759, 16586, 16413, 16238, 16063, 15888, 15712, 15535,
+		15357, 15180, 15001, 14822, 14642, 14462, 14282, 14100,
+		13919, 13736, 13554, 13370, 13186, 13002, 12817, 12632,
+		12446, 12260, 12073, 11886, 11699, 11511, 11322, 11133,
+		10944, 10754, 10564, 10374, 10183, 9991, 9800, 9608,
+		9415, 9223, 9029, 8836, 8642, 8448, 8254, 8059,
+		7864, 7669, 7473, 7277, 7081, 6884, 6688, 6491,
+		6294, 6096, 5898, 5701, 5503, 5304, 5106, 4907,
+		4708, 4509, 4310, 4110, 3911, 3711, 3511, 3311,
+		3111, 2911, 2711, 2510, 2310, 2109, 1909, 1708,
+		1507, 1306, 1105, 904, 703, 502, 301, 100,
+		-100, -301, -502, -703, -904, -1105, -1306, -1507,
+		-1708, -1909, -2109, -2310, -2510, -2711, -2911, -3111,
+		-3311, -3511, -3711, -3911, -4110, -4310, -4509, -4708,
+		-4907, -5106, -5304, -5503, -5701, -5898, -6096, -6294,
+		-6491, -6688, -6884, -7081, -7277, -7473, -7669, -7864,
+		-8059, -8254, -8448, -8642, -8836, -9029, -9223, -9415,
+		-9608, -9800, -9991, -10183, -10374, -10564, -10754, -10944,
+		-11133, -11322, -11511, -11699, -11886, -12073, -12260, -12446,
+		-12632, -12817, -13002, -13186, -13370, -13554, -13736, -13919,
+		-14100, -14282, -14462, -14642, -14822, -15001, -15180, -15357,
+		-15535, -15712, -15888, -16063, -16238, -16413, -16586, -16759,
+		-16932, -17104, -17275, -17445, -17615, -17784, -17953, -18121,
+		-18288, -18454, -18620, -18785, -18950, -19113, -19276, -19439,
+		-19600, -19761, -19921, -20080, -20239, -20396, -20553, -20709,
+		-20865, -21020, -21173, -21326, -21479, -21630, -21781, -21931,
+		-22080, -22228, -22375, -22521, -22667, -22812, -22956, -23099,
+		-23241, -23382, -23523, -23662, -23801, -23939, -24075, -24211,
+		-24346, -24480, -24614, -24746, -24877, -25008, -25137, -25266,
+		-25393, -25520, -25645, -25770, -25894, -26016, -26138, -26259,
+		-26379, -26498, -26615, -26732, -26848, -26963, -27076, -27189,
+		-27301, -27411, -27521, -27630, -27737, -27844, -27949, -28054,
+		-28157, -28259, -28361, -28461, -28560, -28658, -28755, -28851,
+		-28946, -29039, -29132, -29223, -29314, -29403, -29491, -29578,
+		-29664, -29749, -29833, -29915, -29997, -30077, -30156, -30235,
+		-30312, -30387, -30462, -30535, -30608, -30679, -30749, -30818,
+		-30886, -30952, -31018, -31082, -31145, -31207, -31268, -31327,
+		-31386, -31443, -31499, -31554, -31607, -31660, -31711, -31761,
+		-31810, -31857, -31904, -31949, -31993, -32036, -32078, -32118,
+		-32157, -32195, -32232, -32268, -32302, -32335, -32367, -32398,
+		-32427, -32456, -32483, -32509, -32533, -32557, -32579, -32600,
+		-32619, -32638, -32655, -32671, -32686, -32700, -32712, -32723,
+		-32733, -32741, -32749, -32755, -32760, -32764, -32766, -32767,
+		-32767, -32766, -32764, -32760, -32755, -32749, -32741, -32733,
+		-32723, -32712, -32700, -32686, -32671, -32655, -32638, -32619,
+		-32600, -32579, -32557, -32533, -32509, -32483, -32456, -32427,
+		-32398, -32367, -32335, -32302, -32268, -32232, -32195, -32157,
+		-32118, -32078, -32036, -31993, -31949, -31904, -31857, -31810,
+		-31761, -31711, -31660, -31607, -31554, -31499, -31443, -31386,
+		-31327, -31268, -31207, -31145, -31082, -31018, -30952, -30886,
+		-30818, -30749, -30679, -30608, -30535, -30462, -30387, -30312,
+		-30235, -30156, -30077, -29997, -29915, -29833, -29749, -29664,
+		-29578, -29491, -29403, -29314, -29223, -29132, -29039, -28946,
+		-28851, -28755, -28658, -28560, -28461, -28361, -28259, -28157,
+		-28054, -27949, -27844, -27737, -27630, -27521, -27411, -27301,
+		-27189, -27076, -26963, -26848, -26732, -26615, -26498, -26379,
+		-26259, -26138, -26016, -25894, -25770, -25645, -25520, -25393,
+		-25266, -25137, -25008, -24877, -24746, -24614, -24480, -24346,
+		-24211, -24075, -23939, -23801, -23662, -23523, -23382, -23241,
+		-23099, -22956, -22812, -22667, -22521, -22375, -22228, -22080,
+		-21931, -21781, -21630, -21479, -21326, -21173, -21020, -20865,
+		-20709, -20553, -20396, -20239, -20080, -19921, -19761, -19600,
+		-19439, -19276, -19113, -18950, -18785, -18620, -18454, -18288,
+		-18121, -17953, -17784, -17615, -17445, -17275, -17104, -16932,
+		-16759, -16586, -16413, -16238, -16063, -15888, -15712, -15535,
+		-15357, -15180, -15001, -14822, -14642, -14462, -14282, -14100,
+		-13919, -13736, -13554, -13370, -13186, -13002, -12817, -12632,
+		-12446, -12260, -12073, -11886, -11699, -11511, -11322, -11133,
+		-10944, -10754, -10564, -10374, -10183, -9991, -9800, -9608,
+		-9415, -9223, -9029, -8836, -8642, -8448, -8254, -8059,
+		-7864, -7669, -7473, -7277, -7081, -6884, -6688, -6491,
+		-6294, -6096, -5898, -5701, -5503, -5304, -5106, -4907,
+		-4708, -4509, -4310, -4110, -3911, -3711, -3511, -3311,
+		-3111, -2911, -2711, -2510, -2310, -2109, -1909, -1708,
+		-1507, -1306, -1105, -904, -703, -502, -301, -100
+	},
+	{
+		0, 2, 7, 15, 24, 37, 52, 69,
+		89, 111, 135, 162, 192, 224, 258, 295,
+		334, 376, 420, 466, 515, 566, 620, 676,
+		734, 795, 858, 924, 991, 1061, 1134, 1208,
+		1285, 1365, 1446, 1530, 1616, 1704, 1794, 1887,
+		1982, 2079, 2178, 2279, 2382, 2488, 2595, 2705,
+		2817, 2931, 3046, 3164, 3284, 3406, 3529, 3655,
+		3783, 3912, 4043, 4176, 4311, 4448, 4587, 4727,
+		4870, 5013, 5159, 5306, 5455, 5606, 5758, 5912,
+		6068, 6224, 6383, 6543, 6704, 6867, 7032, 7198,
+		7365, 7533, 7703, 7874, 8047, 8221, 8395, 8572,
+		8749, 8927, 9107, 9288, 9469, 9652, 9836, 10021,
+		10207, 10393, 10581, 10769, 10959, 11149, 11340, 11531,
+		11724, 11917, 12111, 12305, 12500, 12696, 12892, 13089,
+		13286, 13483, 13682, 13880, 14079, 14278, 14478, 14678,
+		14878, 15078, 15278, 15479, 15680, 15881, 16082, 16283,
+		16484, 16685, 16886, 17087, 17288, 17489, 17689, 17889,
+		18089, 18289, 18489, 18688, 18887, 19085, 19284, 19481,
+		19678, 19875, 20071, 20267, 20462, 20656, 20850, 21043,
+		21236, 21427, 21618, 21808, 21998, 22186, 22374, 22560,
+		22746, 22931, 23115, 23298, 23479, 23660, 23840, 24018,
+		24195, 24372, 24546, 24720, 24893, 25064, 25234, 25402,
+		25569, 25735, 25900, 26063, 26224, 26384, 26543, 26699,
+		26855, 27009, 27161, 27312, 27461, 27608, 27754, 27897,
+		28040, 28180, 28319, 28456, 28591, 28724, 28855, 28984,
+		29112, 29238, 29361, 29483, 29603, 29721, 29836, 29950,
+		30062, 30172, 30279, 30385, 30488, 30589, 30688, 30785,
+		30880, 30973, 31063, 31151, 31237, 31321, 31402, 31482,
+		31559, 31633, 31706, 31776, 31843, 31909, 31972, 32033,
+		32091, 32147, 32201, 32252, 32301, 32347, 32391, 32433,
+		32472, 32509, 32543, 32575, 32605, 32632, 32656, 32678,
+		32698, 32715, 32730, 32743, 32752, 32760, 32765, 32767,
+		32767, 32765, 32760, 32752, 32743, 32730, 32715, 32698,
+		32678, 32656, 32632, 32605, 32575, 32543, 32509, 32472,
+		32433, 32391, 32347, 32301, 32252, 32201, 32147, 32091,
+		32033, 31972, 31909, 31843, 31776, 31706, 31633, 31559,
+		31482, 31402, 31321, 31237, 31151, 31063, 30973, 30880,
+		30785, 30688, 30589, 30488, 30385, 30279, 30172, 30062,
+		29950, 29836, 29721, 29603, 29483, 29361, 29238, 29112,
+		28984, 28855, 28724, 28591, 28456, 28319, 28180, 28040,
+		27897, 27754, 27608, 27461, 27312, 27161, 27009, 26855,
+		26699, 26543, 26384, 26224, 26063, 25900, 25735, 25569,
+		25402, 25234, 25064, 24893, 24720, 24546, 24372, 24195,
+		24018, 23840, 23660, 23479, 23298, 23115, 22931, 22746,
+		22560, 22374, 22186, 21998, 21808, 21618, 21427, 21236,
+		21043, 20850, 20656, 20462, 20267, 20071, 19875, 19678,
+		19481, 19284, 19085, 18887, 18688, 18489, 18289, 18089,
+		17889, 17689, 17489, 17288, 17087, 16886, 16685, 16484,
+		16283, 16082, 15881, 15680, 15479, 15278, 15078, 14878,
+		14678, 14478, 14278, 14079, 13880, 13682, 13483, 13286,
+		13089, 12892, 12696, 12500, 12305, 12111, 11917, 11724,
+		11531, 11340, 11149, 10959, 10769, 10581, 10393, 10207,
+		10021, 9836, 9652, 9469, 9288, 9107, 8927, 8749,
+		8572, 8395, 8221, 8047, 7874, 7703, 7533, 7365,
+		7198, 7032, 6867, 6704, 6543, 6383, 6224, 6068,
+		5912, 5758, 5606, 5455, 5306, 5159, 5013, 4870,
+		4727, 4587, 4448, 4311, 4176, 4043, 3912, 3783,
+		3655, 3529, 3406, 3284, 3164, 3046, 2931, 2817,
+		2705, 2595, 2488, 2382, 2279, 2178, 2079, 1982,
+		1887, 1794, 1704, 1616, 1530, 1446, 1365, 1285,
+		1208, 1134, 1061, 991, 924, 858, 795, 734,
+		676, 620, 566, 515, 466, 420, 376, 334,
+		295, 258, 224, 192, 162, 135, 111, 89,
+		69, 52, 37, 24, 15, 7, 2, 0,
+		0, -2, -7, -15, -24, -37, -52, -69,
+		-89, -111, -135, -162, -192, -224, -258, -295,
+		-334, -376, -420, -466, -515, -566, -620, -676,
+		-734, -795, -858, -924, -991, -1061, -1134, -1208,
+		-1285, -1365, -1446, -1530, -1616, -1704, -1794, -1887,
+		-1982, -2079, -2178, -2279, -2382, -2488, -2595, -2705,
+		-2817, -2931, -3046, -3164, -3284, -3406, -3529, -3655,
+		-3783, -3912, -4043, -4176, -4311, -4448, -4587, -4727,
+		-4870, -5013, -5159, -5306, -5455, -5606, -5758, -5912,
+		-6068, -6224, -6383, -6543, -6704, -6867, -7032, -7198,
+		-7365, -7533, -7703, -7874, -8047, -8221, -8395, -8572,
+		-8749, -8927, -9107, -9288, -9469, -9652, -9836, -10021,
+		-10207, -10393, -10581, -10769, -10959, -11149, -11340, -11531,
+		-11724, -11917, -12111, -12305, -12500, -12696, -12892, -13089,
+		-13286, -13483, -13682, -13880, -14079, -14278, -14478, -14678,
+		-14878, -15078, -15278, -15479, -15680, -15881, -16082, -16283,
+		-16484, -16685, -16886, -17087, -17288, -17489, -17689, -17889,
+		-18089, -18289, -18489, -18688, -18887, -19085, -19284, -19481,
+		-19678, -19875, -20071, -20267, -20462, -20656, -20850, -21043,
+		-21236, -21427, -21618, -21808, -21998, -22186, -22374, -22560,
+		-22746, -22931, -23115, -23298, -23479, -23660, -23840, -24018,
+		-24195, -24372, -24546, -24720, -24893, -25064, -25234, -25402,
+		-25569, -25735, -25900, -26063, -26224, -26384, -26543, -26699,
+		-26855, -27009, -27161, -27312, -27461, -27608, -27754, -27897,
+		-28040, -28180, -28319, -28456, -28591, -28724, -28855, -28984,
+		-29112, -29238, -29361, -29483, -29603, -29721, -29836, -29950,
+		-30062, -30172, -30279, -30385, -30488, -30589, -30688, -30785,
+		-30880, -30973, -31063, -31151, -31237, -31321, -31402, -31482,
+		-31559, -31633, -31706, -31776, -31843, -31909, -31972, -32033,
+		-32091, -32147, -32201, -32252, -32301, -32347, -32391, -32433,
+		-32472, -32509, -32543, -32575, -32605, -32632, -32656, -32678,
+		-32698, -32715, -32730, -32743, -32752, -32760, -32765, -32767,
+		-32767, -32765, -32760, -32752, -32743, -32730, -32715, -32698,
+		-32678, -32656, -32632, -32605, -32575, -32543, -32509, -32472,
+		-32433, -32391, -32347, -32301, -32252, -32201, -32147, -32091,
+		-32033, -31972, -31909, -31843, -31776, -31706, -31633, -31559,
+		-31482, -31402, -31321, -31237, -31151, -31063, -30973, -30880,
+		-30785, -30688, -30589, -30488, -30385, -30279, -30172, -30062,
+		-29950, -29836, -29721, -29603, -29483, -29361, -29238, -29112,
+		-28984, -28855, -28724, -28591, -28456, -28319, -28180, -28040,
+		-27897, -27754, -27608, -27461, -27312, -27161, -27009, -26855,
+		-26699, -26543, -26384, -26224, -26063, -25900, -25735, -25569,
+		-25402, -25234, -25064, -24893, -24720, -24546, -24372, -24195,
+		-24018, -23840, -23660, -23479, -23298, -23115, -22931, -22746,
+		-22560, -22374, -22186, -21998, -21808, -21618, -21427, -21236,
+		-21043, -20850, -20656, -20462, -20267, -20071, -19875, -19678,
+		-19481, -19284, -19085, -18887, -18688, -18489, -18289, -18089,
+		-17889, -17689, -17489, -17288, -17087, -16886, -16685, -16484,
+		-16283, -16082, -15881, -15680, -15479, -15278, -15078, -14878,
+		-14678, -14478, -14278, -14079, -13880, -13682, -13483, -13286,
+		-13089, -12892, -12696, -12500, -12305, -12111, -11917, -11724,
+		-11531, -11340, -11149, -10959, -10769, -10581, -10393, -10207,
+		-10021, -9836, -9652, -9469, -9288, -9107, -8927, -8749,
+		-8572, -8395, -8221, -8047, -7874, -7703, -7533, -7365,
+		-7198, -7032, -6867, -6704, -6543, -6383, -6224, -6068,
+		-5912, -5758, -5606, -5455, -5306, -5159, -5013, -4870,
+		-4727, -4587, -4448, -4311, -4176, -4043, -3912, -3783,
+		-3655, -3529, -3406, -3284, -3164, -3046, -2931, -2817,
+		-2705, -2595, -2488, -2382, -2279, -2178, -2079, -1982,
+		-1887, -1794, -1704, -1616, -1530, -1446, -1365, -1285,
+		-1208, -1134, -1061, -991, -924, -858, -795, -734,
+		-676, -620, -566, -515, -466, -420, -376, -334,
+		-295, -258, -224, -192, -162, -135, -111, -89,
+		-69, -52, -37, -24, -15, -7, -2, 0
+	},
+	{
+		100, 301, 502, 703, 904, 1105, 1306, 1507,
+		1708, 1909, 2109, 2310, 2510, 2711, 2911, 3111,
+		3311, 3511, 3711, 3911, 4110, 4310, 4509, 4708,
+		4907, 5106, 5304, 5503, 5701, 5898, 6096, 6294,
+		6491, 6688, 6884, 7081, 7277, 7473, 7669, 7864,
+		8059, 8254, 8448, 8642, 8836, 9029, 9223, 9415,
+		9608, 9800, 9991, 10183, 10374, 10564, 10754, 10944,
+		11133, 11322, 11511, 11699, 11886, 12073, 12260, 12446,
+		12632, 12817, 13002, 13186, 13370, 13554, 13736, 13919,
+		14100, 14282, 14462, 14642, 14822, 15001, 15180, 15357,
+		15535, 15712, 15888, 16063, 16238, 16413, 16586, 16759,
+		16932, 17104, 17275, 17445, 17615, 17784, 17953, 18121,
+		18288, 18454, 18620, 18785, 18950, 19113, 19276, 19439,
+		19600, 19761, 19921, 20080, 20239, 20396, 20553, 20709,
+		20865, 21020, 21173, 21326, 21479, 21630, 21781, 21931,
+		22080, 22228, 22375, 22521, 22667, 22812, 22956, 23099,
+		23241, 23382, 23523, 23662, 23801, 23939, 24075, 24211,
+		24346, 24480, 24614, 24746, 24877, 25008, 25137, 25266,
+		25393, 25520, 25645, 25770, 25894, 26016, 26138, 26259,
+		26379, 26498, 26615, 26732, 26848, 26963, 27076, 27189,
+		27301, 27411, 27521, 27630, 27737, 27844, 27949, 28054,
+		28157, 28259, 28361, 28461, 28560, 28658, 28755, 28851,
+		28946, 29039, 29132, 29223, 29314, 29403, 29491, 29578,
+		29664, 29749, 29833, 29915, 29997, 30077, 30156, 30235,
+		30312, 30387, 30462, 30535, 30608, 30679, 30749, 30818,
+		30886, 30952, 31018, 31082, 31145, 31207, 31268, 31327,
+		31386, 31443, 31499, 31554, 31607, 31660, 31711, 31761,
+		31810, 31857, 31904, 31949, 31993, 32036, 32078, 32118,
+		32157, 32195, 32232, 32268, 32302, 32335, 32367, 32398,
+		32427, 32456, 32483, 32509, 32533, 32557, 32579, 32600,
+		32619, 32638, 32655, 32671, 32686, 32700, 32712, 32723,
+		32733, 32741, 32749, 32755, 32760, 32764, 32766, 32767,
+		32767, 32766, 32764, 32760, 32755, 32749, 32741, 32733,
+		32723, 32712, 32700, 32686, 32671, 32655, 32638, 32619,
+		32600, 32579, 32557, 32533, 32509, 32483, 32456, 32427,
+		32398, 32367, 32335, 32302, 32268, 32232, 32195, 32157,
+		32118, 32078, 32036, 31993, 31949, 31904, 31857, 31810,
+		31761, 31711, 31660, 31607, 31554, 31499, 31443, 31386,
+		31327, 31268, 31207, 31145, 31082, 31018, 30952, 30886,
+		30818, 30749, 30679, 30608, 30535, 30462, 30387, 30312,
+		30235, 30156, 30077, 29997, 29915, 29833, 29749, 29664,
+		29578, 29491, 29403, 29314, 29223, 29132, 29039, 28946,
+		28851, 28755, 28658, 28560, 28461, 28361, 28259, 28157,
+		28054, 27949, 27844, 27737, 27630, 27521, 27411, 27301,
+		27189, 27076, 26963, 26848, 26732, 26615, 26498, 26379,
+		26259, 26138, 26016, 25894, 25770, 25645, 25520, 25393,
+		25266, 25137, 25008, 24877, 24746, 24614, 24480, 24346,
+		24211, 24075, 23939, 23801, 23662, 23523, 23382, 23241,
+		23099, 22956, 22812, 22667, 22521, 22375, 22228, 22080,
+		21931, 21781, 21630, 21479, 21326, 21173, 21020, 20865,
+		20709, 20553, 20396, 20239, 20080, 19921, 19761, 19600,
+		19439, 19276, 19113, 18950, 18785, 18620, 18454, 18288,
+		18121, 17953, 17784, 17615, 17445, 17275, 17104, 16932,
+		16759, 16586, 16413, 16238, 16063, 15888, 15712, 15535,
+		15357, 15180, 15001, 14822, 14642, 14462, 14282, 14100,
+		13919, 13736, 13554, 13370, 13186, 13002, 12817, 12632,
+		12446, 12260, 12073, 11886, 11699, 11511, 11322, 11133,
+		10944, 10754, 10564, 10374, 10183, 9991, 9800, 9608,
+		9415, 9223, 9029, 8836, 8642, 8448, 8254, 8059,
+		7864, 7669, 7473, 7277, 7081, 6884, 6688, 6491,
+		6294, 6096, 5898, 5701, 5503, 5304, 5106, 4907,
+		4708, 4509, 4310, 4110, 3911, 3711, 3511, 3311,
+		3111, 2911, 2711, 2510, 2310, 2109, 1909, 1708,
+		1507, 1306, 1105, 904, 703, 502, 301, 100,
+		100, 301, 502, 703, 904, 1105, 1306, 1507,
+		1708, 1909, 2109, 2310, 2510, 2711, 2911, 3111,
+		3311, 3511, 3711, 3911, 4110, 4310, 4509, 4708,
+		4907, 5106, 5304, 5503, 5701, 5898, 6096, 6294,
+		6491, 6688, 6884, 7081, 7277, 7473, 7669, 7864,
+		8059, 8254, 8448, 8642, 8836, 9029, 9223, 9415,
+		9608, 9800, 9991, 10183, 10374, 10564, 10754, 10944,
+		11133, 11322, 11511, 11699, 11886, 12073, 12260, 12446,
+		12632, 12817, 13002, 13186, 13370, 13554, 13736, 13919,
+		14100, 14282, 14462, 14642, 14822, 15001, 15180, 15357,
+		15535, 15712, 15888, 16063, 16238, 16413, 16586, 16759,
+		16932, 17104, 17275, 17445, 17615, 17784, 17953, 18121,
+		18288, 18454, 18620, 18785, 18950, 19113, 19276, 19439,
+		19600, 19761, 19921, 20080, 20239, 20396, 20553, 20709,
+		20865, 21020, 21173, 21326, 21479, 21630, 21781, 21931,
+		22080, 22228, 22375, 22521, 22667, 22812, 22956, 23099,
+		23241, 23382, 23523, 23662, 23801, 23939, 24075, 24211,
+		24346, 24480, 24614, 24746, 24877, 25008, 25137, 25266,
+		25393, 25520, 25645, 25770, 25894, 26016, 26138, 26259,
+		26379, 26498, 26615, 26732, 26848, 26963, 27076, 27189,
+		27301, 27411, 27521, 27630, 27737, 27844, 27949, 28054,
+		28157, 28259, 28361, 28461, 28560, 28658, 28755, 28851,
+		28946, 29039, 29132, 29223, 29314, 29403, 29491, 29578,
+		29664, 29749, 29833, 29915, 29997, 30077, 30156, 30235,
+		30312, 30387, 30462, 30535, 30608, 30679, 30749, 30818,
+		30886, 30952, 31018, 31082, 31145, 31207, 31268, 31327,
+		31386, 31443, 31499, 31554, 31607, 31660, 31711, 31761,
+		31810, 31857, 31904, 31949, 31993, 32036, 32078, 32118,
+		32157, 32195, 32232, 32268, 32302, 32335, 32367, 32398,
+		32427, 32456, 32483, 32509, 32533, 32557, 32579, 32600,
+		32619, 32638, 32655, 32671, 32686, 32700, 32712, 32723,
+		32733, 32741, 32749, 32755, 32760, 32764, 32766, 32767,
+		32767, 32766, 32764, 32760, 32755, 32749, 32741, 32733,
+		32723, 32712, 32700, 32686, 32671, 32655, 32638, 32619,
+		32600, 32579, 32557, 32533, 32509, 32483, 32456, 32427,
+		32398, 32367, 32335, 32302, 32268, 32232, 32195, 32157,
+		32118, 32078, 32036, 31993, 31949, 31904, 31857, 31810,
+		31761, 31711, 31660, 31607, 31554, 31499, 31443, 31386,
+		31327, 31268, 31207, 31145, 31082, 31018, 30952, 30886,
+		30818, 30749, 30679, 30608, 30535, 30462, 30387, 30312,
+		30235, 30156, 30077, 29997, 29915, 29833, 29749, 29664,
+		29578, 29491, 29403, 29314, 29223, 29132, 29039, 28946,
+		28851, 28755, 28658, 28560, 28461, 28361, 28259, 28157,
+		28054, 27949, 27844, 27737, 27630, 27521, 27411, 27301,
+		27189, 27076, 26963, 26848, 26732, 26615, 26498, 26379,
+		26259, 26138, 26016, 25894, 25770, 25645, 25520, 25393,
+		25266, 25137, 25008, 24877, 24746, 24614, 24480, 24346,
+		24211, 24075, 23939, 23801, 23662, 23523, 23382, 23241,
+		23099, 22956, 22812, 22667, 22521, 22375, 22228, 22080,
+		21931, 21781, 21630, 21479, 21326, 21173, 21020, 20865,
+		20709, 20553, 20396, 20239, 20080, 19921, 19761, 19600,
+		19439, 19276, 19113, 18950, 18785, 18620, 18454, 18288,
+		18121, 17953, 17784, 17615, 17445, 17275, 17104, 16932,
+		16759, 16586, 16413, 16238, 16063, 15888, 15712, 15535,
+		15357, 15180, 15001, 14822, 14642, 14462, 14282, 14100,
+		13919, 13736, 13554, 13370, 13186, 13002, 12817, 12632,
+		12446, 12260, 12073, 11886, 11699, 11511, 11322, 11133,
+		10944, 10754, 10564, 10374, 10183, 9991, 9800, 9608,
+		9415, 9223, 9029, 8836, 8642, 8448, 8254, 8059,
+		7864, 7669, 7473, 7277, 7081, 6884, 6688, 6491,
+		6294, 6096, 5898, 5701, 5503, 5304, 5106, 4907,
+		4708, 4509, 4310, 4110, 3911, 3711, 3511, 3311,
+		3111, 2911, 2711, 2510, 2310, 2109, 1909, 1708,
+		1507, 1306, 1105, 904, 703, 502, 301, 100
+	},
+	{
+		100, 301, 502, 703, 904, 1105, 1306, 1507,
+		1708, 1909, 2109, 2310, 2510, 2711, 2911, 3111,
+		3311, 3511, 3711, 3911, 4110, 4310, 4509, 4708,
+		4907, 5106, 5304, 5503, 5701, 5898, 6096, 6294,
+		6491, 6688, 6884, 7081, 7277, 7473, 7669, 7864,
+		8059, 8254, 8448, 8642, 8836, 9029, 9223, 9415,
+		9608, 9800, 9991, 10183, 10374, 10564, 10754, 10944,
+		11133, 11322, 11511, 11699, 11886, 12073, 12260, 12446,
+		12632, 12817, 13002, 13186, 13370, 13554, 13736, 13919,
+		14100, 14282, 14462, 14642, 14822, 15001, 15180, 15357,
+		15535, 15712, 15888, 16063, 16238, 16413, 16586, 16759,
+		16932, 17104, 17275, 17445, 17615, 17784, 17953, 18121,
+		18288, 18454, 18620, 18785, 18950, 19113, 19276, 19439,
+		19600, 19761, 19921, 20080, 20239, 20396, 20553, 20709,
+		20865, 21020, 21173, 21326, 21479, 21630, 21781, 21931,
+		22080, 22228, 22375, 22521, 22667, 22812, 22956, 23099,
+		23241, 23382, 23523, 23662, 23801, 23939, 24075, 24211,
+		24346, 24480, 24614, 24746, 24877, 25008, 25137, 25266,
+		25393, 25520, 25645, 25770, 25894, 26016, 26138, 26259,
+		26379, 26498, 26615, 26732, 26848, 26963, 27076, 27189,
+		27301, 27411, 27521, 27630, 27737, 27844, 27949, 28054,
+		28157, 28259, 28361, 28461, 28560, 28658, 28755, 28851,
+		28946, 29039, 29132, 29223, 29314, 29403, 29491, 29578,
+		29664, 29749, 29833, 29915, 29997, 30077, 30156, 30235,
+		30312, 30387, 30462, 30535, 30608, 30679, 30749, 30818,
+		30886, 30952, 31018, 31082, 31145, 31207, 31268, 31327,
+		31386, 31443, 31499, 31554, 31607, 31660, 31711, 31761,
+		31810, 31857, 31904, 31949, 31993, 32036, 32078, 32118,
+		32157, 32195, 32232, 32268, 32302, 32335, 32367, 32398,
+		32427, 32456, 32483, 32509, 32533, 32557, 32579, 32600,
+		32619, 32638, 32655, 32671, 32686, 32700, 32712, 32723,
+		32733, 32741, 32749, 32755, 32760, 32764, 32766, 32767,
+		32767, 32766, 32764, 32760, 32755, 32749, 32741, 32733,
+		32723, 32712, 32700, 32686, 32671, 32655, 32638, 32619,
+		32600, 32579, 32557, 32533, 32509, 32483, 32456, 32427,
+		32398, 32367, 32335, 32302, 32268, 32232, 32195, 32157,
+		32118, 32078, 32036, 31993, 31949, 31904, 31857, 31810,
+		31761, 31711, 31660, 31607, 31554, 31499, 31443, 31386,
+		31327, 31268, 31207, 31145, 31082, 31018, 30952, 30886,
+		30818, 30749, 30679, 30608, 30535, 30462, 30387, 30312,
+		30235, 30156, 30077, 29997, 29915, 29833, 29749, 29664,
+		29578, 29491, 29403, 29314, 29223, 29132, 29039, 28946,
+		28851, 28755, 28658, 28560, 28461, 28361, 28259, 28157,
+		28054, 27949, 27844, 27737, 27630, 27521, 27411, 27301,
+		27189, 27076, 26963, 26848, 26732, 26615, 26498, 26379,
+		26259, 26138, 26016, 25894, 25770, 25645, 25520, 25393,
+		25266, 25137, 25008, 24877, 24746, 24614, 24480, 24346,
+		24211, 24075, 23939, 23801, 23662, 23523, 23382, 23241,
+		23099, 22956, 22812, 22667, 22521, 22375, 22228, 22080,
+		21931, 21781, 21630, 21479, 21326, 21173, 21020, 20865,
+		20709, 20553, 20396, 20239, 20080, 19921, 19761, 19600,
+		19439, 19276, 19113, 18950, 18785, 18620, 18454, 18288,
+		18121, 17953, 17784, 17615, 17445, 17275, 17104, 16932,
+		16759, 16586, 16413, 16238, 16063, 15888, 15712, 15535,
+		15357, 15180, 15001, 14822, 14642, 14462, 14282, 14100,
+		13919, 13736, 13554, 13370, 13186, 13002, 12817, 12632,
+		12446, 12260, 12073, 11886, 11699, 11511, 11322, 11133,
+		10944, 10754, 10564, 10374, 10183, 9991, 9800, 9608,
+		9415, 9223, 9029, 8836, 8642, 8448, 8254, 8059,
+		7864, 7669, 7473, 7277, 7081, 6884, 6688, 6491,
+		6294, 6096, 5898, 5701, 5503, 5304, 5106, 4907,
+		4708, 4509, 4310, 4110, 3911, 3711, 3511, 3311,
+		3111, 2911, 2711, 2510, 2310, 2109, 1909, 1708,
+		1507, 1306, 1105, 904, 703, 502, 301, 100,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0
+	},
+	{
+		100, 502, 904, 1306, 1708, 2109, 2510, 2911,
+		3311, 3711, 4110, 4509, 4907, 5304, 5701, 6096,
+		6491, 6884, 7277, 7669, 8059, 8448, 8836, 9223,
+		9608, 9991, 10374, 10754, 11133, 11511, 11886, 12260,
+		12632, 13002, 13370, 13736, 14100, 14462, 14822, 15180,
+		15535, 15888, 16238, 16586, 16932, 17275, 17615, 17953,
+		18288, 18620, 18950, 19276, 19600, 19921, 20239, 20553,
+		20865, 21173, 21479, 21781, 22080, 22375, 22667, 22956,
+		23241, 23523, 23801, 24075, 24346, 24614, 24877, 25137,
+		25393, 25645, 25894, 26138, 26379, 26615, 26848, 27076,
+		27301, 27521, 27737, 27949, 28157, 28361, 28560, 28755,
+		28946, 29132, 29314, 29491, 29664, 29833, 29997, 30156,
+		30312, 30462, 30608, 30749, 30886, 31018, 31145, 31268,
+		31386, 31499, 31607, 31711, 31810, 31904, 31993, 32078,
+		32157, 32232, 32302, 32367, 32427, 32483, 32533, 32579,
+		32619, 32655, 32686, 32712, 32733, 32749, 32760, 32766,
+		32767, 32764, 32755, 32741, 32723, 32700, 32671, 32638,
+		32600, 32557, 32509, 32456, 32398, 32335, 32268, 32195,
+		32118, 32036, 31949, 31857, 31761, 31660, 31554, 31443,
+		31327, 31207, 31082, 30952, 30818, 30679, 30535, 30387,
+		30235, 30077, 29915, 29749, 29578, 29403, 29223, 29039,
+		28851, 28658, 28461, 28259, 28054, 27844, 27630, 27411,
+		27189, 26963, 26732, 26498, 26259, 26016, 25770, 25520,
+		25266, 25008, 24746, 24480, 24211, 23939, 23662, 23382,
+		23099, 22812, 22521, 22228, 21931, 21630, 21326, 21020,
+		20709, 20396, 20080, 19761, 19439, 19113, 18785, 18454,
+		18121, 17784, 17445, 17104, 16759, 16413, 16063, 15712,
+		15357, 15001, 14642, 14282, 13919, 13554, 13186, 12817,
+		12446, 12073, 11699, 11322, 10944, 10564, 10183, 9800,
+		9415, 9029, 8642, 8254, 7864, 7473, 7081, 6688,
+		6294, 5898, 5503, 5106, 4708, 4310, 3911, 3511,
+		3111, 2711, 2310, 1909, 1507, 1105, 703, 301,
+		-100, -502, -904, -1306, -1708, -2109, -2510, -2911,
+		-3311, -3711, -4110, -4509, -4907, -5304, -5701, -6096,
+		-6491, -6884, -7277, -7669, -8059, -8448, -8836, -9223,
+		-9608, -9991, -10374, -10754, -11133, -11511, -11886, -12260,
+		-12632, -13002, -13370, -13736, -14100, -14462, -14822, -15180,
+		-15535, -15888, -16238, -16586, -16932, -17275, -17615, -17953,
+		-18288, -18620, -18950, -19276, -19600, -19921, -20239, -20553,
+		-20865, -21173, -21479, -21781, -22080, -22375, -22667, -22956,
+		-23241, -23523, -23801, -24075, -24346, -24614, -24877, -25137,
+		-25393, -25645, -25894, -26138, -26379, -26615, -26848, -27076,
+		-27301, -27521, -27737, -27949, -28157, -28361, -28560, -28755,
+		-28946, -29132, -29314, -29491, -29664, -29833, -29997, -30156,
+		-30312, -30462, -30608, -30749, -30886, -31018, -31145, -31268,
+		-31386, -31499, -31607, -31711, -31810, -31904, -31993, -32078,
+		-32157, -32232, -32302, -32367, -32427, -32483, -32533, -32579,
+		-32619, -32655, -32686, -32712, -32733, -32749, -32760, -32766,
+		-32767, -32764, -32755, -32741, -32723, -32700, -32671, -32638,
+		-32600, -32557, -32509, -32456, -32398, -32335, -32268, -32195,
+		-32118, -32036, -31949, -31857, -31761, -31660, -31554, -31443,
+		-31327, -31207, -31082, -30952, -30818, -30679, -30535, -30387,
+		-30235, -30077, -29915, -29749, -29578, -29403, -29223, -29039,
+		-28851, -28658, -28461, -28259, -28054, -27844, -27630, -27411,
+		-27189, -26963, -26732, -26498, -26259, -26016, -25770, -25520,
+		-25266, -25008, -24746, -24480, -24211, -23939, -23662, -23382,
+		-23099, -22812, -22521, -22228, -21931, -21630, -21326, -21020,
+		-20709, -20396, -20080, -19761, -19439, -19113, -18785, -18454,
+		-18121, -17784, -17445, -17104, -16759, -16413, -16063, -15712,
+		-15357, -15001, -14642, -14282, -13919, -13554, -13186, -12817,
+		-12446, -12073, -11699, -11322, -10944, -10564, -10183, -9800,
+		-9415, -9029, -8642, -8254, -7864, -7473, -7081, -6688,
+		-6294, -5898, -5503, -5106, -4708, -4310, -3911, -3511,
+		-3111, -2711, -2310, -1909, -1507, -1105, -703, -301,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0
+	},
+	{
+		100, 502, 904, 1306, 1708, 2109, 2510, 2911,
+		3311, 3711, 4110, 4509, 4907, 5304, 5701, 6096,
+		6491, 6884, 7277, 7669, 8059, 8448, 8836, 9223,
+		9608, 9991, 10374, 10754, 11133, 11511, 11886, 12260,
+		12632, 13002, 13370, 13736, 14100, 14462, 14822, 15180,
+		15535, 15888, 16238, 16586, 16932, 17275, 17615, 17953,
+		18288, 18620, 18950, 19276, 19600, 19921, 20239, 20553,
+		20865, 21173, 21479, 21781, 22080, 22375, 22667, 22956,
+		23241, 23523, 23801, 24075, 24346, 24614, 24877, 25137,
+		25393, 25645, 25894, 26138, 26379, 26615, 26848, 27076,
+		27301, 27521, 27737, 27949, 28157, 28361, 28560, 28755,
+		28946, 29132, 29314, 29491, 29664, 29833, 29997, 30156,
+		30312, 30462, 30608, 30749, 30886, 31018, 31145, 31268,
+		31386, 31499, 31607, 31711, 31810, 31904, 31993, 32078,
+		32157, 32232, 32302, 32367, 32427, 32483, 32533, 32579,
+		32619, 32655, 32686, 32712, 32733, 32749, 32760, 32766,
+		32767, 32764, 32755, 32741, 32723, 32700, 32671, 32638,
+		32600, 32557, 32509, 32456, 32398, 32335, 32268, 32195,
+		32118, 32036, 31949, 31857, 31761, 31660, 31554, 31443,
+		31327, 31207, 31082, 30952, 30818, 30679, 30535, 30387,
+		30235, 30077, 29915, 29749, 29578, 29403, 29223, 29039,
+		28851, 28658, 28461, 28259, 28054, 27844, 27630, 27411,
+		27189, 26963, 26732, 26498, 26259, 26016, 25770, 25520,
+		25266, 25008, 24746, 24480, 24211, 23939, 23662, 23382,
+		23099, 22812, 22521, 22228, 21931, 21630, 21326, 21020,
+		20709, 20396, 20080, 19761, 19439, 19113, 18785, 18454,
+		18121, 17784, 17445, 17104, 16759, 16413, 16063, 15712,
+		15357, 15001, 14642, 14282, 13919, 13554, 13186, 12817,
+		12446, 12073, 11699, 11322, 10944, 10564, 10183, 9800,
+		9415, 9029, 8642, 8254, 7864, 7473, 7081, 6688,
+		6294, 5898, 5503, 5106, 4708, 4310, 3911, 3511,
+		3111, 2711, 2310, 1909, 1507, 1105, 703, 301,
+		100, 502, 904, 1306, 1708, 2109, 2510, 2911,
+		3311, 3711, 4110, 4509, 4907, 5304, 5701, 6096,
+		6491, 6884, 7277, 7669, 8059, 8448, 8836, 9223,
+		9608, 9991, 10374, 10754, 11133, 11511, 11886, 12260,
+		12632, 13002, 13370, 13736, 14100, 14462, 14822, 15180,
+		15535, 15888, 16238, 16586, 16932, 17275, 17615, 17953,
+		18288, 18620, 18950, 19276, 19600, 19921, 20239, 20553,
+		20865, 21173, 21479, 21781, 22080, 22375, 22667, 22956,
+		23241, 23523, 23801, 24075, 24346, 24614, 24877, 25137,
+		25393, 25645, 25894, 26138, 26379, 26615, 26848, 27076,
+		27301, 27521, 27737, 27949, 28157, 28361, 28560, 28755,
+		28946, 29132, 29314, 29491, 29664, 29833, 29997, 30156,
+		30312, 30462, 30608, 30749, 30886, 31018, 31145, 31268,
+		31386, 31499, 31607, 31711, 31810, 31904, 31993, 32078,
+		32157, 32232, 32302, 32367, 32427, 32483, 32533, 32579,
+		32619, 32655, 32686, 32712, 32733, 32749, 32760, 32766,
+		32767, 32764, 32755, 32741, 32723, 32700, 32671, 32638,
+		32600, 32557, 32509, 32456, 32398, 32335, 32268, 32195,
+		32118, 32036, 31949, 31857, 31761, 31660, 31554, 31443,
+		31327, 31207, 31082, 30952, 30818, 30679, 30535, 30387,
+		30235, 30077, 29915, 29749, 29578, 29403, 29223, 29039,
+		28851, 28658, 28461, 28259, 28054, 27844, 27630, 27411,
+		27189, 26963, 26732, 26498, 26259, 26016, 25770, 25520,
+		25266, 25008, 24746, 24480, 24211, 23939, 23662, 23382,
+		23099, 22812, 22521, 22228, 21931, 21630, 21326, 21020,
+		20709, 20396, 20080, 19761, 19439, 19113, 18785, 18454,
+		18121, 17784, 17445, 17104, 16759, 16413, 16063, 15712,
+		15357, 15001, 14642, 14282, 13919, 13554, 13186, 12817,
+		12446, 12073, 11699, 11322, 10944, 10564, 10183, 9800,
+		9415, 9029, 8642, 8254, 7864, 7473, 7081, 6688,
+		6294, 5898, 5503, 5106, 4708, 4310, 3911, 3511,
+		3111, 2711, 2310, 1909, 1507, 1105, 703, 301,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0
+	},
+	{
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+		-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0
+	}
+};
+
+static const double lut_plfo[4][8][LFO_LENGTH] =
+{
+	{
+		{
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1
+		},
+		{
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1
+		},
+		{
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1
+		},
+		{
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1
+		},
+		{
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1
+		},
+		{
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1
+		},
+		{
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1
+		},
+		{
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1
+		}
+	},
+	{
+		{
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1
+		},
+		{
+			1, 1.0000153639708851, 1.0000307281778216, 1.0000460926208135, 1.0000614572998643, 1.0000768222149774, 1.0000921873661568, 1.0001075527534058,
+			1.0001229183767282, 1.0001382842361277, 1.0001536503316075, 1.0001690166631718, 1.0001843832308239, 1.0001997500345676, 1.0002151170744065, 1.0002304843503438,
+			1.0002458518623838, 1.0002612196105296, 1.0002765875947852, 1.000291955815154, 1.0003073242716396, 1.0003226929642459, 1.0003380618929762, 1.0003534310578344,
+			1.0003688004588238, 1.0003841700959484, 1.0003995399692116, 1.000414910078617, 1.0004302804241685, 1.0004456510058695, 1.0004610218237235, 1.0004763928777345,
+			1.0004917641679059, 1.0005071356942412, 1.0005225074567443, 1.0005378794554187, 1.000553251690268, 1.0005686241612959, 1.000583996868506, 1.0005993698119018,
+			1.0006147429914873, 1.0006301164072657, 1.000645490059241, 1.0006608639474164, 1.000676238071796, 1.000691612432383, 1.0007069870291811, 1.0007223618621943,
+			1.0007377369314261, 1.0007531122368798, 1.0007684877785594, 1.0007838635564683, 1.0007992395706102, 1.0008146158209887, 1.0008299923076074, 1.0008453690304702,
+			1.0008607459895804, 1.0008761231849417, 1.0008915006165577, 1.0009068782844324, 1.0009222561885689, 1.0009376343289713, 1.0009530127056427, 1.0009683913185874,
+			1.0009837701678084, 1.0009991492533097, 1.0010145285750947, 1.0010299081331673, 1.0010452879275309, 1.001060667958189, 1.0010760482251457, 1.0010914287284045,
+			1.0011068094679687, 1.0011221904438421, 1.0011375716560285, 1.0011529531045313, 1.0011683347893543, 1.0011837167105011, 1.0011990988679751, 1.0012144812617803,
+			1.0012298638919201, 1.0012452467583981, 1.0012606298612181, 1.0012760132003835, 1.0012913967758983, 1.0013067805877658, 1.0013221646359898, 1.0013375489205738,
+			1.0013529334415214, 1.0013683181988364, 1.0013837031925226, 1.0013990884225832, 1.0014144738890218, 1.0014298595918425, 1.0014452455310487, 1.0014606317066441,
+			1.0014760181186322, 1.0014914047670165, 1.001506791651801, 1.0015221787729891, 1.0015375661305845, 1.0015529537245909, 1.0015683415550116, 1.0015837296218506,
+			1.0015991179251116, 1.0016145064647979, 1.0016298952409131, 1.0016452842534611, 1.0016606735024456, 1.00167606298787, 1.001691452709738, 1.0017068426680531,
+			1.0017222328628193, 1.0017376232940398, 1.0017530139617186, 1.0017684048658591, 1.0017837960064651, 1.0017991873835399, 1.0018145789970876, 1.0018299708471115,
+			1.0018453629336153, 1.0018607552566028, 1.0018761478160774, 1.0018915406120428, 1.0019069336445028, 1.0019223269134607, 1.0019377204189206, 1.0019531141608857,
+			0.99805069305810645, 0.99806602707989633, 0.99808136133727776, 0.99809669583025429, 0.99811203055882947, 0.99812736552300696, 0.99814270072279043, 0.99815803615818344,
+			0.99817337182918964, 0.99818870773581259, 0.99820404387805606, 0.99821938025592349, 0.99823471686941867, 0.99825005371854503, 0.99826539080330634, 0.99828072812370616,
+			0.99829606567974816, 0.99831140347143599, 0.9983267414987731, 0.99834207976176326, 0.99835741826041002, 0.99837275699471695, 0.99838809596468792, 0.99840343517032626,
+			0.99841877461163575, 0.99843411428861994, 0.9984494542012825, 0.99846479434962698, 0.99848013473365715, 0.99849547535337646, 0.99851081620878857, 0.99852615729989724,
+			0.99854149862670594, 0.99855684018921831, 0.99857218198743802, 0.99858752402136874, 0.99860286629101391, 0.9986182087963773, 0.99863355153746258, 0.99864889451427319,
+			0.9986642377268129, 0.99867958117508526, 0.99869492485909395, 0.9987102687788425, 0.99872561293433459, 0.99874095732557389, 0.99875630195256393, 0.99877164681530828,
+			0.99878699191381082, 0.99880233724807488, 0.99881768281810435, 0.99883302862390255, 0.99884837466547338, 0.99886372094282028, 0.99887906745594701, 0.99889441420485703,
+			0.9989097611895541, 0.99892510841004178, 0.99894045586632374, 0.99895580355840352, 0.9989711514862849, 0.99898649964997133, 0.99900184804946646, 0.99901719668477396,
+			0.99903254555589749, 0.99904789466284061, 0.99906324400560698, 0.99907859358420015, 0.9990939433986239, 0.99910929344888166, 0.99912464373497711, 0.99913999425691402,
+			0.99915534501469583, 0.99917069600832631, 0.99918604723780891, 0.9992013987031475, 0.99921675040434543, 0.99923210234140647, 0.99924745451433428, 0.9992628069231323,
+			0.99927815956780441, 0.99929351244835407, 0.99930886556478493, 0.99932421891710055, 0.99933957250530481, 0.99935492632940104, 0.99937028038939291, 0.99938563468528419,
+			0.99940098921707843, 0.99941634398477919, 0.99943169898839024, 0.99944705422791513, 0.99946240970335742, 0.99947776541472078, 0.99949312136200885, 0.9995084775452252,
+			0.99952383396437361, 0.99953919061945751, 0.99955454751048056, 0.99956990463744655, 0.99958526200035902, 0.99960061959922142, 0.99961597743403763, 0.9996313355048112,
+			0.99964669381154558, 0.99966205235424466, 0.99967741113291186, 0.99969277014755098, 0.99970812939816556, 0.99972348888475915, 0.99973884860733542, 0.99975420856589803,
+			0.99976956876045064, 0.99978492919099682, 0.99980028985754021, 0.9998156507600845, 0.9998310118986331, 0.99984637327318993, 0.9998617348837584, 0.9998770967303422,
+			0.99989245881294497, 0.99990782113157028, 0.99992318368622191, 0.99993854647690339, 0.99995390950361829, 0.99996927276637027, 0.99998463626516298, 1
+		},
+		{
+			1, 1.0000230351288915, 1.0000460707884002, 1.0000691069785383, 1.000092143699318, 1.0001151809507516, 1.0001382187328511, 1.0001612570456291,
+			1.0001842958890974, 1.0002073352632685, 1.0002303751681545, 1.0002534156037677, 1.0002764565701203, 1.0002994980672246, 1.0003225400950928, 1.0003455826537371,
+			1.0003686257431694, 1.0003916693634025, 1.0004147135144483, 1.0004377581963191, 1.0004608034090272, 1.0004838491525847, 1.0005068954270038, 1.0005299422322969,
+			1.0005529895684759, 1.0005760374355535, 1.0005990858335416, 1.0006221347624527, 1.0006451842222985, 1.0006682342130917, 1.0006912847348446, 1.0007143357875692,
+			1.0007373873712775, 1.0007604394859821, 1.0007834921316954, 1.0008065453084292, 1.0008295990161957, 1.0008526532550077, 1.0008757080248767, 1.0008987633258155,
+			1.0009218191578362, 1.0009448755209509, 1.0009679324151717, 1.0009909898405112, 1.0010140477969816, 1.0010371062845946, 1.0010601653033633, 1.0010832248532993,
+			1.0011062849344148, 1.0011293455467225, 1.0011524066902342, 1.0011754683649623, 1.0011985305709192, 1.001221593308117, 1.0012446565765678, 1.0012677203762841,
+			1.0012907847072778, 1.0013138495695615, 1.0013369149631473, 1.0013599808880471, 1.0013830473442737, 1.0014061143318391, 1.0014291818507555, 1.0014522499010352,
+			1.0014753184826906, 1.0014983875957333, 1.0015214572401763, 1.0015445274160315, 1.0015675981233112, 1.0015906693620276, 1.0016137411321928, 1.0016368134338194,
+			1.0016598862669193, 1.0016829596315049, 1.0017060335275885, 1.0017291079551822, 1.0017521829142984, 1.0017752584049493, 1.0017983344271471, 1.0018214109809038,
+			1.0018444880662321, 1.0018675656831439, 1.0018906438316517, 1.0019137225117676, 1.001936801723504, 1.0019598814668726, 1.0019829617418865, 1.0020060425485573,
+			1.0020291238868975, 1.0020522057569194, 1.002075288158635, 1.0020983710920568, 1.0021214545571968, 1.0021445385540675, 1.002167623082681, 1.0021907081430499,
+			1.0022137937351858, 1.0022368798591013, 1.0022599665148086, 1.0022830537023202, 1.0023061414216481, 1.0023292296728046, 1.0023523184558019, 1.0023754077706521,
+			1.0023984976173679, 1.0024215879959613, 1.0024446789064443, 1.0024677703488296, 1.0024908623231292, 1.0025139548293553, 1.0025370478675204, 1.0025601414376366,
+			1.0025832355397162, 1.0026063301737713, 1.0026294253398143, 1.0026525210378574, 1.002675617267913, 1.0026987140299932, 1.0027218113241103, 1.0027449091502765,
+			1.0027680075085041, 1.0027911063988053, 1.0028142058211926, 1.0028373057756779, 1.0028604062622737, 1.0028835072809921, 1.0029066088318455, 1.0029297109148463,
+			0.99707884721834217, 0.99710181505810291, 0.99712478342693078, 0.99714775232483788, 0.99717072175183663, 0.99719369170793903, 0.99721666219315741, 0.99723963320750375,
+			0.99726260475099049, 0.99728557682362962, 0.99730854942543345, 0.99733152255641411, 0.99735449621658379, 0.9973774704059547, 0.99740044512453896, 0.99742342037234888,
+			0.99744639614939667, 0.99746937245569434, 0.99749234929125419, 0.99751532665608844, 0.99753830455020931, 0.99756128297362889, 0.99758426192635941, 0.99760724140841295,
+			0.99763022141980195, 0.99765320196053853, 0.99767618303063466, 0.99769916463010289, 0.9977221467589551, 0.99774512941720361, 0.99776811260486065, 0.99779109632193841,
+			0.997814080568449, 0.99783706534440464, 0.99786005064981764, 0.99788303648470011, 0.99790602284906416, 0.99792900974292209, 0.99795199716628613, 0.99797498511916849,
+			0.99799797360158127, 0.99802096261353668, 0.99804395215504693, 0.99806694222612424, 0.99808993282678082, 0.99811292395702877, 0.99813591561688042, 0.99815890780634797,
+			0.99818190052544353, 0.99820489377417931, 0.99822788755256764, 0.9982508818606205, 0.99827387669835022, 0.998296872065769, 0.99831986796288907, 0.99834286438972264,
+			0.9983658613462818, 0.99838885883257877, 0.99841185684862588, 0.99843485539443522, 0.99845785447001911, 0.99848085407538956, 0.99850385421055887, 0.99852685487553938,
+			0.99854985607034308, 0.99857285779498228, 0.99859586004946921, 0.99861886283381596, 0.99864186614803485, 0.9986648699921381, 0.99868787436613782, 0.99871087927004631,
+			0.99873388470387559, 0.99875689066763818, 0.99877989716134596, 0.99880290418501139, 0.99882591173864654, 0.99884891982226365, 0.99887192843587491, 0.99889493757949255,
+			0.99891794725312877, 0.9989409574567959, 0.99896396819050592, 0.99898697945427117, 0.99900999124810386, 0.99903300357201619, 0.99905601642602038, 0.99907902981012864,
+			0.99910204372435318, 0.99912505816870623, 0.99914807314319987, 0.99917108864784643, 0.99919410468265812, 0.99921712124764717, 0.99924013834282577, 0.99926315596820603,
+			0.99928617412380039, 0.99930919280962083, 0.99933221202567968, 0.99935523177198915, 0.99937825204856146, 0.99940127285540881, 0.99942429419254342, 0.9994473160599775,
+			0.99947033845772326, 0.99949336138579292, 0.99951638484419869, 0.99953940883295278, 0.9995624333520674, 0.99958545840155477, 0.99960848398142721, 0.99963151009169682,
+			0.99965453673237581, 0.9996775639034764, 0.9997005916050109, 0.99972361983699154, 0.99974664859943041, 0.99976967789233973, 0.99979270771573181, 0.99981573806961888,
+			0.99983876895401314, 0.99986180036892669, 0.99988483231437197, 0.99990786479036098, 0.99993089779690614, 0.99995393133401955, 0.99997696540171344, 1
+		},
+		{
+			1, 1.0000306986135497, 1.0000613981695041, 1.0000920986678925, 1.0001228001087437, 1.0001535024920865, 1.0001842058179498, 1.0002149100863627,
+			1.000245615297354, 1.0002763214509529, 1.000307028547188, 1.0003377365860884, 1.0003684455676829, 1.0003991554920006, 1.0004298663590707, 1.0004605781689215,
+			1.0004912909215824, 1.0005220046170822, 1.00055271925545, 1.0005834348367144, 1.0006141513609048, 1.0006448688280496, 1.0006755872381783, 1.0007063065913195,
+			1.0007370268875022, 1.0007677481267556, 1.0007984703091084, 1.0008291934345894, 1.000859917503228, 1.0008906425150528, 1.0009213684700928, 1.000952095368377,
+			1.0009828232099345, 1.001013551994794, 1.0010442817229848, 1.0010750123945356, 1.0011057440094753, 1.001136476567833, 1.0011672100696376, 1.0011979445149182,
+			1.0012286799037036, 1.0012594162360227, 1.0012901535119048, 1.0013208917313785, 1.001351630894473, 1.0013823710012171, 1.0014131120516401, 1.0014438540457704,
+			1.0014745969836376, 1.0015053408652701, 1.0015360856906972, 1.001566831459948, 1.0015975781730511, 1.0016283258300358, 1.0016590744309308, 1.0016898239757652,
+			1.0017205744645683, 1.0017513258973685, 1.0017820782741951, 1.0018128315950769, 1.0018435858600432, 1.0018743410691229, 1.0019050972223447, 1.0019358543197376,
+			1.0019666123613311, 1.0019973713471535, 1.0020281312772343, 1.0020588921516023, 1.0020896539702866, 1.002120416733316, 1.0021511804407195, 1.0021819450925262,
+			1.0022127106887651, 1.0022434772294651, 1.0022742447146551, 1.0023050131443645, 1.0023357825186219, 1.0023665528374563, 1.0023973241008972, 1.0024280963089729,
+			1.0024588694617129, 1.0024896435591459, 1.002520418601301, 1.0025511945882073, 1.0025819715198938, 1.0026127493963894, 1.0026435282177231, 1.002674307983924,
+			1.0027050886950208, 1.0027358703510429, 1.0027666529520194, 1.0027974364979788, 1.0028282209889505, 1.0028590064249634, 1.0028897928060465, 1.0029205801322287,
+			1.0029513684035392, 1.0029821576200069, 1.0030129477816609, 1.0030437388885303, 1.0030745309406437, 1.0031053239380305, 1.0031361178807199, 1.0031669127687404,
+			1.0031977086021213, 1.0032285053808916, 1.0032593031050803, 1.0032901017747164, 1.003320901389829, 1.0033517019504472, 1.0033825034565997, 1.0034133059083159,
+			1.0034441093056246, 1.0034749136485548, 1.0035057189371357, 1.0035365251713961, 1.0035673323513654, 1.0035981404770724, 1.003628949548546, 1.0036597595658154,
+			1.0036905705289099, 1.0037213824378579, 1.0037521952926889, 1.0037830090934319, 1.0038138238401157, 1.0038446395327696, 1.0038754561714227, 1.0039062737561035,
+			0.99610892584475208, 0.99613950500771997, 0.99617008510942573, 0.99620066614989833, 0.99623124812916641, 0.99626183104725885, 0.99629241490420439, 0.99632299970003202,
+			0.99635358543477048, 0.99638417210844854, 0.99641475972109517, 0.99644534827273901, 0.99647593776340904, 0.99650652819313401, 0.99653711956194269, 0.99656771186986404,
+			0.99659830511692682, 0.9966288993031599, 0.99665949442859203, 0.99669009049325208, 0.99672068749716902, 0.99675128544037139, 0.99678188432288828, 0.99681248414474843,
+			0.99684308490598073, 0.99687368660661391, 0.99690428924667684, 0.99693489282619852, 0.99696549734520756, 0.99699610280373296, 0.99702670920180336, 0.99705731653944796,
+			0.99708792481669528, 0.9971185340335742, 0.9971491441901138, 0.99717975528634262, 0.99721036732228974, 0.99724098029798391, 0.99727159421345402, 0.9973022090687288,
+			0.99733282486383723, 0.99736344159880819, 0.99739405927367042, 0.99742467788845279, 0.99745529744318417, 0.99748591793789343, 0.99751653937260953, 0.99754716174736113,
+			0.9975777850621772, 0.9976084093170865, 0.99763903451211811, 0.99766966064730067, 0.99770028772266306, 0.99773091573823425, 0.9977615446940431, 0.99779217459011837,
+			0.99782280542648905, 0.99785343720318387, 0.99788406992023182, 0.99791470357766165, 0.99794533817550235, 0.99797597371378266, 0.99800661019253156, 0.99803724761177792,
+			0.99806788597155049, 0.99809852527187826, 0.99812916551279018, 0.99815980669431492, 0.99819044881648145, 0.99822109187931862, 0.99825173588285532, 0.99828238082712051,
+			0.99831302671214295, 0.99834367353795161, 0.99837432130457537, 0.99840497001204298, 0.99843561966038341, 0.99846627024962564, 0.99849692177979843, 0.99852757425093075,
+			0.99855822766305136, 0.99858888201618923, 0.99861953731037323, 0.99865019354563223, 0.99868085072199519, 0.998711508839491, 0.99874216789814851, 0.9987728278979966,
+			0.99880348883906411, 0.99883415072138004, 0.99886481354497325, 0.99889547730987271, 0.99892614201610719, 0.99895680766370554, 0.99898747425269685, 0.99901814178310988,
+			0.99904881025497361, 0.99907947966831689, 0.99911015002316872, 0.99914082131955784, 0.99917149355751322, 0.99920216673706375, 0.99923284085823838, 0.9992635159210661,
+			0.99929419192557567, 0.99932486887179606, 0.99935554675975613, 0.99938622558948476, 0.99941690536101102, 0.99944758607436368, 0.99947826772957182, 0.99950895032666409,
+			0.99953963386566969, 0.99957031834661725, 0.99960100376953587, 0.99963169013445452, 0.99966237744140196, 0.99969306569040717, 0.99972375488149912, 0.99975444501470667,
+			0.9997851360900587, 0.99981582810758429, 0.9998465210673122, 0.9998772149692714, 0.99990790981349087, 0.99993860559999959, 0.9999693023288263, 1
+		},
+		{
+			1, 1.0000460030169538, 1.000092008150185, 1.0001380153997912, 1.0001840247658695, 1.0002300362485177, 1.0002760498478329, 1.0003220655639125,
+			1.0003680833968536, 1.0004141033467542, 1.0004601254137111, 1.000506149597822, 1.0005521758991842, 1.0005982043178951, 1.0006442348540523, 1.0006902675077529,
+			1.0007363022790943, 1.0007823391681743, 1.00082837817509, 1.000874419299939, 1.0009204625428185, 1.0009665079038261, 1.0010125553830593, 1.0010586049806154,
+			1.001104656696592, 1.0011507105310864, 1.0011967664841963, 1.0012428245560188, 1.0012888847466517, 1.0013349470561921, 1.0013810114847379, 1.0014270780323864,
+			1.001473146699235, 1.0015192174853813, 1.0015652903909227, 1.0016113654159566, 1.0016574425605811, 1.0017035218248929, 1.0017496032089899, 1.0017956867129698,
+			1.0018417723369297, 1.0018878600809675, 1.0019339499451805, 1.0019800419296663, 1.0020261360345224, 1.0020722322598465, 1.002118330605736, 1.0021644310722884,
+			1.0022105336596014, 1.0022566383677725, 1.0023027451968993, 1.0023488541470793, 1.0023949652184101, 1.0024410784109894, 1.0024871937249147, 1.0025333111602834,
+			1.0025794307171934, 1.0026255523957421, 1.002671676196027, 1.0027178021181462, 1.0027639301621969, 1.0028100603282766, 1.0028561926164832, 1.0029023270269142,
+			1.0029484635596673, 1.0029946022148402, 1.0030407429925303, 1.0030868858928355, 1.0031330309158533, 1.0031791780616812, 1.0032253273304172, 1.0032714787221588,
+			1.0033176322370037, 1.0033637878750494, 1.0034099456363936, 1.0034561055211342, 1.0035022675293688, 1.0035484316611951, 1.0035945979167107, 1.0036407662960132,
+			1.0036869367992005, 1.0037331094263704, 1.0037792841776203, 1.0038254610530482, 1.0038716400527514, 1.003917821176828, 1.0039640044253759, 1.0040101897984923,
+			1.0040563772962752, 1.0041025669188226, 1.0041487586662317, 1.0041949525386007, 1.0042411485360272, 1.0042873466586089, 1.0043335469064436, 1.0043797492796289,
+			1.0044259537782632, 1.0044721604024434, 1.0045183691522679, 1.0045645800278344, 1.0046107930292405, 1.004657008156584, 1.004703225409963, 1.0047494447894749,
+			1.0047956662952178, 1.0048418899272893, 1.0048881156857874, 1.0049343435708098, 1.0049805735824546, 1.0050268057208191, 1.0050730399860017, 1.0051192763780998,
+			1.0051655148972116, 1.0052117555434346, 1.005257998316867, 1.0053042432176063, 1.0053504902457506, 1.0053967394013978, 1.0054429906846458, 1.0054892440955923,
+			1.0055354996343351, 1.0055817573009722, 1.0056280170956018, 1.0056742790183213, 1.0057205430692289, 1.0057668092484224, 1.0058130775559997, 1.0058593479920588,
+			0.9941747839757562, 0.99422051901519837, 0.99426625615859032, 0.99431199540602888, 0.99435773675761085, 0.99440348021343294, 0.99444922577359196, 0.99449497343818483,
+			0.99454072320730824, 0.99458647508105913, 0.99463222905953419, 0.99467798514283035, 0.9947237433310443, 0.99476950362427297, 0.99481526602261328, 0.99486103052616193,
+			0.99490679713501573, 0.99495256584927172, 0.9949983366690266, 0.99504410959437728, 0.99508988462542058, 0.99513566176225343, 0.99518144100497274, 0.99522722235367533,
+			0.99527300580845801, 0.99531879136941781, 0.99536457903665143, 0.99541036881025602, 0.99545616069032827, 0.99550195467696512, 0.99554775077026358, 0.99559354897032049,
+			0.99563934927723274, 0.99568515169109728, 0.99573095621201113, 0.99577676284007099, 0.99582257157537402, 0.99586838241801712, 0.99591419536809711, 0.99596001042571103,
+			0.99600582759095591, 0.99605164686392855, 0.996097468244726, 0.99614329173344518, 0.99618911733018312, 0.99623494503503673, 0.99628077484810296, 0.99632660676947893,
+			0.99637244079926157, 0.99641827693754792, 0.99646411518443478, 0.99650995554001942, 0.99655579800439864, 0.99660164257766948, 0.99664748925992908, 0.99669333805127436,
+			0.99673918895180236, 0.99678504196161011, 0.99683089708079464, 0.99687675430945311, 0.99692261364768231, 0.99696847509557951, 0.99701433865324163, 0.9970602043207657,
+			0.99710607209824897, 0.99715194198578827, 0.99719781398348084, 0.99724368809142372, 0.99728956430971394, 0.99733544263844864, 0.99738132307772487, 0.99742720562763976,
+			0.99747309028829023, 0.99751897705977366, 0.99756486594218696, 0.99761075693562729, 0.99765665004019177, 0.99770254525597757, 0.99774844258308171, 0.99779434202160144,
+			0.9978402435716337, 0.99788614723327584, 0.9979320530066248, 0.99797796089177793, 0.99802387088883227, 0.99806978299788496, 0.99811569721903315, 0.99816161355237409,
+			0.99820753199800483, 0.99825345255602271, 0.99829937522652468, 0.99834530000960808, 0.99839122690537008, 0.9984371559139078, 0.99848308703531852, 0.99852902026969936,
+			0.9985749556171476, 0.99862089307776036, 0.99866683265163492, 0.99871277433886851, 0.9987587181395583, 0.99880466405380153, 0.99885061208169545, 0.99889656222333723,
+			0.99894251447882421, 0.99898846884825354, 0.99903442533172249, 0.9990803839293283, 0.99912634464116834, 0.99917230746733976, 0.99921827240793981, 0.99926423946306586,
+			0.99931020863281506, 0.99935617991728476, 0.99940215331657234, 0.99944812883077494, 0.99949410645998982, 0.99954008620431445, 0.99958606806384598, 0.99963205203868177,
+			0.9996780381289192, 0.99972402633465551, 0.99977001665598797, 0.99981600909301394, 0.99986200364583089, 0.99990800031453597, 0.99995399909922655, 1
+		},
+		{
+			1, 1.0000917411457384, 1.0001834907079143, 1.0002752486873006, 1.0003670150846686, 1.0004587899007913, 1.0005505731364408, 1.0006423647923894,
+			1.0007341648694099, 1.0008259733682743, 1.0009177902897559, 1.0010096156346269, 1.0011014494036603, 1.0011932915976287, 1.0012851422173055, 1.0013770012634633,
+			1.0014688687368751, 1.0015607446383143, 1.0016526289685539, 1.0017445217283671, 1.0018364229185277, 1.0019283325398085, 1.0020202505929834, 1.0021121770788257,
+			1.0022041119981093, 1.0022960553516076, 1.0023880071400946, 1.0024799673643439, 1.0025719360251297, 1.0026639131232256, 1.0027558986594061, 1.0028478926344448,
+			1.0029398950491164, 1.0030319059041948, 1.0031239252004545, 1.0032159529386699, 1.0033079891196155, 1.0034000337440656, 1.0034920868127952, 1.0035841483265786,
+			1.0036762182861909, 1.0037682966924069, 1.0038603835460012, 1.003952478847749, 1.0040445825984252, 1.0041366947988051, 1.0042288154496639, 1.0043209445517767,
+			1.0044130821059187, 1.0045052281128657, 1.0045973825733929, 1.0046895454882758, 1.0047817168582902, 1.0048738966842117, 1.0049660849668161, 1.0050582817068789,
+			1.0051504869051766, 1.0052427005624847, 1.0053349226795794, 1.0054271532572367, 1.0055193922962329, 1.0056116397973442, 1.0057038957613471, 1.0057961601890177,
+			1.0058884330811326, 1.0059807144384683, 1.0060730042618016, 1.0061653025519088, 1.0062576093095672, 1.0063499245355529, 1.0064422482306437, 1.0065345803956156,
+			1.0066269210312464, 1.0067192701383127, 1.006811627717592, 1.0069039937698616, 1.0069963682958984, 1.0070887512964803, 1.0071811427723842, 1.0072735427243884,
+			1.0073659511532698, 1.0074583680598062, 1.0075507934447756, 1.0076432273089559, 1.0077356696531246, 1.0078281204780599, 1.0079205797845399, 1.0080130475733424,
+			1.0081055238452461, 1.0081980086010287, 1.0082905018414687, 1.0083830035673449, 1.008475513779435, 1.0085680324785182, 1.0086605596653728, 1.0087530953407775,
+			1.0088456395055112, 1.0089381921603524, 1.0090307533060805, 1.009123322943474, 1.0092159010733119, 1.0093084876963738, 1.0094010828134383, 1.0094936864252853,
+			1.0095862985326933, 1.0096789191364426, 1.009771548237312, 1.0098641858360811, 1.0099568319335297, 1.0100494865304375, 1.0101421496275842, 1.0102348212257497,
+			1.0103275013257136, 1.0104201899282561, 1.0105128870341573, 1.010605592644197, 1.0106983067591557, 1.0107910293798137, 1.0108837605069509, 1.010976500141348,
+			1.0110692482837855, 1.0111620049350438, 1.0112547700959036, 1.0113475437671455, 1.0114403259495504, 1.0115331166438988, 1.0116259158509719, 1.0117187235715508,
+			0.98841701423674211, 0.9885076927460954, 0.988598379574399, 0.98868907472241618, 0.98877977819091023, 0.98887048998064431, 0.98896121009238191, 0.98905193852688655,
+			0.98914267528492161, 0.98923342036725093, 0.98932417377463799, 0.98941493550784676, 0.98950570556764084, 0.98959648395478417, 0.9896872706700407, 0.98977806571417459,
+			0.98986886908794991, 0.9899596807921307, 0.99005050082748125, 0.99014132919476594, 0.99023216589474916, 0.99032301092819519, 0.99041386429586875, 0.99050472599853434,
+			0.99059559603695668, 0.99068647441190039, 0.9907773611241304, 0.99086825617441143, 0.99095915956350866, 0.99105007129218681, 0.99114099136121125, 0.99123191977134684,
+			0.99132285652335905, 0.99141380161801307, 0.99150475505607427, 0.99159571683830805, 0.99168668696548001, 0.99177766543835566, 0.9918686522577006, 0.99195964742428067,
+			0.99205065093886147, 0.99214166280220906, 0.99223268301508927, 0.99232371157826804, 0.99241474849251143, 0.99250579375858572, 0.99259684737725706, 0.99268790934929174,
+			0.99277897967545592, 0.99287005835651632, 0.9929611453932391, 0.99305224078639109, 0.99314334453673891, 0.99323445664504906, 0.99332557711208835, 0.99341670593862386,
+			0.99350784312542217, 0.99359898867325047, 0.9936901425828758, 0.99378130485506522, 0.99387247549058588, 0.99396365449020518, 0.99405484185469029, 0.99414603758480879,
+			0.99423724168132799, 0.99432845414501547, 0.99441967497663897, 0.99451090417696608, 0.99460214174676442, 0.99469338768680204, 0.99478464199784677, 0.99487590468066656,
+			0.99496717573602933, 0.99505845516470337, 0.99514974296745673, 0.99524103914505779, 0.99533234369827472, 0.99542365662787591, 0.99551497793462995, 0.99560630761930535,
+			0.99569764568267061, 0.99578899212549443, 0.99588034694854566, 0.995971710152593, 0.9960630817384053, 0.99615446170675159, 0.99624585005840083, 0.99633724679412228,
+			0.99642865191468488, 0.99652006542085803, 0.99661148731341087, 0.99670291759311302, 0.99679435626073365, 0.99688580331704257, 0.99697725876280907, 0.99706872259880297,
+			0.99716019482579399, 0.99725167544455195, 0.9973431644558467, 0.99743466186044816, 0.99752616765912627, 0.99761768185265132, 0.99770920444179323, 0.99780073542732239,
+			0.99789227481000897, 0.99798382259062346, 0.99807537876993624, 0.99816694334871769, 0.99825851632773865, 0.9983500977077695, 0.99844168748958118, 0.99853328567394439,
+			0.99862489226162987, 0.99871650725340877, 0.99880813065005192, 0.99889976245233048, 0.9989914026610156, 0.99908305127687846, 0.99917470830069033, 0.99926637373322258,
+			0.9993580475752466, 0.99944972982753388, 0.99954142049085615, 0.99963311956598488, 0.99972482705369181, 0.99981654295474864, 0.99990826726992743, 1
+		},
+		{
+			1, 1.0001824344203625, 1.0003649021230425, 1.0005474031141122, 1.0007299373996446, 1.0009125049857133, 1.0010951058783939, 1.0012777400837625,
+			1.0014604076078963, 1.0016431084568742, 1.0018258426367754, 1.0020086101536809, 1.0021914110136725, 1.002374245222833, 1.0025571127872464, 1.002740013712998,
+			1.0029229480061739, 1.0031059156728614, 1.0032889167191494, 1.0034719511511272, 1.0036550189748852, 1.0038381201965159, 1.0040212548221115, 1.0042044228577665,
+			1.004387624309576, 1.004570859183636, 1.0047541274860441, 1.0049374292228987, 1.0051207644002995, 1.0053041330243471, 1.0054875351011434, 1.0056709706367912,
+			1.0058544396373945, 1.0060379421090588, 1.00622147805789, 1.0064050474899957, 1.0065886504114843, 1.0067722868284656, 1.0069559567470501, 1.0071396601733495,
+			1.0073233971134774, 1.0075071675735472, 1.0076909715596745, 1.0078748090779754, 1.0080586801345675, 1.0082425847355689, 1.0084265228870999, 1.008610494595281,
+			1.0087944998662339, 1.0089785387060817, 1.0091626111209486, 1.0093467171169599, 1.0095308567002419, 1.009715029876922, 1.0098992366531288, 1.010083477034992,
+			1.0102677510286424, 1.0104520586402121, 1.0106363998758343, 1.0108207747416427, 1.011005183243773, 1.0111896253883614, 1.0113741011815456, 1.0115586106294643,
+			1.0117431537382571, 1.011927730514065, 1.0121123409630299, 1.0122969850912951, 1.0124816629050049, 1.0126663744103046, 1.0128511196133405, 1.0130358985202605,
+			1.0132207111372136, 1.0134055574703489, 1.013590437525818, 1.0137753513097729, 1.0139602988283669, 1.0141452800877542, 1.0143302950940902, 1.0145153438535317,
+			1.0147004263722363, 1.014885542656363, 1.0150706927120718, 1.0152558765455235, 1.0154410941628806, 1.0156263455703065, 1.0158116307739653, 1.015996949780023,
+			1.0161823025946461, 1.0163676892240026, 1.016553109674261, 1.0167385639515922, 1.0169240520621667, 1.0171095740121574, 1.0172951298077373, 1.0174807194550812,
+			1.017666342960365, 1.0178520003297653, 1.01803769156946, 1.0182234166856285, 1.0184091756844511, 1.018594968572109, 1.0187807953547843, 1.0189666560386612,
+			1.0191525506299244, 1.0193384791347593, 1.0195244415593534, 1.0197104379098945, 1.0198964681925722, 1.0200825324135765, 1.0202686305790991, 1.0204547626953329,
+			1.0206409287684712, 1.0208271288047093, 1.0210133628102429, 1.0211996307912694, 1.0213859327539871, 1.0215722687045954, 1.0217586386492949, 1.0219450425942871,
+			1.0221314805457751, 1.0223179525099626, 1.0225044584930549, 1.022690998501258, 1.0228775725407795, 1.0230641806178276, 1.0232508227386121, 1.0234374989093438,
+			0.97709923768249585, 0.97727749421555898, 0.97745578326874938, 0.97763410484799995, 0.9778124589592444, 0.97799084560841776, 0.97816926480145605, 0.97834771654429642,
+			0.97852620084287711, 0.97870471770313727, 0.97888326713101736, 0.97906184913245886, 0.97924046371340434, 0.97941911087979727, 0.97959779063758246, 0.97977650299270569,
+			0.97995524795111388, 0.98013402551875495, 0.9803128357015779, 0.98049167850553298, 0.98067055393657132, 0.98084946200064516, 0.98102840270370806, 0.98120737605171438,
+			0.98138638205061968, 0.98156542070638064, 0.98174449202495495, 0.9819235960123015, 0.9821027326743802, 0.98228190201715193, 0.98246110404657894, 0.98264033876862433,
+			0.98281960618925224, 0.98299890631442821, 0.98317823915011859, 0.98335760470229083, 0.98353700297691371, 0.98371643397995667, 0.98389589771739083, 0.98407539419518786,
+			0.98425492341932075, 0.98443448539576361, 0.98461408013049156, 0.98479370762948082, 0.98497336789870871, 0.98515306094415367, 0.98533278677179537, 0.98551254538761413,
+			0.98569233679759172, 0.98587216100771113, 0.98605201802395592, 0.9862319078523113, 0.98641183049876324, 0.98659178596929897, 0.98677177426990659, 0.98695179540657541,
+			0.98713184938529608, 0.98731193621205993, 0.98749205589285971, 0.98767220843368897, 0.98785239384054269, 0.98803261211941651, 0.98821286327630775, 0.98839314731721417,
+			0.98857346424813519, 0.9887538140750709, 0.98893419680402284, 0.9891146124409933, 0.98929506099198594, 0.9894755424630054, 0.98965605686005742, 0.98983660418914887,
+			0.99001718445628761, 0.99019779766748273, 0.99037844382874429, 0.99055912294608361, 0.99073983502551299, 0.99092058007304573, 0.99110135809469657, 0.99128216909648093,
+			0.99146301308441565, 0.99164389006451847, 0.99182480004280837, 0.9920057430253052, 0.99218671901803024, 0.99236772802700557, 0.99254877005825448, 0.99272984511780149,
+			0.992910953211672, 0.99309209434589263, 0.99327326852649112, 0.99345447575949619, 0.99363571605093781, 0.99381698940684693, 0.99399829583325572, 0.99417963533619724,
+			0.9943610079217059, 0.99454241359581708, 0.99472385236456728, 0.99490532423399403, 0.99508682921013614, 0.99526836729903334, 0.99544993850672658, 0.99563154283925792,
+			0.9958131803026703, 0.99599485090300799, 0.99617655464631649, 0.99635829153864197, 0.99654006158603214, 0.99672186479453551, 0.99690370117020177, 0.99708557071908188,
+			0.99726747344722777, 0.99744940936069237, 0.99763137846552996, 0.99781338076779558, 0.99799541627354582, 0.99817748498883807, 0.99835958691973081, 0.99854172207228376,
+			0.99872389045255761, 0.9989060920666144, 0.99908832692051708, 0.99927059502032967, 0.99945289637211743, 0.99963523098194662, 0.99981759885588462, 1
+		},
+		{
+			1, 1.0003607699400991, 1.000721670035148, 1.0010827003321026, 1.0014438608779357, 1.0018051517196374, 1.0021665729042142, 1.0025281244786903,
+			1.0028898064901062, 1.0032516189855196, 1.0036135620120055, 1.0039756356166554, 1.0043378398465777, 1.0047001747488986, 1.0050626403707603, 1.0054252367593228,
+			1.0057879639617626, 1.0061508220252735, 1.0065138109970664, 1.0068769309243688, 1.0072401818544257, 1.0076035638344987, 1.0079670769118669, 1.0083307211338264,
+			1.0086944965476901, 1.0090584032007879, 1.0094224411404673, 1.0097866104140922, 1.0101509110690443, 1.0105153431527218, 1.0108799067125402, 1.0112446017959325,
+			1.0116094284503478, 1.0119743867232538, 1.0123394766621339, 1.0127046983144892, 1.0130700517278384, 1.0134355369497163, 1.0138011540276761, 1.0141669030092872,
+			1.0145327839421363, 1.0148987968738279, 1.0152649418519828, 1.0156312189242394, 1.0159976281382537, 1.0163641695416978, 1.0167308431822624, 1.0170976491076542,
+			1.0174645873655979, 1.0178316580038347, 1.0181988610701238, 1.0185661966122412, 1.0189336646779801, 1.019301265315151, 1.0196689985715817, 1.0200368644951174,
+			1.0204048631336202, 1.0207729945349697, 1.021141258747063, 1.0215096558178141, 1.0218781857951542, 1.0222468487270322, 1.0226156446614139, 1.0229845736462828,
+			1.0233536357296396, 1.0237228309595021, 1.0240921593839054, 1.0244616210509025, 1.0248312160085629, 1.0252009443049741, 1.0255708059882407, 1.0259408011064846,
+			1.026310929707845, 1.0266811918404788, 1.0270515875525601, 1.0274221168922801, 1.0277927799078479, 1.0281635766474897, 1.0285345071594489, 1.0289055714919868,
+			1.0292767696933816, 1.0296481018119292, 1.0300195678959432, 1.0303911679937541, 1.0307629021537099, 1.0311347704241762, 1.0315067728535363, 1.0318789094901906,
+			1.0322511803825571, 1.0326235855790709, 1.0329961251281854, 1.0333687990783704, 1.0337416074781143, 1.0341145503759221, 1.034487627820317, 1.0348608398598391,
+			1.0352341865430463, 1.035607667918514, 1.0359812840348352, 1.0363550349406203, 1.0367289206844974, 1.0371029413151118, 1.0374770968811267, 1.0378513874312227,
+			1.0382258130140982, 1.0386003736784688, 1.0389750694730677, 1.039349900446646, 1.0397248666479724, 1.0400999681258325, 1.0404752049290305, 1.0408505771063874,
+			1.0412260847067423, 1.0416017277789515, 1.0419775063718895, 1.042353420534448, 1.0427294703155363, 1.0431056557640817, 1.0434819769290289, 1.0438584338593402,
+			1.0442350266039955, 1.0446117552119929, 1.0449886197323477, 1.0453656202140928, 1.0457427567062791, 1.0461200292579753, 1.0464974379182672, 1.0468749827362589,
+			0.95522389634936167, 0.95556851241722895, 0.9559132528122144, 0.95625811757917145, 0.95660310676296978, 0.95694822040849536, 0.95729345856065018, 0.9576388212643524,
+			0.95798430856453665, 0.9583299205061534, 0.95867565713416958, 0.95902151849356843, 0.95936750462934917, 0.95971361558652746, 0.96005985141013495, 0.96040621214521982,
+			0.96075269783684625, 0.96109930853009495, 0.96144604427006275, 0.96179290510186266, 0.96213989107062403, 0.96248700222149264, 0.96283423859963035, 0.96318160025021538,
+			0.96352908721844222, 0.96387669954952182, 0.96422443728868135, 0.96457230048116416, 0.96492028917223005, 0.96526840340715514, 0.96561664323123197, 0.96596500868976931,
+			0.96631349982809223, 0.96666211669154223, 0.96701085932547715, 0.96735972777527124, 0.96770872208631509, 0.96805784230401559, 0.9684070884737962, 0.96875646064109644,
+			0.96910595885137263, 0.96945558315009717, 0.96980533358275911, 0.97015521019486362, 0.97050521303193249, 0.97085534213950397, 0.97120559756313263, 0.97155597934838944,
+			0.97190648754086195, 0.97225712218615401, 0.97260788332988612, 0.97295877101769501, 0.97330978529523404, 0.97366092620817291, 0.97401219380219795, 0.97436358812301183,
+			0.97471510921633386, 0.97506675712789959, 0.97541853190346128, 0.97577043358878768, 0.97612246222966415, 0.97647461787189216, 0.97682690056129018, 0.97717931034369288,
+			0.97753184726495179, 0.97788451137093457, 0.97823730270752574, 0.97859022132062634, 0.97894326725615377, 0.97929644056004228, 0.97964974127824245, 0.98000316945672161,
+			0.98035672514146355, 0.98071040837846857, 0.98106421921375397, 0.98141815769335317, 0.98177222386331642, 0.98212641776971055, 0.98248073945861925, 0.9828351889761423,
+			0.9831897663683965, 0.98354447168151538, 0.98389930496164879, 0.98425426625496348, 0.98460935560764262, 0.98496457306588625, 0.98531991867591107, 0.98567539248395031,
+			0.98603099453625398, 0.98638672487908874, 0.98674258355873801, 0.98709857062150175, 0.9874546861136968, 0.98781093008165677, 0.98816730257173158, 0.98852380363028836,
+			0.98888043330371067, 0.98923719163839885, 0.9895940786807701, 0.98995109447725826, 0.99030823907431398, 0.99066551251840451, 0.99102291485601413, 0.99138044613364362,
+			0.99173810639781079, 0.99209589569504997, 0.99245381407191247, 0.99281186157496637, 0.99317003825079653, 0.99352834414600455, 0.99388677930720903, 0.99424534378104501,
+			0.99460403761416472, 0.99496286085323726, 0.9953218135449482, 0.99568089573600016, 0.99604010747311278, 0.99639944880302223, 0.99675891977248166, 0.99711852042826132,
+			0.99747825081714803, 0.99783811098594555, 0.99819810098147466, 0.99855822085057278, 0.99891847064009465, 0.99927885039691133, 0.99963936016791144, 1
+		}
+	},
+	{
+		{
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1
+		},
+		{
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857, 1.0019531141608857,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645,
+			0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645, 0.99805069305810645
+		},
+		{
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463, 1.0029297109148463,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217,
+			0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217, 0.99707884721834217
+		},
+		{
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035, 1.0039062737561035,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208,
+			0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208, 0.99610892584475208
+		},
+		{
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588, 1.0058593479920588,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562,
+			0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562, 0.9941747839757562
+		},
+		{
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508, 1.0117187235715508,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211,
+			0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211, 0.98841701423674211
+		},
+		{
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438, 1.0234374989093438,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585,
+			0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585, 0.97709923768249585
+		},
+		{
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589, 1.0468749827362589,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167,
+			0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167, 0.95522389634936167
+		}
+	},
+	{
+		{
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1,
+			1, 1, 1, 1, 1, 1, 1, 1
+		},
+		{
+			1, 1.0000304881102728, 1.0000609771500708, 1.0000914671194217, 1.0001219580183542, 1.0001524498468968, 1.0001829426050775, 1.0002134362929247,
+			1.0002439309104667, 1.0002744264577321, 1.0003049229347494, 1.0003354203415462, 1.0003659186781515, 1.0003964179445934, 1.0004269181409005, 1.0004574192671007,
+			1.0004879213232227, 1.0005184243092948, 1.0005489282253452, 1.0005794330714024, 1.0006099388474947, 1.0006404455536504, 1.0006709531898981, 1.0007014617562657,
+			1.000731971252782, 1.0007624816794753, 1.0007929930363737, 1.0008235053235057, 1.0008540185408998, 1.0008845326885842, 1.0009150477665874, 1.0009455637749374,
+			1.000976080713663, 1.0010065985827925, 1.001037117382354, 1.0010676371123759, 1.001098157772887, 1.0011286793639151, 1.0011592018854889, 1.0011897253376367,
+			1.001220249720387, 1.001250775033768, 1.0012813012778081, 1.0013118284525357, 1.0013423565579791, 1.0013728855941668, 1.0014034155611271, 1.0014339464588884,
+			1.0014644782874791, 1.0014950110469276, 1.0015255447372622, 1.0015560793585112, 1.0015866149107033, 1.0016171513938665, 1.0016476888080295, 1.0016782271532205,
+			1.0017087664294679, 1.0017393066368001, 1.0017698477752457, 1.0018003898448327, 1.0018309328455899, 1.0018614767775453, 1.0018920216407274, 1.0019225674351648,
+			1.0019531141608857, 1.0019225674351648, 1.0018920216407274, 1.0018614767775453, 1.0018309328455899, 1.0018003898448327, 1.0017698477752457, 1.0017393066368001,
+			1.0017087664294679, 1.0016782271532205, 1.0016476888080295, 1.0016171513938665, 1.0015866149107033, 1.0015560793585112, 1.0015255447372622, 1.0014950110469276,
+			1.0014644782874791, 1.0014339464588884, 1.0014034155611271, 1.0013728855941668, 1.0013423565579791, 1.0013118284525357, 1.0012813012778081, 1.001250775033768,
+			1.001220249720387, 1.0011897253376367, 1.0011592018854889, 1.0011286793639151, 1.001098157772887, 1.0010676371123759, 1.001037117382354, 1.0010065985827925,
+			1.000976080713663, 1.0009455637749374, 1.0009150477665874, 1.0008845326885842, 1.0008540185408998, 1.0008235053235057, 1.0007929930363737, 1.0007624816794753,
+			1.000731971252782, 1.0007014617562657, 1.0006709531898981, 1.0006404455536504, 1.0006099388474947, 1.0005794330714024, 1.0005489282253452, 1.0005184243092948,
+			1.0004879213232227, 1.0004574192671007, 1.0004269181409005, 1.0003964179445934, 1.0003659186781515, 1.0003354203415462, 1.0003049229347494, 1.0002744264577321,
+			1.0002439309104667, 1.0002134362929247, 1.0001829426050775, 1.0001524498468968, 1.0001219580183542, 1.0000914671194217, 1.0000609771500708, 1.0000304881102728,
+			1, 0.99996951281922364, 0.99993902656791545, 0.999908541246047, 0.99987805685359021, 0.99984757339051655, 0.99981709085679771, 0.99978660925240548,
+			0.99975612857731133, 0.99972564883148707, 0.99969517001490438, 0.99966469212753484, 0.99963421516935014, 0.99960373914032208, 0.99957326404042213, 0.99954278986962208,
+			0.99951231662789353, 0.99948184431520826, 0.99945137293153785, 0.99942090247685411, 0.99939043295112862, 0.99935996435433305, 0.999329496686439, 0.99929902994741837,
+			0.99926856413724263, 0.99923809925588369, 0.99920763530331302, 0.99917717227950231, 0.99914671018442336, 0.99911624901804785, 0.99908578878034737, 0.99905532947129372,
+			0.99902487109085847, 0.99899441363901342, 0.99896395711573016, 0.99893350152098048, 0.99890304685473608, 0.99887259311696852, 0.99884214030764951, 0.99881168842675094,
+			0.9987812374742443, 0.99875078745010126, 0.99872033835429375, 0.99868989018679322, 0.99865944294757159, 0.99862899663660032, 0.99859855125385133, 0.9985681067992962,
+			0.99853766327290672, 0.99850722067465447, 0.99847677900451115, 0.99844633826244866, 0.99841589844843848, 0.9983854595624525, 0.99835502160446221, 0.99832458457443962,
+			0.99829414847235609, 0.99826371329818364, 0.99823327905189385, 0.9982028457334583, 0.9981724133428489, 0.99814198188003733, 0.9981115513449953, 0.99808112173769437,
+			0.99805069305810645, 0.99808112173769437, 0.9981115513449953, 0.99814198188003733, 0.9981724133428489, 0.9982028457334583, 0.99823327905189385, 0.99826371329818364,
+			0.99829414847235609, 0.99832458457443962, 0.99835502160446221, 0.9983854595624525, 0.99841589844843848, 0.99844633826244866, 0.99847677900451115, 0.99850722067465447,
+			0.99853766327290672, 0.9985681067992962, 0.99859855125385133, 0.99862899663660032, 0.99865944294757159, 0.99868989018679322, 0.99872033835429375, 0.99875078745010126,
+			0.9987812374742443, 0.99881168842675094, 0.99884214030764951, 0.99887259311696852, 0.99890304685473608, 0.99893350152098048, 0.99896395711573016, 0.99899441363901342,
+			0.99902487109085847, 0.99905532947129372, 0.99908578878034737, 0.99911624901804785, 0.99914671018442336, 0.99917717227950231, 0.99920763530331302, 0.99923809925588369,
+			0.99926856413724263, 0.99929902994741837, 0.999329496686439, 0.99935996435433305, 0.99939043295112862, 0.99942090247685411, 0.99945137293153785, 0.99948184431520826,
+			0.99951231662789353, 0.99954278986962208, 0.99957326404042213, 0.99960373914032208, 0.99963421516935014, 0.99966469212753484, 0.99969517001490438, 0.99972564883148707,
+			0.99975612857731133, 0.99978660925240548, 0.99981709085679771, 0.99984757339051655, 0.99987805685359021, 0.999908541246047, 0.99993902656791545, 0.99996951281922364
+		},
+		{
+			1, 1.0000457108521397, 1.0000914237937615, 1.0001371388249605, 1.0001828559458328, 1.0002285751564737, 1.0002742964569784, 1.0003200198474429,
+			1.0003657453279626, 1.0004114728986329, 1.0004572025595493, 1.0005029343108076, 1.0005486681525033, 1.0005944040847317, 1.0006401421075886, 1.0006858822211695,
+			1.00073162442557, 1.0007773687208856, 1.000823115107212, 1.0008688635846446, 1.0009146141532792, 1.0009603668132112, 1.0010061215645363, 1.0010518784073501,
+			1.0010976373417479, 1.001143398367826, 1.0011891614856794, 1.0012349266954039, 1.0012806939970951, 1.0013264633908487, 1.0013722348767604, 1.0014180084549256,
+			1.0014637841254401, 1.0015095618883996, 1.0015553417438996, 1.0016011236920357, 1.0016469077329038, 1.0016926938665993, 1.001738482093218, 1.0017842724128556,
+			1.0018300648256078, 1.00187585933157, 1.0019216559308384, 1.001967454623508, 1.0020132554096752, 1.0020590582894351, 1.0021048632628839, 1.0021506703301171,
+			1.0021964794912301, 1.0022422907463191, 1.0022881040954794, 1.0023339195388072, 1.0023797370763978, 1.0024255567083471, 1.0024713784347508, 1.0025172022557047,
+			1.0025630281713045, 1.002608856181646, 1.0026546862868249, 1.0027005184869369, 1.0027463527820779, 1.0027921891723435, 1.0028380276578295, 1.0028838682386318,
+			1.0029297109148463, 1.0028838682386318, 1.0028380276578295, 1.0027921891723435, 1.0027463527820779, 1.0027005184869369, 1.0026546862868249, 1.002608856181646,
+			1.0025630281713045, 1.0025172022557047, 1.0024713784347508, 1.0024255567083471, 1.0023797370763978, 1.0023339195388072, 1.0022881040954794, 1.0022422907463191,
+			1.0021964794912301, 1.0021506703301171, 1.0021048632628839, 1.0020590582894351, 1.0020132554096752, 1.001967454623508, 1.0019216559308384, 1.00187585933157,
+			1.0018300648256078, 1.0017842724128556, 1.001738482093218, 1.0016926938665993, 1.0016469077329038, 1.0016011236920357, 1.0015553417438996, 1.0015095618883996,
+			1.0014637841254401, 1.0014180084549256, 1.0013722348767604, 1.0013264633908487, 1.0012806939970951, 1.0012349266954039, 1.0011891614856794, 1.001143398367826,
+			1.0010976373417479, 1.0010518784073501, 1.0010061215645363, 1.0009603668132112, 1.0009146141532792, 1.0008688635846446, 1.000823115107212, 1.0007773687208856,
+			1.00073162442557, 1.0006858822211695, 1.0006401421075886, 1.0005944040847317, 1.0005486681525033, 1.0005029343108076, 1.0004572025595493, 1.0004114728986329,
+			1.0003657453279626, 1.0003200198474429, 1.0002742964569784, 1.0002285751564737, 1.0001828559458328, 1.0001371388249605, 1.0000914237937615, 1.0000457108521397,
+			1, 0.99995429123724677, 0.99990858456378462, 0.99986287997951795, 0.99981717748435117, 0.99977147707818903, 0.99972577876093582, 0.99968008253249618,
+			0.99963438839277463, 0.99958869634167569, 0.99954300637910376, 0.99949731850496359, 0.9994516327191596, 0.99940594902159641, 0.99936026741217843, 0.99931458789081029,
+			0.99926891045739663, 0.99922323511184186, 0.99917756185405071, 0.9991318906839276, 0.99908622160137717, 0.99904055460630403, 0.99899488969861272, 0.99894922687820786,
+			0.99890356614499398, 0.99885790749887571, 0.99881225093975767, 0.99876659646754451, 0.99872094408214074, 0.9986752937834511, 0.99862964557138012, 0.99858399944583232,
+			0.99853835540671254, 0.99849271345392532, 0.99844707358737528, 0.99840143580696705, 0.99835580011260527, 0.99831016650419468, 0.99826453498163981, 0.99821890554484538,
+			0.99817327819371615, 0.99812765292815664, 0.99808202974807148, 0.99803640865336551, 0.99799078964394339, 0.99794517271970962, 0.99789955788056917, 0.99785394512642644,
+			0.99780833445718631, 0.9977627258727535, 0.99771711937303253, 0.99767151495792838, 0.99762591262734557, 0.99758031238118883, 0.99753471421936291, 0.99748911814177255,
+			0.9974435241483226, 0.99739793223891759, 0.99735234241346238, 0.99730675467186158, 0.99726116901402018, 0.99721558543984279, 0.99717000394923405, 0.99712442454209893,
+			0.99707884721834217, 0.99712442454209893, 0.99717000394923405, 0.99721558543984279, 0.99726116901402018, 0.99730675467186158, 0.99735234241346238, 0.99739793223891759,
+			0.9974435241483226, 0.99748911814177255, 0.99753471421936291, 0.99758031238118883, 0.99762591262734557, 0.99767151495792838, 0.99771711937303253, 0.9977627258727535,
+			0.99780833445718631, 0.99785394512642644, 0.99789955788056917, 0.99794517271970962, 0.99799078964394339, 0.99803640865336551, 0.99808202974807148, 0.99812765292815664,
+			0.99817327819371615, 0.99821890554484538, 0.99826453498163981, 0.99831016650419468, 0.99835580011260527, 0.99840143580696705, 0.99844707358737528, 0.99849271345392532,
+			0.99853835540671254, 0.99858399944583232, 0.99862964557138012, 0.9986752937834511, 0.99872094408214074, 0.99876659646754451, 0.99881225093975767, 0.99885790749887571,
+			0.99890356614499398, 0.99894922687820786, 0.99899488969861272, 0.99904055460630403, 0.99908622160137717, 0.9991318906839276, 0.99917756185405071, 0.99922323511184186,
+			0.99926891045739663, 0.99931458789081029, 0.99936026741217843, 0.99940594902159641, 0.9994516327191596, 0.99949731850496359, 0.99954300637910376, 0.99958869634167569,
+			0.99963438839277463, 0.99968008253249618, 0.99972577876093582, 0.99977147707818903, 0.99981717748435117, 0.99986287997951795, 0.99990858456378462, 0.99995429123724677
+		},
+		{
+			1, 1.0000609184816949, 1.000121840674451, 1.0001827665784948, 1.000243696194052, 1.0003046295213489, 1.0003655665606117, 1.0004265073120662,
+			1.000487451775939, 1.0005483999524558, 1.0006093518418431, 1.0006703074443268, 1.0007312667601334, 1.0007922297894889, 1.0008531965326197, 1.0009141669897519,
+			1.0009751411611116, 1.0010361190469255, 1.0010971006474194, 1.00115808596282, 1.0012190749933534, 1.0012800677392457, 1.0013410642007237, 1.0014020643780135,
+			1.0014630682713415, 1.0015240758809338, 1.0015850872070173, 1.0016461022498182, 1.0017071210095627, 1.0017681434864776, 1.0018291696807888, 1.0018901995927234,
+			1.0019512332225076, 1.0020122705703676, 1.0020733116365304, 1.0021343564212222, 1.0021954049246695, 1.0022564571470991, 1.0023175130887372, 1.0023785727498107,
+			1.0024396361305461, 1.0025007032311697, 1.0025617740519086, 1.0026228485929891, 1.0026839268546379, 1.0027450088370815, 1.002806094540547, 1.0028671839652608,
+			1.0029282771114494, 1.0029893739793398, 1.0030504745691586, 1.0031115788811327, 1.0031726869154884, 1.0032337986724531, 1.0032949141522531, 1.0033560333551155,
+			1.0034171562812668, 1.0034782829309339, 1.0035394133043438, 1.0036005474017231, 1.0036616852232989, 1.0037228267692979, 1.0037839720399471, 1.0038451210354733,
+			1.0039062737561035, 1.0038451210354733, 1.0037839720399471, 1.0037228267692979, 1.0036616852232989, 1.0036005474017231, 1.0035394133043438, 1.0034782829309339,
+			1.0034171562812668, 1.0033560333551155, 1.0032949141522531, 1.0032337986724531, 1.0031726869154884, 1.0031115788811327, 1.0030504745691586, 1.0029893739793398,
+			1.0029282771114494, 1.0028671839652608, 1.002806094540547, 1.0027450088370815, 1.0026839268546379, 1.0026228485929891, 1.0025617740519086, 1.0025007032311697,
+			1.0024396361305461, 1.0023785727498107, 1.0023175130887372, 1.0022564571470991, 1.0021954049246695, 1.0021343564212222, 1.0020733116365304, 1.0020122705703676,
+			1.0019512332225076, 1.0018901995927234, 1.0018291696807888, 1.0017681434864776, 1.0017071210095627, 1.0016461022498182, 1.0015850872070173, 1.0015240758809338,
+			1.0014630682713415, 1.0014020643780135, 1.0013410642007237, 1.0012800677392457, 1.0012190749933534, 1.00115808596282, 1.0010971006474194, 1.0010361190469255,
+			1.0009751411611116, 1.0009141669897519, 1.0008531965326197, 1.0007922297894889, 1.0007312667601334, 1.0006703074443268, 1.0006093518418431, 1.0005483999524558,
+			1.000487451775939, 1.0004265073120662, 1.0003655665606117, 1.0003046295213489, 1.000243696194052, 1.0001827665784948, 1.000121840674451, 1.0000609184816949,
+			1, 0.99993908522914055, 0.99987817416889047, 0.99981726681902361, 0.99975636317931393, 0.99969546324953562, 0.99963456702946252, 0.9995736745188688,
+			0.99951278571752833, 0.99945190062521527, 0.99939101924170359, 0.99933014156676758, 0.99926926760018109, 0.99920839734171829, 0.99914753079115348, 0.99908666794826051,
+			0.99902580881281366, 0.99896495338458724, 0.99890410166335519, 0.99884325364889182, 0.99878240934097129, 0.99872156873936779, 0.99866073184385573, 0.99859989865420906,
+			0.9985390691702023, 0.99847824339160962, 0.99841742131820521, 0.99835660294976358, 0.99829578828605892, 0.9982349773268655, 0.99817417007195774, 0.99811336652111005,
+			0.99805256667409659, 0.99799177053069199, 0.99793097809067055, 0.99787018935380656, 0.99780940431987464, 0.99774862298864908, 0.9976878453599044, 0.997627071433415,
+			0.99756630120895551, 0.99750553468630021, 0.99744477186522384, 0.9973840127455007, 0.99732325732690541, 0.99726250560921259, 0.99720175759219665, 0.99714101327563232,
+			0.99708027265929411, 0.99701953574295654, 0.99695880252639435, 0.99689807300938216, 0.99683734719169459, 0.99677662507310627, 0.99671590665339194, 0.9966551919323261,
+			0.99659448090968372, 0.99653377358523931, 0.99647306995876772, 0.99641237003004357, 0.9963516737988416, 0.99629098126493676, 0.99623029242810368, 0.99616960728811721,
+			0.99610892584475208, 0.99616960728811721, 0.99623029242810368, 0.99629098126493676, 0.9963516737988416, 0.99641237003004357, 0.99647306995876772, 0.99653377358523931,
+			0.99659448090968372, 0.9966551919323261, 0.99671590665339194, 0.99677662507310627, 0.99683734719169459, 0.99689807300938216, 0.99695880252639435, 0.99701953574295654,
+			0.99708027265929411, 0.99714101327563232, 0.99720175759219665, 0.99726250560921259, 0.99732325732690541, 0.9973840127455007, 0.99744477186522384, 0.99750553468630021,
+			0.99756630120895551, 0.997627071433415, 0.9976878453599044, 0.99774862298864908, 0.99780940431987464, 0.99787018935380656, 0.99793097809067055, 0.99799177053069199,
+			0.99805256667409659, 0.99811336652111005, 0.99817417007195774, 0.9982349773268655, 0.99829578828605892, 0.99835660294976358, 0.99841742131820521, 0.99847824339160962,
+			0.9985390691702023, 0.99859989865420906, 0.99866073184385573, 0.99872156873936779, 0.99878240934097129, 0.99884325364889182, 0.99890410166335519, 0.99896495338458724,
+			0.99902580881281366, 0.99908666794826051, 0.99914753079115348, 0.99920839734171829, 0.99926926760018109, 0.99933014156676758, 0.99939101924170359, 0.99945190062521527,
+			0.99951278571752833, 0.9995736745188688, 0.99963456702946252, 0.99969546324953562, 0.99975636317931393, 0.99981726681902361, 0.99987817416889047, 0.99993908522914055
+		},
+		{
+			1, 1.0000912893037026, 1.0001825869411423, 1.0002738929130797, 1.0003652072202756, 1.0004565298634911, 1.000547860843487, 1.0006392001610247,
+			1.0007305478168649, 1.0008219038117689, 1.0009132681464983, 1.0010046408218141, 1.0010960218384779, 1.001187411197251, 1.0012788088988951, 1.0013702149441717,
+			1.0014616293338425, 1.0015530520686693, 1.0016444831494138, 1.0017359225768381, 1.001827370351704, 1.0019188264747738, 1.0020102909468092, 1.0021017637685725,
+			1.0021932449408262, 1.0022847344643324, 1.0023762323398533, 1.0024677385681517, 1.0025592531499901, 1.0026507760861307, 1.0027423073773365, 1.0028338470243701,
+			1.0029253950279944, 1.0030169513889722, 1.0031085161080664, 1.0032000891860402, 1.0032916706236563, 1.0033832604216784, 1.003474858580869, 1.003566465101992,
+			1.0036580799858106, 1.003749703233088, 1.0038413348445878, 1.0039329748210737, 1.0040246231633092, 1.0041162798720582, 1.0042079449480841, 1.0042996183921511,
+			1.0043913002050229, 1.0044829903874637, 1.0045746889402372, 1.0046663958641078, 1.0047581111598398, 1.0048498348281971, 1.0049415668699442, 1.0050333072858457,
+			1.0051250560766658, 1.0052168132431691, 1.0053085787861202, 1.0054003527062838, 1.0054921350044248, 1.0055839256813079, 1.005675724737698, 1.0057675321743598,
+			1.0058593479920588, 1.0057675321743598, 1.005675724737698, 1.0055839256813079, 1.0054921350044248, 1.0054003527062838, 1.0053085787861202, 1.0052168132431691,
+			1.0051250560766658, 1.0050333072858457, 1.0049415668699442, 1.0048498348281971, 1.0047581111598398, 1.0046663958641078, 1.0045746889402372, 1.0044829903874637,
+			1.0043913002050229, 1.0042996183921511, 1.0042079449480841, 1.0041162798720582, 1.0040246231633092, 1.0039329748210737, 1.0038413348445878, 1.003749703233088,
+			1.0036580799858106, 1.003566465101992, 1.003474858580869, 1.0033832604216784, 1.0032916706236563, 1.0032000891860402, 1.0031085161080664, 1.0030169513889722,
+			1.0029253950279944, 1.0028338470243701, 1.0027423073773365, 1.0026507760861307, 1.0025592531499901, 1.0024677385681517, 1.0023762323398533, 1.0022847344643324,
+			1.0021932449408262, 1.0021017637685725, 1.0020102909468092, 1.0019188264747738, 1.001827370351704, 1.0017359225768381, 1.0016444831494138, 1.0015530520686693,
+			1.0014616293338425, 1.0013702149441717, 1.0012788088988951, 1.001187411197251, 1.0010960218384779, 1.0010046408218141, 1.0009132681464983, 1.0008219038117689,
+			1.0007305478168649, 1.0006392001610247, 1.000547860843487, 1.0004565298634911, 1.0003652072202756, 1.0002738929130797, 1.0001825869411423, 1.0000912893037026,
+			1, 0.99990871902927358, 0.99981744639076287, 0.99972618208370712, 0.99963492610734594, 0.99954367846091885, 0.99945243914366555, 0.99936120815482565,
+			0.99926998549363899, 0.99917877115934539, 0.9990875651511848, 0.99899636746839715, 0.9989051781102225, 0.99881399707590102, 0.99872282436467286, 0.9986316599757783,
+			0.99854050390845761, 0.99844935616195118, 0.99835821673549963, 0.99826708562834332, 0.99817596283972299, 0.99808484836887923, 0.99799374221505288, 0.99790264437748466,
+			0.99781155485541539, 0.99772047364808625, 0.99762940075473805, 0.99753833617461196, 0.99744727990694915, 0.99735623195099088, 0.99726519230597843, 0.99717416097115308,
+			0.99708313794575643, 0.99699212322902975, 0.99690111682021487, 0.9968101187185533, 0.99671912892328685, 0.99662814743365713, 0.9965371742489062, 0.99644620936827577,
+			0.99635525279100801, 0.99626430451634496, 0.99617336454352867, 0.99608243287180143, 0.99599150950040538, 0.99590059442858292, 0.99580968765557654, 0.99571878918062862,
+			0.99562789900298165, 0.99553701712187848, 0.99544614353656147, 0.99535527824627368, 0.99526442125025771, 0.99517357254775651, 0.99508273213801313, 0.9949919000202706,
+			0.99490107619377177, 0.99481026065776013, 0.99471945341147872, 0.99462865445417092, 0.99453786378508002, 0.99444708140344962, 0.99435630730852309, 0.99426554149954405,
+			0.9941747839757562, 0.99426554149954405, 0.99435630730852309, 0.99444708140344962, 0.99453786378508002, 0.99462865445417092, 0.99471945341147872, 0.99481026065776013,
+			0.99490107619377177, 0.9949919000202706, 0.99508273213801313, 0.99517357254775651, 0.99526442125025771, 0.99535527824627368, 0.99544614353656147, 0.99553701712187848,
+			0.99562789900298165, 0.99571878918062862, 0.99580968765557654, 0.99590059442858292, 0.99599150950040538, 0.99608243287180143, 0.99617336454352867, 0.99626430451634496,
+			0.99635525279100801, 0.99644620936827577, 0.9965371742489062, 0.99662814743365713, 0.99671912892328685, 0.9968101187185533, 0.99690111682021487, 0.99699212322902975,
+			0.99708313794575643, 0.99717416097115308, 0.99726519230597843, 0.99735623195099088, 0.99744727990694915, 0.99753833617461196, 0.99762940075473805, 0.99772047364808625,
+			0.99781155485541539, 0.99790264437748466, 0.99799374221505288, 0.99808484836887923, 0.99817596283972299, 0.99826708562834332, 0.99835821673549963, 0.99844935616195118,
+			0.99854050390845761, 0.9986316599757783, 0.99872282436467286, 0.99881399707590102, 0.9989051781102225, 0.99899636746839715, 0.9990875651511848, 0.99917877115934539,
+			0.99926998549363899, 0.99936120815482565, 0.99945243914366555, 0.99954367846091885, 0.99963492610734594, 0.99972618208370712, 0.99981744639076287, 0.99990871902927358
+		},
+		{
+			1, 1.0001820570562754, 1.0003641472573226, 1.0005462706091759, 1.0007284271178702, 1.0009106167894426, 1.0010928396299301, 1.0012750956453715,
+			1.0014573848418067, 1.0016397072252763, 1.0018220628018224, 1.002004451577488, 1.002186873558317, 1.002369328750355, 1.0025518171596481, 1.0027343387922438,
+			1.0029168936541906, 1.0030994817515382, 1.0032821030903374, 1.0034647576766398, 1.0036474455164985, 1.0038301666159677, 1.0040129209811024, 1.0041957086179587,
+			1.004378529532594, 1.004561383731067, 1.0047442712194372, 1.004927192003765, 1.0051101460901124, 1.0052931334845421, 1.0054761541931183, 1.0056592082219058,
+			1.005842295576971, 1.0060254162643811, 1.0062085702902046, 1.0063917576605106, 1.0065749783813702, 1.0067582324588549, 1.0069415198990375, 1.0071248407079918,
+			1.007308194891793, 1.0074915824565172, 1.0076750034082416, 1.0078584577530443, 1.0080419454970051, 1.0082254666462045, 1.008409021206724, 1.0085926091846467,
+			1.0087762305860559, 1.0089598854170372, 1.0091435736836762, 1.0093272953920602, 1.0095110505482778, 1.0096948391584182, 1.0098786612285719, 1.0100625167648307,
+			1.0102464057732869, 1.0104303282600349, 1.0106142842311694, 1.0107982736927865, 1.0109822966509834, 1.0111663531118582, 1.0113504430815106, 1.0115345665660409,
+			1.0117187235715508, 1.0115345665660409, 1.0113504430815106, 1.0111663531118582, 1.0109822966509834, 1.0107982736927865, 1.0106142842311694, 1.0104303282600349,
+			1.0102464057732869, 1.0100625167648307, 1.0098786612285719, 1.0096948391584182, 1.0095110505482778, 1.0093272953920602, 1.0091435736836762, 1.0089598854170372,
+			1.0087762305860559, 1.0085926091846467, 1.008409021206724, 1.0082254666462045, 1.0080419454970051, 1.0078584577530443, 1.0076750034082416, 1.0074915824565172,
+			1.007308194891793, 1.0071248407079918, 1.0069415198990375, 1.0067582324588549, 1.0065749783813702, 1.0063917576605106, 1.0062085702902046, 1.0060254162643811,
+			1.005842295576971, 1.0056592082219058, 1.0054761541931183, 1.0052931334845421, 1.0051101460901124, 1.004927192003765, 1.0047442712194372, 1.004561383731067,
+			1.004378529532594, 1.0041957086179587, 1.0040129209811024, 1.0038301666159677, 1.0036474455164985, 1.0034647576766398, 1.0032821030903374, 1.0030994817515382,
+			1.0029168936541906, 1.0027343387922438, 1.0025518171596481, 1.002369328750355, 1.002186873558317, 1.002004451577488, 1.0018220628018224, 1.0016397072252763,
+			1.0014573848418067, 1.0012750956453715, 1.0010928396299301, 1.0009106167894426, 1.0007284271178702, 1.0005462706091759, 1.0003641472573226, 1.0001820570562754,
+			1, 0.99981797608246314, 0.99963598529763287, 0.9994540276394781, 0.99927210310196923, 0.9990902116790773, 0.99890835336477468, 0.99872652815303498,
+			0.99854473603783256, 0.99836297701314314, 0.99818125107294342, 0.99799955821121134, 0.9978178984219257, 0.99763627169906643, 0.99745467803661492, 0.99727311742855329,
+			0.9970915898688647, 0.99691009535153374, 0.99672863387054578, 0.99654720541988751, 0.99636580999354651, 0.99618444758551172, 0.99600311818977294, 0.99582182180032108,
+			0.99564055841114829, 0.9954593280162477, 0.99527813060961356, 0.99509696618524124, 0.99491583473712719, 0.99473473625926889, 0.99455367074566492, 0.99437263819031518,
+			0.99419163858722026, 0.99401067193038228, 0.99382973821380405, 0.9936488374314898, 0.99346796957744454, 0.99328713464567464, 0.99310633263018744, 0.99292556352499151,
+			0.99274482732409619, 0.99256412402151217, 0.99238345361125124, 0.99220281608732608, 0.9920222114437508, 0.9918416396745402, 0.9916611007737105, 0.99148059473527872,
+			0.9913001215532633, 0.99111968122168337, 0.99093927373455948, 0.99075889908591319, 0.99057855726976707, 0.99039824828014478, 0.99021797211107121, 0.99003772875657214,
+			0.98985751821067458, 0.98967734046740652, 0.98949719552079718, 0.98931708336487678, 0.98913700399367654, 0.98895695740122902, 0.98877694358156742, 0.98859696252872664,
+			0.98841701423674211, 0.98859696252872664, 0.98877694358156742, 0.98895695740122902, 0.98913700399367654, 0.98931708336487678, 0.98949719552079718, 0.98967734046740652,
+			0.98985751821067458, 0.99003772875657214, 0.99021797211107121, 0.99039824828014478, 0.99057855726976707, 0.99075889908591319, 0.99093927373455948, 0.99111968122168337,
+			0.9913001215532633, 0.99148059473527872, 0.9916611007737105, 0.9918416396745402, 0.9920222114437508, 0.99220281608732608, 0.99238345361125124, 0.99256412402151217,
+			0.99274482732409619, 0.99292556352499151, 0.99310633263018744, 0.99328713464567464, 0.99346796957744454, 0.9936488374314898, 0.99382973821380405, 0.99401067193038228,
+			0.99419163858722026, 0.99437263819031518, 0.99455367074566492, 0.99473473625926889, 0.99491583473712719, 0.99509696618524124, 0.99527813060961356, 0.9954593280162477,
+			0.99564055841114829, 0.99582182180032108, 0.99600311818977294, 0.99618444758551172, 0.99636580999354651, 0.99654720541988751, 0.99672863387054578, 0.99691009535153374,
+			0.9970915898688647, 0.99727311742855329, 0.99745467803661492, 0.99763627169906643, 0.9978178984219257, 0.99799955821121134, 0.99818125107294342, 0.99836297701314314,
+			0.99854473603783256, 0.99872652815303498, 0.99890835336477468, 0.9990902116790773, 0.99927210310196923, 0.9994540276394781, 0.99963598529763287, 0.99981797608246314
+		},
+		{
+			1, 1.0003620508092019, 1.0007242326991923, 1.0010865457174292, 1.0014489899113872, 1.0018115653285591, 1.0021742720164541, 1.0025371100225993,
+			1.0029000793945377, 1.0032631801798313, 1.0036264124260579, 1.0039897761808132, 1.0043532714917101, 1.0047168984063781, 1.0050806569724651, 1.0054445472376352,
+			1.0058085692495702, 1.0061727230559694, 1.0065370087045487, 1.0069014262430418, 1.0072659757191997, 1.0076306571807905, 1.0079954706755996, 1.0083604162514295,
+			1.0087254939561006, 1.0090907038374499, 1.0094560459433326, 1.0098215203216201, 1.0101871270202021, 1.0105528660869851, 1.0109187375698934, 1.0112847415168678,
+			1.0116508779758677, 1.0120171469948687, 1.0123835486218644, 1.0127500829048657, 1.0131167498919007, 1.0134835496310151, 1.0138504821702718, 1.0142175475577515,
+			1.0145847458415516, 1.0149520770697875, 1.0153195412905918, 1.0156871385521145, 1.0160548689025233, 1.016422732390003, 1.0167907290627562, 1.0171588589690024,
+			1.017527122156979, 1.017895518674941, 1.0182640485711603, 1.0186327118939267, 1.0190015086915474, 1.0193704390123473, 1.0197395029046681, 1.0201087004168701,
+			1.0204780315973299, 1.0208474964944425, 1.0212170951566202, 1.0215868276322924, 1.0219566939699067, 1.0223266942179279, 1.0226968284248383, 1.0230670966391378,
+			1.0234374989093438, 1.0230670966391378, 1.0226968284248383, 1.0223266942179279, 1.0219566939699067, 1.0215868276322924, 1.0212170951566202, 1.0208474964944425,
+			1.0204780315973299, 1.0201087004168701, 1.0197395029046681, 1.0193704390123473, 1.0190015086915474, 1.0186327118939267, 1.0182640485711603, 1.017895518674941,
+			1.017527122156979, 1.0171588589690024, 1.0167907290627562, 1.016422732390003, 1.0160548689025233, 1.0156871385521145, 1.0153195412905918, 1.0149520770697875,
+			1.0145847458415516, 1.0142175475577515, 1.0138504821702718, 1.0134835496310151, 1.0131167498919007, 1.0127500829048657, 1.0123835486218644, 1.0120171469948687,
+			1.0116508779758677, 1.0112847415168678, 1.0109187375698934, 1.0105528660869851, 1.0101871270202021, 1.0098215203216201, 1.0094560459433326, 1.0090907038374499,
+			1.0087254939561006, 1.0083604162514295, 1.0079954706755996, 1.0076306571807905, 1.0072659757191997, 1.0069014262430418, 1.0065370087045487, 1.0061727230559694,
+			1.0058085692495702, 1.0054445472376352, 1.0050806569724651, 1.0047168984063781, 1.0043532714917101, 1.0039897761808132, 1.0036264124260579, 1.0032631801798313,
+			1.0029000793945377, 1.0025371100225993, 1.0021742720164541, 1.0018115653285591, 1.0014489899113872, 1.0010865457174292, 1.0007242326991923, 1.0003620508092019,
+			1, 0.9996380802241458, 0.9992762914342157, 0.99891463358280341, 0.9985531066225195, 0.9981917105059922, 0.99783044518586628, 0.99746931061480415,
+			0.9971083067454849, 0.99674743353060524, 0.99638669092287846, 0.99602607887503558, 0.99566559733982418, 0.99530524627000916, 0.9949450256183725, 0.99458493533771342,
+			0.99422497538084798, 0.99386514570060946, 0.99350544624984816, 0.99314587698143153, 0.99278643784824383, 0.99242712880318662, 0.99206794979917856, 0.99170890078915508,
+			0.99134998172606881, 0.99099119256288937, 0.99063253325260348, 0.99027400374821484, 0.98991560400274403, 0.98955733396922874, 0.98919919360072361, 0.98884118285030054,
+			0.98848330167104792, 0.98812555001607139, 0.98776792783849376, 0.98741043509145443, 0.98705307172811008, 0.98669583770163394, 0.98633873296521668, 0.98598175747206551,
+			0.98562491117540485, 0.98526819402847599, 0.98491160598453686, 0.98455514699686264, 0.98419881701874545, 0.98384261600349399, 0.98348654390443424, 0.98313060067490865,
+			0.98277478626827697, 0.98241910063791549, 0.98206354373721771, 0.9817081155195938, 0.98135281593847057, 0.98099764494729225, 0.9806426024995194, 0.98028768854862969,
+			0.97993290304811742, 0.97957824595149412, 0.97922371721228763, 0.97886931678404299, 0.97851504462032191, 0.97816090067470296, 0.97780688490078138, 0.97745299725216939,
+			0.97709923768249585, 0.97745299725216939, 0.97780688490078138, 0.97816090067470296, 0.97851504462032191, 0.97886931678404299, 0.97922371721228763, 0.97957824595149412,
+			0.97993290304811742, 0.98028768854862969, 0.9806426024995194, 0.98099764494729225, 0.98135281593847057, 0.9817081155195938, 0.98206354373721771, 0.98241910063791549,
+			0.98277478626827697, 0.98313060067490865, 0.98348654390443424, 0.98384261600349399, 0.98419881701874545, 0.98455514699686264, 0.98491160598453686, 0.98526819402847599,
+			0.98562491117540485, 0.98598175747206551, 0.98633873296521668, 0.98669583770163394, 0.98705307172811008, 0.98741043509145443, 0.98776792783849376, 0.98812555001607139,
+			0.98848330167104792, 0.98884118285030054, 0.98919919360072361, 0.98955733396922874, 0.98991560400274403, 0.99027400374821484, 0.99063253325260348, 0.99099119256288937,
+			0.99134998172606881, 0.99170890078915508, 0.99206794979917856, 0.99242712880318662, 0.99278643784824383, 0.99314587698143153, 0.99350544624984816, 0.99386514570060946,
+			0.99422497538084798, 0.99458493533771342, 0.9949450256183725, 0.99530524627000916, 0.99566559733982418, 0.99602607887503558, 0.99638669092287846, 0.99674743353060524,
+			0.9971083067454849, 0.99746931061480415, 0.99783044518586628, 0.9981917105059922, 0.9985531066225195, 0.99891463358280341, 0.9992762914342157, 0.9996380802241458
+		},
+		{
+			1, 1.0007160299699767, 1.0014325726388711, 1.0021496283737912, 1.0028671975421077, 1.0035852805114542, 1.0043038776497277, 1.0050229893250886,
+			1.0057426159059608, 1.0064627577610321, 1.0071834152592543, 1.0079045887698432, 1.0086262786622793, 1.0093484853063075, 1.0100712090719373, 1.0107944503294433,
+			1.0115182094493651, 1.0122424868025079, 1.0129672827599421, 1.0136925976930038, 1.0144184319732954, 1.015144785972685, 1.0158716600633069, 1.0165990546175621,
+			1.017326970008118, 1.0180554066079093, 1.0187843647901371, 1.0195138449282706, 1.0202438473960451, 1.0209743725674649, 1.0217054208168013, 1.0224369925185937,
+			1.0231690880476496, 1.0239017077790453, 1.0246348520881252, 1.0253685213505028, 1.0261027159420604, 1.0268374362389492, 1.0275726826175902, 1.0283084554546735,
+			1.0290447551271595, 1.0297815820122778, 1.0305189364875285, 1.0312568189306819, 1.031995229719779, 1.0327341692331311, 1.0334736378493208, 1.0342136359472016,
+			1.0349541639058983, 1.035695222104807, 1.0364368109235955, 1.0371789307422037, 1.0379215819408434, 1.0386647648999985, 1.0394084800004255, 1.0401527276231537,
+			1.0408975081494847, 1.0416428219609937, 1.0423886694395286, 1.0431350509672113, 1.043881966926437, 1.0446294176998743, 1.0453774036704666, 1.046125925221431,
+			1.0468749827362589, 1.046125925221431, 1.0453774036704666, 1.0446294176998743, 1.043881966926437, 1.0431350509672113, 1.0423886694395286, 1.0416428219609937,
+			1.0408975081494847, 1.0401527276231537, 1.0394084800004255, 1.0386647648999985, 1.0379215819408434, 1.0371789307422037, 1.0364368109235955, 1.035695222104807,
+			1.0349541639058983, 1.0342136359472016, 1.0334736378493208, 1.0327341692331311, 1.031995229719779, 1.0312568189306819, 1.0305189364875285, 1.0297815820122778,
+			1.0290447551271595, 1.0283084554546735, 1.0275726826175902, 1.0268374362389492, 1.0261027159420604, 1.0253685213505028, 1.0246348520881252, 1.0239017077790453,
+			1.0231690880476496, 1.0224369925185937, 1.0217054208168013, 1.0209743725674649, 1.0202438473960451, 1.0195138449282706, 1.0187843647901371, 1.0180554066079093,
+			1.017326970008118, 1.0165990546175621, 1.0158716600633069, 1.015144785972685, 1.0144184319732954, 1.0136925976930038, 1.0129672827599421, 1.0122424868025079,
+			1.0115182094493651, 1.0107944503294433, 1.0100712090719373, 1.0093484853063075, 1.0086262786622793, 1.0079045887698432, 1.0071834152592543, 1.0064627577610321,
+			1.0057426159059608, 1.0050229893250886, 1.0043038776497277, 1.0035852805114542, 1.0028671975421077, 1.0021496283737912, 1.0014325726388711, 1.0007160299699767,
+			1, 0.99928448236209622, 0.99856947668968266, 0.99785498261643879, 0.99714099977630655, 0.99642752780348964, 0.99571456633245337, 0.99500211499792479,
+			0.99429017343489223, 0.99357874127860513, 0.99286781816457403, 0.99215740372857031, 0.99144749760662565, 0.99073809943503255, 0.99002920885034351, 0.98932082548937128,
+			0.98861294898918806, 0.98790557898712628, 0.98719871512077739, 0.98649235702799254, 0.98578650434688175, 0.98508115671581409, 0.98437631377341728, 0.98367197515857763,
+			0.98296814051044001, 0.98226480946840733, 0.98156198167214048, 0.98085965676155829, 0.98015783437683723, 0.97945651415841106, 0.97875569574697097, 0.97805537878346516,
+			0.97735556290909897, 0.97665624776533411, 0.97595743299388915, 0.97525911823673872, 0.97456130313611378, 0.97386398733450141, 0.97316717047464429, 0.97247085219954077,
+			0.97177503215244476, 0.9710797099768651, 0.97038488531656619, 0.96969055781556701, 0.96899672711814122, 0.96830339286881717, 0.96761055471237745, 0.96691821229385888,
+			0.96622636525855221, 0.96553501325200208, 0.96484415592000661, 0.96415379290861747, 0.96346392386413959, 0.96277454843313082, 0.962085666262402, 0.96139727699901689,
+			0.9607093802902914, 0.96002197578379411, 0.95933506312734562, 0.95864864196901844, 0.95796271195713711, 0.95727727274027763, 0.95659232396726757, 0.95590786528718563,
+			0.95522389634936167, 0.95590786528718563, 0.95659232396726757, 0.95727727274027763, 0.95796271195713711, 0.95864864196901844, 0.95933506312734562, 0.96002197578379411,
+			0.9607093802902914, 0.96139727699901689, 0.962085666262402, 0.96277454843313082, 0.96346392386413959, 0.96415379290861747, 0.96484415592000661, 0.96553501325200208,
+			0.96622636525855221, 0.96691821229385888, 0.96761055471237745, 0.96830339286881717, 0.96899672711814122, 0.96969055781556701, 0.97038488531656619, 0.9710797099768651,
+			0.97177503215244476, 0.97247085219954077, 0.97316717047464429, 0.97386398733450141, 0.97456130313611378, 0.97525911823673872, 0.97595743299388915, 0.97665624776533411,
+			0.97735556290909897, 0.97805537878346516, 0.97875569574697097, 0.97945651415841106, 0.98015783437683723, 0.98085965676155829, 0.98156198167214048, 0.98226480946840733,
+			0.98296814051044001, 0.98367197515857763, 0.98437631377341728, 0.98508115671581409, 0.98578650434688175, 0.98649235702799254, 0.98719871512077739, 0.98790557898712628,
+			0.98861294898918806, 0.98932082548937128, 0.99002920885034351, 0.99073809943503255, 0.99144749760662565, 0.99215740372857031, 0.99286781816457403, 0.99357874127860513,
+			0.99429017343489223, 0.99500211499792479, 0.99571456633245337, 0.99642752780348964, 0.99714099977630655, 0.99785498261643879, 0.99856947668968266, 0.99928448236209622
+		}
+	}
+};
+
+static const UINT32 lut_plfo_fixed[4][8][LFO_LENGTH] =
+{
+	{
+		{
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U
+		},
+		{
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U
+		},
+		{
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U
+		},
+		{
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U
+		},
+		{
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U
+		},
+		{
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U
+		},
+		{
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U
+		},
+		{
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U
+		}
+	},
+	{
+		{
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U
+		},
+		{
+			0x80000000U, 0x800080E2U, 0x800101C4U, 0x800182A7U, 0x8002038BU, 0x8002846EU, 0x80030553U, 0x80038638U,
+			0x8004071DU, 0x80048803U, 0x800508EAU, 0x800589D1U, 0x80060AB8U, 0x80068BA0U, 0x80070C88U, 0x80078D71U,
+			0x80080E5BU, 0x80088F45U, 0x8009102FU, 0x8009911AU, 0x800A1206U, 0x800A92F2U, 0x800B13DEU, 0x800B94CBU,
+			0x800C15B9U, 0x800C96A7U, 0x800D1796U, 0x800D9885U, 0x800E1974U, 0x800E9A64U, 0x800F1B55U, 0x800F9C46U,
+			0x80101D38U, 0x80109E2AU, 0x80111F1CU, 0x8011A00FU, 0x80122103U, 0x8012A1F7U, 0x801322ECU, 0x8013A3E1U,
+			0x801424D7U, 0x8014A5CDU, 0x801526C3U, 0x8015A7BBU, 0x801628B2U, 0x8016A9AAU, 0x80172AA3U, 0x8017AB9CU,
+			0x80182C96U, 0x8018AD90U, 0x80192E8BU, 0x8019AF86U, 0x801A3082U, 0x801AB17EU, 0x801B327BU, 0x801BB378U,
+			0x801C3476U, 0x801CB574U, 0x801D3673U, 0x801DB772U, 0x801E3872U, 0x801EB972U, 0x801F3A73U, 0x801FBB75U,
+			0x80203C76U, 0x8020BD79U, 0x80213E7CU, 0x8021BF7FU, 0x80224083U, 0x8022C187U, 0x8023428CU, 0x8023C391U,
+			0x80244497U, 0x8024C59EU, 0x802546A5U, 0x8025C7ACU, 0x802648B4U, 0x8026C9BCU, 0x80274AC5U, 0x8027CBCFU,
+			0x80284CD9U, 0x8028CDE3U, 0x80294EEEU, 0x8029CFF9U, 0x802A5105U, 0x802AD212U, 0x802B531FU, 0x802BD42CU,
+			0x802C553AU, 0x802CD649U, 0x802D5758U, 0x802DD868U, 0x802E5978U, 0x802EDA88U, 0x802F5B99U, 0x802FDCABU,
+			0x80305DBDU, 0x8030DECFU, 0x80315FE2U, 0x8031E0F6U, 0x8032620AU, 0x8032E31FU, 0x80336434U, 0x8033E549U,
+			0x80346660U, 0x8034E776U, 0x8035688DU, 0x8035E9A5U, 0x80366ABDU, 0x8036EBD6U, 0x80376CEFU, 0x8037EE09U,
+			0x80386F23U, 0x8038F03EU, 0x80397159U, 0x8039F275U, 0x803A7391U, 0x803AF4ADU, 0x803B75CBU, 0x803BF6E8U,
+			0x803C7807U, 0x803CF925U, 0x803D7A45U, 0x803DFB65U, 0x803E7C85U, 0x803EFDA6U, 0x803F7EC7U, 0x803FFFE9U,
+			0x7FC02007U, 0x7FC0A0A9U, 0x7FC1214BU, 0x7FC1A1EDU, 0x7FC22290U, 0x7FC2A334U, 0x7FC323D8U, 0x7FC3A47DU,
+			0x7FC42522U, 0x7FC4A5C7U, 0x7FC5266EU, 0x7FC5A714U, 0x7FC627BBU, 0x7FC6A863U, 0x7FC7290BU, 0x7FC7A9B4U,
+			0x7FC82A5DU, 0x7FC8AB07U, 0x7FC92BB1U, 0x7FC9AC5BU, 0x7FCA2D07U, 0x7FCAADB2U, 0x7FCB2E5EU, 0x7FCBAF0BU,
+			0x7FCC2FB8U, 0x7FCCB066U, 0x7FCD3114U, 0x7FCDB1C3U, 0x7FCE3272U, 0x7FCEB322U, 0x7FCF33D2U, 0x7FCFB483U,
+			0x7FD03534U, 0x7FD0B5E6U, 0x7FD13698U, 0x7FD1B74BU, 0x7FD237FEU, 0x7FD2B8B2U, 0x7FD33966U, 0x7FD3BA1BU,
+			0x7FD43AD0U, 0x7FD4BB86U, 0x7FD53C3CU, 0x7FD5BCF3U, 0x7FD63DABU, 0x7FD6BE62U, 0x7FD73F1BU, 0x7FD7BFD4U,
+			0x7FD8408DU, 0x7FD8C147U, 0x7FD94201U, 0x7FD9C2BCU, 0x7FDA4377U, 0x7FDAC433U, 0x7FDB44F0U, 0x7FDBC5ADU,
+			0x7FDC466AU, 0x7FDCC728U, 0x7FDD47E6U, 0x7FDDC8A5U, 0x7FDE4965U, 0x7FDECA25U, 0x7FDF4AE5U, 0x7FDFCBA6U,
+			0x7FE04C67U, 0x7FE0CD29U, 0x7FE14DECU, 0x7FE1CEAFU, 0x7FE24F72U, 0x7FE2D036U, 0x7FE350FBU, 0x7FE3D1C0U,
+			0x7FE45285U, 0x7FE4D34BU, 0x7FE55412U, 0x7FE5D4D9U, 0x7FE655A0U, 0x7FE6D668U, 0x7FE75731U, 0x7FE7D7FAU,
+			0x7FE858C3U, 0x7FE8D98EU, 0x7FE95A58U, 0x7FE9DB23U, 0x7FEA5BEFU, 0x7FEADCBBU, 0x7FEB5D87U, 0x7FEBDE55U,
+			0x7FEC5F22U, 0x7FECDFF0U, 0x7FED60BFU, 0x7FEDE18EU, 0x7FEE625EU, 0x7FEEE32EU, 0x7FEF63FEU, 0x7FEFE4D0U,
+			0x7FF065A1U, 0x7FF0E673U, 0x7FF16746U, 0x7FF1E819U, 0x7FF268EDU, 0x7FF2E9C1U, 0x7FF36A96U, 0x7FF3EB6BU,
+			0x7FF46C41U, 0x7FF4ED17U, 0x7FF56DEEU, 0x7FF5EEC5U, 0x7FF66F9DU, 0x7FF6F075U, 0x7FF7714EU, 0x7FF7F227U,
+			0x7FF87301U, 0x7FF8F3DBU, 0x7FF974B6U, 0x7FF9F591U, 0x7FFA766DU, 0x7FFAF749U, 0x7FFB7826U, 0x7FFBF903U,
+			0x7FFC79E1U, 0x7FFCFABFU, 0x7FFD7B9EU, 0x7FFDFC7EU, 0x7FFE7D5DU, 0x7FFEFE3EU, 0x7FFF7F1FU, 0x80000000U
+		},
+		{
+			0x80000000U, 0x8000C13CU, 0x80018278U, 0x800243B6U, 0x800304F5U, 0x8003C635U, 0x80048776U, 0x800548B9U,
+			0x800609FCU, 0x8006CB41U, 0x80078C87U, 0x80084DCEU, 0x80090F16U, 0x8009D05FU, 0x800A91AAU, 0x800B52F5U,
+			0x800C1442U, 0x800CD590U, 0x800D96DEU, 0x800E582FU, 0x800F1980U, 0x800FDAD2U, 0x80109C26U, 0x80115D7AU,
+			0x80121ED0U, 0x8012E027U, 0x8013A17FU, 0x801462D8U, 0x80152433U, 0x8015E58EU, 0x8016A6EBU, 0x80176848U,
+			0x801829A7U, 0x8018EB07U, 0x8019AC69U, 0x801A6DCBU, 0x801B2F2EU, 0x801BF093U, 0x801CB1F9U, 0x801D7360U,
+			0x801E34C8U, 0x801EF631U, 0x801FB79BU, 0x80207906U, 0x80213A73U, 0x8021FBE1U, 0x8022BD50U, 0x80237EC0U,
+			0x80244031U, 0x802501A3U, 0x8025C317U, 0x8026848BU, 0x80274601U, 0x80280778U, 0x8028C8F0U, 0x80298A69U,
+			0x802A4BE3U, 0x802B0D5EU, 0x802BCEDBU, 0x802C9059U, 0x802D51D8U, 0x802E1358U, 0x802ED4D9U, 0x802F965BU,
+			0x803057DEU, 0x80311963U, 0x8031DAE9U, 0x80329C6FU, 0x80335DF7U, 0x80341F80U, 0x8034E10BU, 0x8035A296U,
+			0x80366423U, 0x803725B0U, 0x8037E73FU, 0x8038A8CFU, 0x80396A60U, 0x803A2BF2U, 0x803AED86U, 0x803BAF1AU,
+			0x803C70B0U, 0x803D3247U, 0x803DF3DFU, 0x803EB578U, 0x803F7712U, 0x804038ADU, 0x8040FA4AU, 0x8041BBE8U,
+			0x80427D86U, 0x80433F26U, 0x804400C7U, 0x8044C26AU, 0x8045840DU, 0x804645B1U, 0x80470757U, 0x8047C8FEU,
+			0x80488AA6U, 0x80494C4FU, 0x804A0DF9U, 0x804ACFA4U, 0x804B9151U, 0x804C52FFU, 0x804D14ADU, 0x804DD65DU,
+			0x804E980EU, 0x804F59C1U, 0x80501B74U, 0x8050DD28U, 0x80519EDEU, 0x80526095U, 0x8053224DU, 0x8053E406U,
+			0x8054A5C0U, 0x8055677BU, 0x80562938U, 0x8056EAF6U, 0x8057ACB4U, 0x80586E74U, 0x80593035U, 0x8059F1F8U,
+			0x805AB3BBU, 0x805B757FU, 0x805C3745U, 0x805CF90CU, 0x805DBAD4U, 0x805E7C9DU, 0x805F3E67U, 0x80600032U,
+			0x7FA04798U, 0x7FA10843U, 0x7FA1C8EFU, 0x7FA2899DU, 0x7FA34A4BU, 0x7FA40AFBU, 0x7FA4CBACU, 0x7FA58C5DU,
+			0x7FA64D10U, 0x7FA70DC5U, 0x7FA7CE7AU, 0x7FA88F30U, 0x7FA94FE8U, 0x7FAA10A1U, 0x7FAAD15AU, 0x7FAB9215U,
+			0x7FAC52D1U, 0x7FAD138FU, 0x7FADD44DU, 0x7FAE950DU, 0x7FAF55CDU, 0x7FB0168FU, 0x7FB0D752U, 0x7FB19816U,
+			0x7FB258DBU, 0x7FB319A2U, 0x7FB3DA69U, 0x7FB49B32U, 0x7FB55BFBU, 0x7FB61CC6U, 0x7FB6DD92U, 0x7FB79E5FU,
+			0x7FB85F2EU, 0x7FB91FFDU, 0x7FB9E0CEU, 0x7FBAA19FU, 0x7FBB6272U, 0x7FBC2346U, 0x7FBCE41BU, 0x7FBDA4F2U,
+			0x7FBE65C9U, 0x7FBF26A2U, 0x7FBFE77BU, 0x7FC0A856U, 0x7FC16932U, 0x7FC22A0FU, 0x7FC2EAEDU, 0x7FC3ABCDU,
+			0x7FC46CADU, 0x7FC52D8FU, 0x7FC5EE71U, 0x7FC6AF55U, 0x7FC7703AU, 0x7FC83121U, 0x7FC8F208U, 0x7FC9B2F0U,
+			0x7FCA73DAU, 0x7FCB34C5U, 0x7FCBF5B1U, 0x7FCCB69EU, 0x7FCD778CU, 0x7FCE387BU, 0x7FCEF96BU, 0x7FCFBA5DU,
+			0x7FD07B50U, 0x7FD13C43U, 0x7FD1FD38U, 0x7FD2BE2FU, 0x7FD37F26U, 0x7FD4401EU, 0x7FD50118U, 0x7FD5C212U,
+			0x7FD6830EU, 0x7FD7440BU, 0x7FD80509U, 0x7FD8C608U, 0x7FD98709U, 0x7FDA480AU, 0x7FDB090DU, 0x7FDBCA11U,
+			0x7FDC8B15U, 0x7FDD4C1BU, 0x7FDE0D23U, 0x7FDECE2BU, 0x7FDF8F34U, 0x7FE0503FU, 0x7FE1114BU, 0x7FE1D258U,
+			0x7FE29366U, 0x7FE35475U, 0x7FE41585U, 0x7FE4D696U, 0x7FE597A9U, 0x7FE658BDU, 0x7FE719D2U, 0x7FE7DAE7U,
+			0x7FE89BFFU, 0x7FE95D17U, 0x7FEA1E30U, 0x7FEADF4BU, 0x7FEBA066U, 0x7FEC6183U, 0x7FED22A1U, 0x7FEDE3C0U,
+			0x7FEEA4E0U, 0x7FEF6602U, 0x7FF02724U, 0x7FF0E848U, 0x7FF1A96DU, 0x7FF26A93U, 0x7FF32BBAU, 0x7FF3ECE2U,
+			0x7FF4AE0BU, 0x7FF56F36U, 0x7FF63061U, 0x7FF6F18EU, 0x7FF7B2BCU, 0x7FF873EBU, 0x7FF9351BU, 0x7FF9F64DU,
+			0x7FFAB77FU, 0x7FFB78B3U, 0x7FFC39E7U, 0x7FFCFB1DU, 0x7FFDBC54U, 0x7FFE7D8CU, 0x7FFF3EC6U, 0x80000000U
+		},
+		{
+			0x80000000U, 0x80010185U, 0x8002030CU, 0x80030494U, 0x8004061FU, 0x800507ACU, 0x8006093BU, 0x80070ACCU,
+			0x80080C5FU, 0x80090DF4U, 0x800A0F8BU, 0x800B1124U, 0x800C12BFU, 0x800D145CU, 0x800E15FBU, 0x800F179CU,
+			0x8010193FU, 0x80111AE4U, 0x80121C8CU, 0x80131E35U, 0x80141FE0U, 0x8015218DU, 0x8016233DU, 0x801724EEU,
+			0x801826A1U, 0x80192857U, 0x801A2A0EU, 0x801B2BC7U, 0x801C2D83U, 0x801D2F40U, 0x801E3100U, 0x801F32C1U,
+			0x80203485U, 0x8021364AU, 0x80223812U, 0x802339DCU, 0x80243BA7U, 0x80253D75U, 0x80263F45U, 0x80274116U,
+			0x802842EAU, 0x802944C0U, 0x802A4698U, 0x802B4871U, 0x802C4A4DU, 0x802D4C2BU, 0x802E4E0BU, 0x802F4FEDU,
+			0x803051D1U, 0x803153B7U, 0x8032559FU, 0x80335789U, 0x80345975U, 0x80355B63U, 0x80365D53U, 0x80375F45U,
+			0x8038613AU, 0x80396330U, 0x803A6528U, 0x803B6722U, 0x803C691EU, 0x803D6B1DU, 0x803E6D1DU, 0x803F6F1FU,
+			0x80407124U, 0x8041732AU, 0x80427533U, 0x8043773DU, 0x8044794AU, 0x80457B58U, 0x80467D69U, 0x80477F7BU,
+			0x80488190U, 0x804983A7U, 0x804A85BFU, 0x804B87DAU, 0x804C89F7U, 0x804D8C16U, 0x804E8E36U, 0x804F9059U,
+			0x8050927EU, 0x805194A5U, 0x805296CEU, 0x805398F9U, 0x80549B26U, 0x80559D55U, 0x80569F86U, 0x8057A1B9U,
+			0x8058A3EEU, 0x8059A625U, 0x805AA85EU, 0x805BAA99U, 0x805CACD6U, 0x805DAF16U, 0x805EB157U, 0x805FB39AU,
+			0x8060B5DFU, 0x8061B827U, 0x8062BA70U, 0x8063BCBBU, 0x8064BF09U, 0x8065C158U, 0x8066C3AAU, 0x8067C5FDU,
+			0x8068C853U, 0x8069CAABU, 0x806ACD04U, 0x806BCF60U, 0x806CD1BDU, 0x806DD41DU, 0x806ED67FU, 0x806FD8E3U,
+			0x8070DB48U, 0x8071DDB0U, 0x8072E01AU, 0x8073E286U, 0x8074E4F4U, 0x8075E764U, 0x8076E9D6U, 0x8077EC4AU,
+			0x8078EEC0U, 0x8079F138U, 0x807AF3B2U, 0x807BF62EU, 0x807CF8ACU, 0x807DFB2DU, 0x807EFDAFU, 0x80800033U,
+			0x7F807F4EU, 0x7F817FD2U, 0x7F828058U, 0x7F8380E1U, 0x7F84816BU, 0x7F8581F7U, 0x7F868286U, 0x7F878316U,
+			0x7F8883A8U, 0x7F89843DU, 0x7F8A84D3U, 0x7F8B856CU, 0x7F8C8606U, 0x7F8D86A2U, 0x7F8E8741U, 0x7F8F87E1U,
+			0x7F908884U, 0x7F918928U, 0x7F9289CFU, 0x7F938A77U, 0x7F948B22U, 0x7F958BCFU, 0x7F968C7DU, 0x7F978D2EU,
+			0x7F988DE0U, 0x7F998E95U, 0x7F9A8F4CU, 0x7F9B9004U, 0x7F9C90BFU, 0x7F9D917CU, 0x7F9E923BU, 0x7F9F92FBU,
+			0x7FA093BEU, 0x7FA19483U, 0x7FA2954AU, 0x7FA39613U, 0x7FA496DDU, 0x7FA597AAU, 0x7FA69879U, 0x7FA7994AU,
+			0x7FA89A1DU, 0x7FA99AF2U, 0x7FAA9BC9U, 0x7FAB9CA2U, 0x7FAC9D7DU, 0x7FAD9E5AU, 0x7FAE9F39U, 0x7FAFA01AU,
+			0x7FB0A0FDU, 0x7FB1A1E2U, 0x7FB2A2C9U, 0x7FB3A3B2U, 0x7FB4A49DU, 0x7FB5A58BU, 0x7FB6A67AU, 0x7FB7A76BU,
+			0x7FB8A85EU, 0x7FB9A953U, 0x7FBAAA4BU, 0x7FBBAB44U, 0x7FBCAC3FU, 0x7FBDAD3DU, 0x7FBEAE3CU, 0x7FBFAF3DU,
+			0x7FC0B041U, 0x7FC1B146U, 0x7FC2B24EU, 0x7FC3B357U, 0x7FC4B462U, 0x7FC5B570U, 0x7FC6B67FU, 0x7FC7B791U,
+			0x7FC8B8A4U, 0x7FC9B9BAU, 0x7FCABAD2U, 0x7FCBBBEBU, 0x7FCCBD07U, 0x7FCDBE24U, 0x7FCEBF44U, 0x7FCFC066U,
+			0x7FD0C189U, 0x7FD1C2AFU, 0x7FD2C3D7U, 0x7FD3C501U, 0x7FD4C62CU, 0x7FD5C75AU, 0x7FD6C88AU, 0x7FD7C9BCU,
+			0x7FD8CAF0U, 0x7FD9CC26U, 0x7FDACD5EU, 0x7FDBCE98U, 0x7FDCCFD4U, 0x7FDDD112U, 0x7FDED252U, 0x7FDFD394U,
+			0x7FE0D4D8U, 0x7FE1D61EU, 0x7FE2D766U, 0x7FE3D8B0U, 0x7FE4D9FCU, 0x7FE5DB4AU, 0x7FE6DC9AU, 0x7FE7DDECU,
+			0x7FE8DF41U, 0x7FE9E097U, 0x7FEAE1EFU, 0x7FEBE349U, 0x7FECE4A6U, 0x7FEDE604U, 0x7FEEE764U, 0x7FEFE8C7U,
+			0x7FF0EA2BU, 0x7FF1EB92U, 0x7FF2ECFAU, 0x7FF3EE65U, 0x7FF4EFD1U, 0x7FF5F140U, 0x7FF6F2B0U, 0x7FF7F423U,
+			0x7FF8F597U, 0x7FF9F70EU, 0x7FFAF887U, 0x7FFBFA01U, 0x7FFCFB7EU, 0x7FFDFCFDU, 0x7FFEFE7DU, 0x80000000U
+		},
+		{
+			0x80000000U, 0x800181E7U, 0x800303D2U, 0x800485C2U, 0x800607B6U, 0x800789AFU, 0x80090BADU, 0x800A8DAFU,
+			0x800C0FB5U, 0x800D91C0U, 0x800F13D0U, 0x801095E4U, 0x801217FDU, 0x80139A1AU, 0x80151C3CU, 0x80169E62U,
+			0x8018208DU, 0x8019A2BDU, 0x801B24F1U, 0x801CA729U, 0x801E2966U, 0x801FABA8U, 0x80212DEEU, 0x8022B039U,
+			0x80243288U, 0x8025B4DCU, 0x80273734U, 0x8028B991U, 0x802A3BF3U, 0x802BBE59U, 0x802D40C4U, 0x802EC333U,
+			0x803045A6U, 0x8031C81FU, 0x80334A9CU, 0x8034CD1DU, 0x80364FA3U, 0x8037D22DU, 0x803954BCU, 0x803AD750U,
+			0x803C59E8U, 0x803DDC85U, 0x803F5F26U, 0x8040E1CCU, 0x80426476U, 0x8043E725U, 0x804569D8U, 0x8046EC90U,
+			0x80486F4DU, 0x8049F20EU, 0x804B74D4U, 0x804CF79EU, 0x804E7A6DU, 0x804FFD40U, 0x80518018U, 0x805302F4U,
+			0x805485D5U, 0x805608BBU, 0x80578BA5U, 0x80590E94U, 0x805A9187U, 0x805C147FU, 0x805D977BU, 0x805F1A7CU,
+			0x80609D81U, 0x8062208BU, 0x8063A39AU, 0x806526ADU, 0x8066A9C5U, 0x80682CE1U, 0x8069B002U, 0x806B3327U,
+			0x806CB651U, 0x806E397FU, 0x806FBCB2U, 0x80713FEAU, 0x8072C326U, 0x80744667U, 0x8075C9ACU, 0x80774CF6U,
+			0x8078D044U, 0x807A5397U, 0x807BD6EFU, 0x807D5A4BU, 0x807EDDACU, 0x80806111U, 0x8081E47BU, 0x808367E9U,
+			0x8084EB5CU, 0x80866ED3U, 0x8087F24FU, 0x808975D0U, 0x808AF955U, 0x808C7CDFU, 0x808E006DU, 0x808F8400U,
+			0x80910797U, 0x80928B33U, 0x80940ED4U, 0x80959279U, 0x80971623U, 0x809899D1U, 0x809A1D84U, 0x809BA13BU,
+			0x809D24F7U, 0x809EA8B7U, 0x80A02C7DU, 0x80A1B046U, 0x80A33414U, 0x80A4B7E7U, 0x80A63BBEU, 0x80A7BF9AU,
+			0x80A9437BU, 0x80AAC760U, 0x80AC4B49U, 0x80ADCF38U, 0x80AF532AU, 0x80B0D722U, 0x80B25B1DU, 0x80B3DF1EU,
+			0x80B56323U, 0x80B6E72DU, 0x80B86B3BU, 0x80B9EF4DU, 0x80BB7365U, 0x80BCF781U, 0x80BE7BA1U, 0x80BFFFC6U,
+			0x7F411E8CU, 0x7F429E33U, 0x7F441DDFU, 0x7F459D8FU, 0x7F471D44U, 0x7F489CFDU, 0x7F4A1CBBU, 0x7F4B9C7DU,
+			0x7F4D1C44U, 0x7F4E9C10U, 0x7F501BE0U, 0x7F519BB4U, 0x7F531B8DU, 0x7F549B6BU, 0x7F561B4DU, 0x7F579B33U,
+			0x7F591B1EU, 0x7F5A9B0EU, 0x7F5C1B02U, 0x7F5D9AFAU, 0x7F5F1AF8U, 0x7F609AF9U, 0x7F621AFFU, 0x7F639B0AU,
+			0x7F651B19U, 0x7F669B2DU, 0x7F681B45U, 0x7F699B62U, 0x7F6B1B83U, 0x7F6C9BA9U, 0x7F6E1BD4U, 0x7F6F9C02U,
+			0x7F711C36U, 0x7F729C6EU, 0x7F741CAAU, 0x7F759CEBU, 0x7F771D31U, 0x7F789D7BU, 0x7F7A1DC9U, 0x7F7B9E1CU,
+			0x7F7D1E74U, 0x7F7E9ED0U, 0x7F801F31U, 0x7F819F96U, 0x7F832000U, 0x7F84A06EU, 0x7F8620E1U, 0x7F87A158U,
+			0x7F8921D4U, 0x7F8AA254U, 0x7F8C22D9U, 0x7F8DA363U, 0x7F8F23F1U, 0x7F90A483U, 0x7F92251AU, 0x7F93A5B6U,
+			0x7F952656U, 0x7F96A6FAU, 0x7F9827A3U, 0x7F99A851U, 0x7F9B2903U, 0x7F9CA9BAU, 0x7F9E2A75U, 0x7F9FAB35U,
+			0x7FA12BF9U, 0x7FA2ACC2U, 0x7FA42D8FU, 0x7FA5AE61U, 0x7FA72F38U, 0x7FA8B013U, 0x7FAA30F2U, 0x7FABB1D6U,
+			0x7FAD32BFU, 0x7FAEB3ACU, 0x7FB0349DU, 0x7FB1B594U, 0x7FB3368EU, 0x7FB4B78EU, 0x7FB63891U, 0x7FB7B99AU,
+			0x7FB93AA6U, 0x7FBABBB8U, 0x7FBC3CCEU, 0x7FBDBDE8U, 0x7FBF3F07U, 0x7FC0C02BU, 0x7FC24153U, 0x7FC3C27FU,
+			0x7FC543B0U, 0x7FC6C4E6U, 0x7FC84620U, 0x7FC9C75FU, 0x7FCB48A2U, 0x7FCCC9EAU, 0x7FCE4B36U, 0x7FCFCC87U,
+			0x7FD14DDCU, 0x7FD2CF36U, 0x7FD45095U, 0x7FD5D1F8U, 0x7FD75360U, 0x7FD8D4CCU, 0x7FDA563CU, 0x7FDBD7B1U,
+			0x7FDD592BU, 0x7FDEDAA9U, 0x7FE05C2CU, 0x7FE1DDB4U, 0x7FE35F3FU, 0x7FE4E0D0U, 0x7FE66265U, 0x7FE7E3FEU,
+			0x7FE9659CU, 0x7FEAE73FU, 0x7FEC68E6U, 0x7FEDEA92U, 0x7FEF6C42U, 0x7FF0EDF7U, 0x7FF26FB0U, 0x7FF3F16EU,
+			0x7FF57330U, 0x7FF6F4F7U, 0x7FF876C3U, 0x7FF9F893U, 0x7FFB7A67U, 0x7FFCFC40U, 0x7FFE7E1EU, 0x80000000U
+		},
+		{
+			0x80000000U, 0x80030195U, 0x8006033BU, 0x800904F4U, 0x800C06BFU, 0x800F089CU, 0x80120A8BU, 0x80150C8CU,
+			0x80180E9FU, 0x801B10C4U, 0x801E12FCU, 0x80211545U, 0x802417A1U, 0x80271A0EU, 0x802A1C8EU, 0x802D1F20U,
+			0x803021C4U, 0x8033247AU, 0x80362742U, 0x80392A1CU, 0x803C2D08U, 0x803F3007U, 0x80423317U, 0x8045363AU,
+			0x8048396EU, 0x804B3CB5U, 0x804E400EU, 0x80514379U, 0x805446F7U, 0x80574A86U, 0x805A4E27U, 0x805D51DBU,
+			0x806055A1U, 0x80635978U, 0x80665D62U, 0x8069615EU, 0x806C656DU, 0x806F698DU, 0x80726DBFU, 0x80757204U,
+			0x8078765BU, 0x807B7AC4U, 0x807E7F3FU, 0x808183CCU, 0x8084886BU, 0x80878D1CU, 0x808A91E0U, 0x808D96B6U,
+			0x80909B9EU, 0x8093A098U, 0x8096A5A4U, 0x8099AAC2U, 0x809CAFF3U, 0x809FB535U, 0x80A2BA8AU, 0x80A5BFF1U,
+			0x80A8C56AU, 0x80ABCAF6U, 0x80AED093U, 0x80B1D643U, 0x80B4DC05U, 0x80B7E1D9U, 0x80BAE7BFU, 0x80BDEDB7U,
+			0x80C0F3C2U, 0x80C3F9DEU, 0x80C7000DU, 0x80CA064EU, 0x80CD0CA2U, 0x80D01307U, 0x80D3197FU, 0x80D62009U,
+			0x80D926A5U, 0x80DC2D53U, 0x80DF3413U, 0x80E23AE6U, 0x80E541CBU, 0x80E848C1U, 0x80EB4FCBU, 0x80EE56E6U,
+			0x80F15E14U, 0x80F46553U, 0x80F76CA5U, 0x80FA740AU, 0x80FD7B80U, 0x81008309U, 0x81038AA4U, 0x81069251U,
+			0x81099A10U, 0x810CA1E1U, 0x810FA9C5U, 0x8112B1BBU, 0x8115B9C3U, 0x8118C1DEU, 0x811BCA0AU, 0x811ED249U,
+			0x8121DA9AU, 0x8124E2FEU, 0x8127EB73U, 0x812AF3FBU, 0x812DFC95U, 0x81310541U, 0x81340E00U, 0x813716D0U,
+			0x813A1FB3U, 0x813D28A9U, 0x814031B0U, 0x81433ACAU, 0x814643F6U, 0x81494D34U, 0x814C5684U, 0x814F5FE7U,
+			0x8152695CU, 0x815572E3U, 0x81587C7DU, 0x815B8629U, 0x815E8FE7U, 0x816199B7U, 0x8164A39AU, 0x8167AD8FU,
+			0x816AB796U, 0x816DC1AFU, 0x8170CBDBU, 0x8173D619U, 0x8176E069U, 0x8179EACBU, 0x817CF540U, 0x817FFFC7U,
+			0x7E8472DFU, 0x7E876B8AU, 0x7E8A6447U, 0x7E8D5D15U, 0x7E9055F5U, 0x7E934EE7U, 0x7E9647EBU, 0x7E994101U,
+			0x7E9C3A29U, 0x7E9F3362U, 0x7EA22CAEU, 0x7EA5260BU, 0x7EA81F7AU, 0x7EAB18FBU, 0x7EAE128EU, 0x7EB10C33U,
+			0x7EB405EAU, 0x7EB6FFB3U, 0x7EB9F98DU, 0x7EBCF37AU, 0x7EBFED78U, 0x7EC2E788U, 0x7EC5E1AAU, 0x7EC8DBDEU,
+			0x7ECBD624U, 0x7ECED07CU, 0x7ED1CAE6U, 0x7ED4C561U, 0x7ED7BFEFU, 0x7EDABA8EU, 0x7EDDB540U, 0x7EE0B003U,
+			0x7EE3AAD8U, 0x7EE6A5BFU, 0x7EE9A0B8U, 0x7EEC9BC3U, 0x7EEF96E0U, 0x7EF2920FU, 0x7EF58D50U, 0x7EF888A2U,
+			0x7EFB8407U, 0x7EFE7F7DU, 0x7F017B06U, 0x7F0476A0U, 0x7F07724CU, 0x7F0A6E0BU, 0x7F0D69DBU, 0x7F1065BDU,
+			0x7F1361B1U, 0x7F165DB7U, 0x7F1959CFU, 0x7F1C55F9U, 0x7F1F5235U, 0x7F224E82U, 0x7F254AE2U, 0x7F284754U,
+			0x7F2B43D7U, 0x7F2E406DU, 0x7F313D14U, 0x7F3439CEU, 0x7F373699U, 0x7F3A3377U, 0x7F3D3066U, 0x7F402D67U,
+			0x7F432A7BU, 0x7F4627A0U, 0x7F4924D7U, 0x7F4C2220U, 0x7F4F1F7CU, 0x7F521CE9U, 0x7F551A68U, 0x7F5817F9U,
+			0x7F5B159CU, 0x7F5E1351U, 0x7F611118U, 0x7F640EF1U, 0x7F670CDCU, 0x7F6A0AD9U, 0x7F6D08E8U, 0x7F700709U,
+			0x7F73053CU, 0x7F760381U, 0x7F7901D8U, 0x7F7C0041U, 0x7F7EFEBCU, 0x7F81FD49U, 0x7F84FBE8U, 0x7F87FA99U,
+			0x7F8AF95CU, 0x7F8DF831U, 0x7F90F718U, 0x7F93F611U, 0x7F96F51CU, 0x7F99F43AU, 0x7F9CF369U, 0x7F9FF2AAU,
+			0x7FA2F1FDU, 0x7FA5F162U, 0x7FA8F0D9U, 0x7FABF062U, 0x7FAEEFFEU, 0x7FB1EFABU, 0x7FB4EF6AU, 0x7FB7EF3BU,
+			0x7FBAEF1FU, 0x7FBDEF14U, 0x7FC0EF1BU, 0x7FC3EF35U, 0x7FC6EF60U, 0x7FC9EF9EU, 0x7FCCEFEDU, 0x7FCFF04FU,
+			0x7FD2F0C3U, 0x7FD5F148U, 0x7FD8F1E0U, 0x7FDBF28AU, 0x7FDEF346U, 0x7FE1F414U, 0x7FE4F4F4U, 0x7FE7F5E6U,
+			0x7FEAF6EAU, 0x7FEDF800U, 0x7FF0F928U, 0x7FF3FA62U, 0x7FF6FBAFU, 0x7FF9FD0DU, 0x7FFCFE7DU, 0x80000000U
+		},
+		{
+			0x80000000U, 0x8005FA5FU, 0x800BF505U, 0x8011EFF3U, 0x8017EB29U, 0x801DE6A6U, 0x8023E26AU, 0x8029DE76U,
+			0x802FDAC9U, 0x8035D765U, 0x803BD447U, 0x8041D171U, 0x8047CEE3U, 0x804DCC9DU, 0x8053CA9EU, 0x8059C8E7U,
+			0x805FC777U, 0x8065C64FU, 0x806BC56FU, 0x8071C4D6U, 0x8077C485U, 0x807DC47CU, 0x8083C4BBU, 0x8089C541U,
+			0x808FC60FU, 0x8095C725U, 0x809BC883U, 0x80A1CA29U, 0x80A7CC16U, 0x80ADCE4BU, 0x80B3D0C8U, 0x80B9D38DU,
+			0x80BFD699U, 0x80C5D9EEU, 0x80CBDD8AU, 0x80D1E16FU, 0x80D7E59BU, 0x80DDEA0FU, 0x80E3EECBU, 0x80E9F3CFU,
+			0x80EFF91CU, 0x80F5FEB0U, 0x80FC048CU, 0x81020AB0U, 0x8108111CU, 0x810E17D0U, 0x81141ECCU, 0x811A2610U,
+			0x81202D9DU, 0x81263571U, 0x812C3D8EU, 0x813245F2U, 0x81384E9FU, 0x813E5794U, 0x814460D1U, 0x814A6A56U,
+			0x81507423U, 0x81567E39U, 0x815C8897U, 0x8162933DU, 0x81689E2BU, 0x816EA962U, 0x8174B4E0U, 0x817AC0A7U,
+			0x8180CCB7U, 0x8186D90EU, 0x818CE5AEU, 0x8192F296U, 0x8198FFC7U, 0x819F0D40U, 0x81A51B01U, 0x81AB290BU,
+			0x81B1375DU, 0x81B745F7U, 0x81BD54DAU, 0x81C36406U, 0x81C97379U, 0x81CF8336U, 0x81D5933AU, 0x81DBA388U,
+			0x81E1B41DU, 0x81E7C4FBU, 0x81EDD622U, 0x81F3E791U, 0x81F9F949U, 0x82000B4AU, 0x82061D93U, 0x820C3024U,
+			0x821242FEU, 0x82185621U, 0x821E698CU, 0x82247D40U, 0x822A913DU, 0x8230A582U, 0x8236BA10U, 0x823CCEE7U,
+			0x8242E407U, 0x8248F96FU, 0x824F0F20U, 0x82552519U, 0x825B3B5CU, 0x826151E7U, 0x826768BBU, 0x826D7FD8U,
+			0x8273973DU, 0x8279AEECU, 0x827FC6E3U, 0x8285DF23U, 0x828BF7ACU, 0x8292107EU, 0x82982999U, 0x829E42FCU,
+			0x82A45CA9U, 0x82AA769FU, 0x82B090DDU, 0x82B6AB64U, 0x82BCC635U, 0x82C2E14EU, 0x82C8FCB1U, 0x82CF185CU,
+			0x82D53451U, 0x82DB508EU, 0x82E16D15U, 0x82E789E4U, 0x82EDA6FDU, 0x82F3C45FU, 0x82F9E20AU, 0x82FFFFFEU,
+			0x7D11967BU, 0x7D176DCEU, 0x7D1D4567U, 0x7D231D46U, 0x7D28F56AU, 0x7D2ECDD5U, 0x7D34A685U, 0x7D3A7F7BU,
+			0x7D4058B7U, 0x7D463239U, 0x7D4C0C01U, 0x7D51E60FU, 0x7D57C063U, 0x7D5D9AFDU, 0x7D6375DDU, 0x7D695103U,
+			0x7D6F2C6FU, 0x7D750821U, 0x7D7AE419U, 0x7D80C057U, 0x7D869CDBU, 0x7D8C79A5U, 0x7D9256B5U, 0x7D98340BU,
+			0x7D9E11A8U, 0x7DA3EF8AU, 0x7DA9CDB3U, 0x7DAFAC22U, 0x7DB58AD7U, 0x7DBB69D2U, 0x7DC14914U, 0x7DC7289BU,
+			0x7DCD0869U, 0x7DD2E87DU, 0x7DD8C8D8U, 0x7DDEA978U, 0x7DE48A5FU, 0x7DEA6B8CU, 0x7DF04D00U, 0x7DF62EB9U,
+			0x7DFC10BAU, 0x7E01F300U, 0x7E07D58DU, 0x7E0DB860U, 0x7E139B79U, 0x7E197ED9U, 0x7E1F627FU, 0x7E25466CU,
+			0x7E2B2A9FU, 0x7E310F19U, 0x7E36F3D9U, 0x7E3CD8DFU, 0x7E42BE2CU, 0x7E48A3C0U, 0x7E4E899AU, 0x7E546FBAU,
+			0x7E5A5621U, 0x7E603CCEU, 0x7E6623C3U, 0x7E6C0AFDU, 0x7E71F27EU, 0x7E77DA46U, 0x7E7DC255U, 0x7E83AAAAU,
+			0x7E899345U, 0x7E8F7C28U, 0x7E956551U, 0x7E9B4EC0U, 0x7EA13877U, 0x7EA72274U, 0x7EAD0CB7U, 0x7EB2F742U,
+			0x7EB8E213U, 0x7EBECD2BU, 0x7EC4B889U, 0x7ECAA42FU, 0x7ED0901BU, 0x7ED67C4EU, 0x7EDC68C8U, 0x7EE25589U,
+			0x7EE84290U, 0x7EEE2FDFU, 0x7EF41D74U, 0x7EFA0B50U, 0x7EFFF973U, 0x7F05E7DDU, 0x7F0BD68EU, 0x7F11C585U,
+			0x7F17B4C4U, 0x7F1DA44AU, 0x7F239416U, 0x7F29842AU, 0x7F2F7484U, 0x7F356526U, 0x7F3B560EU, 0x7F41473EU,
+			0x7F4738B5U, 0x7F4D2A72U, 0x7F531C77U, 0x7F590EC3U, 0x7F5F0156U, 0x7F64F430U, 0x7F6AE751U, 0x7F70DABAU,
+			0x7F76CE69U, 0x7F7CC260U, 0x7F82B69EU, 0x7F88AB23U, 0x7F8E9FEFU, 0x7F949502U, 0x7F9A8A5DU, 0x7FA07FFFU,
+			0x7FA675E8U, 0x7FAC6C18U, 0x7FB26290U, 0x7FB8594FU, 0x7FBE5055U, 0x7FC447A3U, 0x7FCA3F38U, 0x7FD03714U,
+			0x7FD62F38U, 0x7FDC27A3U, 0x7FE22055U, 0x7FE8194FU, 0x7FEE1290U, 0x7FF40C18U, 0x7FFA05E9U, 0x80000000U
+		},
+		{
+			0x80000000U, 0x800BD25CU, 0x8017A5CFU, 0x80237A59U, 0x802F4FFCU, 0x803B26B6U, 0x8046FE88U, 0x8052D772U,
+			0x805EB174U, 0x806A8C8FU, 0x807668C1U, 0x8082460CU, 0x808E2470U, 0x809A03ECU, 0x80A5E481U, 0x80B1C62FU,
+			0x80BDA8F6U, 0x80C98CD6U, 0x80D571CFU, 0x80E157E1U, 0x80ED3F0CU, 0x80F92751U, 0x810510AFU, 0x8110FB27U,
+			0x811CE6B9U, 0x8128D365U, 0x8134C12AU, 0x8140B00AU, 0x814CA004U, 0x81589117U, 0x81648346U, 0x8170768EU,
+			0x817C6AF2U, 0x81886070U, 0x81945708U, 0x81A04EBCU, 0x81AC478AU, 0x81B84174U, 0x81C43C79U, 0x81D03899U,
+			0x81DC35D4U, 0x81E8342BU, 0x81F4339DU, 0x8200342BU, 0x820C35D5U, 0x8218389BU, 0x82243C7CU, 0x8230417AU,
+			0x823C4794U, 0x82484ECAU, 0x8254571DU, 0x8260608CU, 0x826C6B17U, 0x827876C0U, 0x82848385U, 0x82909167U,
+			0x829CA066U, 0x82A8B082U, 0x82B4C1BBU, 0x82C0D412U, 0x82CCE786U, 0x82D8FC18U, 0x82E511C7U, 0x82F12894U,
+			0x82FD407FU, 0x83095988U, 0x831573AEU, 0x83218EF3U, 0x832DAB56U, 0x8339C8D8U, 0x8345E778U, 0x83520736U,
+			0x835E2813U, 0x836A4A0FU, 0x83766D2AU, 0x83829164U, 0x838EB6BCU, 0x839ADD34U, 0x83A704CCU, 0x83B32D82U,
+			0x83BF5758U, 0x83CB824EU, 0x83D7AE63U, 0x83E3DB98U, 0x83F009EDU, 0x83FC3962U, 0x840869F8U, 0x84149BADU,
+			0x8420CE83U, 0x842D0279U, 0x8439378FU, 0x84456DC6U, 0x8451A51EU, 0x845DDD97U, 0x846A1731U, 0x847651ECU,
+			0x84828DC7U, 0x848ECAC5U, 0x849B08E3U, 0x84A74823U, 0x84B38885U, 0x84BFCA08U, 0x84CC0CADU, 0x84D85074U,
+			0x84E4955CU, 0x84F0DB67U, 0x84FD2294U, 0x85096AE4U, 0x8515B456U, 0x8521FEEAU, 0x852E4AA1U, 0x853A977AU,
+			0x8546E577U, 0x85533496U, 0x855F84D9U, 0x856BD63EU, 0x857828C7U, 0x85847C73U, 0x8590D142U, 0x859D2736U,
+			0x85A97E4CU, 0x85B5D687U, 0x85C22FE5U, 0x85CE8A68U, 0x85DAE60EU, 0x85E742D9U, 0x85F3A0C8U, 0x85FFFFDBU,
+			0x7A44C6D2U, 0x7A5011ABU, 0x7A5B5D8FU, 0x7A66AA7FU, 0x7A71F879U, 0x7A7D477FU, 0x7A889791U, 0x7A93E8ADU,
+			0x7A9F3AD6U, 0x7AAA8E0AU, 0x7AB5E249U, 0x7AC13795U, 0x7ACC8DEDU, 0x7AD7E550U, 0x7AE33DC0U, 0x7AEE973CU,
+			0x7AF9F1C4U, 0x7B054D59U, 0x7B10A9FBU, 0x7B1C07A8U, 0x7B276663U, 0x7B32C62BU, 0x7B3E26FFU, 0x7B4988E1U,
+			0x7B54EBCFU, 0x7B604FCBU, 0x7B6BB4D4U, 0x7B771AEBU, 0x7B82820FU, 0x7B8DEA40U, 0x7B995380U, 0x7BA4BDCDU,
+			0x7BB02928U, 0x7BBB9591U, 0x7BC70308U, 0x7BD2718DU, 0x7BDDE121U, 0x7BE951C3U, 0x7BF4C373U, 0x7C003632U,
+			0x7C0BAA00U, 0x7C171EDCU, 0x7C2294C8U, 0x7C2E0BC2U, 0x7C3983CBU, 0x7C44FCE4U, 0x7C50770CU, 0x7C5BF243U,
+			0x7C676E89U, 0x7C72EBE0U, 0x7C7E6A45U, 0x7C89E9BBU, 0x7C956A40U, 0x7CA0EBD6U, 0x7CAC6E7BU, 0x7CB7F231U,
+			0x7CC376F7U, 0x7CCEFCCDU, 0x7CDA83B3U, 0x7CE60BAAU, 0x7CF194B2U, 0x7CFD1ECBU, 0x7D08A9F4U, 0x7D14362EU,
+			0x7D1FC379U, 0x7D2B51D6U, 0x7D36E143U, 0x7D4271C2U, 0x7D4E0353U, 0x7D5995F5U, 0x7D6529A8U, 0x7D70BE6DU,
+			0x7D7C5444U, 0x7D87EB2DU, 0x7D938328U, 0x7D9F1C35U, 0x7DAAB655U, 0x7DB65186U, 0x7DC1EDCAU, 0x7DCD8B21U,
+			0x7DD9298AU, 0x7DE4C906U, 0x7DF06995U, 0x7DFC0B36U, 0x7E07ADEBU, 0x7E1351B3U, 0x7E1EF68DU, 0x7E2A9C7CU,
+			0x7E36437DU, 0x7E41EB92U, 0x7E4D94BBU, 0x7E593EF7U, 0x7E64EA48U, 0x7E7096ACU, 0x7E7C4424U, 0x7E87F2B0U,
+			0x7E93A250U, 0x7E9F5305U, 0x7EAB04CEU, 0x7EB6B7ACU, 0x7EC26B9EU, 0x7ECE20A5U, 0x7ED9D6C0U, 0x7EE58DF1U,
+			0x7EF14637U, 0x7EFCFF91U, 0x7F08BA01U, 0x7F147586U, 0x7F203221U, 0x7F2BEFD1U, 0x7F37AE97U, 0x7F436E72U,
+			0x7F4F2F63U, 0x7F5AF16AU, 0x7F66B487U, 0x7F7278BAU, 0x7F7E3E04U, 0x7F8A0463U, 0x7F95CBD9U, 0x7FA19466U,
+			0x7FAD5E09U, 0x7FB928C3U, 0x7FC4F493U, 0x7FD0C17BU, 0x7FDC8F79U, 0x7FE85E8FU, 0x7FF42EBCU, 0x80000000U
+		}
+	},
+	{
+		{
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U
+		},
+		{
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U, 0x803FFFE9U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U,
+			0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U, 0x7FC02007U
+		},
+		{
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U, 0x80600032U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U,
+			0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U, 0x7FA04798U
+		},
+		{
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U, 0x80800033U,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU,
+			0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU, 0x7F807F4EU
+		},
+		{
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U, 0x80BFFFC6U,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU,
+			0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU, 0x7F411E8CU
+		},
+		{
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U, 0x817FFFC7U,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU,
+			0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU, 0x7E8472DFU
+		},
+		{
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU, 0x82FFFFFEU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU,
+			0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU, 0x7D11967BU
+		},
+		{
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU, 0x85FFFFDBU,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U,
+			0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U, 0x7A44C6D2U
+		}
+	},
+	{
+		{
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U,
+			0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U, 0x80000000U
+		},
+		{
+			0x80000000U, 0x8000FFC1U, 0x8001FF83U, 0x8002FF48U, 0x8003FF0FU, 0x8004FED8U, 0x8005FEA2U, 0x8006FE6FU,
+			0x8007FE3EU, 0x8008FE0EU, 0x8009FDE1U, 0x800AFDB6U, 0x800BFD8CU, 0x800CFD65U, 0x800DFD40U, 0x800EFD1CU,
+			0x800FFCFBU, 0x8010FCDCU, 0x8011FCBEU, 0x8012FCA3U, 0x8013FC8AU, 0x8014FC72U, 0x8015FC5DU, 0x8016FC4AU,
+			0x8017FC38U, 0x8018FC29U, 0x8019FC1CU, 0x801AFC10U, 0x801BFC07U, 0x801CFBFFU, 0x801DFBFAU, 0x801EFBF7U,
+			0x801FFBF5U, 0x8020FBF6U, 0x8021FBF9U, 0x8022FBFDU, 0x8023FC04U, 0x8024FC0CU, 0x8025FC17U, 0x8026FC24U,
+			0x8027FC32U, 0x8028FC43U, 0x8029FC56U, 0x802AFC6AU, 0x802BFC81U, 0x802CFC99U, 0x802DFCB4U, 0x802EFCD1U,
+			0x802FFCEFU, 0x8030FD10U, 0x8031FD32U, 0x8032FD57U, 0x8033FD7EU, 0x8034FDA6U, 0x8035FDD1U, 0x8036FDFDU,
+			0x8037FE2CU, 0x8038FE5DU, 0x8039FE8FU, 0x803AFEC4U, 0x803BFEFAU, 0x803CFF33U, 0x803DFF6EU, 0x803EFFAAU,
+			0x803FFFE9U, 0x803EFFAAU, 0x803DFF6EU, 0x803CFF33U, 0x803BFEFAU, 0x803AFEC4U, 0x8039FE8FU, 0x8038FE5DU,
+			0x8037FE2CU, 0x8036FDFDU, 0x8035FDD1U, 0x8034FDA6U, 0x8033FD7EU, 0x8032FD57U, 0x8031FD32U, 0x8030FD10U,
+			0x802FFCEFU, 0x802EFCD1U, 0x802DFCB4U, 0x802CFC99U, 0x802BFC81U, 0x802AFC6AU, 0x8029FC56U, 0x8028FC43U,
+			0x8027FC32U, 0x8026FC24U, 0x8025FC17U, 0x8024FC0CU, 0x8023FC04U, 0x8022FBFDU, 0x8021FBF9U, 0x8020FBF6U,
+			0x801FFBF5U, 0x801EFBF7U, 0x801DFBFAU, 0x801CFBFFU, 0x801BFC07U, 0x801AFC10U, 0x8019FC1CU, 0x8018FC29U,
+			0x8017FC38U, 0x8016FC4AU, 0x8015FC5DU, 0x8014FC72U, 0x8013FC8AU, 0x8012FCA3U, 0x8011FCBEU, 0x8010FCDCU,
+			0x800FFCFBU, 0x800EFD1CU, 0x800DFD40U, 0x800CFD65U, 0x800BFD8CU, 0x800AFDB6U, 0x8009FDE1U, 0x8008FE0EU,
+			0x8007FE3EU, 0x8006FE6FU, 0x8005FEA2U, 0x8004FED8U, 0x8003FF0FU, 0x8002FF48U, 0x8001FF83U, 0x8000FFC1U,
+			0x80000000U, 0x7FFF0041U, 0x7FFE0085U, 0x7FFD00CAU, 0x7FFC0111U, 0x7FFB015AU, 0x7FFA01A6U, 0x7FF901F3U,
+			0x7FF80242U, 0x7FF70293U, 0x7FF602E7U, 0x7FF5033CU, 0x7FF40393U, 0x7FF303ECU, 0x7FF20448U, 0x7FF104A5U,
+			0x7FF00504U, 0x7FEF0565U, 0x7FEE05C8U, 0x7FED062EU, 0x7FEC0695U, 0x7FEB06FEU, 0x7FEA0769U, 0x7FE907D6U,
+			0x7FE80845U, 0x7FE708B7U, 0x7FE6092AU, 0x7FE5099FU, 0x7FE40A16U, 0x7FE30A8FU, 0x7FE20B0AU, 0x7FE10B87U,
+			0x7FE00C07U, 0x7FDF0C88U, 0x7FDE0D0BU, 0x7FDD0D90U, 0x7FDC0E17U, 0x7FDB0EA0U, 0x7FDA0F2BU, 0x7FD90FB8U,
+			0x7FD81047U, 0x7FD710D8U, 0x7FD6116CU, 0x7FD51201U, 0x7FD41298U, 0x7FD31331U, 0x7FD213CCU, 0x7FD11469U,
+			0x7FD01508U, 0x7FCF15A9U, 0x7FCE164CU, 0x7FCD16F1U, 0x7FCC1798U, 0x7FCB1841U, 0x7FCA18ECU, 0x7FC91999U,
+			0x7FC81A48U, 0x7FC71AF9U, 0x7FC61BACU, 0x7FC51C61U, 0x7FC41D18U, 0x7FC31DD0U, 0x7FC21E8BU, 0x7FC11F48U,
+			0x7FC02007U, 0x7FC11F48U, 0x7FC21E8BU, 0x7FC31DD0U, 0x7FC41D18U, 0x7FC51C61U, 0x7FC61BACU, 0x7FC71AF9U,
+			0x7FC81A48U, 0x7FC91999U, 0x7FCA18ECU, 0x7FCB1841U, 0x7FCC1798U, 0x7FCD16F1U, 0x7FCE164CU, 0x7FCF15A9U,
+			0x7FD01508U, 0x7FD11469U, 0x7FD213CCU, 0x7FD31331U, 0x7FD41298U, 0x7FD51201U, 0x7FD6116CU, 0x7FD710D8U,
+			0x7FD81047U, 0x7FD90FB8U, 0x7FDA0F2BU, 0x7FDB0EA0U, 0x7FDC0E17U, 0x7FDD0D90U, 0x7FDE0D0BU, 0x7FDF0C88U,
+			0x7FE00C07U, 0x7FE10B87U, 0x7FE20B0AU, 0x7FE30A8FU, 0x7FE40A16U, 0x7FE5099FU, 0x7FE6092AU, 0x7FE708B7U,
+			0x7FE80845U, 0x7FE907D6U, 0x7FEA0769U, 0x7FEB06FEU, 0x7FEC0695U, 0x7FED062EU, 0x7FEE05C8U, 0x7FEF0565U,
+			0x7FF00504U, 0x7FF104A5U, 0x7FF20448U, 0x7FF303ECU, 0x7FF40393U, 0x7FF5033CU, 0x7FF602E7U, 0x7FF70293U,
+			0x7FF80242U, 0x7FF901F3U, 0x7FFA01A6U, 0x7FFB015AU, 0x7FFC0111U, 0x7FFD00CAU, 0x7FFE0085U, 0x7FFF0041U
+		},
+		{
+			0x80000000U, 0x80017F73U, 0x8002FEEBU, 0x80047E67U, 0x8005FDE8U, 0x80077D6DU, 0x8008FCF7U, 0x800A7C85U,
+			0x800BFC18U, 0x800D7BAFU, 0x800EFB4BU, 0x80107AEBU, 0x8011FA90U, 0x80137A39U, 0x8014F9E7U, 0x80167999U,
+			0x8017F94FU, 0x8019790BU, 0x801AF8CAU, 0x801C788EU, 0x801DF857U, 0x801F7824U, 0x8020F7F6U, 0x802277CCU,
+			0x8023F7A6U, 0x80257785U, 0x8026F769U, 0x80287751U, 0x8029F73DU, 0x802B772EU, 0x802CF724U, 0x802E771EU,
+			0x802FF71CU, 0x8031771FU, 0x8032F727U, 0x80347733U, 0x8035F743U, 0x80377758U, 0x8038F772U, 0x803A7790U,
+			0x803BF7B2U, 0x803D77D9U, 0x803EF805U, 0x80407835U, 0x8041F869U, 0x804378A2U, 0x8044F8DFU, 0x80467921U,
+			0x8047F968U, 0x804979B3U, 0x804AFA02U, 0x804C7A56U, 0x804DFAAEU, 0x804F7B0BU, 0x8050FB6DU, 0x80527BD3U,
+			0x8053FC3DU, 0x80557CACU, 0x8056FD1FU, 0x80587D97U, 0x8059FE14U, 0x805B7E95U, 0x805CFF1AU, 0x805E7FA4U,
+			0x80600032U, 0x805E7FA4U, 0x805CFF1AU, 0x805B7E95U, 0x8059FE14U, 0x80587D97U, 0x8056FD1FU, 0x80557CACU,
+			0x8053FC3DU, 0x80527BD3U, 0x8050FB6DU, 0x804F7B0BU, 0x804DFAAEU, 0x804C7A56U, 0x804AFA02U, 0x804979B3U,
+			0x8047F968U, 0x80467921U, 0x8044F8DFU, 0x804378A2U, 0x8041F869U, 0x80407835U, 0x803EF805U, 0x803D77D9U,
+			0x803BF7B2U, 0x803A7790U, 0x8038F772U, 0x80377758U, 0x8035F743U, 0x80347733U, 0x8032F727U, 0x8031771FU,
+			0x802FF71CU, 0x802E771EU, 0x802CF724U, 0x802B772EU, 0x8029F73DU, 0x80287751U, 0x8026F769U, 0x80257785U,
+			0x8023F7A6U, 0x802277CCU, 0x8020F7F6U, 0x801F7824U, 0x801DF857U, 0x801C788EU, 0x801AF8CAU, 0x8019790BU,
+			0x8017F94FU, 0x80167999U, 0x8014F9E7U, 0x80137A39U, 0x8011FA90U, 0x80107AEBU, 0x800EFB4BU, 0x800D7BAFU,
+			0x800BFC18U, 0x800A7C85U, 0x8008FCF7U, 0x80077D6DU, 0x8005FDE8U, 0x80047E67U, 0x8002FEEBU, 0x80017F73U,
+			0x80000000U, 0x7FFE8091U, 0x7FFD0127U, 0x7FFB81C1U, 0x7FFA0260U, 0x7FF88303U, 0x7FF703AAU, 0x7FF58456U,
+			0x7FF40507U, 0x7FF285BCU, 0x7FF10676U, 0x7FEF8734U, 0x7FEE07F6U, 0x7FEC88BDU, 0x7FEB0989U, 0x7FE98A59U,
+			0x7FE80B2DU, 0x7FE68C06U, 0x7FE50CE4U, 0x7FE38DC5U, 0x7FE20EACU, 0x7FE08F97U, 0x7FDF1086U, 0x7FDD917AU,
+			0x7FDC1272U, 0x7FDA936FU, 0x7FD91470U, 0x7FD79576U, 0x7FD61680U, 0x7FD4978FU, 0x7FD318A2U, 0x7FD199BAU,
+			0x7FD01AD6U, 0x7FCE9BF7U, 0x7FCD1D1CU, 0x7FCB9E46U, 0x7FCA1F74U, 0x7FC8A0A6U, 0x7FC721DDU, 0x7FC5A319U,
+			0x7FC42459U, 0x7FC2A59DU, 0x7FC126E6U, 0x7FBFA834U, 0x7FBE2986U, 0x7FBCAADCU, 0x7FBB2C37U, 0x7FB9AD96U,
+			0x7FB82EFAU, 0x7FB6B062U, 0x7FB531CFU, 0x7FB3B340U, 0x7FB234B6U, 0x7FB0B630U, 0x7FAF37AFU, 0x7FADB932U,
+			0x7FAC3ABAU, 0x7FAABC46U, 0x7FA93DD7U, 0x7FA7BF6CU, 0x7FA64105U, 0x7FA4C2A3U, 0x7FA34446U, 0x7FA1C5EDU,
+			0x7FA04798U, 0x7FA1C5EDU, 0x7FA34446U, 0x7FA4C2A3U, 0x7FA64105U, 0x7FA7BF6CU, 0x7FA93DD7U, 0x7FAABC46U,
+			0x7FAC3ABAU, 0x7FADB932U, 0x7FAF37AFU, 0x7FB0B630U, 0x7FB234B6U, 0x7FB3B340U, 0x7FB531CFU, 0x7FB6B062U,
+			0x7FB82EFAU, 0x7FB9AD96U, 0x7FBB2C37U, 0x7FBCAADCU, 0x7FBE2986U, 0x7FBFA834U, 0x7FC126E6U, 0x7FC2A59DU,
+			0x7FC42459U, 0x7FC5A319U, 0x7FC721DDU, 0x7FC8A0A6U, 0x7FCA1F74U, 0x7FCB9E46U, 0x7FCD1D1CU, 0x7FCE9BF7U,
+			0x7FD01AD6U, 0x7FD199BAU, 0x7FD318A2U, 0x7FD4978FU, 0x7FD61680U, 0x7FD79576U, 0x7FD91470U, 0x7FDA936FU,
+			0x7FDC1272U, 0x7FDD917AU, 0x7FDF1086U, 0x7FE08F97U, 0x7FE20EACU, 0x7FE38DC5U, 0x7FE50CE4U, 0x7FE68C06U,
+			0x7FE80B2DU, 0x7FE98A59U, 0x7FEB0989U, 0x7FEC88BDU, 0x7FEE07F6U, 0x7FEF8734U, 0x7FF10676U, 0x7FF285BCU,
+			0x7FF40507U, 0x7FF58456U, 0x7FF703AAU, 0x7FF88303U, 0x7FFA0260U, 0x7FFB81C1U, 0x7FFD0127U, 0x7FFE8091U
+		},
+		{
+			0x80000000U, 0x8001FF05U, 0x8003FE13U, 0x8005FD28U, 0x8007FC46U, 0x8009FB6BU, 0x800BFA98U, 0x800DF9CDU,
+			0x800FF90BU, 0x8011F850U, 0x8013F79DU, 0x8015F6F2U, 0x8017F64FU, 0x8019F5B5U, 0x801BF522U, 0x801DF497U,
+			0x801FF414U, 0x8021F399U, 0x8023F326U, 0x8025F2BBU, 0x8027F258U, 0x8029F1FDU, 0x802BF1A9U, 0x802DF15EU,
+			0x802FF11BU, 0x8031F0E0U, 0x8033F0ADU, 0x8035F082U, 0x8037F05EU, 0x8039F043U, 0x803BF030U, 0x803DF025U,
+			0x803FF021U, 0x8041F026U, 0x8043F033U, 0x8045F048U, 0x8047F064U, 0x8049F089U, 0x804BF0B5U, 0x804DF0EAU,
+			0x804FF127U, 0x8051F16BU, 0x8053F1B8U, 0x8055F20CU, 0x8057F269U, 0x8059F2CEU, 0x805BF33AU, 0x805DF3AFU,
+			0x805FF42BU, 0x8061F4B0U, 0x8063F53CU, 0x8065F5D1U, 0x8067F66DU, 0x8069F712U, 0x806BF7BEU, 0x806DF873U,
+			0x806FF92FU, 0x8071F9F4U, 0x8073FAC0U, 0x8075FB95U, 0x8077FC71U, 0x8079FD56U, 0x807BFE42U, 0x807DFF37U,
+			0x80800033U, 0x807DFF37U, 0x807BFE42U, 0x8079FD56U, 0x8077FC71U, 0x8075FB95U, 0x8073FAC0U, 0x8071F9F4U,
+			0x806FF92FU, 0x806DF873U, 0x806BF7BEU, 0x8069F712U, 0x8067F66DU, 0x8065F5D1U, 0x8063F53CU, 0x8061F4B0U,
+			0x805FF42BU, 0x805DF3AFU, 0x805BF33AU, 0x8059F2CEU, 0x8057F269U, 0x8055F20CU, 0x8053F1B8U, 0x8051F16BU,
+			0x804FF127U, 0x804DF0EAU, 0x804BF0B5U, 0x8049F089U, 0x8047F064U, 0x8045F048U, 0x8043F033U, 0x8041F026U,
+			0x803FF021U, 0x803DF025U, 0x803BF030U, 0x8039F043U, 0x8037F05EU, 0x8035F082U, 0x8033F0ADU, 0x8031F0E0U,
+			0x802FF11BU, 0x802DF15EU, 0x802BF1A9U, 0x8029F1FDU, 0x8027F258U, 0x8025F2BBU, 0x8023F326U, 0x8021F399U,
+			0x801FF414U, 0x801DF497U, 0x801BF522U, 0x8019F5B5U, 0x8017F64FU, 0x8015F6F2U, 0x8013F79DU, 0x8011F850U,
+			0x800FF90BU, 0x800DF9CDU, 0x800BFA98U, 0x8009FB6BU, 0x8007FC46U, 0x8005FD28U, 0x8003FE13U, 0x8001FF05U,
+			0x80000000U, 0x7FFE0103U, 0x7FFC020DU, 0x7FFA031FU, 0x7FF8043AU, 0x7FF6055CU, 0x7FF40687U, 0x7FF207B9U,
+			0x7FF008F3U, 0x7FEE0A36U, 0x7FEC0B80U, 0x7FEA0CD2U, 0x7FE80E2CU, 0x7FE60F8EU, 0x7FE410F8U, 0x7FE2126AU,
+			0x7FE013E4U, 0x7FDE1566U, 0x7FDC16F0U, 0x7FDA1882U, 0x7FD81A1CU, 0x7FD61BBEU, 0x7FD41D68U, 0x7FD21F19U,
+			0x7FD020D3U, 0x7FCE2295U, 0x7FCC245EU, 0x7FCA2630U, 0x7FC82809U, 0x7FC629EBU, 0x7FC42BD4U, 0x7FC22DC5U,
+			0x7FC02FBFU, 0x7FBE31C0U, 0x7FBC33C9U, 0x7FBA35DAU, 0x7FB837F4U, 0x7FB63A15U, 0x7FB43C3EU, 0x7FB23E6FU,
+			0x7FB040A8U, 0x7FAE42E9U, 0x7FAC4531U, 0x7FAA4782U, 0x7FA849DBU, 0x7FA64C3CU, 0x7FA44EA4U, 0x7FA25115U,
+			0x7FA0538DU, 0x7F9E560EU, 0x7F9C5896U, 0x7F9A5B27U, 0x7F985DBFU, 0x7F96605FU, 0x7F946307U, 0x7F9265B7U,
+			0x7F90686FU, 0x7F8E6B2FU, 0x7F8C6DF7U, 0x7F8A70C7U, 0x7F88739FU, 0x7F86767FU, 0x7F847967U, 0x7F827C56U,
+			0x7F807F4EU, 0x7F827C56U, 0x7F847967U, 0x7F86767FU, 0x7F88739FU, 0x7F8A70C7U, 0x7F8C6DF7U, 0x7F8E6B2FU,
+			0x7F90686FU, 0x7F9265B7U, 0x7F946307U, 0x7F96605FU, 0x7F985DBFU, 0x7F9A5B27U, 0x7F9C5896U, 0x7F9E560EU,
+			0x7FA0538DU, 0x7FA25115U, 0x7FA44EA4U, 0x7FA64C3CU, 0x7FA849DBU, 0x7FAA4782U, 0x7FAC4531U, 0x7FAE42E9U,
+			0x7FB040A8U, 0x7FB23E6FU, 0x7FB43C3EU, 0x7FB63A15U, 0x7FB837F4U, 0x7FBA35DAU, 0x7FBC33C9U, 0x7FBE31C0U,
+			0x7FC02FBFU, 0x7FC22DC5U, 0x7FC42BD4U, 0x7FC629EBU, 0x7FC82809U, 0x7FCA2630U, 0x7FCC245EU, 0x7FCE2295U,
+			0x7FD020D3U, 0x7FD21F19U, 0x7FD41D68U, 0x7FD61BBEU, 0x7FD81A1CU, 0x7FDA1882U, 0x7FDC16F0U, 0x7FDE1566U,
+			0x7FE013E4U, 0x7FE2126AU, 0x7FE410F8U, 0x7FE60F8EU, 0x7FE80E2CU, 0x7FEA0CD2U, 0x7FEC0B80U, 0x7FEE0A36U,
+			0x7FF008F3U, 0x7FF207B9U, 0x7FF40687U, 0x7FF6055CU, 0x7FF8043AU, 0x7FFA031FU, 0x7FFC020DU, 0x7FFE0103U
+		},
+		{
+			0x80000000U, 0x8002FDCAU, 0x8005FBA6U, 0x8008F995U, 0x800BF795U, 0x800EF5A6U, 0x8011F3CAU, 0x8014F200U,
+			0x8017F047U, 0x801AEEA1U, 0x801DED0CU, 0x8020EB8AU, 0x8023EA19U, 0x8026E8BAU, 0x8029E76DU, 0x802CE632U,
+			0x802FE509U, 0x8032E3F2U, 0x8035E2EDU, 0x8038E1F9U, 0x803BE118U, 0x803EE048U, 0x8041DF8BU, 0x8044DEDFU,
+			0x8047DE46U, 0x804ADDBEU, 0x804DDD48U, 0x8050DCE4U, 0x8053DC92U, 0x8056DC52U, 0x8059DC24U, 0x805CDC08U,
+			0x805FDBFEU, 0x8062DC06U, 0x8065DC20U, 0x8068DC4BU, 0x806BDC89U, 0x806EDCD8U, 0x8071DD3AU, 0x8074DDADU,
+			0x8077DE33U, 0x807ADECAU, 0x807DDF74U, 0x8080E02FU, 0x8083E0FCU, 0x8086E1DCU, 0x8089E2CDU, 0x808CE3D0U,
+			0x808FE4E5U, 0x8092E60DU, 0x8095E746U, 0x8098E891U, 0x809BE9EEU, 0x809EEB5DU, 0x80A1ECDEU, 0x80A4EE71U,
+			0x80A7F016U, 0x80AAF1CDU, 0x80ADF396U, 0x80B0F571U, 0x80B3F75EU, 0x80B6F95DU, 0x80B9FB6EU, 0x80BCFD91U,
+			0x80BFFFC6U, 0x80BCFD91U, 0x80B9FB6EU, 0x80B6F95DU, 0x80B3F75EU, 0x80B0F571U, 0x80ADF396U, 0x80AAF1CDU,
+			0x80A7F016U, 0x80A4EE71U, 0x80A1ECDEU, 0x809EEB5DU, 0x809BE9EEU, 0x8098E891U, 0x8095E746U, 0x8092E60DU,
+			0x808FE4E5U, 0x808CE3D0U, 0x8089E2CDU, 0x8086E1DCU, 0x8083E0FCU, 0x8080E02FU, 0x807DDF74U, 0x807ADECAU,
+			0x8077DE33U, 0x8074DDADU, 0x8071DD3AU, 0x806EDCD8U, 0x806BDC89U, 0x8068DC4BU, 0x8065DC20U, 0x8062DC06U,
+			0x805FDBFEU, 0x805CDC08U, 0x8059DC24U, 0x8056DC52U, 0x8053DC92U, 0x8050DCE4U, 0x804DDD48U, 0x804ADDBEU,
+			0x8047DE46U, 0x8044DEDFU, 0x8041DF8BU, 0x803EE048U, 0x803BE118U, 0x8038E1F9U, 0x8035E2EDU, 0x8032E3F2U,
+			0x802FE509U, 0x802CE632U, 0x8029E76DU, 0x8026E8BAU, 0x8023EA19U, 0x8020EB8AU, 0x801DED0CU, 0x801AEEA1U,
+			0x8017F047U, 0x8014F200U, 0x8011F3CAU, 0x800EF5A6U, 0x800BF795U, 0x8008F995U, 0x8005FBA6U, 0x8002FDCAU,
+			0x80000000U, 0x7FFD0248U, 0x7FFA04A1U, 0x7FF7070DU, 0x7FF4098AU, 0x7FF10C19U, 0x7FEE0EBAU, 0x7FEB116DU,
+			0x7FE81432U, 0x7FE51708U, 0x7FE219F1U, 0x7FDF1CECU, 0x7FDC1FF8U, 0x7FD92316U, 0x7FD62646U, 0x7FD32988U,
+			0x7FD02CDCU, 0x7FCD3042U, 0x7FCA33B9U, 0x7FC73743U, 0x7FC43ADEU, 0x7FC13E8BU, 0x7FBE424AU, 0x7FBB461BU,
+			0x7FB849FEU, 0x7FB54DF2U, 0x7FB251F9U, 0x7FAF5611U, 0x7FAC5A3BU, 0x7FA95E77U, 0x7FA662C5U, 0x7FA36725U,
+			0x7FA06B96U, 0x7F9D701AU, 0x7F9A74AFU, 0x7F977956U, 0x7F947E0FU, 0x7F9182DAU, 0x7F8E87B6U, 0x7F8B8CA5U,
+			0x7F8891A5U, 0x7F8596B7U, 0x7F829BDBU, 0x7F7FA111U, 0x7F7CA658U, 0x7F79ABB2U, 0x7F76B11DU, 0x7F73B69AU,
+			0x7F70BC29U, 0x7F6DC1C9U, 0x7F6AC77CU, 0x7F67CD40U, 0x7F64D316U, 0x7F61D8FEU, 0x7F5EDEF8U, 0x7F5BE503U,
+			0x7F58EB21U, 0x7F55F150U, 0x7F52F791U, 0x7F4FFDE3U, 0x7F4D0448U, 0x7F4A0ABEU, 0x7F471146U, 0x7F4417E0U,
+			0x7F411E8CU, 0x7F4417E0U, 0x7F471146U, 0x7F4A0ABEU, 0x7F4D0448U, 0x7F4FFDE3U, 0x7F52F791U, 0x7F55F150U,
+			0x7F58EB21U, 0x7F5BE503U, 0x7F5EDEF8U, 0x7F61D8FEU, 0x7F64D316U, 0x7F67CD40U, 0x7F6AC77CU, 0x7F6DC1C9U,
+			0x7F70BC29U, 0x7F73B69AU, 0x7F76B11DU, 0x7F79ABB2U, 0x7F7CA658U, 0x7F7FA111U, 0x7F829BDBU, 0x7F8596B7U,
+			0x7F8891A5U, 0x7F8B8CA5U, 0x7F8E87B6U, 0x7F9182DAU, 0x7F947E0FU, 0x7F977956U, 0x7F9A74AFU, 0x7F9D701AU,
+			0x7FA06B96U, 0x7FA36725U, 0x7FA662C5U, 0x7FA95E77U, 0x7FAC5A3BU, 0x7FAF5611U, 0x7FB251F9U, 0x7FB54DF2U,
+			0x7FB849FEU, 0x7FBB461BU, 0x7FBE424AU, 0x7FC13E8BU, 0x7FC43ADEU, 0x7FC73743U, 0x7FCA33B9U, 0x7FCD3042U,
+			0x7FD02CDCU, 0x7FD32988U, 0x7FD62646U, 0x7FD92316U, 0x7FDC1FF8U, 0x7FDF1CECU, 0x7FE219F1U, 0x7FE51708U,
+			0x7FE81432U, 0x7FEB116DU, 0x7FEE0EBAU, 0x7FF10C19U, 0x7FF4098AU, 0x7FF7070DU, 0x7FFA04A1U, 0x7FFD0248U
+		},
+		{
+			0x80000000U, 0x8005F735U, 0x800BEEB0U, 0x8011E673U, 0x8017DE7DU, 0x801DD6CFU, 0x8023CF67U, 0x8029C847U,
+			0x802FC16EU, 0x8035BADCU, 0x803BB492U, 0x8041AE8FU, 0x8047A8D3U, 0x804DA35FU, 0x80539E32U, 0x8059994CU,
+			0x805F94ADU, 0x80659056U, 0x806B8C47U, 0x8071887EU, 0x807784FEU, 0x807D81C4U, 0x80837ED2U, 0x80897C28U,
+			0x808F79C5U, 0x809577A9U, 0x809B75D5U, 0x80A17448U, 0x80A77303U, 0x80AD7206U, 0x80B37150U, 0x80B970E1U,
+			0x80BF70BAU, 0x80C570DBU, 0x80CB7143U, 0x80D171F3U, 0x80D772EBU, 0x80DD742AU, 0x80E375B0U, 0x80E9777FU,
+			0x80EF7995U, 0x80F57BF3U, 0x80FB7E98U, 0x81018186U, 0x810784BAU, 0x810D8837U, 0x81138BFCU, 0x81199008U,
+			0x811F945CU, 0x812598F7U, 0x812B9DDBU, 0x8131A306U, 0x8137A87AU, 0x813DAE35U, 0x8143B437U, 0x8149BA82U,
+			0x814FC115U, 0x8155C7EFU, 0x815BCF12U, 0x8161D67CU, 0x8167DE2EU, 0x816DE629U, 0x8173EE6BU, 0x8179F6F5U,
+			0x817FFFC7U, 0x8179F6F5U, 0x8173EE6BU, 0x816DE629U, 0x8167DE2EU, 0x8161D67CU, 0x815BCF12U, 0x8155C7EFU,
+			0x814FC115U, 0x8149BA82U, 0x8143B437U, 0x813DAE35U, 0x8137A87AU, 0x8131A306U, 0x812B9DDBU, 0x812598F7U,
+			0x811F945CU, 0x81199008U, 0x81138BFCU, 0x810D8837U, 0x810784BAU, 0x81018186U, 0x80FB7E98U, 0x80F57BF3U,
+			0x80EF7995U, 0x80E9777FU, 0x80E375B0U, 0x80DD742AU, 0x80D772EBU, 0x80D171F3U, 0x80CB7143U, 0x80C570DBU,
+			0x80BF70BAU, 0x80B970E1U, 0x80B37150U, 0x80AD7206U, 0x80A77303U, 0x80A17448U, 0x809B75D5U, 0x809577A9U,
+			0x808F79C5U, 0x80897C28U, 0x80837ED2U, 0x807D81C4U, 0x807784FEU, 0x8071887EU, 0x806B8C47U, 0x80659056U,
+			0x805F94ADU, 0x8059994CU, 0x80539E32U, 0x804DA35FU, 0x8047A8D3U, 0x8041AE8FU, 0x803BB492U, 0x8035BADCU,
+			0x802FC16EU, 0x8029C847U, 0x8023CF67U, 0x801DD6CFU, 0x8017DE7DU, 0x8011E673U, 0x800BEEB0U, 0x8005F735U,
+			0x80000000U, 0x7FFA0913U, 0x7FF4126CU, 0x7FEE1C0DU, 0x7FE825F5U, 0x7FE23024U, 0x7FDC3A9BU, 0x7FD64558U,
+			0x7FD0505CU, 0x7FCA5BA8U, 0x7FC4673AU, 0x7FBE7314U, 0x7FB87F35U, 0x7FB28B9CU, 0x7FAC984BU, 0x7FA6A540U,
+			0x7FA0B27DU, 0x7F9AC000U, 0x7F94CDCBU, 0x7F8EDBDCU, 0x7F88EA34U, 0x7F82F8D4U, 0x7F7D07BAU, 0x7F7716E7U,
+			0x7F71265AU, 0x7F6B3615U, 0x7F654617U, 0x7F5F565FU, 0x7F5966EEU, 0x7F5377C4U, 0x7F4D88E1U, 0x7F479A45U,
+			0x7F41ABEFU, 0x7F3BBDE0U, 0x7F35D018U, 0x7F2FE296U, 0x7F29F55BU, 0x7F240867U, 0x7F1E1BBAU, 0x7F182F53U,
+			0x7F124333U, 0x7F0C575AU, 0x7F066BC7U, 0x7F00807BU, 0x7EFA9576U, 0x7EF4AAB7U, 0x7EEEC03EU, 0x7EE8D60DU,
+			0x7EE2EC21U, 0x7EDD027DU, 0x7ED7191FU, 0x7ED13007U, 0x7ECB4736U, 0x7EC55EABU, 0x7EBF7667U, 0x7EB98E69U,
+			0x7EB3A6B2U, 0x7EADBF41U, 0x7EA7D817U, 0x7EA1F133U, 0x7E9C0A96U, 0x7E96243FU, 0x7E903E2EU, 0x7E8A5863U,
+			0x7E8472DFU, 0x7E8A5863U, 0x7E903E2EU, 0x7E96243FU, 0x7E9C0A96U, 0x7EA1F133U, 0x7EA7D817U, 0x7EADBF41U,
+			0x7EB3A6B2U, 0x7EB98E69U, 0x7EBF7667U, 0x7EC55EABU, 0x7ECB4736U, 0x7ED13007U, 0x7ED7191FU, 0x7EDD027DU,
+			0x7EE2EC21U, 0x7EE8D60DU, 0x7EEEC03EU, 0x7EF4AAB7U, 0x7EFA9576U, 0x7F00807BU, 0x7F066BC7U, 0x7F0C575AU,
+			0x7F124333U, 0x7F182F53U, 0x7F1E1BBAU, 0x7F240867U, 0x7F29F55BU, 0x7F2FE296U, 0x7F35D018U, 0x7F3BBDE0U,
+			0x7F41ABEFU, 0x7F479A45U, 0x7F4D88E1U, 0x7F5377C4U, 0x7F5966EEU, 0x7F5F565FU, 0x7F654617U, 0x7F6B3615U,
+			0x7F71265AU, 0x7F7716E7U, 0x7F7D07BAU, 0x7F82F8D4U, 0x7F88EA34U, 0x7F8EDBDCU, 0x7F94CDCBU, 0x7F9AC000U,
+			0x7FA0B27DU, 0x7FA6A540U, 0x7FAC984BU, 0x7FB28B9CU, 0x7FB87F35U, 0x7FBE7314U, 0x7FC4673AU, 0x7FCA5BA8U,
+			0x7FD0505CU, 0x7FD64558U, 0x7FDC3A9BU, 0x7FE23024U, 0x7FE825F5U, 0x7FEE1C0DU, 0x7FF4126CU, 0x7FFA0913U
+		},
+		{
+			0x80000000U, 0x800BDD1AU, 0x8017BB4EU, 0x80239A9BU, 0x802F7B02U, 0x803B5C83U, 0x80473F1EU, 0x805322D2U,
+			0x805F07A1U, 0x806AED8AU, 0x8076D48DU, 0x8082BCABU, 0x808EA5E3U, 0x809A9036U, 0x80A67BA4U, 0x80B2682CU,
+			0x80BE55CFU, 0x80CA448EU, 0x80D63467U, 0x80E2255CU, 0x80EE176CU, 0x80FA0A98U, 0x8105FEDFU, 0x8111F441U,
+			0x811DEAC0U, 0x8129E25AU, 0x8135DB10U, 0x8141D4E2U, 0x814DCFD1U, 0x8159CBDBU, 0x8165C902U, 0x8171C746U,
+			0x817DC6A6U, 0x8189C723U, 0x8195C8BCU, 0x81A1CB73U, 0x81ADCF46U, 0x81B9D436U, 0x81C5DA44U, 0x81D1E16FU,
+			0x81DDE9B7U, 0x81E9F31DU, 0x81F5FDA0U, 0x82020942U, 0x820E1600U, 0x821A23DDU, 0x822632D8U, 0x823242F1U,
+			0x823E5428U, 0x824A667EU, 0x825679F2U, 0x82628E84U, 0x826EA435U, 0x827ABB05U, 0x8286D2F4U, 0x8292EC01U,
+			0x829F062EU, 0x82AB217AU, 0x82B73DE5U, 0x82C35B6FU, 0x82CF7A19U, 0x82DB99E3U, 0x82E7BACCU, 0x82F3DCD5U,
+			0x82FFFFFEU, 0x82F3DCD5U, 0x82E7BACCU, 0x82DB99E3U, 0x82CF7A19U, 0x82C35B6FU, 0x82B73DE5U, 0x82AB217AU,
+			0x829F062EU, 0x8292EC01U, 0x8286D2F4U, 0x827ABB05U, 0x826EA435U, 0x82628E84U, 0x825679F2U, 0x824A667EU,
+			0x823E5428U, 0x823242F1U, 0x822632D8U, 0x821A23DDU, 0x820E1600U, 0x82020942U, 0x81F5FDA0U, 0x81E9F31DU,
+			0x81DDE9B7U, 0x81D1E16FU, 0x81C5DA44U, 0x81B9D436U, 0x81ADCF46U, 0x81A1CB73U, 0x8195C8BCU, 0x8189C723U,
+			0x817DC6A6U, 0x8171C746U, 0x8165C902U, 0x8159CBDBU, 0x814DCFD1U, 0x8141D4E2U, 0x8135DB10U, 0x8129E25AU,
+			0x811DEAC0U, 0x8111F441U, 0x8105FEDFU, 0x80FA0A98U, 0x80EE176CU, 0x80E2255CU, 0x80D63467U, 0x80CA448EU,
+			0x80BE55CFU, 0x80B2682CU, 0x80A67BA4U, 0x809A9036U, 0x808EA5E3U, 0x8082BCABU, 0x8076D48DU, 0x806AED8AU,
+			0x805F07A1U, 0x805322D2U, 0x80473F1EU, 0x803B5C83U, 0x802F7B02U, 0x80239A9BU, 0x8017BB4EU, 0x800BDD1AU,
+			0x80000000U, 0x7FF423FFU, 0x7FE84918U, 0x7FDC6F49U, 0x7FD09694U, 0x7FC4BEF8U, 0x7FB8E875U, 0x7FAD130AU,
+			0x7FA13EB8U, 0x7F956B7FU, 0x7F89995EU, 0x7F7DC855U, 0x7F71F865U, 0x7F66298DU, 0x7F5A5BCDU, 0x7F4E8F25U,
+			0x7F42C395U, 0x7F36F91DU, 0x7F2B2FBCU, 0x7F1F6773U, 0x7F13A041U, 0x7F07DA27U, 0x7EFC1524U, 0x7EF05138U,
+			0x7EE48E63U, 0x7ED8CCA5U, 0x7ECD0BFEU, 0x7EC14C6EU, 0x7EB58DF4U, 0x7EA9D091U, 0x7E9E1445U, 0x7E92590FU,
+			0x7E869EEFU, 0x7E7AE5E5U, 0x7E6F2DF1U, 0x7E637713U, 0x7E57C14BU, 0x7E4C0C99U, 0x7E4058FCU, 0x7E34A675U,
+			0x7E28F504U, 0x7E1D44A8U, 0x7E119561U, 0x7E05E72FU, 0x7DFA3A12U, 0x7DEE8E0AU, 0x7DE2E317U, 0x7DD73939U,
+			0x7DCB906FU, 0x7DBFE8BAU, 0x7DB44219U, 0x7DA89C8DU, 0x7D9CF815U, 0x7D9154B1U, 0x7D85B261U, 0x7D7A1125U,
+			0x7D6E70FDU, 0x7D62D1E9U, 0x7D5733E8U, 0x7D4B96FBU, 0x7D3FFB22U, 0x7D34605BU, 0x7D28C6A8U, 0x7D1D2E08U,
+			0x7D11967BU, 0x7D1D2E08U, 0x7D28C6A8U, 0x7D34605BU, 0x7D3FFB22U, 0x7D4B96FBU, 0x7D5733E8U, 0x7D62D1E9U,
+			0x7D6E70FDU, 0x7D7A1125U, 0x7D85B261U, 0x7D9154B1U, 0x7D9CF815U, 0x7DA89C8DU, 0x7DB44219U, 0x7DBFE8BAU,
+			0x7DCB906FU, 0x7DD73939U, 0x7DE2E317U, 0x7DEE8E0AU, 0x7DFA3A12U, 0x7E05E72FU, 0x7E119561U, 0x7E1D44A8U,
+			0x7E28F504U, 0x7E34A675U, 0x7E4058FCU, 0x7E4C0C99U, 0x7E57C14BU, 0x7E637713U, 0x7E6F2DF1U, 0x7E7AE5E5U,
+			0x7E869EEFU, 0x7E92590FU, 0x7E9E1445U, 0x7EA9D091U, 0x7EB58DF4U, 0x7EC14C6EU, 0x7ECD0BFEU, 0x7ED8CCA5U,
+			0x7EE48E63U, 0x7EF05138U, 0x7EFC1524U, 0x7F07DA27U, 0x7F13A041U, 0x7F1F6773U, 0x7F2B2FBCU, 0x7F36F91DU,
+			0x7F42C395U, 0x7F4E8F25U, 0x7F5A5BCDU, 0x7F66298DU, 0x7F71F865U, 0x7F7DC855U, 0x7F89995EU, 0x7F956B7FU,
+			0x7FA13EB8U, 0x7FAD130AU, 0x7FB8E875U, 0x7FC4BEF8U, 0x7FD09694U, 0x7FDC6F49U, 0x7FE84918U, 0x7FF423FFU
+		},
+		{
+			0x80000000U, 0x8017767FU, 0x802EF14AU, 0x80467064U, 0x805DF3CCU, 0x80757B83U, 0x808D078BU, 0x80A497E3U,
+			0x80BC2C8EU, 0x80D3C58BU, 0x80EB62DBU, 0x8103047FU, 0x811AAA78U, 0x813254C7U, 0x814A036DU, 0x8161B66AU,
+			0x81796DBEU, 0x8191296CU, 0x81A8E974U, 0x81C0ADD6U, 0x81D87693U, 0x81F043ACU, 0x82081522U, 0x821FEAF6U,
+			0x8237C529U, 0x824FA3BAU, 0x826786ACU, 0x827F6DFFU, 0x829759B3U, 0x82AF49CAU, 0x82C73E44U, 0x82DF3723U,
+			0x82F73466U, 0x830F360FU, 0x83273C1EU, 0x833F4695U, 0x83575574U, 0x836F68BBU, 0x8387806DU, 0x839F9C89U,
+			0x83B7BD11U, 0x83CFE204U, 0x83E80B65U, 0x84003934U, 0x84186B71U, 0x8430A21DU, 0x8448DD3AU, 0x84611CC8U,
+			0x847960C7U, 0x8491A93AU, 0x84A9F620U, 0x84C2477AU, 0x84DA9D49U, 0x84F2F78EU, 0x850B564AU, 0x8523B97EU,
+			0x853C212AU, 0x85548D4FU, 0x856CFDEEU, 0x85857309U, 0x859DEC9EU, 0x85B66AB1U, 0x85CEED40U, 0x85E7744EU,
+			0x85FFFFDBU, 0x85E7744EU, 0x85CEED40U, 0x85B66AB1U, 0x859DEC9EU, 0x85857309U, 0x856CFDEEU, 0x85548D4FU,
+			0x853C212AU, 0x8523B97EU, 0x850B564AU, 0x84F2F78EU, 0x84DA9D49U, 0x84C2477AU, 0x84A9F620U, 0x8491A93AU,
+			0x847960C7U, 0x84611CC8U, 0x8448DD3AU, 0x8430A21DU, 0x84186B71U, 0x84003934U, 0x83E80B65U, 0x83CFE204U,
+			0x83B7BD11U, 0x839F9C89U, 0x8387806DU, 0x836F68BBU, 0x83575574U, 0x833F4695U, 0x83273C1EU, 0x830F360FU,
+			0x82F73466U, 0x82DF3723U, 0x82C73E44U, 0x82AF49CAU, 0x829759B3U, 0x827F6DFFU, 0x826786ACU, 0x824FA3BAU,
+			0x8237C529U, 0x821FEAF6U, 0x82081522U, 0x81F043ACU, 0x81D87693U, 0x81C0ADD6U, 0x81A8E974U, 0x8191296CU,
+			0x81796DBEU, 0x8161B66AU, 0x814A036DU, 0x813254C7U, 0x811AAA78U, 0x8103047FU, 0x80EB62DBU, 0x80D3C58BU,
+			0x80BC2C8EU, 0x80A497E3U, 0x808D078BU, 0x80757B83U, 0x805DF3CCU, 0x80467064U, 0x802EF14AU, 0x8017767FU,
+			0x80000000U, 0x7FE88DCEU, 0x7FD11FE7U, 0x7FB9B64AU, 0x7FA250F8U, 0x7F8AEFEEU, 0x7F73932DU, 0x7F5C3AB4U,
+			0x7F44E681U, 0x7F2D9694U, 0x7F164AECU, 0x7EFF0389U, 0x7EE7C069U, 0x7ED0818CU, 0x7EB946F1U, 0x7EA21097U,
+			0x7E8ADE7EU, 0x7E73B0A5U, 0x7E5C870AU, 0x7E4561AEU, 0x7E2E408FU, 0x7E1723ACU, 0x7E000B05U, 0x7DE8F69AU,
+			0x7DD1E668U, 0x7DBADA70U, 0x7DA3D2B1U, 0x7D8CCF2AU, 0x7D75CFDAU, 0x7D5ED4C0U, 0x7D47DDDCU, 0x7D30EB2DU,
+			0x7D19FCB2U, 0x7D03126AU, 0x7CEC2C54U, 0x7CD54A71U, 0x7CBE6CBEU, 0x7CA7933CU, 0x7C90BDE9U, 0x7C79ECC5U,
+			0x7C631FCFU, 0x7C4C5706U, 0x7C359269U, 0x7C1ED1F9U, 0x7C0815B2U, 0x7BF15D96U, 0x7BDAA9A4U, 0x7BC3F9DAU,
+			0x7BAD4E38U, 0x7B96A6BDU, 0x7B800368U, 0x7B696438U, 0x7B52C92EU, 0x7B3C3247U, 0x7B259F84U, 0x7B0F10E4U,
+			0x7AF88665U, 0x7AE20007U, 0x7ACB7DC9U, 0x7AB4FFABU, 0x7A9E85ABU, 0x7A880FCAU, 0x7A719E06U, 0x7A5B305EU,
+			0x7A44C6D2U, 0x7A5B305EU, 0x7A719E06U, 0x7A880FCAU, 0x7A9E85ABU, 0x7AB4FFABU, 0x7ACB7DC9U, 0x7AE20007U,
+			0x7AF88665U, 0x7B0F10E4U, 0x7B259F84U, 0x7B3C3247U, 0x7B52C92EU, 0x7B696438U, 0x7B800368U, 0x7B96A6BDU,
+			0x7BAD4E38U, 0x7BC3F9DAU, 0x7BDAA9A4U, 0x7BF15D96U, 0x7C0815B2U, 0x7C1ED1F9U, 0x7C359269U, 0x7C4C5706U,
+			0x7C631FCFU, 0x7C79ECC5U, 0x7C90BDE9U, 0x7CA7933CU, 0x7CBE6CBEU, 0x7CD54A71U, 0x7CEC2C54U, 0x7D03126AU,
+			0x7D19FCB2U, 0x7D30EB2DU, 0x7D47DDDCU, 0x7D5ED4C0U, 0x7D75CFDAU, 0x7D8CCF2AU, 0x7DA3D2B1U, 0x7DBADA70U,
+			0x7DD1E668U, 0x7DE8F69AU, 0x7E000B05U, 0x7E1723ACU, 0x7E2E408FU, 0x7E4561AEU, 0x7E5C870AU, 0x7E73B0A5U,
+			0x7E8ADE7EU, 0x7EA21097U, 0x7EB946F1U, 0x7ED0818CU, 0x7EE7C069U, 0x7EFF0389U, 0x7F164AECU, 0x7F2D9694U,
+			0x7F44E681U, 0x7F5C3AB4U, 0x7F73932DU, 0x7F8AEFEEU, 0x7FA250F8U, 0x7FB9B64AU, 0x7FD11FE7U, 0x7FE88DCEU
+		}
+	}
+};
+
+static const int lut_alfo[4][LFO_LENGTH] =
+{
+	{
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0
+	},
+	{
+		65536, 65280, 65024, 64768, 64512, 64256, 64000, 63744,
+		63488, 63232, 62976, 62720, 62464, 62208, 61952, 61696,
+		61440, 61184, 60928, 60672, 60416, 60160, 59904, 59648,
+		59392, 59136, 58880, 58624, 58368, 58112, 57856, 57600,
+		57344, 57088, 56832, 56576, 56320, 56064, 55808, 55552,
+		55296, 55040, 54784, 54528, 54272, 54016, 53760, 53504,
+		53248, 52992, 52736, 52480, 52224, 51968, 51712, 51456,
+		51200, 50944, 50688, 50432, 50176, 49920, 49664, 49408,
+		49152, 48896, 48640, 48384, 48128, 47872, 47616, 47360,
+		47104, 46848, 46592, 46336, 46080, 45824, 45568, 45312,
+		45056, 44800, 44544, 44288, 44032, 43776, 43520, 43264,
+		43008, 42752, 42496, 42240, 41984, 41728, 41472, 41216,
+		40960, 40704, 40448, 40192, 39936, 39680, 39424, 39168,
+		38912, 38656, 38400, 38144, 37888, 37632, 37376, 37120,
+		36864, 36608, 36352, 36096, 35840, 35584, 35328, 35072,
+		34816, 34560, 34304, 34048, 33792, 33536, 33280, 33024,
+		32768, 32512, 32256, 32000, 31744, 31488, 31232, 30976,
+		30720, 30464, 30208, 29952, 29696, 29440, 29184, 28928,
+		28672, 28416, 28160, 27904, 27648, 27392, 27136, 26880,
+		26624, 26368, 26112, 25856, 25600, 25344, 25088, 24832,
+		24576, 24320, 24064, 23808, 23552, 23296, 23040, 22784,
+		22528, 22272, 22016, 21760, 21504, 21248, 20992, 20736,
+		20480, 20224, 19968, 19712, 19456, 19200, 18944, 18688,
+		18432, 18176, 17920, 17664, 17408, 17152, 16896, 16640,
+		16384, 16128, 15872, 15616, 15360, 15104, 14848, 14592,
+		14336, 14080, 13824, 13568, 13312, 13056, 12800, 12544,
+		12288, 12032, 11776, 11520, 11264, 11008, 10752, 10496,
+		10240, 9984, 9728, 9472, 9216, 8960, 8704, 8448,
+		8192, 7936, 7680, 7424, 7168, 6912, 6656, 6400,
+		6144, 5888, 5632, 5376, 5120, 4864, 4608, 4352,
+		4096, 3840, 3584, 3328, 3072, 2816, 2560, 2304,
+		2048, 1792, 1536, 1280, 1024, 768, 512, 256
+	},
+	{
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0
+	},
+	{
+		65536, 65024, 64512, 64000, 63488, 62976, 62464, 61952,
+		61440, 60928, 60416, 59904, 59392, 58880, 58368, 57856,
+		57344, 56832, 56320, 55808, 55296, 54784, 54272, 53760,
+		53248, 52736, 52224, 51712, 51200, 50688, 50176, 49664,
+		49152, 48640, 48128, 47616, 47104, 46592, 46080, 45568,
+		45056, 44544, 44032, 43520, 43008, 42496, 41984, 41472,
+		40960, 40448, 39936, 39424, 38912, 38400, 37888, 37376,
+		36864, 36352, 35840, 35328, 34816, 34304, 33792, 33280,
+		32768, 32256, 31744, 31232, 30720, 30208, 29696, 29184,
+		28672, 28160, 27648, 27136, 26624, 26112, 25600, 25088,
+		24576, 24064, 23552, 23040, 22528, 22016, 21504, 20992,
+		20480, 19968, 19456, 18944, 18432, 17920, 17408, 16896,
+		16384, 15872, 15360, 14848, 14336, 13824, 13312, 12800,
+		12288, 11776, 11264, 10752, 10240, 9728, 9216, 8704,
+		8192, 7680, 7168, 6656, 6144, 5632, 5120, 4608,
+		4096, 3584, 3072, 2560, 2048, 1536, 1024, 512,
+		0, 512, 1024, 1536, 2048, 2560, 3072, 3584,
+		4096, 4608, 5120, 5632, 6144, 6656, 7168, 7680,
+		8192, 8704, 9216, 9728, 10240, 10752, 11264, 11776,
+		12288, 12800, 13312, 13824, 14336, 14848, 15360, 15872,
+		16384, 16896, 17408, 17920, 18432, 18944, 19456, 19968,
+		20480, 20992, 21504, 22016, 22528, 23040, 23552, 24064,
+		24576, 25088, 25600, 26112, 26624, 27136, 27648, 28160,
+		28672, 29184, 29696, 30208, 30720, 31232, 31744, 32256,
+		32768, 33280, 33792, 34304, 34816, 35328, 35840, 36352,
+		36864, 37376, 37888, 38400, 38912, 39424, 39936, 40448,
+		40960, 41472, 41984, 42496, 43008, 43520, 44032, 44544,
+		45056, 45568, 46080, 46592, 47104, 47616, 48128, 48640,
+		49152, 49664, 50176, 50688, 51200, 51712, 52224, 52736,
+		53248, 53760, 54272, 54784, 55296, 55808, 56320, 56832,
+		57344, 57856, 58368, 58880, 59392, 59904, 60416, 60928,
+		61440, 61952, 62464, 62976, 63488, 64000, 64512, 65024
+	}
+};
+
+static const int lut_attenuation[16] =
+{
+	65536, 49145, 32845, 24630, 16461, 12344, 8156, 6116, 4087, 3065, 2048, 1536, 1026, 1, 1, 1
+};
+
+static const int lut_total_level[128] =
+{
+	65536, 60114, 55141, 50580, 46395, 42557, 39037, 35807, 32845, 30128, 27636, 25350, 23253, 21329, 19565, 17946,
+	16461, 15100, 13850, 12705, 11654, 10690, 9805, 8994, 8250, 7567, 6941, 6367, 5840, 5357, 4914, 4507,
+	4135, 3792, 3479, 3191, 2927, 2685, 2463, 2259, 2072, 1900, 1743, 1599, 1467, 1345, 1234, 1132,
+	1038, 952, 873, 801, 735, 674, 618, 567, 520, 477, 438, 401, 368, 338, 310, 284,
+	260, 239, 219, 201, 184, 169, 155, 142, 130, 119, 110, 100, 92, 84, 77, 71,
+	65, 60, 55, 50, 46, 42, 39, 35, 32, 30, 27, 25, 23, 21, 19, 17,
+	16, 15, 13, 12, 11, 10, 9, 8, 8, 7, 6, 6, 5, 5, 4, 4,
+	4, 3, 3, 3, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const int lut_env_volume[256] =
+{
+	65536, 62766, 60114, 57574, 55141, 52811, 50580, 48442, 46395, 44435, 42557, 40759, 39037, 37387, 35807, 34294,
+	32845, 31457, 30128, 28855, 27636, 26468, 25350, 24278, 23253, 22270, 21329, 20428, 19565, 18738, 17946, 17188,
+	16461, 15766, 15100, 14462, 13850, 13265, 12705, 12168, 11654, 11161, 10690, 10238, 9805, 9391, 8994, 8614,
+	8250, 7901, 7567, 7248, 6941, 6648, 6367, 6098, 5840, 5594, 5357, 5131, 4914, 4706, 4507, 4317,
+	4135, 3960, 3792, 3632, 3479, 3332, 3191, 3056, 2927, 2803, 2685, 2571, 2463, 2359, 2259, 2163,
+	2072, 1984, 1900, 1820, 1743, 1670, 1599, 1531, 1467, 1405, 1345, 1288, 1234, 1182, 1132, 1084,
+	1038, 994, 952, 912, 873, 837, 801, 767, 735, 704, 674, 645, 618, 592, 567, 543,
+	520, 498, 477, 457, 438, 419, 401, 384, 368, 352, 338, 323, 310, 296, 284, 272,
+	260, 249, 239, 229, 219, 210, 201, 192, 184, 176, 169, 162, 155, 148, 142, 136,
+	130, 125, 119, 114, 110, 105, 100, 96, 92, 88, 84, 81, 77, 74, 71, 68,
+	65, 62, 60, 57, 55, 52, 50, 48, 46, 44, 42, 40, 39, 37, 35, 34,
+	32, 31, 30, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 17,
+	16, 15, 15, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9, 8, 8,
+	8, 7, 7, 7, 6, 6, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4,
+	4, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
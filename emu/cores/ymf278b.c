@@ -103,6 +103,7 @@
 #include "../snddef.h"
 #include "../SoundEmu.h"
 #include "../EmuHelper.h"
+#include "../pcmmix.h"
 #include "../logging.h"
 #include "ymf278b.h"
 
@@ -124,6 +125,7 @@ static void ymf278b_w(void *info, UINT8 offset, UINT8 data);
 static void ymf278b_alloc_rom(void* info, UINT32 memsize);
 static void ymf278b_alloc_ram(void* info, UINT32 memsize);
 static void ymf278b_write_rom(void *info, UINT32 offset, UINT32 length, const UINT8* data);
+static void ymf278b_attach_rom(void *info, UINT32 length, const UINT8* data);
 static void ymf278b_write_ram(void *info, UINT32 offset, UINT32 length, const UINT8* data);
 
 static void ymf278b_set_mute_mask(void *info, UINT32 MuteMask);
@@ -136,6 +138,7 @@ static DEVDEF_RWFUNC devFunc[] =
 	{RWF_REGISTER | RWF_READ, DEVRW_A8D8, 0, ymf278b_r},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0x524F, ymf278b_write_rom},	// 0x524F = 'RO' for ROM
 	{RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0x524F, ymf278b_alloc_rom},
+	{RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0x524F, ymf278b_attach_rom},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0x5241, ymf278b_write_ram},	// 0x5241 = 'RA' for RAM
 	{RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0x5241, ymf278b_alloc_ram},
 	{RWF_CHN_MUTE | RWF_WRITE, DEVRW_ALL, 0, ymf278b_set_mute_mask},
@@ -265,6 +268,7 @@ struct _YMF278BChip
 
 	UINT32 ROMSize;
 	UINT8 *rom;
+	UINT8 ROMOwned;
 	UINT32 RAMSize;
 	UINT8 *ram;
 	UINT32 clock;
@@ -625,105 +629,90 @@ INLINE void ymf278b_eg_phase_switch(YMF278BSlot* op)
 	return;
 }
 
-static void ymf278b_advance(YMF278BChip* chip)
+INLINE void ymf278b_slot_advance(YMF278BSlot* op, UINT32 eg_cnt, UINT32 tl_int_cnt, UINT8 tl_int_step)
 {
-	YMF278BSlot* op;
-	int i;
 	UINT8 rate;
 	UINT8 shift;
 	UINT8 select;
 	
-	chip->tl_int_cnt ++;
-	if (chip->tl_int_cnt >= 9)
+	if (! tl_int_cnt)
 	{
-		chip->tl_int_cnt -= 9;
-		chip->tl_int_step ++;
-		if (chip->tl_int_step >= 3)
-			chip->tl_int_step -= 3;
+		if (tl_int_step == 0)
+		{
+			// decrease volume by one step every 27 samples
+			if (op->TL < op->TLdest)
+				op->TL ++;
+		}
+		else //if (tl_int_step > 0)
+		{
+			// increase volume by one step every 13.5 samples
+			if (op->TL > op->TLdest)
+				op->TL --;
+		}
 	}
 
-	chip->eg_cnt ++;
-	for (i = 0; i < 24; i ++)
+	if (op->lfo_active)
 	{
-		op = &chip->slots[i];
+		op->lfo_cnt += lfo_period[op->lfo];
+		op->lfo_cnt &= (LFO_PERIOD - 1);
+	}
 
-		if (! chip->tl_int_cnt)
+	// Envelope Generator
+	switch(op->state)
+	{
+	case EG_ATT:	// attack phase
+		rate = ymf278b_slot_compute_rate(op, op->AR);
+		// Verified by HW recording (and matches Nemesis' tests of the YM2612):
+		// AR = 0xF during KeyOn results in instant switch to EG_DEC. (see keyOnHelper)
+		// Setting AR = 0xF while the attack phase is in progress freezes the envelope.
+		if (rate >= 63)
+			break;
+		
+		shift = eg_rate_shift[rate];
+		if (! (eg_cnt & ((1 << shift) - 1)))
 		{
-			if (chip->tl_int_step == 0)
-			{
-				// decrease volume by one step every 27 samples
-				if (op->TL < op->TLdest)
-					op->TL ++;
-			}
-			else //if (chip->tl_int_step > 0)
-			{
-				// increase volume by one step every 13.5 samples
-				if (op->TL > op->TLdest)
-					op->TL --;
-			}
+			select = eg_rate_select[rate];
+			// >>4 makes the attack phase's shape match the actual chip -Valley Bell
+			op->env_vol += (~op->env_vol * eg_inc[select + ((eg_cnt >> shift) & 7)]) >> 4;
+			ymf278b_eg_phase_switch(op);
 		}
-
-		if (op->lfo_active)
+		break;
+	case EG_DEC:	// decay phase
+		rate = ymf278b_slot_compute_decay_rate(op, op->D1R);
+		shift = eg_rate_shift[rate];
+		if (! (eg_cnt & ((1 << shift) - 1)))
 		{
-			op->lfo_cnt += lfo_period[op->lfo];
-			op->lfo_cnt &= (LFO_PERIOD - 1);
+			select = eg_rate_select[rate];
+			op->env_vol += eg_inc[select + ((eg_cnt >> shift) & 7)];
+			ymf278b_eg_phase_switch(op);
 		}
-
-		// Envelope Generator
-		switch(op->state)
+		break;
+	case EG_SUS:	// sustain phase
+		rate = ymf278b_slot_compute_decay_rate(op, op->D2R);
+		shift = eg_rate_shift[rate];
+		if (! (eg_cnt & ((1 << shift) - 1)))
 		{
-		case EG_ATT:	// attack phase
-			rate = ymf278b_slot_compute_rate(op, op->AR);
-			// Verified by HW recording (and matches Nemesis' tests of the YM2612):
-			// AR = 0xF during KeyOn results in instant switch to EG_DEC. (see keyOnHelper)
-			// Setting AR = 0xF while the attack phase is in progress freezes the envelope.
-			if (rate >= 63)
-				break;
-			
-			shift = eg_rate_shift[rate];
-			if (! (chip->eg_cnt & ((1 << shift) - 1)))
-			{
-				select = eg_rate_select[rate];
-				// >>4 makes the attack phase's shape match the actual chip -Valley Bell
-				op->env_vol += (~op->env_vol * eg_inc[select + ((chip->eg_cnt >> shift) & 7)]) >> 4;
-				ymf278b_eg_phase_switch(op);
-			}
-			break;
-		case EG_DEC:	// decay phase
-			rate = ymf278b_slot_compute_decay_rate(op, op->D1R);
-			shift = eg_rate_shift[rate];
-			if (! (chip->eg_cnt & ((1 << shift) - 1)))
-			{
-				select = eg_rate_select[rate];
-				op->env_vol += eg_inc[select + ((chip->eg_cnt >> shift) & 7)];
-				ymf278b_eg_phase_switch(op);
-			}
-			break;
-		case EG_SUS:	// sustain phase
-			rate = ymf278b_slot_compute_decay_rate(op, op->D2R);
-			shift = eg_rate_shift[rate];
-			if (! (chip->eg_cnt & ((1 << shift) - 1)))
-			{
-				select = eg_rate_select[rate];
-				op->env_vol += eg_inc[select + ((chip->eg_cnt >> shift) & 7)];
-				ymf278b_eg_phase_switch(op);
-			}
-			break;
-		case EG_REL:	// release phase
-			rate = ymf278b_slot_compute_decay_rate(op, op->RR);
-			shift = eg_rate_shift[rate];
-			if (! (chip->eg_cnt & ((1 << shift) - 1)))
-			{
-				select = eg_rate_select[rate];
-				op->env_vol += eg_inc[select + ((chip->eg_cnt >> shift) & 7)];
-				ymf278b_eg_phase_switch(op);
-			}
-			break;
-		case EG_OFF:
-			// nothing
-			break;
+			select = eg_rate_select[rate];
+			op->env_vol += eg_inc[select + ((eg_cnt >> shift) & 7)];
+			ymf278b_eg_phase_switch(op);
+		}
+		break;
+	case EG_REL:	// release phase
+		rate = ymf278b_slot_compute_decay_rate(op, op->RR);
+		shift = eg_rate_shift[rate];
+		if (! (eg_cnt & ((1 << shift) - 1)))
+		{
+			select = eg_rate_select[rate];
+			op->env_vol += eg_inc[select + ((eg_cnt >> shift) & 7)];
+			ymf278b_eg_phase_switch(op);
 		}
+		break;
+	case EG_OFF:
+		// nothing
+		break;
 	}
+	
+	return;
 }
 
 INLINE INT16 ymf278b_getSample(YMF278BChip* chip, YMF278BSlot* slot, UINT16 pos)
@@ -761,6 +750,32 @@ INLINE INT16 ymf278b_getSample(YMF278BChip* chip, YMF278BSlot* slot, UINT16 pos)
 	return sample;
 }
 
+INLINE INT16 ymf278b_getSampleDirect(const UINT8* data, UINT8 bits, UINT16 pos)
+{
+	// same as ymf278b_getSample, but reads from a linear memory block
+	const UINT8* ptr;
+	
+	switch (bits)
+	{
+	case 0:
+		// 8 bit
+		return data[pos] << 8;
+	case 1:
+		// 12 bit
+		ptr = &data[(pos / 2) * 3];
+		if (pos & 1)
+			return (ptr[2] << 8) | ((ptr[1] & 0xF0) << 0);
+		else
+			return (ptr[0] << 8) | ((ptr[1] & 0x0F) << 4);
+	case 2:
+		// 16 bit
+		ptr = &data[pos * 2];
+		return (ptr[0] << 8) | ptr[1];
+	default:
+		return 0;
+	}
+}
+
 INLINE INT16 ymf278b_nextPos(YMF278BSlot* slot, UINT16 pos, UINT16 step)
 {
 	// If there is a 4-sample loop and you advance 12 samples per step,
@@ -784,89 +799,163 @@ static int ymf278b_anyActive(YMF278BChip* chip)
 	return 0;
 }
 
-static void ymf278b_pcm_update(void *info, UINT32 samples, DEV_SMPL** outputs)
+static void ymf278b_render_slot(YMF278BChip* chip, YMF278BSlot* sl, UINT32 samples, DEV_SMPL** outputs)
 {
-	YMF278BChip* chip = (YMF278BChip *)info;
-	int i;
+	INT32 smplBuf[PCMMIX_BLOCK];
+	const UINT8* romData;
+	UINT32 romEnd;
+	UINT32 eg_cnt;
+	UINT32 tl_int_cnt;
+	UINT8 tl_int_step;
+	INT32 volLeft;
+	INT32 volRight;
+	UINT32 smplOfs;
+	UINT32 blkLen;
 	UINT32 j;
-	INT32 vl;
-	INT32 vr;
 	
-	memset(outputs[0], 0, samples * sizeof(DEV_SMPL));
-	memset(outputs[1], 0, samples * sizeof(DEV_SMPL));
+	// The envelope/TL counters are global, but each slot only depends on their values.
+	// So we can render one slot after another with local copies of the counters.
+	eg_cnt = chip->eg_cnt;
+	tl_int_cnt = chip->tl_int_cnt;
+	tl_int_step = chip->tl_int_step;
 	
-	if (! ymf278b_anyActive(chip))
+	if (sl->state == EG_OFF)
 	{
-		// TODO update internal state, even if muted
-		// TODO also mute individual channels
+		// A slot can't be keyed on during the update, so only the LFO and the TL interpolation run.
+		if (sl->lfo_active)
+			sl->lfo_cnt = (sl->lfo_cnt + lfo_period[sl->lfo] * samples) & (LFO_PERIOD - 1);
+		for (j = 0; j < samples && sl->TL != sl->TLdest; j ++)
+		{
+			tl_int_cnt ++;
+			if (tl_int_cnt >= 9)
+			{
+				tl_int_cnt -= 9;
+				tl_int_step ++;
+				if (tl_int_step >= 3)
+					tl_int_step -= 3;
+			}
+			if (! tl_int_cnt)
+			{
+				if (tl_int_step == 0 && sl->TL < sl->TLdest)
+					sl->TL ++;
+				else if (tl_int_step > 0 && sl->TL > sl->TLdest)
+					sl->TL --;
+			}
+		}
 		return;
 	}
-
-	vl = mix_level[chip->pcm_l];
-	vr = mix_level[chip->pcm_r];
-	for (j = 0; j < samples; j ++)
+	
+	// Samples that lie completely within the ROM (up to 64K samples of 16 bit) are read directly.
+	romEnd = sl->startaddr + 0x20000;
+	romData = (romEnd <= chip->ROMSize && romEnd <= 0x400000) ? &chip->rom[sl->startaddr] : NULL;
+	
+	// Panning is also done separately. (low-volume TL + low-volume panning goes below -60 db)
+	// I'll be taking wild guess and assume that -3 db is approximated with 75%. (same as with TL and envelope levels)
+	// The same applies to the PCM mix level.
+	volLeft  = pan_left [sl->pan] + mix_level[chip->pcm_l];
+	volRight = pan_right[sl->pan] + mix_level[chip->pcm_r];
+	// 0 -> 0x20, 8 -> 0x18, 16 -> 0x10, 24 -> 0x0C, etc. (not using vol_tab here saves array boundary checks)
+	volLeft  = (0x20 - (volLeft  & 0x0F)) >> (volLeft  >> 4);
+	volRight = (0x20 - (volRight & 0x0F)) >> (volRight >> 4);
+	
+	for (smplOfs = 0; smplOfs < samples; smplOfs += blkLen)
 	{
-		for (i = 0; i < 24; i ++)
+		blkLen = samples - smplOfs;
+		if (blkLen > PCMMIX_BLOCK)
+			blkLen = PCMMIX_BLOCK;
+		
+		for (j = 0; j < blkLen; j ++)
 		{
-			YMF278BSlot* sl;
-			INT16 sample;
-			INT32 smplOut;
-			UINT16 envVol;
-			INT32 volLeft;
-			INT32 volRight;
-			UINT32 step;
-			
-			sl = &chip->slots[i];
 			if (sl->state == EG_OFF || sl->Muted)
 			{
-				//outputs[0][j] += 0;
-				//outputs[1][j] += 0;
-				continue;
+				smplBuf[j] = 0;
+			}
+			else
+			{
+				INT16 sample;
+				INT32 smplOut;
+				UINT16 envVol;
+				UINT32 step;
+				
+				if (romData != NULL)
+					sample = (ymf278b_getSampleDirect(romData, sl->bits, sl->pos) * (0x10000 - sl->stepptr) +
+					          ymf278b_getSampleDirect(romData, sl->bits, ymf278b_nextPos(sl, sl->pos, 1)) * sl->stepptr) >> 16;
+				else
+					sample = (ymf278b_getSample(chip, sl, sl->pos) * (0x10000 - sl->stepptr) +
+					          ymf278b_getSample(chip, sl, ymf278b_nextPos(sl, sl->pos, 1)) * sl->stepptr) >> 16;
+				
+				// TL levels are 00..FF internally (TL register value 7F is mapped to TL level FF)
+				// Envelope levels have 4x the resolution (000..3FF)
+				// Volume levels are approximate logarithmic: -6 db result in half volume. Steps in between use linear interpolation.
+				// A volume of -60 db or lower results in silence. (value 0x280..0x3FF).
+				// Recordings from actual hardware indicate, that TL level and envelope level are applied separately.
+				// Each of them is clipped to silence below -60 db, but TL+envelope might result in a lower volume. -Valley Bell
+				envVol = (UINT16)sl->env_vol;
+				if (sl->lfo_active && sl->AM)
+					envVol += ymf278b_slot_compute_am(sl);
+				if (envVol >= MAX_ATT_INDEX)
+					envVol = MAX_ATT_INDEX;
+				smplOut = (sample * vol_tab[envVol]) >> 15;
+				smplOut = (smplOut * vol_tab[sl->TL << TL_SHIFT]) >> 15;
+				smplBuf[j] = (smplOut * 0x5A82) >> 17;	// reduce volume by -15 db, should bring it into balance with FM
+				
+				step = (sl->lfo_active && sl->vib)
+				     ? calcStep(sl->OCT, sl->FN, ymf278b_slot_compute_vib(sl))
+				     : sl->step;
+				sl->stepptr += step;
+				
+				if (sl->stepptr >= 0x10000)
+				{
+					sl->pos = ymf278b_nextPos(sl, sl->pos, sl->stepptr >> 16);
+					sl->stepptr &= 0xFFFF;
+				}
 			}
-
-			sample = (ymf278b_getSample(chip, sl, sl->pos) * (0x10000 - sl->stepptr) +
-			          ymf278b_getSample(chip, sl, ymf278b_nextPos(sl, sl->pos, 1)) * sl->stepptr) >> 16;
-			
-			// TL levels are 00..FF internally (TL register value 7F is mapped to TL level FF)
-			// Envelope levels have 4x the resolution (000..3FF)
-			// Volume levels are approximate logarithmic: -6 db result in half volume. Steps in between use linear interpolation.
-			// A volume of -60 db or lower results in silence. (value 0x280..0x3FF).
-			// Recordings from actual hardware indicate, that TL level and envelope level are applied separately.
-			// Each of them is clipped to silence below -60 db, but TL+envelope might result in a lower volume. -Valley Bell
-			envVol = (UINT16)sl->env_vol;
-			if (sl->lfo_active && sl->AM)
-				envVol += ymf278b_slot_compute_am(sl);
-			if (envVol >= MAX_ATT_INDEX)
-				envVol = MAX_ATT_INDEX;
-			smplOut = (sample * vol_tab[envVol]) >> 15;
-			smplOut = (smplOut * vol_tab[sl->TL << TL_SHIFT]) >> 15;
-
-			// Panning is also done separately. (low-volume TL + low-volume panning goes below -60 db)
-			// I'll be taking wild guess and assume that -3 db is approximated with 75%. (same as with TL and envelope levels)
-			// The same applies to the PCM mix level.
-			volLeft  = pan_left [sl->pan] + vl;
-			volRight = pan_right[sl->pan] + vr;
-			// 0 -> 0x20, 8 -> 0x18, 16 -> 0x10, 24 -> 0x0C, etc. (not using vol_tab here saves array boundary checks)
-			volLeft  = (0x20 - (volLeft  & 0x0F)) >> (volLeft  >> 4);
-			volRight = (0x20 - (volRight & 0x0F)) >> (volRight >> 4);
 			
-			smplOut = (smplOut * 0x5A82) >> 17;	// reduce volume by -15 db, should bring it into balance with FM
-			outputs[0][j] += (smplOut * volLeft ) >> 5;
-			outputs[1][j] += (smplOut * volRight) >> 5;
-
-			step = (sl->lfo_active && sl->vib)
-			     ? calcStep(sl->OCT, sl->FN, ymf278b_slot_compute_vib(sl))
-			     : sl->step;
-			sl->stepptr += step;
-
-			if (sl->stepptr >= 0x10000)
+			tl_int_cnt ++;
+			if (tl_int_cnt >= 9)
 			{
-				sl->pos = ymf278b_nextPos(sl, sl->pos, sl->stepptr >> 16);
-				sl->stepptr &= 0xFFFF;
+				tl_int_cnt -= 9;
+				tl_int_step ++;
+				if (tl_int_step >= 3)
+					tl_int_step -= 3;
 			}
+			eg_cnt ++;
+			ymf278b_slot_advance(sl, eg_cnt, tl_int_cnt, tl_int_step);
 		}
-		ymf278b_advance(chip);
+		
+		if (! sl->Muted)
+			PcmMix_AddStereo(smplBuf, blkLen, volLeft, volRight, 5, &outputs[0][smplOfs], &outputs[1][smplOfs]);
 	}
+	
+	return;
+}
+
+static void ymf278b_pcm_update(void *info, UINT32 samples, DEV_SMPL** outputs)
+{
+	YMF278BChip* chip = (YMF278BChip *)info;
+	int i;
+	UINT32 tl_ticks;
+	
+	memset(outputs[0], 0, samples * sizeof(DEV_SMPL));
+	memset(outputs[1], 0, samples * sizeof(DEV_SMPL));
+	
+	if (! ymf278b_anyActive(chip))
+	{
+		// TODO update internal state, even if muted
+		// TODO also mute individual channels
+		return;
+	}
+	
+	// render slot by slot (the envelope generator still runs for muted/silent slots)
+	for (i = 0; i < 24; i ++)
+		ymf278b_render_slot(chip, &chip->slots[i], samples, outputs);
+	
+	chip->eg_cnt += samples;
+	tl_ticks = chip->tl_int_cnt + samples;
+	chip->tl_int_cnt = tl_ticks % 9;
+	chip->tl_int_step = (UINT8)((chip->tl_int_step + tl_ticks / 9) % 3);
+	
+	return;
 }
 
 INLINE void ymf278b_keyOnHelper(YMF278BChip* chip, YMF278BSlot* slot)
@@ -1499,7 +1588,7 @@ static void device_stop_ymf278b(void *info)
 	YMF278BChip* chip = (YMF278BChip *)info;
 	
 	free(chip->ram);
-	free(chip->rom);
+	rom_free(chip->rom, chip->ROMOwned);
 	free(chip);
 	
 	return;
@@ -1583,7 +1672,7 @@ static void ymf278b_alloc_rom(void* info, UINT32 memsize)
 	if (chip->ROMSize == memsize)
 		return;
 	
-	chip->rom = (UINT8*)realloc(chip->rom, memsize);
+	chip->rom = (UINT8*)rom_realloc(chip->rom, &chip->ROMOwned, memsize);
 	chip->ROMSize = memsize;
 	memset(chip->rom, 0xFF, memsize);
 	
@@ -1607,17 +1696,32 @@ static void ymf278b_alloc_ram(void* info, UINT32 memsize)
 static void ymf278b_write_rom(void *info, UINT32 offset, UINT32 length, const UINT8* data)
 {
 	YMF278BChip *chip = (YMF278BChip *)info;
+	UINT8* rom;
 	
 	if (offset > chip->ROMSize)
 		return;
 	if (offset + length > chip->ROMSize)
 		length = chip->ROMSize - offset;
 	
+	rom = (UINT8*)rom_unshare(chip->rom, &chip->ROMOwned, chip->ROMSize);
+	if (rom == NULL)
+		return;
+	chip->rom = rom;
 	memcpy(chip->rom + offset, data, length);
 	
 	return;
 }
 
+static void ymf278b_attach_rom(void *info, UINT32 length, const UINT8* data)
+{
+	YMF278BChip *chip = (YMF278BChip *)info;
+	
+	chip->rom = (UINT8*)rom_attach(chip->rom, &chip->ROMOwned, data);
+	chip->ROMSize = (data != NULL) ? length : 0x00;
+	
+	return;
+}
+
 static void ymf278b_write_ram(void *info, UINT32 offset, UINT32 length, const UINT8* data)
 {
 	YMF278BChip *chip = (YMF278BChip *)info;
@@ -52,7 +52,9 @@ static UINT8 ymz280b_r(void *info, UINT8 offset);
 static void ymz280b_w(void *info, UINT8 offset, UINT8 data);
 static void ymz280b_alloc_rom(void* info, UINT32 memsize);
 static void ymz280b_write_rom(void *info, UINT32 offset, UINT32 length, const UINT8* data);
+static void ymz280b_attach_rom(void *info, UINT32 length, const UINT8* data);
 
+static void ymz280b_set_options(void *info, UINT32 Flags);
 static void ymz280b_set_mute_mask(void *info, UINT32 MuteMask);
 static void ymz280b_set_log_cb(void *info, DEVCB_LOG func, void* param);
 
@@ -63,6 +65,7 @@ static DEVDEF_RWFUNC devFunc[] =
 	{RWF_REGISTER | RWF_READ, DEVRW_A8D8, 0, ymz280b_r},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, ymz280b_write_rom},
 	{RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, ymz280b_alloc_rom},
+	{RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, ymz280b_attach_rom},
 	{RWF_CHN_MUTE | RWF_WRITE, DEVRW_ALL, 0, ymz280b_set_mute_mask},
 	{0x00, 0x00, 0, NULL}
 };
@@ -75,7 +78,7 @@ static DEV_DEF devDef =
 	device_reset_ymz280b,
 	ymz280b_update,
 	
-	NULL,	// SetOptionBits
+	ymz280b_set_options,	// SetOptionBits
 	ymz280b_set_mute_mask,
 	NULL,	// SetPanning
 	NULL,	// SetSampleRateChangeCallback
@@ -130,6 +133,25 @@ const DEV_DECL sndDev_YMZ280B =
 #define INTERNAL_SAMPLE_RATE    chip->rate
 
 
+#define ADPCM_CACHE_SLOTS   32
+#define ADPCM_CACHE_MAXLEN  0x100000    /* maximum length of a decoded phrase, in nibbles */
+#define ADPCM_CACHE_MAX     0x2000000   /* maximum memory used by decoded phrases, in bytes */
+#define ADPCM_CACHE_BLOCK   0x1000      /* initial buffer size of a phrase, in nibbles */
+
+
+/* ADPCM phrase decoded from the start address, see OPT_YMZ280B_ADPCM_CACHE */
+struct YMZ280BPhrase
+{
+	UINT32 start;           /* start address, in nibbles */
+	UINT32 stop;            /* stop address, in nibbles */
+	UINT32 length;          /* maximum number of decoded nibbles */
+	UINT32 decoded;         /* number of nibbles decoded so far */
+	UINT32 alloc;           /* number of nibbles the buffers can hold */
+	UINT32 last_use;        /* value of cache_clock when the phrase was last started */
+	INT16 *signal;          /* ADPCM signal after each nibble */
+	INT16 *step;            /* ADPCM step after each nibble */
+};
+
 /* struct describing a single playing ADPCM voice */
 struct YMZ280BVoice
 {
@@ -164,6 +186,8 @@ struct YMZ280BVoice
 	INT16 curr_sample;      /* current sample target */
 	UINT8 irq_schedule;     /* 1 if the IRQ state is updated by timer */
 	UINT8 Muted;            /* used for muting */
+
+	struct YMZ280BPhrase *phrase;   /* decoded ADPCM data (NULL = decode from memory) */
 };
 
 typedef struct _ymz280b_state ymz280b_state;
@@ -195,8 +219,14 @@ struct _ymz280b_state
 	double rate;
 	
 	UINT8 *mem_base;                /* pointer to the base of the region */
+	UINT8 mem_owned;                /* 0 = memory is attached (owned by the caller) */
 	UINT32 mem_size;
 	INT16 *scratch; // not having to use scratch memory would be nice, but it's required for resampling
+	
+	UINT8 cache_enable;
+	UINT32 cache_clock;             /* incremented for each started phrase, for replacing the least recently used one */
+	UINT32 cache_size;
+	struct YMZ280BPhrase phrases[ADPCM_CACHE_SLOTS];
 };
 
 static void write_to_register(ymz280b_state *chip, UINT8 data);
@@ -330,12 +360,32 @@ static void compute_tables(void)
 
 ***********************************************************************************************/
 
+INLINE void decode_adpcm(ymz280b_state *chip, UINT32 position, INT32 *signal, INT32 *step)
+{
+	UINT8 val = ymz280b_read_memory(chip, position / 2) >> ((~position & 1) << 2);
+
+	*signal = (*signal * 254) / 256;
+	*signal += (*step * diff_lookup[val & 15]) / 8;
+
+	/* clamp to the maximum */
+	if (*signal > 32767)
+		*signal = 32767;
+	else if (*signal < -32768)
+		*signal = -32768;
+
+	/* adjust the step size and clamp */
+	*step = (*step * index_scale[val & 7]) >> 8;
+	if (*step > 0x6000)
+		*step = 0x6000;
+	else if (*step < 0x7f)
+		*step = 0x7f;
+}
+
 static int generate_adpcm(ymz280b_state *chip, struct YMZ280BVoice *voice, INT16 *buffer, UINT32 samples)
 {
 	UINT32 position = voice->position;
 	INT32 signal = voice->signal;
 	INT32 step = voice->step;
-	UINT8 val;
 
 	/* two cases: first cases is non-looping */
 	if (!voice->looping)
@@ -344,22 +394,7 @@ static int generate_adpcm(ymz280b_state *chip, struct YMZ280BVoice *voice, INT16
 		while (samples)
 		{
 			/* compute the new amplitude and update the current step */
-			val = ymz280b_read_memory(chip, position / 2) >> ((~position & 1) << 2);
-			signal = (signal * 254) / 256;
-			signal += (step * diff_lookup[val & 15]) / 8;
-
-			/* clamp to the maximum */
-			if (signal > 32767)
-				signal = 32767;
-			else if (signal < -32768)
-				signal = -32768;
-
-			/* adjust the step size and clamp */
-			step = (step * index_scale[val & 7]) >> 8;
-			if (step > 0x6000)
-				step = 0x6000;
-			else if (step < 0x7f)
-				step = 0x7f;
+			decode_adpcm(chip, position, &signal, &step);
 
 			/* output to the buffer, scaling by the volume */
 			*buffer++ = signal;
@@ -382,22 +417,7 @@ static int generate_adpcm(ymz280b_state *chip, struct YMZ280BVoice *voice, INT16
 		while (samples)
 		{
 			/* compute the new amplitude and update the current step */
-			val = ymz280b_read_memory(chip, position / 2) >> ((~position & 1) << 2);
-			signal = (signal * 254) / 256;
-			signal += (step * diff_lookup[val & 15]) / 8;
-
-			/* clamp to the maximum */
-			if (signal > 32767)
-				signal = 32767;
-			else if (signal < -32768)
-				signal = -32768;
-
-			/* adjust the step size and clamp */
-			step = (step * index_scale[val & 7]) >> 8;
-			if (step > 0x6000)
-				step = 0x6000;
-			else if (step < 0x7f)
-				step = 0x7f;
+			decode_adpcm(chip, position, &signal, &step);
 
 			/* output to the buffer, scaling by the volume */
 			*buffer++ = signal;
@@ -438,6 +458,278 @@ static int generate_adpcm(ymz280b_state *chip, struct YMZ280BVoice *voice, INT16
 
 
 
+/**********************************************************************************************
+
+     ADPCM phrase cache -- decodes each phrase once and plays it back from the decoded data
+
+***********************************************************************************************/
+
+/* The decoded data holds the ADPCM state after each nibble, when starting from the start address.
+   A voice uses it as long as its own state matches the decoded one. This covers loops as well,
+   as the loop start state is recorded during the first pass. In all other cases
+   (changed addresses, loop start before the start address, ...) the voice decodes from memory.
+   Phrases are decoded while they are played, so voices that are keyed off early
+   don't waste time on decoding the rest of the phrase.
+   Memory writes discard the phrases that read from the written range. */
+
+INLINE UINT8 phrase_in_sync(const struct YMZ280BPhrase *phrase, UINT32 position, INT32 signal, INT32 step)
+{
+	UINT32 idx = position - phrase->start;
+
+	if (position < phrase->start || idx >= phrase->length || idx > phrase->decoded)
+		return 0;
+	if (idx == 0)
+		return (signal == 0 && step == 0x7f);
+	return (signal == phrase->signal[idx - 1] && step == phrase->step[idx - 1]);
+}
+
+static void phrase_free(ymz280b_state *chip, struct YMZ280BPhrase *phrase)
+{
+	int i;
+
+	if (phrase->signal == NULL)
+		return;
+
+	for (i = 0; i < 8; i++)
+	{
+		if (chip->voice[i].phrase == phrase)
+			chip->voice[i].phrase = NULL;
+	}
+	chip->cache_size -= phrase->alloc * 2 * sizeof(INT16);
+	free(phrase->signal);	phrase->signal = NULL;
+	free(phrase->step);	phrase->step = NULL;
+	phrase->alloc = 0;
+}
+
+static void phrase_cache_flush(ymz280b_state *chip)
+{
+	int i;
+
+	for (i = 0; i < ADPCM_CACHE_SLOTS; i++)
+		phrase_free(chip, &chip->phrases[i]);
+}
+
+/* discard all phrases that read from the memory range [start, end) (in bytes) */
+static void phrase_cache_invalidate(ymz280b_state *chip, UINT32 start, UINT32 end)
+{
+	struct YMZ280BPhrase *phrase;
+	UINT32 first, last;
+	int i;
+
+	for (i = 0; i < ADPCM_CACHE_SLOTS; i++)
+	{
+		phrase = &chip->phrases[i];
+		if (phrase->signal == NULL || phrase->decoded == 0)
+			continue;
+		/* ymz280b_read_memory wraps the address at 24 bits */
+		first = (phrase->start / 2) & 0xFFFFFF;
+		last = ((phrase->start + phrase->decoded - 1) / 2) & 0xFFFFFF;
+		if (first <= last ? (first < end && last >= start) : (first < end || last >= start))
+			phrase_free(chip, phrase);
+	}
+}
+
+/* free the least recently used phrases until 'size' more bytes fit into the cache */
+static UINT8 phrase_make_room(ymz280b_state *chip, UINT32 size, const struct YMZ280BPhrase *keep)
+{
+	struct YMZ280BPhrase *oldest;
+	struct YMZ280BPhrase *phrase;
+	int i;
+
+	while (chip->cache_size + size > ADPCM_CACHE_MAX)
+	{
+		oldest = NULL;
+		for (i = 0; i < ADPCM_CACHE_SLOTS; i++)
+		{
+			phrase = &chip->phrases[i];
+			if (phrase->signal == NULL || phrase == keep)
+				continue;
+			if (oldest == NULL || (INT32)(phrase->last_use - oldest->last_use) < 0)
+				oldest = phrase;
+		}
+		if (oldest == NULL)
+			return 0;
+		phrase_free(chip, oldest);
+	}
+	return 1;
+}
+
+/* grow the buffers of a phrase to hold at least 'length' nibbles */
+static UINT8 phrase_grow(ymz280b_state *chip, struct YMZ280BPhrase *phrase, UINT32 length)
+{
+	UINT32 alloc;
+	INT16 *buf;
+
+	alloc = phrase->alloc ? phrase->alloc : ADPCM_CACHE_BLOCK;
+	while (alloc < length)
+		alloc *= 2;
+	if (alloc > phrase->length)
+		alloc = phrase->length;
+	if (! phrase_make_room(chip, (alloc - phrase->alloc) * 2 * sizeof(INT16), phrase))
+		return 0;
+
+	buf = (INT16*)realloc(phrase->signal, alloc * sizeof(INT16));
+	if (buf == NULL)
+		return 0;
+	phrase->signal = buf;
+	buf = (INT16*)realloc(phrase->step, alloc * sizeof(INT16));
+	if (buf == NULL)
+		return 0;
+	phrase->step = buf;
+	chip->cache_size += (alloc - phrase->alloc) * 2 * sizeof(INT16);
+	phrase->alloc = alloc;
+	return 1;
+}
+
+/* make sure that the first 'length' nibbles of the phrase are decoded */
+static UINT8 phrase_decode(ymz280b_state *chip, struct YMZ280BPhrase *phrase, UINT32 length)
+{
+	UINT32 i;
+	INT32 signal;
+	INT32 step;
+
+	if (length > phrase->length)
+		length = phrase->length;
+	if (length <= phrase->decoded)
+		return 1;
+	if (length > phrase->alloc && ! phrase_grow(chip, phrase, length))
+		return 0;
+
+	i = phrase->decoded;
+	signal = i ? phrase->signal[i - 1] : 0;
+	step = i ? phrase->step[i - 1] : 0x7f;
+	for (; i < length; i++)
+	{
+		decode_adpcm(chip, phrase->start + i, &signal, &step);
+		phrase->signal[i] = (INT16)signal;
+		phrase->step[i] = (INT16)step;
+	}
+	phrase->decoded = length;
+	return 1;
+}
+
+static struct YMZ280BPhrase *phrase_get(ymz280b_state *chip, UINT32 start, UINT32 stop)
+{
+	struct YMZ280BPhrase *phrase;
+	struct YMZ280BPhrase *oldest;
+	UINT32 i;
+
+	if (stop <= start)
+		return NULL;
+
+	chip->cache_clock++;
+	oldest = NULL;
+	for (i = 0; i < ADPCM_CACHE_SLOTS; i++)
+	{
+		phrase = &chip->phrases[i];
+		if (phrase->signal == NULL)
+		{
+			if (oldest == NULL || oldest->signal != NULL)
+				oldest = phrase;    /* prefer unused slots */
+			continue;
+		}
+		if (phrase->start == start && phrase->stop == stop)
+		{
+			phrase->last_use = chip->cache_clock;
+			return phrase;
+		}
+		if (oldest == NULL || (oldest->signal != NULL && (INT32)(phrase->last_use - oldest->last_use) < 0))
+			oldest = phrase;
+	}
+
+	/* replace the least recently used phrase */
+	phrase = oldest;
+	phrase_free(chip, phrase);
+	phrase->start = start;
+	phrase->stop = stop;
+	phrase->length = stop - start;
+	if (phrase->length > ADPCM_CACHE_MAXLEN)
+		phrase->length = ADPCM_CACHE_MAXLEN;
+	phrase->decoded = 0;
+	phrase->last_use = chip->cache_clock;
+	if (! phrase_grow(chip, phrase, 1))
+	{
+		free(phrase->signal);	phrase->signal = NULL;
+		free(phrase->step);	phrase->step = NULL;
+		phrase->alloc = 0;
+		return NULL;
+	}
+
+	return phrase;
+}
+
+static int generate_adpcm_cached(ymz280b_state *chip, struct YMZ280BVoice *voice, INT16 *buffer, UINT32 samples)
+{
+	struct YMZ280BPhrase *phrase = voice->phrase;
+	UINT32 position = voice->position;
+	INT32 signal = voice->signal;
+	INT32 step = voice->step;
+	UINT8 sync = phrase_in_sync(phrase, position, signal, step);
+
+	/* loop while we still have samples to generate */
+	while (samples)
+	{
+		if (sync)
+		{
+			UINT32 idx = position - phrase->start;
+			/* decode the data needed for this call when reaching the end of the decoded part */
+			if (idx >= phrase->decoded && ! phrase_decode(chip, phrase, idx + samples))
+				sync = 0;
+		}
+		if (sync)
+		{
+			UINT32 idx = position - phrase->start;
+			signal = phrase->signal[idx];
+			step = phrase->step[idx];
+			sync = (idx + 1 < phrase->length);
+		}
+		else
+		{
+			decode_adpcm(chip, position, &signal, &step);
+		}
+
+		/* output to the buffer, scaling by the volume */
+		*buffer++ = signal;
+		samples--;
+
+		/* next! */
+		position++;
+		if (voice->looping)
+		{
+			if (position == voice->loop_start && voice->loop_count == 0)
+			{
+				voice->loop_signal = signal;
+				voice->loop_step = step;
+			}
+			if (position >= voice->loop_end)
+			{
+				if (voice->keyon)
+				{
+					position = voice->loop_start;
+					signal = voice->loop_signal;
+					step = voice->loop_step;
+					voice->loop_count++;
+					sync = phrase_in_sync(phrase, position, signal, step);
+				}
+			}
+		}
+		if (position >= voice->stop)
+		{
+			voice->ended = 1;
+			break;
+		}
+	}
+
+	/* update the parameters */
+	voice->position = position;
+	voice->signal = signal;
+	voice->step = step;
+
+	return samples;
+}
+
+
+
 /**********************************************************************************************
 
      generate_pcm8 -- general 8-bit PCM decoding routine
@@ -652,7 +944,12 @@ static void ymz280b_update(void *param, UINT32 samples, DEV_SMPL **outputs)
 		/* generate them into our buffer */
 		switch (voice->playing << 7 | voice->mode)
 		{
-			case 0x81:  samples_left = generate_adpcm(chip, voice, chip->scratch, new_samples); break;
+			case 0x81:
+				if (voice->phrase != NULL)
+					samples_left = generate_adpcm_cached(chip, voice, chip->scratch, new_samples);
+				else
+					samples_left = generate_adpcm(chip, voice, chip->scratch, new_samples);
+				break;
 			case 0x82:  samples_left = generate_pcm8(chip, voice, chip->scratch, new_samples); break;
 			case 0x83:  samples_left = generate_pcm16(chip, voice, chip->scratch, new_samples); break;
 			default:    samples_left = 0; memset(chip->scratch, 0, new_samples * sizeof(chip->scratch[0])); break;
@@ -771,7 +1068,8 @@ static UINT8 device_start_ymz280b(const DEV_GEN_CFG* cfg, DEV_INFO* retDevInf)
 static void device_stop_ymz280b(void *info)
 {
 	ymz280b_state *chip = (ymz280b_state *)info;
-	free(chip->mem_base);
+	phrase_cache_flush(chip);
+	rom_free(chip->mem_base, chip->mem_owned);
 	free(chip->scratch);
 	free(chip);
 	
@@ -846,6 +1144,8 @@ static void write_to_register(ymz280b_state *chip, UINT8 data)
 					voice->signal = voice->loop_signal = 0;
 					voice->step = voice->loop_step = 0x7f;
 					voice->loop_count = 0;
+					voice->phrase = (chip->cache_enable && voice->mode == 1) ?
+						phrase_get(chip, voice->start, voice->stop) : NULL;
 
 					/* if update_irq_state_timer is set, cancel it. */
 					voice->irq_schedule = 0;
@@ -1068,7 +1368,8 @@ static void ymz280b_alloc_rom(void* info, UINT32 memsize)
 	if (chip->mem_size == memsize)
 		return;
 	
-	chip->mem_base = (UINT8*)realloc(chip->mem_base, memsize);
+	phrase_cache_flush(chip);
+	chip->mem_base = (UINT8*)rom_realloc(chip->mem_base, &chip->mem_owned, memsize);
 	chip->mem_size = memsize;
 	memset(chip->mem_base, 0xFF, memsize);
 	
@@ -1078,17 +1379,46 @@ static void ymz280b_alloc_rom(void* info, UINT32 memsize)
 static void ymz280b_write_rom(void *info, UINT32 offset, UINT32 length, const UINT8* data)
 {
 	ymz280b_state *chip = (ymz280b_state *)info;
+	UINT8* rom;
 	
 	if (offset > chip->mem_size)
 		return;
 	if (offset + length > chip->mem_size)
 		length = chip->mem_size - offset;
 	
+	phrase_cache_invalidate(chip, offset, offset + length);
+	rom = (UINT8*)rom_unshare(chip->mem_base, &chip->mem_owned, chip->mem_size);
+	if (rom == NULL)
+		return;
+	chip->mem_base = rom;
 	memcpy(chip->mem_base + offset, data, length);
 	
 	return;
 }
 
+static void ymz280b_attach_rom(void *info, UINT32 length, const UINT8* data)
+{
+	ymz280b_state *chip = (ymz280b_state *)info;
+	
+	if (data != chip->mem_base || length != chip->mem_size)
+		phrase_cache_flush(chip);
+	chip->mem_base = (UINT8*)rom_attach(chip->mem_base, &chip->mem_owned, data);
+	chip->mem_size = (data != NULL) ? length : 0x00;
+	
+	return;
+}
+
+
+static void ymz280b_set_options(void *info, UINT32 Flags)
+{
+	ymz280b_state *chip = (ymz280b_state *)info;
+	
+	chip->cache_enable = (Flags & OPT_YMZ280B_ADPCM_CACHE) ? 1 : 0;
+	if (! chip->cache_enable)
+		phrase_cache_flush(chip);
+	
+	return;
+}
 
 static void ymz280b_set_mute_mask(void *info, UINT32 MuteMask)
 {
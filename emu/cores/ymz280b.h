@@ -3,6 +3,8 @@
 
 #include "../EmuStructs.h"
 
+#define OPT_YMZ280B_ADPCM_CACHE	0x01	// decode each ADPCM phrase once and play it from memory (default: disabled)
+
 extern const DEV_DECL sndDev_YMZ280B;
 
 #endif	// __YMZ280B_H__
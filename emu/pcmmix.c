@@ -0,0 +1,85 @@
+/*
+	pcmmix.c - shared voice mixing for sample playback chips
+	The gain stage works on plain arrays without branches, so the loops can be
+	auto-vectorized by the compiler.
+*/
+
+#include "../stdtype.h"
+#include "snddef.h"
+#include "pcmmix.h"
+
+
+const INT16 PcmMix_DPCM4Table[16] =
+{
+	0 * 0x100,   1 * 0x100,   2 * 0x100,   4 * 0x100,  8 * 0x100, 16 * 0x100, 32 * 0x100, 64 * 0x100,
+	0 * 0x100, -64 * 0x100, -32 * 0x100, -16 * 0x100, -8 * 0x100, -4 * 0x100, -2 * 0x100, -1 * 0x100
+};
+
+void PcmMix_GenerateMuLaw(INT16 table[256])
+{
+	INT32 val;
+	UINT32 curIdx;
+
+	val = 0;
+	for (curIdx = 0; curIdx < 128; curIdx ++)
+	{
+		table[curIdx] = (INT16)(val << 5);
+		if (curIdx < 16)
+			val += 1;
+		else if (curIdx < 24)
+			val += 2;
+		else if (curIdx < 48)
+			val += 4;
+		else if (curIdx < 100)
+			val += 8;
+		else
+			val += 16;
+	}
+	for (curIdx = 128; curIdx < 256; curIdx ++)
+		table[curIdx] = (~table[curIdx - 128]) & ~0x1F;
+
+	return;
+}
+
+void PcmMix_AddMono(const INT32* smpl, UINT32 count, INT32 vol, UINT8 shift, DEV_SMPL* out)
+{
+	UINT32 curSmpl;
+
+	for (curSmpl = 0; curSmpl < count; curSmpl ++)
+		out[curSmpl] += (smpl[curSmpl] * vol) >> shift;
+
+	return;
+}
+
+void PcmMix_AddStereo(const INT32* smpl, UINT32 count, INT32 volL, INT32 volR, UINT8 shift,
+						DEV_SMPL* outL, DEV_SMPL* outR)
+{
+	UINT32 curSmpl;
+
+	for (curSmpl = 0; curSmpl < count; curSmpl ++)
+	{
+		outL[curSmpl] += (smpl[curSmpl] * volL) >> shift;
+		outR[curSmpl] += (smpl[curSmpl] * volR) >> shift;
+	}
+
+	return;
+}
+
+void PcmMix_AddStereoTrunc(const INT32* smpl, UINT32 count, INT32 volL, INT32 volR, UINT8 shift,
+							DEV_SMPL* outL, DEV_SMPL* outR)
+{
+	INT32 bias = (1 << shift) - 1;
+	UINT32 curSmpl;
+
+	// Adding (2^shift - 1) to negative values before the arithmetic shift rounds towards zero.
+	// This matches a division by 2^shift, but avoids the division in the loop.
+	for (curSmpl = 0; curSmpl < count; curSmpl ++)
+	{
+		INT32 l = smpl[curSmpl] * volL;
+		INT32 r = smpl[curSmpl] * volR;
+		outL[curSmpl] += (l + ((l >> 31) & bias)) >> shift;
+		outR[curSmpl] += (r + ((r >> 31) & bias)) >> shift;
+	}
+
+	return;
+}
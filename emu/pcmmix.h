@@ -0,0 +1,89 @@
+#ifndef __EMU_PCMMIX_H__
+#define __EMU_PCMMIX_H__
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "../stdtype.h"
+#include "../common_def.h"	// for INLINE
+#include "snddef.h"
+
+// Shared voice mixing for sample playback chips
+// Cores render a voice in two stages: First they fetch and decode a block of samples into
+// an INT32 buffer, following their own addressing, looping and end-of-sample rules.
+// Then one of the PcmMix_Add* functions applies the voice's gain and accumulates the block
+// into the output. The gain stage has no branches or chip-specific state, so compilers can
+// vectorize it.
+
+#define PCMMIX_BLOCK	256	// recommended maximum number of samples per fetch buffer
+
+// --- sample decoders ---
+INLINE INT32 PcmMix_DecodeU8(UINT8 data)
+{
+	return (INT32)data - 0x80;
+}
+
+// sign-magnitude, bit 7 set = positive (Ricoh RF5C68)
+INLINE INT32 PcmMix_DecodeSM8(UINT8 data)
+{
+	return (data & 0x80) ? (data & 0x7F) : -(INT32)data;
+}
+
+// 4-bit DPCM with a fixed delta table and clamping to 16 bits (Konami K054539)
+extern const INT16 PcmMix_DPCM4Table[16];
+INLINE INT32 PcmMix_DecodeDPCM4(INT32 prev, UINT8 nibble)
+{
+	INT32 val = prev + PcmMix_DPCM4Table[nibble & 0x0F];
+	if (val < -0x8000)
+		val = -0x8000;
+	else if (val > 0x7FFF)
+		val = 0x7FFF;
+	return val;
+}
+
+// 8-bit mu-law expansion table (Namco C352 format)
+void PcmMix_GenerateMuLaw(INT16 table[256]);
+
+// --- position helpers ---
+// number of steps of size 'step' needed to get from 'pos' to 'target' or beyond
+// returns 0 when pos >= target, 0xFFFFFFFF when the target is never reached
+INLINE UINT32 PcmMix_StepsUntil(UINT32 pos, UINT32 step, UINT32 target)
+{
+	if (pos >= target)
+		return 0;
+	if (! step)
+		return 0xFFFFFFFF;
+	return (UINT32)(((UINT64)target - pos + step - 1) / step);
+}
+
+// fetch 'count' unsigned/signed 8-bit samples from a linear position with 'fracBits' fraction bits
+// The position is advanced by 'step' after each sample. No loop/end handling is done.
+INLINE UINT32 PcmMix_Fetch8(INT32* dst, UINT32 count, const UINT8* data, UINT32 mask,
+							UINT32 pos, UINT32 step, UINT8 fracBits, UINT8 xorVal)
+{
+	UINT32 curSmpl;
+
+	for (curSmpl = 0; curSmpl < count; curSmpl ++)
+	{
+		dst[curSmpl] = (INT8)(data[(pos >> fracBits) & mask] ^ xorVal);
+		pos += step;
+	}
+	return pos;
+}
+
+// --- gain stage ---
+// out += (smpl * vol) >> shift
+void PcmMix_AddMono(const INT32* smpl, UINT32 count, INT32 vol, UINT8 shift, DEV_SMPL* out);
+void PcmMix_AddStereo(const INT32* smpl, UINT32 count, INT32 volL, INT32 volR, UINT8 shift,
+						DEV_SMPL* outL, DEV_SMPL* outR);
+// out += (smpl * vol) / (1 << shift), i.e. the scaled sample is rounded towards zero
+void PcmMix_AddStereoTrunc(const INT32* smpl, UINT32 count, INT32 volL, INT32 volR, UINT8 shift,
+							DEV_SMPL* outL, DEV_SMPL* outR);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// __EMU_PCMMIX_H__
@@ -4,6 +4,8 @@
 #include <math.h>	// for pow()
 #include <vector>
 #include <string>
+#include <memory>
+#include <mutex>
 
 #define INLINE	static inline
 
@@ -1535,6 +1537,7 @@ void VGMPlayer::InitDevices(void)
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_REGISTER | RWF_WRITE, DEVRW_A8D8, 0, (void**)&chipDev.write8);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0x524F, (void**)&chipDev.romSize);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0x524F, (void**)&chipDev.romWrite);
+			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0x524F, (void**)&chipDev.romAttach);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0x5241, (void**)&chipDev.romSizeB);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0x5241, (void**)&chipDev.romWriteB);
 			if (_opl4YRW801Req & (1 << chipID))
@@ -1554,6 +1557,7 @@ void VGMPlayer::InitDevices(void)
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_REGISTER | RWF_WRITE, DEVRW_A8D16, 0, (void**)&chipDev.writeD16);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, (void**)&chipDev.romSize);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, (void**)&chipDev.romWrite);
+			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, (void**)&chipDev.romAttach);
 			break;
 		case DEVID_C352:
 			retVal = SndEmu_Start2(chipType, devCfg, devInf, _userDevList, _devStartOpts);
@@ -1562,6 +1566,7 @@ void VGMPlayer::InitDevices(void)
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_REGISTER | RWF_WRITE, DEVRW_A16D16, 0, (void**)&chipDev.writeM16);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, (void**)&chipDev.romSize);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, (void**)&chipDev.romWrite);
+			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, (void**)&chipDev.romAttach);
 			break;
 		case DEVID_QSOUND:
 			chipDev.flags = 0x00;
@@ -1579,6 +1584,7 @@ void VGMPlayer::InitDevices(void)
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_REGISTER | RWF_QUICKWRITE, DEVRW_A8D16, 0, (void**)&chipDev.writeD16);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, (void**)&chipDev.romSize);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, (void**)&chipDev.romWrite);
+			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, (void**)&chipDev.romAttach);
 			
 			memset(&_qsWork[chipID], 0x00, sizeof(QSOUND_WORK));
 			if (devInf->devDef->coreID == FCC_MAME)
@@ -1643,6 +1649,7 @@ void VGMPlayer::InitDevices(void)
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_REGISTER | RWF_WRITE, DEVRW_A16D8, 0, (void**)&chipDev.writeM8);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_MEMSIZE, 0, (void**)&chipDev.romSize);
 			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_BLOCK, 0, (void**)&chipDev.romWrite);
+			SndEmu_GetDeviceFunc(devInf->devDef, RWF_MEMORY | RWF_WRITE, DEVRW_ATTACH, 0, (void**)&chipDev.romAttach);
 			break;
 		}
 		if (retVal)
@@ -1687,7 +1694,7 @@ void VGMPlayer::InitDevices(void)
 			VGM_BASEDEV* clDev = chipDev.base.linkDev;
 			size_t optID = DeviceID2OptionID(PLR_DEV_ID(DEVID_AY8910, chipID));
 			if (optID != (size_t)-1 && clDev != NULL && clDev->defInf.devDef->SetOptionBits != NULL)
-				clDev->defInf.devDef->SetOptionBits(devInf->dataPtr, _devOpts[optID].coreOpts);
+				clDev->defInf.devDef->SetOptionBits(clDev->defInf.dataPtr, _devOpts[optID].coreOpts);
 		}
 
 		_vdDevMap[sdCfg.vgmChipType][chipID] = _devices.size();
@@ -1892,6 +1899,11 @@ void VGMPlayer::ParseFileForOPL4ROMRequirement(void)
 	return;
 }
 
+// The YRW801 ROM is 2 MB large and read-only, so one copy is shared by all players in the process.
+// It is released when the last player that uses it is destroyed.
+static std::mutex yrwCacheMtx;
+static std::weak_ptr<const std::vector<UINT8> > yrwCache;
+
 void VGMPlayer::LoadOPL4ROM(CHIP_DEVICE* chipDev)
 {
 	static const char* romFile = "yrw801.rom";
@@ -1900,7 +1912,12 @@ void VGMPlayer::LoadOPL4ROM(CHIP_DEVICE* chipDev)
 		return;
 	emu_logf(&_logger, PLRLOG_DEBUG, "OPL4 requires external sample ROM %s.\n", romFile);
 	
-	if (_yrwRom.empty())
+	if (_yrwRom == NULL)
+	{
+		std::lock_guard<std::mutex> lock(yrwCacheMtx);
+		_yrwRom = yrwCache.lock();
+	}
+	if (_yrwRom == NULL)
 	{
 		if (_fileReqCbFunc == NULL)
 		{
@@ -1918,18 +1935,34 @@ void VGMPlayer::LoadOPL4ROM(CHIP_DEVICE* chipDev)
 		UINT32 yrwSize = DataLoader_GetSize(romDLoad);
 		const UINT8* yrwData = DataLoader_GetData(romDLoad);
 		if (yrwSize > 0 && yrwData != NULL)
-			_yrwRom.assign(yrwData, yrwData + yrwSize);
+		{
+			auto romData = std::make_shared<const std::vector<UINT8> >(yrwData, yrwData + yrwSize);
+			std::lock_guard<std::mutex> lock(yrwCacheMtx);
+			_yrwRom = yrwCache.lock();	// another player may have loaded it in the meantime
+			if (_yrwRom == NULL)
+			{
+				_yrwRom = romData;
+				yrwCache = romData;
+			}
+		}
 		DataLoader_Deinit(romDLoad);
 	}
-	if (_yrwRom.empty())
+	if (_yrwRom == NULL)
 	{
 		emu_logf(&_logger, PLRLOG_WARN, "Couldn't load %s.\n", romFile);
 		return;
 	}
 	
+	const std::vector<UINT8>& yrwRom = *_yrwRom;
+	if (chipDev->romAttach != NULL)
+	{
+		// all OPL4 instances reference the shared ROM data (the chip never writes to it)
+		chipDev->romAttach(chipDev->base.defInf.dataPtr, (UINT32)yrwRom.size(), yrwRom.data());
+		return;
+	}
 	if (chipDev->romSize != NULL)
-		chipDev->romSize(chipDev->base.defInf.dataPtr, (UINT32)_yrwRom.size());
-	chipDev->romWrite(chipDev->base.defInf.dataPtr, 0x00, (UINT32)_yrwRom.size(), &_yrwRom[0]);
+		chipDev->romSize(chipDev->base.defInf.dataPtr, (UINT32)yrwRom.size());
+	chipDev->romWrite(chipDev->base.defInf.dataPtr, 0x00, (UINT32)yrwRom.size(), yrwRom.data());
 	
 	return;
 }
@@ -12,6 +12,7 @@
 #include "dblk_compr.h"
 #include <vector>
 #include <string>
+#include <memory>
 
 
 #define FCC_VGM 	0x56474D00
@@ -73,6 +74,7 @@ public:
 		DEVFUNC_WRITE_A16D16 writeM16;	// write 16-bit data to 16-bit register/offset
 		DEVFUNC_WRITE_MEMSIZE romSize;
 		DEVFUNC_WRITE_BLOCK romWrite;
+		DEVFUNC_ATTACH_BLOCK romAttach;	// reference ROM data without copying it
 		DEVFUNC_WRITE_MEMSIZE romSizeB;
 		DEVFUNC_WRITE_BLOCK romWriteB;
 		DEVLOG_CB_DATA logCbData;
@@ -279,7 +281,7 @@ protected:
 	DEV_LOGGER _logger;
 	DATA_LOADER *_dLoad;
 	const UINT8* _fileData;	// data pointer for quick access, equals _dLoad->GetFileData().data()
-	std::vector<UINT8> _yrwRom;	// cache for OPL4 sample ROM (yrw801.rom)
+	std::shared_ptr<const std::vector<UINT8> > _yrwRom;	// OPL4 sample ROM (yrw801.rom), shared by all players
 	UINT8 _shownCmdWarnings[0x100];
 	
 	enum
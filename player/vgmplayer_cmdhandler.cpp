@@ -643,10 +643,17 @@ INLINE void SendYMCommand(VGMPlayer::CHIP_DEVICE* cDev, UINT8 port, UINT8 reg, U
 }
 
 static void WriteChipROM(VGMPlayer::CHIP_DEVICE* cDev, UINT8 memID,
-						 UINT32 memSize, UINT32 dataOfs, UINT32 dataLen, const UINT8* data)
+						 UINT32 memSize, UINT32 dataOfs, UINT32 dataLen, const UINT8* data, bool fileData)
 {
 	if (memID == 0)
 	{
+		if (cDev->romAttach != NULL && fileData && dataOfs == 0x00 && dataLen == memSize)
+		{
+			// The data block contains the whole ROM. Let the chip reference the file data directly.
+			// (The file data stays valid until the devices are stopped.)
+			cDev->romAttach(cDev->base.defInf.dataPtr, memSize, data);
+			return;
+		}
 		if (cDev->romSize != NULL)
 			cDev->romSize(cDev->base.defInf.dataPtr, memSize);
 		if (cDev->romWrite != NULL && dataLen)
@@ -769,11 +776,11 @@ void VGMPlayer::Cmd_DataBlock(void)
 				swpData[curPos + 0x00] = dataPtr[curPos + 0x01];
 				swpData[curPos + 0x01] = dataPtr[curPos + 0x00];
 			}
-			WriteChipROM(cDev, _VGM_ROM_CHIPS[dblkType & 0x3F][1], memSize, dataOfs, dataLen, &swpData[0x00]);
+			WriteChipROM(cDev, _VGM_ROM_CHIPS[dblkType & 0x3F][1], memSize, dataOfs, dataLen, &swpData[0x00], false);
 		}
 		else
 		{
-			WriteChipROM(cDev, _VGM_ROM_CHIPS[dblkType & 0x3F][1], memSize, dataOfs, dataLen, dataPtr);
+			WriteChipROM(cDev, _VGM_ROM_CHIPS[dblkType & 0x3F][1], memSize, dataOfs, dataLen, dataPtr, true);
 		}
 		break;
 	case 0xC0:	// RAM Write